@@ -0,0 +1,136 @@
+#include "Benchmark.hpp"
+
+#include <M3D/AABB.hpp>
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const AABB a(Vector3(0.0f, 0.0f, 0.0f), Vector3(2.0f, 2.0f, 2.0f));
+	const AABB b(Vector3(1.0f, -1.0f, 1.5f), Vector3(3.0f, 1.0f, 4.0f));
+	const Affine3 A(Quaternion::euler(Vector3(0.1f, 0.2f, 0.3f)), Vector3(1.0f, -2.0f, 0.5f), 1.5f);
+
+	// Number of points bounded by each iteration of the batch benchmarks.
+	const std::size_t batchSize = 1024;
+
+	/**
+	 * Returns the points bounded by the batch benchmarks.
+	 */
+	std::vector<Vector3> cloud()
+	{
+		std::vector<Vector3> points;
+		for (std::size_t i = 0; i < batchSize; ++i)
+		{
+			const float f = static_cast<float>(i);
+			points.push_back(Vector3(std::sin(1.3f * f) * f, std::cos(0.7f * f) * f, 5.0f - 0.5f * f));
+		}
+
+		return points;
+	}
+}
+
+BENCHMARK(AABB, Merge)
+{
+	repeat(iterations, [](const AABB& x, const AABB& y) { return merge(x, y); }, a, b);
+}
+
+BENCHMARK(AABB, Intersection)
+{
+	repeat(iterations, [](const AABB& x, const AABB& y) { return intersection(x, y); }, a, b);
+}
+
+BENCHMARK(AABB, Intersects)
+{
+	repeat(iterations, [](const AABB& x, const AABB& y) { return x.intersects(y); }, a, b);
+}
+
+BENCHMARK(AABB, ContainsPoint)
+{
+	repeat(iterations, [](const AABB& x, const Vector3& p) { return x.contains(p); }, a, b.center());
+}
+
+BENCHMARK(AABB, TransformMatrix4)
+{
+	repeat(iterations, [](const AABB& x, const Matrix4& M) { return x.transformed(M); }, a, Matrix4(A));
+}
+
+BENCHMARK(AABB, TransformAffine3)
+{
+	repeat(iterations, [](const AABB& x, const Affine3& T) { return x.transformed(T); }, a, A);
+}
+
+// Transforms the eight corners of the box and bounds them, for comparison
+// with Arvo's method.
+BENCHMARK(AABB, TransformCorners)
+{
+	repeat(iterations, [](const AABB& x, const Matrix4& M)
+	{
+		AABB result;
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			const Vector4 p = M * Vector4(
+				(i & 1) ? x.max.x : x.min.x,
+				(i & 2) ? x.max.y : x.min.y,
+				(i & 4) ? x.max.z : x.min.z,
+				1.0f);
+			result.merge(Vector3(p.x, p.y, p.z));
+		}
+
+		return result;
+	}, a, Matrix4(A));
+}
+
+BENCHMARK_BATCH(AABB, FromPointsOneByOne, batchSize)
+{
+	std::vector<Vector3> points = cloud();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(points[0]);
+		AABB box;
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			box.merge(points[j]);
+		}
+
+		doNotOptimize(box);
+	}
+}
+
+BENCHMARK_BATCH(AABB, FromPoints, batchSize)
+{
+	std::vector<Vector3> points = cloud();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(points[0]);
+		AABB box = AABB::fromPoints(points.data(), batchSize);
+		doNotOptimize(box);
+	}
+}
+
+BENCHMARK_BATCH(AABB, FromPointArrays, batchSize)
+{
+	const std::vector<Vector3> points = cloud();
+	std::vector<float> xs, ys, zs;
+	for (const Vector3& p : points)
+	{
+		xs.push_back(p.x);
+		ys.push_back(p.y);
+		zs.push_back(p.z);
+	}
+
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(xs[0]);
+		AABB box = AABB::fromPoints(xs.data(), ys.data(), zs.data(), batchSize);
+		doNotOptimize(box);
+	}
+}
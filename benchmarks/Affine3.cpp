@@ -0,0 +1,174 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Affine3 A(
+		4.0f, 2.0f, -3.0f, 1.0f,
+		1.0f, 5.0f, 0.5f, -2.0f,
+		-1.0f, 2.0f, 6.0f, 0.25f
+	);
+	const Affine3 B(
+		0.5f, -1.5f, 2.5f, 1.0f,
+		1.0f, 3.0f, -2.0f, 0.5f,
+		0.25f, 1.0f, 2.0f, -1.0f
+	);
+	const Quaternion q = Quaternion::euler(Vector3(0.1f, 0.2f, 0.3f));
+	const Vector3 u(1.5f, -2.0f, 0.75f);
+
+	// Number of transformations in each hierarchy chain.
+	const std::size_t chainLength = 16;
+
+	/**
+	 * Returns a chain of rigid transformations, such as the local transforms
+	 * along a path of a scene hierarchy.
+	 */
+	template <typename Transform>
+	std::vector<Transform> rigidChain()
+	{
+		std::vector<Transform> chain;
+		for (std::size_t i = 0; i < chainLength; ++i)
+		{
+			const float f = static_cast<float>(i);
+			const Quaternion r = Quaternion::euler(Vector3(0.1f * f, -0.2f * f, 0.05f * f));
+			chain.push_back(Transform(Affine3(r, Vector3(f, 0.5f * f, -f))));
+		}
+
+		return chain;
+	}
+}
+
+BENCHMARK(Affine3, FromQuaternion)
+{
+	repeat(iterations, [](const Quaternion& r, const Vector3& t) { return Affine3(r, t); }, q, u);
+}
+
+BENCHMARK(Affine3, FromMatrix4)
+{
+	repeat(iterations, [](const Matrix4& X) { return Affine3(X); }, Matrix4(A));
+}
+
+BENCHMARK(Affine3, ToMatrix4)
+{
+	repeat(iterations, [](const Affine3& X) { return Matrix4(X); }, A);
+}
+
+BENCHMARK(Affine3, RotationPart)
+{
+	repeat(iterations, [](const Affine3& X) { return X.rotationPart(); }, Affine3(q, u, 2.0f));
+}
+
+BENCHMARK(Affine3, Composition)
+{
+	repeat(iterations, [](const Affine3& X, const Affine3& Y) { return X * Y; }, A, B);
+}
+
+BENCHMARK(Affine3, TransformPoint)
+{
+	repeat(iterations, [](const Affine3& X, const Vector3& p) { return X.transformPoint(p); }, A, u);
+}
+
+BENCHMARK(Affine3, TransformVector)
+{
+	repeat(iterations, [](const Affine3& X, const Vector3& v) { return X.transformVector(v); }, A, u);
+}
+
+BENCHMARK(Affine3, Determinant)
+{
+	repeat(iterations, [](const Affine3& X) { return X.determinant(); }, A);
+}
+
+BENCHMARK(Affine3, Inverse)
+{
+	repeat(iterations, [](const Affine3& X) { return X.inverse(); }, A);
+}
+
+BENCHMARK(Affine3, RigidInverse)
+{
+	repeat(iterations, [](const Affine3& X) { return X.rigidInverse(); }, Affine3(q, u));
+}
+
+BENCHMARK(Affine3, UniformScaleInverse)
+{
+	repeat(iterations, [](const Affine3& X) { return X.uniformScaleInverse(); }, Affine3(q, u, 2.0f));
+}
+
+// The chain benchmarks compose a hierarchy of transformations and transform a
+// point by the result, once with Affine3 and once with the equivalent Matrix4
+// operations.
+
+BENCHMARK_BATCH(Affine3, TransformChain, chainLength)
+{
+	const std::vector<Affine3> chain = rigidChain<Affine3>();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		Affine3 world = chain[0];
+		for (std::size_t j = 1; j < chainLength; ++j)
+		{
+			doNotOptimize(world);
+			world = world * chain[j];
+		}
+
+		Vector3 p = world.transformPoint(u);
+		doNotOptimize(p);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, TransformChain, chainLength)
+{
+	const std::vector<Matrix4> chain = rigidChain<Matrix4>();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		Matrix4 world = chain[0];
+		for (std::size_t j = 1; j < chainLength; ++j)
+		{
+			doNotOptimize(world);
+			world = world * chain[j];
+		}
+
+		Vector4 p = world * Vector4(u, 1.0f);
+		doNotOptimize(p);
+	}
+}
+
+BENCHMARK_BATCH(Affine3, InverseChain, chainLength)
+{
+	const std::vector<Affine3> chain = rigidChain<Affine3>();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		Affine3 local = Affine3::IDENTITY;
+		for (std::size_t j = 0; j < chainLength; ++j)
+		{
+			doNotOptimize(local);
+			local = chain[j].rigidInverse() * local;
+		}
+
+		doNotOptimize(local);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, InverseChain, chainLength)
+{
+	const std::vector<Matrix4> chain = rigidChain<Matrix4>();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		Matrix4 local = Matrix4::IDENTITY;
+		for (std::size_t j = 0; j < chainLength; ++j)
+		{
+			doNotOptimize(local);
+			local = chain[j].inverse() * local;
+		}
+
+		doNotOptimize(local);
+	}
+}
@@ -0,0 +1,95 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Aligned.hpp>
+#include <M3D/Allocator.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Matrix4 A = Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f)) * Matrix4::euler(Vector3(0.1f, 0.2f, 0.3f));
+
+	// Number of scratch arrays allocated by each simulated frame, and the
+	// number of vectors in each.
+	const std::size_t arraysPerFrame = 16;
+	const std::size_t arraySize = 256;
+}
+
+// Each frame allocates its scratch arrays from the heap.
+BENCHMARK_BATCH(Allocator, ScratchHeap, arraysPerFrame)
+{
+	const std::vector<Vector4> source(arraySize, Vector4(1.5f, -2.0f, 0.75f, 1.0f));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t j = 0; j < arraysPerFrame; ++j)
+		{
+			std::vector<Vector4> scratch(arraySize);
+			transform(A, source.data(), scratch.data(), arraySize);
+			doNotOptimize(scratch[0]);
+		}
+	}
+}
+
+// Each frame allocates its scratch arrays from an arena, which is reset at
+// the end of the frame.
+BENCHMARK_BATCH(Allocator, ScratchArena, arraysPerFrame)
+{
+	const std::vector<Vector4> source(arraySize, Vector4(1.5f, -2.0f, 0.75f, 1.0f));
+	Arena arena;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t j = 0; j < arraysPerFrame; ++j)
+		{
+			Vector4* scratch = arena.allocate<Vector4>(arraySize);
+			transform(A, source.data(), scratch, arraySize);
+			doNotOptimize(scratch[0]);
+		}
+
+		arena.reset();
+	}
+}
+
+// As ScratchArena, through aligned vectors that allocate from the arena.
+BENCHMARK_BATCH(Allocator, ScratchArenaVector, arraysPerFrame)
+{
+	const AlignedVector<Vector4> source(arraySize, Vector4(1.5f, -2.0f, 0.75f, 1.0f));
+	Arena arena;
+	const AlignedAllocator<Vector4> allocator(&arena);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t j = 0; j < arraysPerFrame; ++j)
+		{
+			AlignedVector<Vector4> scratch(allocator);
+			transform(A, source, scratch);
+			doNotOptimize(scratch[0]);
+		}
+
+		arena.reset();
+	}
+}
+
+BENCHMARK(Allocator, PoolAllocate)
+{
+	AlignedPool pool(sizeof(Matrix4A), alignof(Matrix4A));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		void* block = pool.allocate();
+		doNotOptimize(block);
+		pool.deallocate(block);
+	}
+}
+
+BENCHMARK(Allocator, HeapAllocate)
+{
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		void* block = alignedAllocate(sizeof(Matrix4A), alignof(Matrix4A));
+		doNotOptimize(block);
+		alignedFree(block);
+	}
+}
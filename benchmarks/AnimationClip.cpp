@@ -0,0 +1,108 @@
+#include "Benchmark.hpp"
+
+#include <M3D/AnimationClip.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	// Number of tracks sampled by each iteration of the benchmarks.
+	const std::size_t trackCount = 2048;
+
+	const std::size_t frameCount = 121;
+	const float frameRate = 30.0f;
+
+	/**
+	 * Smoothly moving tracks, uncompressed and as a clip.
+	 */
+	struct Animation
+	{
+		Animation()
+		: translations(trackCount * frameCount)
+		, rotations(trackCount * frameCount)
+		, scales(trackCount * frameCount, Vector3(1.0f, 1.0f, 1.0f))
+		{
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				for (std::size_t track = 0; track < trackCount; ++track)
+				{
+					const std::size_t i = frame * trackCount + track;
+					const float t = static_cast<float>(frame) / frameRate;
+					const float k = static_cast<float>(track);
+					translations[i] = Vector3(std::sin(t * 3.0f + k), std::cos(t * 2.0f + k), 0.1f * t);
+					rotations[i] = Quaternion::euler(Vector3(std::sin(t + k), 2.0f * t + k, std::cos(1.5f * t)));
+				}
+			}
+
+			clip = AnimationClip(translations.data(), rotations.data(), scales.data(), trackCount, frameCount, frameRate);
+		}
+
+		std::vector<Vector3> translations;
+		std::vector<Quaternion> rotations;
+		std::vector<Vector3> scales;
+		AnimationClip clip;
+	};
+
+	// The animation is compressed on first use, outside of the timed loops.
+	const Animation& animation()
+	{
+		static const Animation instance;
+		return instance;
+	}
+}
+
+BENCHMARK_BATCH(AnimationClip, SampleUncompressed, trackCount)
+{
+	// Interpolation between the two nearest frames of the source, for
+	// comparison.
+	const Animation& a = animation();
+	AnimationPose pose(trackCount);
+	float time = 0.0f;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(time);
+		const float frame = time * frameRate;
+		const std::size_t first = static_cast<std::size_t>(frame);
+		const float t = frame - static_cast<float>(first);
+		const Vector3* translations = &a.translations[first * trackCount];
+		const Quaternion* rotations = &a.rotations[first * trackCount];
+		const Vector3* scales = &a.scales[first * trackCount];
+		for (std::size_t track = 0; track < trackCount; ++track)
+		{
+			const Vector3 v = translations[track] + (translations[track + trackCount] - translations[track]) * t;
+			const Quaternion q = nlerp(rotations[track], rotations[track + trackCount], t);
+			const Vector3 s = scales[track] + (scales[track + trackCount] - scales[track]) * t;
+			pose.translationX[track] = v.x;
+			pose.translationY[track] = v.y;
+			pose.translationZ[track] = v.z;
+			pose.rotationW[track] = q.w;
+			pose.rotationX[track] = q.x;
+			pose.rotationY[track] = q.y;
+			pose.rotationZ[track] = q.z;
+			pose.scaleX[track] = s.x;
+			pose.scaleY[track] = s.y;
+			pose.scaleZ[track] = s.z;
+		}
+
+		doNotOptimize(pose.rotationW[0]);
+		time = std::fmod(time + 0.0123f, a.clip.duration());
+	}
+}
+
+BENCHMARK_BATCH(AnimationClip, Sample, trackCount)
+{
+	const Animation& a = animation();
+	AnimationPose pose(trackCount);
+	float time = 0.0f;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(time);
+		a.clip.sample(time, pose);
+		doNotOptimize(pose.rotationW[0]);
+		time = std::fmod(time + 0.0123f, a.clip.duration());
+	}
+}
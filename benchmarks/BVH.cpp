@@ -0,0 +1,155 @@
+#include "Benchmark.hpp"
+
+#include <M3D/BVH.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Ray.hpp>
+#include <M3D/Triangle.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	// Number of triangles in the scene.
+	const std::size_t triangleCount = 100000;
+
+	// Number of rays or queries in each iteration of the traversal
+	// benchmarks.
+	const std::size_t rayCount = 256;
+
+	/**
+	 * Returns a pseudo-random point in the box [-100, 100]^3 for the index
+	 * `i` and the seed `k`.
+	 */
+	Vector3 point(std::size_t i, float k)
+	{
+		const float f = static_cast<float>(i) + k;
+		return Vector3(100.0f * std::sin(1.3f * f), 100.0f * std::cos(0.7f * f), 100.0f * std::sin(0.31f * f + 1.0f));
+	}
+
+	/**
+	 * Small triangles scattered through a box, with their bounds, the
+	 * hierarchy over them, and rays through the box.
+	 */
+	struct Scene
+	{
+		Scene()
+		: triangles(triangleCount), bounds(triangleCount), rays(rayCount)
+		{
+			for (std::size_t i = 0; i < triangleCount; ++i)
+			{
+				const Vector3 a = point(i, 0.0f);
+				triangles[i] = Triangle(a, a + point(i, 1.0f) * 0.02f, a + point(i, 2.0f) * 0.02f);
+				bounds[i] = triangles[i].bounds();
+			}
+
+			for (std::size_t i = 0; i < rayCount; ++i)
+			{
+				rays[i] = Ray(point(i, 3.0f) * 1.5f, point(i, 4.0f) - point(i, 3.0f) * 1.5f);
+			}
+
+			bvh.build(bounds.data(), triangleCount);
+		}
+
+		std::vector<Triangle> triangles;
+		std::vector<AABB> bounds;
+		std::vector<Ray> rays;
+		BVH bvh;
+	};
+
+	// The scene is built on first use, outside of the timed loops.
+	const Scene& scene()
+	{
+		static const Scene instance;
+		return instance;
+	}
+}
+
+BENCHMARK_BATCH(BVH, Build, triangleCount)
+{
+	const Scene& s = scene();
+	BVH bvh;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		bvh.build(s.bounds.data(), triangleCount);
+		doNotOptimize(bvh);
+	}
+}
+
+BENCHMARK_BATCH(BVH, BuildFourThreads, triangleCount)
+{
+	const Scene& s = scene();
+	BVH bvh;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		bvh.build(s.bounds.data(), triangleCount, 4);
+		doNotOptimize(bvh);
+	}
+}
+
+BENCHMARK_BATCH(BVH, Refit, triangleCount)
+{
+	const Scene& s = scene();
+	BVH bvh = s.bvh;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		bvh.refit(s.bounds.data());
+		doNotOptimize(bvh);
+	}
+}
+
+BENCHMARK_BATCH(BVH, IntersectRay, rayCount)
+{
+	const Scene& s = scene();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t j = 0; j < rayCount; ++j)
+		{
+			float distance = 0.0f;
+			std::size_t primitive = 0;
+			s.bvh.intersectTriangles(s.rays[j], s.triangles.data(), distance, primitive);
+			doNotOptimize(distance);
+		}
+	}
+}
+
+// Tests every triangle, for comparison with the traversal.
+BENCHMARK_BATCH(BVH, IntersectRayBruteForce, 1)
+{
+	const Scene& s = scene();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		const Ray& ray = s.rays[i % rayCount];
+		float closest = std::numeric_limits<float>::infinity();
+		for (std::size_t j = 0; j < triangleCount; ++j)
+		{
+			float t;
+			if (ray.intersects(s.triangles[j], t) && t < closest)
+			{
+				closest = t;
+			}
+		}
+
+		doNotOptimize(closest);
+	}
+}
+
+BENCHMARK_BATCH(BVH, Query, rayCount)
+{
+	const Scene& s = scene();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t j = 0; j < rayCount; ++j)
+		{
+			const Vector3 p = point(j, 5.0f);
+			std::size_t candidates = 0;
+			s.bvh.query(AABB(p, p + Vector3(5.0f, 5.0f, 5.0f)), [&](std::size_t) { ++candidates; });
+			doNotOptimize(candidates);
+		}
+	}
+}
@@ -0,0 +1,170 @@
+#include "Benchmark.hpp"
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace M3D
+{
+	namespace benchmark
+	{
+		namespace
+		{
+			struct Entry
+			{
+				std::string name;
+				Function function;
+				std::size_t operations;
+			};
+
+			struct Result
+			{
+				std::string name;
+				std::size_t iterations;
+				double nsPerOp;
+				double opsPerSec;
+			};
+
+			// Function local so that registrations in other translation units
+			// are safe regardless of static initialization order.
+			std::vector<Entry>& registry()
+			{
+				static std::vector<Entry> entries;
+				return entries;
+			}
+
+			// Returns the time in seconds taken to run `entry` for
+			// `iterations` iterations.
+			double time(const Entry& entry, std::size_t iterations)
+			{
+				const auto start = std::chrono::steady_clock::now();
+				entry.function(iterations);
+				const auto end = std::chrono::steady_clock::now();
+				return std::chrono::duration<double>(end - start).count();
+			}
+
+			// Runs `entry` with an increasing number of iterations until it
+			// takes at least `minTime` seconds.
+			Result measure(const Entry& entry, double minTime)
+			{
+				// Warm up the caches and branch predictors.
+				time(entry, 1);
+
+				std::size_t iterations = 1;
+				double elapsed = time(entry, iterations);
+				while (elapsed < minTime)
+				{
+					// Aim slightly beyond the target to avoid creeping up on it
+					// one small step at a time.
+					const double scale = (elapsed > 0.0) ? 1.4 * minTime / elapsed : 10.0;
+					const std::size_t next = static_cast<std::size_t>(iterations * (scale < 10.0 ? scale : 10.0));
+					iterations = (next > iterations) ? next : iterations + 1;
+					elapsed = time(entry, iterations);
+				}
+
+				const double operations = static_cast<double>(iterations) * entry.operations;
+
+				Result result;
+				result.name = entry.name;
+				result.iterations = iterations;
+				result.nsPerOp = 1e9 * elapsed / operations;
+				result.opsPerSec = operations / elapsed;
+				return result;
+			}
+
+			// Returns the instruction set that the library kernels were
+			// configured with.
+			const char* simd()
+			{
+#if defined(M3D_SIMD_AVX)
+				return "AVX";
+#elif defined(M3D_SIMD_SSE2)
+				return "SSE2";
+#else
+				return "NONE";
+#endif
+			}
+
+			bool writeJson(const std::string& path, const std::vector<Result>& results)
+			{
+				std::ofstream out(path.c_str());
+				if (!out) return false;
+
+				char date[32];
+				const std::time_t now = std::time(nullptr);
+				std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+				out << std::setprecision(10);
+				out << "{" << std::endl;
+				out << "  \"context\": {" << std::endl;
+				out << "    \"date\": \"" << date << "\"," << std::endl;
+				out << "    \"simd\": \"" << simd() << "\"" << std::endl;
+				out << "  }," << std::endl;
+				out << "  \"benchmarks\": [" << std::endl;
+
+				for (std::size_t i = 0; i < results.size(); ++i)
+				{
+					const Result& result = results[i];
+					out << "    {"
+						<< "\"name\": \"" << result.name << "\", "
+						<< "\"iterations\": " << result.iterations << ", "
+						<< "\"ns_per_op\": " << result.nsPerOp << ", "
+						<< "\"ops_per_sec\": " << result.opsPerSec
+						<< "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+				}
+
+				out << "  ]" << std::endl;
+				out << "}" << std::endl;
+
+				return static_cast<bool>(out);
+			}
+		}
+
+		Registration::Registration(const std::string& name, Function function, std::size_t operations)
+		{
+			Entry entry;
+			entry.name = name;
+			entry.function = function;
+			entry.operations = operations;
+			registry().push_back(entry);
+		}
+
+		bool run(const std::string& filter, double minTime, const std::string& jsonPath)
+		{
+			std::cout << "SIMD: " << simd() << std::endl;
+			std::cout << std::left << std::setw(48) << "Benchmark"
+				<< std::right << std::setw(14) << "ns/op"
+				<< std::setw(18) << "ops/sec" << std::endl;
+			std::cout << std::string(80, '-') << std::endl;
+
+			std::vector<Result> results;
+			for (const Entry& entry : registry())
+			{
+				if (entry.name.find(filter) == std::string::npos) continue;
+
+				const Result result = measure(entry, minTime);
+				results.push_back(result);
+
+				std::cout << std::left << std::setw(48) << result.name
+					<< std::right << std::fixed
+					<< std::setw(14) << std::setprecision(3) << result.nsPerOp
+					<< std::setw(18) << std::setprecision(0) << result.opsPerSec
+					<< std::endl;
+			}
+
+			if (jsonPath.empty()) return true;
+
+			if (!writeJson(jsonPath, results))
+			{
+				std::cerr << "Failed to write " << jsonPath << std::endl;
+				return false;
+			}
+
+			std::cout << "Results written to " << jsonPath << std::endl;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,108 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace M3D
+{
+	namespace benchmark
+	{
+		/**
+		 * Signature for a benchmark body. The body should perform the
+		 * operation being measured `iterations` times.
+		 */
+		typedef void (*Function)(std::size_t iterations);
+
+		/**
+		 * Registers a benchmark with the runner. Instances are created by the
+		 * BENCHMARK macros and should not be created directly.
+		 */
+		class Registration
+		{
+		public:
+			/**
+			 * Constructor.
+			 *
+			 * @param name Name of the benchmark.
+			 * @param function Benchmark body.
+			 * @param operations Number of operations performed by each
+			 * iteration of the benchmark body.
+			 */
+			Registration(const std::string& name, Function function, std::size_t operations);
+		};
+
+		/**
+		 * Runs all registered benchmarks whose names contain `filter`.
+		 *
+		 * Results are written to the standard output and, unless `jsonPath`
+		 * is empty, also written to the JSON file at `jsonPath`.
+		 *
+		 * @param filter Substring that benchmark names must contain.
+		 * @param minTime Minimum time, in seconds, to run each benchmark for.
+		 * @param jsonPath Path of the JSON file to write.
+		 * @return True if the results were written successfully.
+		 */
+		bool run(const std::string& filter, double minTime, const std::string& jsonPath);
+
+		/**
+		 * Prevents the compiler from optimising away the computation of
+		 * `value`, and forces it to assume that `value` may have been
+		 * modified so that the computation cannot be hoisted out of the
+		 * benchmark loop.
+		 *
+		 * @param value The value to escape.
+		 */
+		template <typename T>
+		inline void doNotOptimize(T& value)
+		{
+#if defined(_MSC_VER)
+			const volatile void* volatile escape = &value;
+			(void)escape;
+#else
+			asm volatile("" : "+m"(value) : : "memory");
+#endif
+		}
+
+		/**
+		 * Evaluates `op(args...)` `iterations` times. The arguments are
+		 * escaped before every evaluation and the result escaped after it, so
+		 * that each evaluation is actually performed.
+		 *
+		 * @param iterations Number of times to evaluate the operation.
+		 * @param op The operation to evaluate.
+		 * @param args The arguments to pass to the operation.
+		 */
+		template <typename Op, typename... Args>
+		inline void repeat(std::size_t iterations, Op op, Args... args)
+		{
+			for (std::size_t i = 0; i < iterations; ++i)
+			{
+				const int escape[] = {0, (doNotOptimize(args), 0)...};
+				(void)escape;
+
+				auto result = op(args...);
+				doNotOptimize(result);
+			}
+		}
+	}
+}
+
+/**
+ * Defines a benchmark named `Type/Operation` that performs one operation per
+ * iteration. The body that follows the macro has access to `iterations`.
+ */
+#define BENCHMARK(Type, Operation) \
+	BENCHMARK_BATCH(Type, Operation, 1)
+
+/**
+ * Defines a benchmark named `Type/Operation` that performs `operations`
+ * operations per iteration, such as a batch function applied to an array.
+ * Timings are reported per operation.
+ */
+#define BENCHMARK_BATCH(Type, Operation, operations) \
+	static void Type##_##Operation(std::size_t iterations); \
+	static const M3D::benchmark::Registration Type##_##Operation##_registration(#Type "/" #Operation, Type##_##Operation, operations); \
+	static void Type##_##Operation(std::size_t iterations)
+
+#endif
@@ -0,0 +1,63 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Conversion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	// Number of vectors converted by each iteration of the benchmarks.
+	const std::size_t batchSize = 1024;
+}
+
+BENCHMARK_BATCH(Conversion, DoubleToFloatOneByOne, batchSize)
+{
+	std::vector<Vector3d> in(batchSize, Vector3d(1e8, 0.5, -2.0));
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = Vector3(in[j]);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Conversion, DoubleToFloat, batchSize)
+{
+	std::vector<Vector3d> in(batchSize, Vector3d(1e8, 0.5, -2.0));
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		convert(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Conversion, FloatToDoubleOneByOne, batchSize)
+{
+	std::vector<Vector3> in(batchSize, Vector3(1e8f, 0.5f, -2.0f));
+	std::vector<Vector3d> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = Vector3d(in[j]);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Conversion, FloatToDouble, batchSize)
+{
+	std::vector<Vector3> in(batchSize, Vector3(1e8f, 0.5f, -2.0f));
+	std::vector<Vector3d> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		convert(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
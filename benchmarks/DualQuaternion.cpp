@@ -0,0 +1,180 @@
+#include "Benchmark.hpp"
+
+#include <M3D/DualQuaternion.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const DualQuaternion a(Quaternion::euler(Vector3(0.1f, 0.2f, 0.3f)), Vector3(1.0f, -2.0f, 0.5f));
+	const DualQuaternion b(Quaternion::euler(Vector3(-0.4f, 0.5f, 1.2f)), Vector3(-3.0f, 0.25f, 2.0f));
+	const Vector3 v(1.5f, -2.0f, 0.75f);
+
+	// Number of points skinned by each iteration of the skinning benchmarks.
+	const std::size_t batchSize = 1024;
+
+	// Number of bones in the skeleton and influences on each point.
+	const std::size_t boneCount = 64;
+	const std::size_t influences = 4;
+
+	/**
+	 * Mesh with the influences stored in structure-of-arrays form, as
+	 * expected by skinPoints().
+	 */
+	struct Mesh
+	{
+		Mesh()
+		: indices(influences * batchSize)
+		, weights(influences * batchSize)
+		, xs(batchSize)
+		, ys(batchSize)
+		, zs(batchSize)
+		{
+			const float w[influences] = {0.4f, 0.3f, 0.2f, 0.1f};
+			for (std::size_t i = 0; i < batchSize; ++i)
+			{
+				for (std::size_t k = 0; k < influences; ++k)
+				{
+					indices[k * batchSize + i] = static_cast<unsigned int>((7 * i + 13 * k) % boneCount);
+					weights[k * batchSize + i] = w[k];
+				}
+
+				xs[i] = 0.01f * i;
+				ys[i] = 1.0f - 0.02f * i;
+				zs[i] = 0.5f;
+			}
+		}
+
+		std::vector<unsigned int> indices;
+		std::vector<float> weights;
+		std::vector<float> xs;
+		std::vector<float> ys;
+		std::vector<float> zs;
+	};
+
+	/**
+	 * Returns the pose of each bone in the skeleton.
+	 */
+	std::vector<DualQuaternion> skeleton()
+	{
+		std::vector<DualQuaternion> bones;
+		for (std::size_t j = 0; j < boneCount; ++j)
+		{
+			const float f = static_cast<float>(j);
+			const Quaternion r = Quaternion::euler(Vector3(0.1f * f, -0.2f * f, 0.05f * f));
+			bones.push_back(DualQuaternion(r, Vector3(f, 0.5f * f, -f)));
+		}
+
+		return bones;
+	}
+}
+
+BENCHMARK(DualQuaternion, FromRotationTranslation)
+{
+	repeat(iterations, [](const Quaternion& r, const Vector3& t) { return DualQuaternion(r, t); }, a.real, v);
+}
+
+BENCHMARK(DualQuaternion, FromMatrix4)
+{
+	repeat(iterations, [](const Matrix4& M) { return DualQuaternion(M); }, Matrix4(a));
+}
+
+BENCHMARK(DualQuaternion, ToMatrix4)
+{
+	repeat(iterations, [](const DualQuaternion& dq) { return Matrix4(dq); }, a);
+}
+
+BENCHMARK(DualQuaternion, Composition)
+{
+	repeat(iterations, [](const DualQuaternion& x, const DualQuaternion& y) { return x * y; }, a, b);
+}
+
+BENCHMARK(DualQuaternion, TransformPoint)
+{
+	repeat(iterations, [](const DualQuaternion& dq, const Vector3& p) { return dq.transformPoint(p); }, a, v);
+}
+
+BENCHMARK(DualQuaternion, Normalize)
+{
+	repeat(iterations, [](const DualQuaternion& dq) { return dq.normalized(); }, 2.0f * a);
+}
+
+BENCHMARK(DualQuaternion, Inverse)
+{
+	repeat(iterations, [](const DualQuaternion& dq) { return dq.inverse(); }, a);
+}
+
+// The skinning benchmarks deform the same mesh, once by blending a palette of
+// matrices for each point, once by blending dual quaternions one point at a
+// time and once with the batched kernel.
+
+BENCHMARK_BATCH(Matrix4, SkinMatrixPalette, batchSize)
+{
+	const Mesh mesh;
+	std::vector<DualQuaternion> bones = skeleton();
+	std::vector<Matrix4> palette(bones.begin(), bones.end());
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(palette[0]);
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			Matrix4 M = mesh.weights[j] * palette[mesh.indices[j]];
+			for (std::size_t k = 1; k < influences; ++k)
+			{
+				M = M + mesh.weights[k * batchSize + j] * palette[mesh.indices[k * batchSize + j]];
+			}
+
+			const Vector4 p = M * Vector4(mesh.xs[j], mesh.ys[j], mesh.zs[j], 1.0f);
+			out[j] = Vector3(p.x, p.y, p.z);
+		}
+
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(DualQuaternion, SkinOneByOne, batchSize)
+{
+	const Mesh mesh;
+	std::vector<DualQuaternion> bones = skeleton();
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(bones[0]);
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			DualQuaternion dqs[influences];
+			float weights[influences];
+			for (std::size_t k = 0; k < influences; ++k)
+			{
+				dqs[k] = bones[mesh.indices[k * batchSize + j]];
+				weights[k] = mesh.weights[k * batchSize + j];
+			}
+
+			out[j] = blend(dqs, weights, influences).transformPoint(Vector3(mesh.xs[j], mesh.ys[j], mesh.zs[j]));
+		}
+
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(DualQuaternion, SkinPoints, batchSize)
+{
+	const Mesh mesh;
+	std::vector<DualQuaternion> bones = skeleton();
+	std::vector<float> outXs(batchSize), outYs(batchSize), outZs(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(bones[0]);
+		skinPoints(bones.data(), mesh.indices.data(), mesh.weights.data(), influences,
+			mesh.xs.data(), mesh.ys.data(), mesh.zs.data(), outXs.data(), outYs.data(), outZs.data(), batchSize);
+		doNotOptimize(outXs[0]);
+	}
+}
@@ -0,0 +1,56 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Expression.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Vector4.hpp>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Matrix4 A(
+		4.0f, 2.0f, -3.0f, 1.0f,
+		1.0f, 5.0f, 0.5f, -2.0f,
+		-1.0f, 2.0f, 6.0f, 0.25f,
+		0.5f, -1.0f, 1.5f, 3.0f
+	);
+	const Matrix4 B(
+		0.5f, -1.5f, 2.5f, 1.0f,
+		1.0f, 3.0f, -2.0f, 0.5f,
+		0.25f, 1.0f, 2.0f, -1.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	);
+	const Vector4 a(1.5f, -2.0f, 0.75f, 1.0f);
+	const Vector4 b(0.5f, 3.0f, -1.25f, 0.0f);
+	const Vector4 c(-1.0f, 0.25f, 2.0f, 1.0f);
+}
+
+BENCHMARK(Expression, MatrixBlendEager)
+{
+	repeat(iterations, [](const Matrix4& X, const Matrix4& Y, float t) { return X * (1.0f - t) + Y * t; }, A, B, 0.3f);
+}
+
+BENCHMARK(Expression, MatrixBlendLazy)
+{
+	repeat(iterations, [](const Matrix4& X, const Matrix4& Y, float t)
+	{
+		using namespace M3D::expr;
+		return Matrix4(lazy(X) * (1.0f - t) + Y * t);
+	}, A, B, 0.3f);
+}
+
+BENCHMARK(Expression, VectorChainEager)
+{
+	repeat(iterations, [](const Vector4& x, const Vector4& y, const Vector4& z, float s) { return x + y * s - z; },
+		a, b, c, 2.5f);
+}
+
+BENCHMARK(Expression, VectorChainLazy)
+{
+	repeat(iterations, [](const Vector4& x, const Vector4& y, const Vector4& z, float s)
+	{
+		using namespace M3D::expr;
+		return Vector4(x + lazy(y) * s - z);
+	}, a, b, c, 2.5f);
+}
@@ -0,0 +1,108 @@
+#include "Benchmark.hpp"
+
+#include <M3D/FastMath.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Vector3 v(1.5f, -2.0f, 0.75f);
+	const Quaternion q(0.5f, 1.0f, -2.0f, 3.0f);
+	const Vector3 angles(0.3f, -1.2f, 2.9f);
+	const float theta = 1.234f;
+	const float cosine = 0.37f;
+
+	// Number of vectors normalized by each iteration of the batch
+	// benchmarks.
+	const std::size_t batchSize = 1024;
+}
+
+BENCHMARK(FastMath, NormalizedPrecise)
+{
+	repeat(iterations, [](const Vector3& a) { return a.normalized(); }, v);
+}
+
+BENCHMARK(FastMath, Normalized)
+{
+	repeat(iterations, [](const Vector3& a) { return fast::normalized(a); }, v);
+}
+
+BENCHMARK(FastMath, QuaternionNormalizedPrecise)
+{
+	repeat(iterations, [](const Quaternion& a) { return a.normalized(); }, q);
+}
+
+BENCHMARK(FastMath, QuaternionNormalized)
+{
+	repeat(iterations, [](const Quaternion& a) { return fast::normalized(a); }, q);
+}
+
+BENCHMARK(FastMath, SinCosPrecise)
+{
+	repeat(iterations, [](float a) { return std::sin(a) + std::cos(a); }, theta);
+}
+
+BENCHMARK(FastMath, SinCos)
+{
+	repeat(iterations, [](float a) { float s, c; fast::sincos(a, s, c); return s + c; }, theta);
+}
+
+BENCHMARK(FastMath, AcosPrecise)
+{
+	repeat(iterations, [](float x) { return std::acos(x); }, cosine);
+}
+
+BENCHMARK(FastMath, Acos)
+{
+	repeat(iterations, [](float x) { return fast::acos(x); }, cosine);
+}
+
+BENCHMARK(FastMath, Atan2Precise)
+{
+	repeat(iterations, [](float y, float x) { return std::atan2(y, x); }, cosine, -theta);
+}
+
+BENCHMARK(FastMath, Atan2)
+{
+	repeat(iterations, [](float y, float x) { return fast::atan2(y, x); }, cosine, -theta);
+}
+
+BENCHMARK(FastMath, EulerPrecise)
+{
+	repeat(iterations, [](const Vector3& a) { return Quaternion::euler(a); }, angles);
+}
+
+BENCHMARK(FastMath, Euler)
+{
+	repeat(iterations, [](const Vector3& a) { return fast::euler(a); }, angles);
+}
+
+BENCHMARK_BATCH(FastMath, NormalizeOneByOnePrecise, batchSize)
+{
+	std::vector<Vector3> in(batchSize, v);
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = in[j].normalized();
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(FastMath, NormalizeBatch, batchSize)
+{
+	std::vector<Vector3> in(batchSize, v);
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		fast::normalize(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
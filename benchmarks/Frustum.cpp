@@ -0,0 +1,189 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Frustum.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	// Number of objects culled by each iteration of the batch benchmarks.
+	const std::size_t batchSize = 1024;
+
+	/**
+	 * Returns a view-projection matrix with a 90 degree field of view, for a
+	 * camera at (1, 2, 3) rotated about the y-axis.
+	 */
+	Matrix4 viewProjection()
+	{
+		const Matrix4 projection(
+			1.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, -1.0f, -1.0f,
+			0.0f, 0.0f, -1.0f, 0.0f);
+		return projection * Matrix4::angleAxis(0.4f, Vector3(0.0f, 1.0f, 0.0f)) * Matrix4::translation(Vector3(-1.0f, -2.0f, -3.0f));
+	}
+
+	const Matrix4 A = viewProjection();
+	const Frustum frustum(A);
+
+	/**
+	 * Objects stored in structure-of-arrays form, as both spheres and
+	 * boxes, about half of which are visible.
+	 */
+	struct Scene
+	{
+		Scene()
+		: xs(batchSize), ys(batchSize), zs(batchSize), radii(batchSize)
+		, minXs(batchSize), minYs(batchSize), minZs(batchSize)
+		, maxXs(batchSize), maxYs(batchSize), maxZs(batchSize)
+		, visibility((batchSize + 31) / 32)
+		{
+			for (std::size_t i = 0; i < batchSize; ++i)
+			{
+				const float f = static_cast<float>(i);
+				xs[i] = 8.0f * std::sin(1.3f * f);
+				ys[i] = 8.0f * std::cos(0.7f * f);
+				zs[i] = 3.0f - 12.0f * std::sin(0.31f * f);
+				radii[i] = 0.5f;
+				minXs[i] = xs[i] - 0.5f;
+				minYs[i] = ys[i] - 0.5f;
+				minZs[i] = zs[i] - 0.5f;
+				maxXs[i] = xs[i] + 0.5f;
+				maxYs[i] = ys[i] + 0.5f;
+				maxZs[i] = zs[i] + 0.5f;
+			}
+		}
+
+		std::vector<float> xs, ys, zs, radii;
+		std::vector<float> minXs, minYs, minZs, maxXs, maxYs, maxZs;
+		std::vector<std::uint32_t> visibility;
+	};
+}
+
+BENCHMARK(Frustum, Extract)
+{
+	repeat(iterations, [](const Matrix4& M) { return Frustum(M); }, A);
+}
+
+BENCHMARK(Frustum, IntersectsSphere)
+{
+	repeat(iterations, [](const Frustum& F, const Vector3& c) { return F.intersects(c, 0.5f); }, frustum, Vector3(0.0f, 2.0f, -2.0f));
+}
+
+BENCHMARK(Frustum, IntersectsBox)
+{
+	repeat(iterations, [](const Frustum& F, const AABB& box) { return F.intersects(box); },
+		frustum, AABB(Vector3(-0.5f, 1.5f, -2.5f), Vector3(0.5f, 2.5f, -1.5f)));
+}
+
+BENCHMARK_BATCH(Frustum, CullSpheresOneByOne, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.xs[0]);
+		std::fill(scene.visibility.begin(), scene.visibility.end(), std::uint32_t(0));
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			if (frustum.intersects(Vector3(scene.xs[j], scene.ys[j], scene.zs[j]), scene.radii[j]))
+			{
+				scene.visibility[j / 32] |= std::uint32_t(1) << (j % 32);
+			}
+		}
+
+		doNotOptimize(scene.visibility[0]);
+	}
+}
+
+BENCHMARK_BATCH(Frustum, CullSpheres, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.xs[0]);
+		frustum.cullSpheres(scene.xs.data(), scene.ys.data(), scene.zs.data(), scene.radii.data(),
+			scene.visibility.data(), batchSize);
+		doNotOptimize(scene.visibility[0]);
+	}
+}
+
+// Transforms the eight corners of each box to clip space and culls the box if
+// all of the corners are outside the same clip plane, for comparison with the
+// plane tests.
+BENCHMARK_BATCH(Frustum, CullBoxesClipSpace, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.xs[0]);
+		std::fill(scene.visibility.begin(), scene.visibility.end(), std::uint32_t(0));
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			unsigned int outside = 0x3f;
+			for (std::size_t k = 0; k < 8; ++k)
+			{
+				const Vector4 c = A * Vector4(
+					(k & 1) ? scene.maxXs[j] : scene.minXs[j],
+					(k & 2) ? scene.maxYs[j] : scene.minYs[j],
+					(k & 4) ? scene.maxZs[j] : scene.minZs[j],
+					1.0f);
+
+				outside &= (c.x < -c.w ? 0x01 : 0) | (c.x > c.w ? 0x02 : 0)
+					| (c.y < -c.w ? 0x04 : 0) | (c.y > c.w ? 0x08 : 0)
+					| (c.z < -c.w ? 0x10 : 0) | (c.z > c.w ? 0x20 : 0);
+			}
+
+			if (outside == 0)
+			{
+				scene.visibility[j / 32] |= std::uint32_t(1) << (j % 32);
+			}
+		}
+
+		doNotOptimize(scene.visibility[0]);
+	}
+}
+
+BENCHMARK_BATCH(Frustum, CullBoxesOneByOne, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.xs[0]);
+		std::fill(scene.visibility.begin(), scene.visibility.end(), std::uint32_t(0));
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			const AABB box(
+				Vector3(scene.minXs[j], scene.minYs[j], scene.minZs[j]),
+				Vector3(scene.maxXs[j], scene.maxYs[j], scene.maxZs[j]));
+			if (frustum.intersects(box))
+			{
+				scene.visibility[j / 32] |= std::uint32_t(1) << (j % 32);
+			}
+		}
+
+		doNotOptimize(scene.visibility[0]);
+	}
+}
+
+BENCHMARK_BATCH(Frustum, CullBoxes, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.xs[0]);
+		frustum.cullBoxes(scene.minXs.data(), scene.minYs.data(), scene.minZs.data(),
+			scene.maxXs.data(), scene.maxYs.data(), scene.maxZs.data(),
+			scene.visibility.data(), batchSize);
+		doNotOptimize(scene.visibility[0]);
+	}
+}
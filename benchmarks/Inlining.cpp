@@ -0,0 +1,83 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Vector3.hpp>
+
+#include <vector>
+
+#if defined(_MSC_VER)
+	#define NOINLINE __declspec(noinline)
+#else
+	#define NOINLINE __attribute__((noinline))
+#endif
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	// Out-of-line wrappers that reproduce the cost of calling the Vector3
+	// operations across a translation unit boundary, as was the case before
+	// they were made inline.
+	NOINLINE float outOfLineDot(const Vector3& lhs, const Vector3& rhs)
+	{
+		return dot(lhs, rhs);
+	}
+
+	NOINLINE Vector3 outOfLineCross(const Vector3& lhs, const Vector3& rhs)
+	{
+		return cross(lhs, rhs);
+	}
+
+	NOINLINE Vector3 outOfLineAdd(const Vector3& lhs, const Vector3& rhs)
+	{
+		return lhs + rhs;
+	}
+
+	// Number of elements processed by each iteration of the loops.
+	const std::size_t loopSize = 1024;
+
+	std::vector<Vector3> makeVectors(float s)
+	{
+		std::vector<Vector3> vectors(loopSize);
+		for (std::size_t i = 0; i < loopSize; ++i)
+		{
+			vectors[i] = Vector3(s * i, 1.0f, -0.5f * s * i);
+		}
+
+		return vectors;
+	}
+}
+
+BENCHMARK_BATCH(Inlining, DotCrossInline, loopSize)
+{
+	const std::vector<Vector3> a = makeVectors(0.001f);
+	const std::vector<Vector3> b = makeVectors(0.002f);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		float sum = 0.0f;
+		for (std::size_t j = 0; j < loopSize; ++j)
+		{
+			const Vector3 n = cross(a[j], b[j]);
+			sum += dot(n + a[j], b[j]) + dot(n, n);
+		}
+
+		doNotOptimize(sum);
+	}
+}
+
+BENCHMARK_BATCH(Inlining, DotCrossOutOfLine, loopSize)
+{
+	const std::vector<Vector3> a = makeVectors(0.001f);
+	const std::vector<Vector3> b = makeVectors(0.002f);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		float sum = 0.0f;
+		for (std::size_t j = 0; j < loopSize; ++j)
+		{
+			const Vector3 n = outOfLineCross(a[j], b[j]);
+			sum += outOfLineDot(outOfLineAdd(n, a[j]), b[j]) + outOfLineDot(n, n);
+		}
+
+		doNotOptimize(sum);
+	}
+}
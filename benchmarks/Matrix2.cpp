@@ -0,0 +1,93 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Matrix2.hpp>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Matrix2 A(1.0f, 2.0f, -3.0f, 4.0f);
+	const Matrix2 B(0.5f, -1.5f, 2.5f, 1.0f);
+	const Vector2 v(1.5f, -2.0f);
+}
+
+BENCHMARK(Matrix2, Equality)
+{
+	repeat(iterations, [](const Matrix2& X, const Matrix2& Y) { return X == Y; }, A, B);
+}
+
+BENCHMARK(Matrix2, Addition)
+{
+	repeat(iterations, [](const Matrix2& X, const Matrix2& Y) { return X + Y; }, A, B);
+}
+
+BENCHMARK(Matrix2, Subtraction)
+{
+	repeat(iterations, [](const Matrix2& X, const Matrix2& Y) { return X - Y; }, A, B);
+}
+
+BENCHMARK(Matrix2, Negation)
+{
+	repeat(iterations, [](const Matrix2& X) { return -X; }, A);
+}
+
+BENCHMARK(Matrix2, ScalarMultiplication)
+{
+	repeat(iterations, [](const Matrix2& X, float s) { return X * s; }, A, 2.5f);
+}
+
+BENCHMARK(Matrix2, ColumnVectorMultiplication)
+{
+	repeat(iterations, [](const Matrix2& X, const Vector2& u) { return X * u; }, A, v);
+}
+
+BENCHMARK(Matrix2, RowVectorMultiplication)
+{
+	repeat(iterations, [](const Vector2& u, const Matrix2& X) { return u * X; }, v, A);
+}
+
+BENCHMARK(Matrix2, MatrixMultiplication)
+{
+	repeat(iterations, [](const Matrix2& X, const Matrix2& Y) { return X * Y; }, A, B);
+}
+
+BENCHMARK(Matrix2, Transposed)
+{
+	repeat(iterations, [](const Matrix2& X) { return X.transposed(); }, A);
+}
+
+BENCHMARK(Matrix2, Transpose)
+{
+	repeat(iterations, [](Matrix2 X) { X.transpose(); return X; }, A);
+}
+
+BENCHMARK(Matrix2, Determinant)
+{
+	repeat(iterations, [](const Matrix2& X) { return X.determinant(); }, A);
+}
+
+BENCHMARK(Matrix2, Inverse)
+{
+	repeat(iterations, [](const Matrix2& X) { return X.inverse(); }, A);
+}
+
+BENCHMARK(Matrix2, Scaling)
+{
+	repeat(iterations, [](const Vector2& factors) { return Matrix2::scaling(factors); }, v);
+}
+
+BENCHMARK(Matrix2, UniformScaling)
+{
+	repeat(iterations, [](float factor) { return Matrix2::scaling(factor); }, 2.5f);
+}
+
+BENCHMARK(Matrix2, AngleRotation)
+{
+	repeat(iterations, [](float angle) { return Matrix2::angleRotation(angle); }, 0.7f);
+}
+
+BENCHMARK(Matrix2, FromToRotation)
+{
+	repeat(iterations, [](const Vector2& from, const Vector2& to) { return Matrix2::fromToRotation(from, to); }, v, Vector2::UP);
+}
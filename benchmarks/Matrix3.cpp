@@ -0,0 +1,93 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Matrix3.hpp>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Matrix3 A(4.0f, 2.0f, -3.0f, 1.0f, 5.0f, 0.5f, -1.0f, 2.0f, 6.0f);
+	const Matrix3 B(0.5f, -1.5f, 2.5f, 1.0f, 3.0f, -2.0f, 0.25f, 1.0f, 2.0f);
+	const Vector3 v(1.5f, -2.0f, 0.75f);
+}
+
+BENCHMARK(Matrix3, Equality)
+{
+	repeat(iterations, [](const Matrix3& X, const Matrix3& Y) { return X == Y; }, A, B);
+}
+
+BENCHMARK(Matrix3, Addition)
+{
+	repeat(iterations, [](const Matrix3& X, const Matrix3& Y) { return X + Y; }, A, B);
+}
+
+BENCHMARK(Matrix3, Subtraction)
+{
+	repeat(iterations, [](const Matrix3& X, const Matrix3& Y) { return X - Y; }, A, B);
+}
+
+BENCHMARK(Matrix3, Negation)
+{
+	repeat(iterations, [](const Matrix3& X) { return -X; }, A);
+}
+
+BENCHMARK(Matrix3, ScalarMultiplication)
+{
+	repeat(iterations, [](const Matrix3& X, float s) { return X * s; }, A, 2.5f);
+}
+
+BENCHMARK(Matrix3, ColumnVectorMultiplication)
+{
+	repeat(iterations, [](const Matrix3& X, const Vector3& u) { return X * u; }, A, v);
+}
+
+BENCHMARK(Matrix3, RowVectorMultiplication)
+{
+	repeat(iterations, [](const Vector3& u, const Matrix3& X) { return u * X; }, v, A);
+}
+
+BENCHMARK(Matrix3, MatrixMultiplication)
+{
+	repeat(iterations, [](const Matrix3& X, const Matrix3& Y) { return X * Y; }, A, B);
+}
+
+BENCHMARK(Matrix3, Transposed)
+{
+	repeat(iterations, [](const Matrix3& X) { return X.transposed(); }, A);
+}
+
+BENCHMARK(Matrix3, Transpose)
+{
+	repeat(iterations, [](Matrix3 X) { X.transpose(); return X; }, A);
+}
+
+BENCHMARK(Matrix3, Determinant)
+{
+	repeat(iterations, [](const Matrix3& X) { return X.determinant(); }, A);
+}
+
+BENCHMARK(Matrix3, Inverse)
+{
+	repeat(iterations, [](const Matrix3& X) { return X.inverse(); }, A);
+}
+
+BENCHMARK(Matrix3, AngleAxis)
+{
+	repeat(iterations, [](float angle, const Vector3& axis) { return Matrix3::angleAxis(angle, axis); }, 0.7f, Vector3::UP);
+}
+
+BENCHMARK(Matrix3, Euler)
+{
+	repeat(iterations, [](const Vector3& angles) { return Matrix3::euler(angles); }, Vector3(0.1f, 0.2f, 0.3f));
+}
+
+BENCHMARK(Matrix3, FromToRotation)
+{
+	repeat(iterations, [](const Vector3& from, const Vector3& to) { return Matrix3::fromToRotation(from, to); }, v, Vector3::UP);
+}
+
+BENCHMARK(Matrix3, LookRotation)
+{
+	repeat(iterations, [](const Vector3& forward, const Vector3& upwards) { return Matrix3::lookRotation(forward, upwards); }, v, Vector3::UP);
+}
@@ -0,0 +1,347 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Matrix4 A(
+		4.0f, 2.0f, -3.0f, 1.0f,
+		1.0f, 5.0f, 0.5f, -2.0f,
+		-1.0f, 2.0f, 6.0f, 0.25f,
+		0.5f, -1.0f, 1.5f, 3.0f
+	);
+	const Matrix4 B(
+		0.5f, -1.5f, 2.5f, 1.0f,
+		1.0f, 3.0f, -2.0f, 0.5f,
+		0.25f, 1.0f, 2.0f, -1.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	);
+	const Matrix4 P = Matrix4::perspective(1.2f, 1.5f, 0.1f, 100.0f);
+	const Matrix4 V = Matrix4::lookAt(Vector3(1.0f, 2.0f, 3.0f), Vector3(4.0f, 2.0f, -1.0f), Vector3::UP);
+	const Vector4 v(1.5f, -2.0f, 0.75f, 1.0f);
+	const Vector3 u(1.5f, -2.0f, 0.75f);
+
+	// Number of elements processed by each call to a batch function.
+	const std::size_t batchSize = 1024;
+}
+
+BENCHMARK(Matrix4, FromMatrix3)
+{
+	repeat(iterations, [](const Matrix3& X) { return Matrix4(X); }, Matrix3::euler(u));
+}
+
+BENCHMARK(Matrix4, FromQuaternion)
+{
+	repeat(iterations, [](const Quaternion& q) { return Matrix4(q); }, Quaternion::euler(u));
+}
+
+BENCHMARK(Matrix4, Equality)
+{
+	repeat(iterations, [](const Matrix4& X, const Matrix4& Y) { return X == Y; }, A, B);
+}
+
+BENCHMARK(Matrix4, Addition)
+{
+	repeat(iterations, [](const Matrix4& X, const Matrix4& Y) { return X + Y; }, A, B);
+}
+
+BENCHMARK(Matrix4, Subtraction)
+{
+	repeat(iterations, [](const Matrix4& X, const Matrix4& Y) { return X - Y; }, A, B);
+}
+
+BENCHMARK(Matrix4, Negation)
+{
+	repeat(iterations, [](const Matrix4& X) { return -X; }, A);
+}
+
+BENCHMARK(Matrix4, ScalarMultiplication)
+{
+	repeat(iterations, [](const Matrix4& X, float s) { return X * s; }, A, 2.5f);
+}
+
+BENCHMARK(Matrix4, ColumnVectorMultiplication)
+{
+	repeat(iterations, [](const Matrix4& X, const Vector4& w) { return X * w; }, A, v);
+}
+
+BENCHMARK(Matrix4, RowVectorMultiplication)
+{
+	repeat(iterations, [](const Vector4& w, const Matrix4& X) { return w * X; }, v, A);
+}
+
+BENCHMARK(Matrix4, MatrixMultiplication)
+{
+	repeat(iterations, [](const Matrix4& X, const Matrix4& Y) { return X * Y; }, A, B);
+}
+
+BENCHMARK(Matrix4, Transposed)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.transposed(); }, A);
+}
+
+BENCHMARK(Matrix4, Transpose)
+{
+	repeat(iterations, [](Matrix4 X) { X.transpose(); return X; }, A);
+}
+
+BENCHMARK(Matrix4, Determinant)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.determinant(); }, A);
+}
+
+BENCHMARK(Matrix4, Inverse)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.inverse(); }, A);
+}
+
+BENCHMARK(Matrix4, TryInverse)
+{
+	repeat(iterations, [](const Matrix4& X) { Matrix4 inv; X.tryInverse(inv); return inv; }, A);
+}
+
+BENCHMARK(Matrix4, InverseThenTransposed)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.inverse().transposed(); }, A);
+}
+
+BENCHMARK(Matrix4, InverseTranspose)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.inverseTranspose(); }, A);
+}
+
+BENCHMARK(Matrix4, NormalMatrix)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.normalMatrix(); }, A);
+}
+
+BENCHMARK(Matrix4, ProjectionInverse)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.projectionInverse(); }, P);
+}
+
+// The general inverse of the same projection, for comparison.
+BENCHMARK(Matrix4, ProjectionGeneralInverse)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.inverse(); }, P);
+}
+
+BENCHMARK(Matrix4, RigidInverse)
+{
+	repeat(iterations, [](const Matrix4& X) { return X.rigidInverse(); }, V);
+}
+
+BENCHMARK(Matrix4, Scaling)
+{
+	repeat(iterations, [](const Vector3& factors) { return Matrix4::scaling(factors); }, u);
+}
+
+BENCHMARK(Matrix4, UniformScaling)
+{
+	repeat(iterations, [](float factor) { return Matrix4::scaling(factor); }, 2.5f);
+}
+
+BENCHMARK(Matrix4, Translation)
+{
+	repeat(iterations, [](const Vector3& translation) { return Matrix4::translation(translation); }, u);
+}
+
+BENCHMARK(Matrix4, AngleAxis)
+{
+	repeat(iterations, [](float angle, const Vector3& axis) { return Matrix4::angleAxis(angle, axis); }, 0.7f, Vector3::UP);
+}
+
+BENCHMARK(Matrix4, Euler)
+{
+	repeat(iterations, [](const Vector3& angles) { return Matrix4::euler(angles); }, Vector3(0.1f, 0.2f, 0.3f));
+}
+
+BENCHMARK(Matrix4, FromToRotation)
+{
+	repeat(iterations, [](const Vector3& from, const Vector3& to) { return Matrix4::fromToRotation(from, to); }, u, Vector3::UP);
+}
+
+BENCHMARK(Matrix4, LookRotation)
+{
+	repeat(iterations, [](const Vector3& forward, const Vector3& upwards) { return Matrix4::lookRotation(forward, upwards); }, u, Vector3::UP);
+}
+
+BENCHMARK(Matrix4, LookRotationEye)
+{
+	repeat(iterations, [](const Vector3& target, const Vector3& eye) { return Matrix4::lookRotation(target, eye, Vector3::UP); }, u, Vector3::FORWARD);
+}
+
+BENCHMARK(Matrix4, LookAt)
+{
+	repeat(iterations, [](const Vector3& eye, const Vector3& target) { return Matrix4::lookAt(eye, target, Vector3::UP); }, u, Vector3::FORWARD);
+}
+
+BENCHMARK(Matrix4, Perspective)
+{
+	repeat(iterations, [](float fov, float aspect) { return Matrix4::perspective(fov, aspect, 0.1f, 100.0f); }, 1.2f, 1.5f);
+}
+
+BENCHMARK(Matrix4, Orthographic)
+{
+	repeat(iterations, [](float width, float height) { return Matrix4::orthographic(-width, width, -height, height, 0.1f, 100.0f); }, 8.0f, 6.0f);
+}
+
+BENCHMARK_BATCH(Matrix4, TransformPointsOneByOne, batchSize)
+{
+	std::vector<Vector3> in(batchSize, u);
+	std::vector<Vector3> out(batchSize);
+	Matrix4 X = B;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = X * Vector4(in[j], 1.0f);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, TransformPoints, batchSize)
+{
+	std::vector<Vector3> in(batchSize, u);
+	std::vector<Vector3> out(batchSize);
+	Matrix4 X = B;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		transformPoints(X, in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, TransformPointsSoA, batchSize)
+{
+	std::vector<float> xs(batchSize, u.x), ys(batchSize, u.y), zs(batchSize, u.z);
+	std::vector<float> outXs(batchSize), outYs(batchSize), outZs(batchSize);
+	Matrix4 X = B;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		transformPoints(X, xs.data(), ys.data(), zs.data(), outXs.data(), outYs.data(), outZs.data(), batchSize);
+		doNotOptimize(outXs[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, TransformDirections, batchSize)
+{
+	std::vector<Vector3> in(batchSize, u);
+	std::vector<Vector3> out(batchSize);
+	Matrix4 X = B;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		transformDirections(X, in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, TransformVectors, batchSize)
+{
+	std::vector<Vector4> in(batchSize, v);
+	std::vector<Vector4> out(batchSize);
+	Matrix4 X = B;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		transform(X, in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, MultiplyOneByOne, batchSize)
+{
+	std::vector<Matrix4> models(batchSize, B);
+	std::vector<Matrix4> out(batchSize);
+	Matrix4 X = A;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = X * models[j];
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, MultiplyPairs, batchSize)
+{
+	std::vector<Matrix4> lhs(batchSize, A);
+	std::vector<Matrix4> rhs(batchSize, B);
+	std::vector<Matrix4> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		multiply(lhs.data(), rhs.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, MultiplySharedLeft, batchSize)
+{
+	std::vector<Matrix4> models(batchSize, B);
+	std::vector<Matrix4> out(batchSize);
+	Matrix4 X = A;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		multiply(X, models.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, MultiplySharedRight, batchSize)
+{
+	std::vector<Matrix4> lhs(batchSize, A);
+	std::vector<Matrix4> out(batchSize);
+	Matrix4 X = B;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(X);
+		multiply(lhs.data(), X, out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, InverseTransposeOneByOne, batchSize)
+{
+	std::vector<Matrix4> models(batchSize, A);
+	std::vector<Matrix4> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = models[j].inverseTranspose();
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, InverseTransposeArray, batchSize)
+{
+	std::vector<Matrix4> models(batchSize, A);
+	std::vector<Matrix4> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		inverseTranspose(models.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Matrix4, TryInverseArray, batchSize)
+{
+	std::vector<Matrix4> models(batchSize, A);
+	std::vector<Matrix4> out(batchSize);
+	std::unique_ptr<bool[]> valid(new bool[batchSize]);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		std::size_t inverted = tryInverse(models.data(), out.data(), valid.get(), batchSize);
+		doNotOptimize(inverted);
+		doNotOptimize(out[0]);
+	}
+}
@@ -0,0 +1,165 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Packed.hpp>
+
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Vector3 v(1.5f, -2.0f, 0.75f);
+	const Quaternion q = Quaternion(0.5f, 1.0f, -2.0f, 3.0f).normalized();
+
+	// Number of elements packed or unpacked by each iteration of the batch
+	// benchmarks.
+	const std::size_t batchSize = 1024;
+}
+
+BENCHMARK(Packed, Vector3hPack)
+{
+	repeat(iterations, [](const Vector3& a) { return Vector3h(a); }, v);
+}
+
+BENCHMARK(Packed, Quaternion32Pack)
+{
+	repeat(iterations, [](const Quaternion& a) { return PackedQuaternion32(a); }, q);
+}
+
+BENCHMARK(Packed, Quaternion32Unpack)
+{
+	repeat(iterations, [](const PackedQuaternion32& a) { return a.unpack(); }, PackedQuaternion32(q));
+}
+
+BENCHMARK_BATCH(Packed, Vector3hPackOneByOne, batchSize)
+{
+	std::vector<Vector3> in(batchSize, v);
+	std::vector<Vector3h> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = Vector3h(in[j]);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Vector3hPackBatch, batchSize)
+{
+	std::vector<Vector3> in(batchSize, v);
+	std::vector<Vector3h> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		pack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Vector3hUnpackBatch, batchSize)
+{
+	std::vector<Vector3h> in(batchSize, Vector3h(v));
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		unpack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Vector3sPackBatch, batchSize)
+{
+	std::vector<Vector3> in(batchSize, v.normalized());
+	std::vector<Vector3s> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		pack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Vector3sUnpackBatch, batchSize)
+{
+	std::vector<Vector3s> in(batchSize, Vector3s(v.normalized()));
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		unpack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Quaternion32PackOneByOne, batchSize)
+{
+	std::vector<Quaternion> in(batchSize, q);
+	std::vector<PackedQuaternion32> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = PackedQuaternion32(in[j]);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Quaternion32PackBatch, batchSize)
+{
+	std::vector<Quaternion> in(batchSize, q);
+	std::vector<PackedQuaternion32> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		pack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Quaternion32UnpackOneByOne, batchSize)
+{
+	std::vector<PackedQuaternion32> in(batchSize, PackedQuaternion32(q));
+	std::vector<Quaternion> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = in[j].unpack();
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Quaternion32UnpackBatch, batchSize)
+{
+	std::vector<PackedQuaternion32> in(batchSize, PackedQuaternion32(q));
+	std::vector<Quaternion> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		unpack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Quaternion48PackBatch, batchSize)
+{
+	std::vector<Quaternion> in(batchSize, q);
+	std::vector<PackedQuaternion48> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		pack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Packed, Quaternion48UnpackBatch, batchSize)
+{
+	std::vector<PackedQuaternion48> in(batchSize, PackedQuaternion48(q));
+	std::vector<Quaternion> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(in[0]);
+		unpack(in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
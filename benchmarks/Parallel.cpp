@@ -0,0 +1,108 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Parallel.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Matrix4 A = Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f)) * Matrix4::euler(Vector3(0.1f, 0.2f, 0.3f));
+	const Quaternion q = Quaternion::euler(Vector3(-0.4f, 0.5f, 1.2f));
+
+	// Number of elements processed by each iteration, large enough to span
+	// many chunks and to exceed the caches.
+	const std::size_t batchSize = 1 << 20;
+
+	// The pool with one thread per hardware thread, shared by the
+	// benchmarks, and the single-threaded pool for comparison.
+	parallel::ThreadPool& pool()
+	{
+		static parallel::ThreadPool instance;
+		return instance;
+	}
+
+	parallel::ThreadPool& serialPool()
+	{
+		static parallel::ThreadPool instance(1);
+		return instance;
+	}
+}
+
+BENCHMARK_BATCH(Parallel, TransformSerial, batchSize)
+{
+	std::vector<Vector4> vectors(batchSize, Vector4(1.5f, -2.0f, 0.75f, 1.0f));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		transform(A, vectors.data(), vectors.data(), batchSize);
+		doNotOptimize(vectors[0]);
+	}
+}
+
+BENCHMARK_BATCH(Parallel, TransformSingleThreadPool, batchSize)
+{
+	std::vector<Vector4> vectors(batchSize, Vector4(1.5f, -2.0f, 0.75f, 1.0f));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		parallel::transform(serialPool(), A, vectors.data(), vectors.data(), batchSize);
+		doNotOptimize(vectors[0]);
+	}
+}
+
+BENCHMARK_BATCH(Parallel, Transform, batchSize)
+{
+	std::vector<Vector4> vectors(batchSize, Vector4(1.5f, -2.0f, 0.75f, 1.0f));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		parallel::transform(pool(), A, vectors.data(), vectors.data(), batchSize);
+		doNotOptimize(vectors[0]);
+	}
+}
+
+BENCHMARK_BATCH(Parallel, Rotate, batchSize)
+{
+	std::vector<Vector3> vectors(batchSize, Vector3(1.5f, -2.0f, 0.75f));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		parallel::rotate(pool(), q, vectors.data(), vectors.data(), batchSize);
+		doNotOptimize(vectors[0]);
+	}
+}
+
+BENCHMARK_BATCH(Parallel, RotateEach, batchSize)
+{
+	std::vector<Quaternion> rotations(batchSize, q);
+	std::vector<Vector3> vectors(batchSize, Vector3(1.5f, -2.0f, 0.75f));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		parallel::rotate(pool(), rotations.data(), vectors.data(), vectors.data(), batchSize);
+		doNotOptimize(vectors[0]);
+	}
+}
+
+BENCHMARK_BATCH(Parallel, Multiply, batchSize / 16)
+{
+	std::vector<Matrix4> lhs(batchSize / 16, A);
+	std::vector<Matrix4> rhs(batchSize / 16, A);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		parallel::multiply(pool(), lhs.data(), rhs.data(), rhs.data(), batchSize / 16);
+		doNotOptimize(rhs[0]);
+	}
+}
+
+BENCHMARK_BATCH(Parallel, Normalize, batchSize)
+{
+	std::vector<Vector3> vectors(batchSize, Vector3(1.5f, -2.0f, 0.75f));
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		parallel::normalize(pool(), vectors.data(), vectors.data(), batchSize);
+		doNotOptimize(vectors[0]);
+	}
+}
@@ -0,0 +1,224 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Quaternion.hpp>
+
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Quaternion p = Quaternion::euler(Vector3(0.1f, 0.2f, 0.3f));
+	const Quaternion q = Quaternion::euler(Vector3(-0.4f, 0.5f, 1.2f));
+	const Vector3 v(1.5f, -2.0f, 0.75f);
+
+	// Number of vectors rotated by each iteration of the batch benchmarks.
+	const std::size_t batchSize = 1024;
+}
+
+BENCHMARK(Quaternion, Equality)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b) { return a == b; }, p, q);
+}
+
+BENCHMARK(Quaternion, Multiplication)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b) { return a * b; }, p, q);
+}
+
+BENCHMARK(Quaternion, VectorRotation)
+{
+	repeat(iterations, [](const Quaternion& a, const Vector3& u) { return a * u; }, p, v);
+}
+
+BENCHMARK(Quaternion, SqrMagnitude)
+{
+	repeat(iterations, [](const Quaternion& a) { return a.sqrMagnitude(); }, p);
+}
+
+BENCHMARK(Quaternion, Magnitude)
+{
+	repeat(iterations, [](const Quaternion& a) { return a.magnitude(); }, p);
+}
+
+BENCHMARK(Quaternion, Normalized)
+{
+	repeat(iterations, [](const Quaternion& a) { return a.normalized(); }, p);
+}
+
+BENCHMARK(Quaternion, Normalize)
+{
+	repeat(iterations, [](Quaternion a) { a.normalize(); return a; }, p);
+}
+
+BENCHMARK(Quaternion, Nlerp)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b, float t) { return nlerp(a, b, t); }, p, q, 0.3f);
+}
+
+BENCHMARK(Quaternion, Slerp)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b, float t) { return slerp(a, b, t); }, p, q, 0.3f);
+}
+
+BENCHMARK(Quaternion, Squad)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b, float t) { return squad(a, b, a, b, t); }, p, q, 0.3f);
+}
+
+BENCHMARK(Quaternion, SquadControlPoint)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b) { return squadControlPoint(a, b, a); }, p, q);
+}
+
+BENCHMARK(Quaternion, RotateTowards)
+{
+	repeat(iterations, [](Quaternion a, const Quaternion& b) { a.rotateTowards(b, 0.01f); return a; }, p, q);
+}
+
+BENCHMARK(Quaternion, AngleAxis)
+{
+	repeat(iterations, [](float angle, const Vector3& axis) { return Quaternion::angleAxis(angle, axis); }, 0.7f, Vector3::UP);
+}
+
+BENCHMARK(Quaternion, Euler)
+{
+	repeat(iterations, [](const Vector3& angles) { return Quaternion::euler(angles); }, Vector3(0.1f, 0.2f, 0.3f));
+}
+
+BENCHMARK(Quaternion, FromToRotation)
+{
+	repeat(iterations, [](const Vector3& from, const Vector3& to) { return Quaternion::fromToRotation(from, to); }, v, Vector3::UP);
+}
+
+BENCHMARK(Quaternion, LookRotation)
+{
+	repeat(iterations, [](const Vector3& forward) { return Quaternion::lookRotation(forward); }, v);
+}
+
+BENCHMARK(Quaternion, LookRotationUpwards)
+{
+	repeat(iterations, [](const Vector3& forward, const Vector3& upwards) { return Quaternion::lookRotation(forward, upwards); }, v, Vector3::UP);
+}
+
+BENCHMARK(Quaternion, Conjugate)
+{
+	repeat(iterations, [](const Quaternion& a) { return a.conjugate(); }, p);
+}
+
+BENCHMARK(Quaternion, Inverse)
+{
+	repeat(iterations, [](const Quaternion& a) { return a.inverse(); }, p);
+}
+
+BENCHMARK(Quaternion, Dot)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b) { return dot(a, b); }, p, q);
+}
+
+BENCHMARK(Quaternion, Angle)
+{
+	repeat(iterations, [](const Quaternion& a, const Quaternion& b) { return angle(a, b); }, p, q);
+}
+
+BENCHMARK_BATCH(Quaternion, RotateOneByOne, batchSize)
+{
+	std::vector<Vector3> in(batchSize, v);
+	std::vector<Vector3> out(batchSize);
+	Quaternion a = p;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(a);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = a * in[j];
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Quaternion, Rotate, batchSize)
+{
+	std::vector<Vector3> in(batchSize, v);
+	std::vector<Vector3> out(batchSize);
+	Quaternion a = p;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(a);
+		rotate(a, in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Quaternion, RotateEach, batchSize)
+{
+	std::vector<Quaternion> rotations(batchSize, p);
+	std::vector<Vector3> in(batchSize, v);
+	std::vector<Vector3> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(rotations[0]);
+		rotate(rotations.data(), in.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
+
+// The sampling benchmarks blend one pair of keyframe rotations per bone, as
+// an animation system does for each skeleton every frame.
+
+BENCHMARK_BATCH(Quaternion, SampleRotateTowards, batchSize)
+{
+	std::vector<Quaternion> from(batchSize, p);
+	std::vector<Quaternion> to(batchSize, q);
+	std::vector<Quaternion> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(from[0]);
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			out[j] = from[j];
+			out[j].rotateTowards(to[j], 0.25f);
+		}
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Quaternion, SampleSlerpOneByOne, batchSize)
+{
+	std::vector<Quaternion> from(batchSize, p);
+	std::vector<Quaternion> to(batchSize, q);
+	std::vector<float> factors(batchSize, 0.3f);
+	std::vector<Quaternion> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(from[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = slerp(from[j], to[j], factors[j]);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Quaternion, SampleNlerpOneByOne, batchSize)
+{
+	std::vector<Quaternion> from(batchSize, p);
+	std::vector<Quaternion> to(batchSize, q);
+	std::vector<float> factors(batchSize, 0.3f);
+	std::vector<Quaternion> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(from[0]);
+		for (std::size_t j = 0; j < batchSize; ++j) out[j] = nlerp(from[j], to[j], factors[j]);
+		doNotOptimize(out[0]);
+	}
+}
+
+BENCHMARK_BATCH(Quaternion, SampleSlerp, batchSize)
+{
+	std::vector<Quaternion> from(batchSize, p);
+	std::vector<Quaternion> to(batchSize, q);
+	std::vector<float> factors(batchSize, 0.3f);
+	std::vector<Quaternion> out(batchSize);
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(from[0]);
+		slerp(from.data(), to.data(), factors.data(), out.data(), batchSize);
+		doNotOptimize(out[0]);
+	}
+}
@@ -0,0 +1,235 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Ray.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Sphere.hpp>
+#include <M3D/Triangle.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	// Number of primitives or rays intersected by each iteration of the
+	// batch benchmarks.
+	const std::size_t batchSize = 1024;
+
+	const Ray ray(Vector3(0.1f, -0.2f, 0.3f), Vector3(0.3f, 0.5f, -1.0f));
+	const Triangle triangle(Vector3(-1.0f, -1.0f, -3.0f), Vector3(1.0f, -1.0f, -3.0f), Vector3(0.0f, 1.0f, -3.0f));
+	const AABB box(Vector3(-1.0f, -1.0f, -6.0f), Vector3(1.0f, 1.0f, -4.0f));
+	const Sphere sphere(Vector3(0.0f, 0.0f, -5.0f), 1.0f);
+
+	/**
+	 * Returns a pseudo-random point in the box [-4, 4]^3 for the index `i`
+	 * and the seed `k`.
+	 */
+	Vector3 point(std::size_t i, float k)
+	{
+		const float f = static_cast<float>(i) + k;
+		return Vector3(4.0f * std::sin(1.3f * f), 4.0f * std::cos(0.7f * f), 4.0f * std::sin(0.31f * f + 1.0f));
+	}
+
+	/**
+	 * Triangles, boxes, spheres and rays stored in structure-of-arrays form,
+	 * a fraction of which intersect.
+	 */
+	struct Scene
+	{
+		Scene()
+		: triangles(batchSize), boxes(batchSize), spheres(batchSize), rays(batchSize)
+		, axs(batchSize), ays(batchSize), azs(batchSize)
+		, bxs(batchSize), bys(batchSize), bzs(batchSize)
+		, cxs(batchSize), cys(batchSize), czs(batchSize)
+		, minXs(batchSize), minYs(batchSize), minZs(batchSize)
+		, maxXs(batchSize), maxYs(batchSize), maxZs(batchSize)
+		, xs(batchSize), ys(batchSize), zs(batchSize), radii(batchSize)
+		, oxs(batchSize), oys(batchSize), ozs(batchSize)
+		, dxs(batchSize), dys(batchSize), dzs(batchSize)
+		, distances(batchSize)
+		{
+			for (std::size_t i = 0; i < batchSize; ++i)
+			{
+				const Vector3 p = point(i, 0.0f);
+				triangles[i] = Triangle(p, -p + point(i, 1.0f) * 0.5f, -p + point(i, 2.0f) * 0.5f);
+				boxes[i] = AABB(p, p + Vector3(1.0f, 1.0f, 1.0f));
+				spheres[i] = Sphere(p, 0.75f);
+				rays[i] = Ray(p, point(i, 3.0f) * 0.25f - p);
+
+				axs[i] = triangles[i].a.x; ays[i] = triangles[i].a.y; azs[i] = triangles[i].a.z;
+				bxs[i] = triangles[i].b.x; bys[i] = triangles[i].b.y; bzs[i] = triangles[i].b.z;
+				cxs[i] = triangles[i].c.x; cys[i] = triangles[i].c.y; czs[i] = triangles[i].c.z;
+				minXs[i] = boxes[i].min.x; minYs[i] = boxes[i].min.y; minZs[i] = boxes[i].min.z;
+				maxXs[i] = boxes[i].max.x; maxYs[i] = boxes[i].max.y; maxZs[i] = boxes[i].max.z;
+				xs[i] = p.x; ys[i] = p.y; zs[i] = p.z; radii[i] = spheres[i].radius;
+				oxs[i] = rays[i].origin.x; oys[i] = rays[i].origin.y; ozs[i] = rays[i].origin.z;
+				dxs[i] = rays[i].direction.x; dys[i] = rays[i].direction.y; dzs[i] = rays[i].direction.z;
+			}
+		}
+
+		std::vector<Triangle> triangles;
+		std::vector<AABB> boxes;
+		std::vector<Sphere> spheres;
+		std::vector<Ray> rays;
+		std::vector<float> axs, ays, azs, bxs, bys, bzs, cxs, cys, czs;
+		std::vector<float> minXs, minYs, minZs, maxXs, maxYs, maxZs;
+		std::vector<float> xs, ys, zs, radii;
+		std::vector<float> oxs, oys, ozs, dxs, dys, dzs;
+		std::vector<float> distances;
+	};
+
+	/**
+	 * Intersects `ray` with each of `primitives` in turn, storing the
+	 * distances as the batch functions do.
+	 */
+	template <typename Primitive>
+	void intersectOneByOne(const Ray& r, const std::vector<Primitive>& primitives, std::vector<float>& distances)
+	{
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			float t;
+			distances[j] = r.intersects(primitives[j], t) ? t : std::numeric_limits<float>::infinity();
+		}
+	}
+}
+
+BENCHMARK(Ray, IntersectsTriangle)
+{
+	repeat(iterations, [](const Ray& r, const Triangle& T) { float t = 0.0f; return r.intersects(T, t) ? t : 0.0f; }, ray, triangle);
+}
+
+BENCHMARK(Ray, IntersectsBox)
+{
+	repeat(iterations, [](const Ray& r, const AABB& B) { float t = 0.0f; return r.intersects(B, t) ? t : 0.0f; }, ray, box);
+}
+
+BENCHMARK(Ray, IntersectsSphere)
+{
+	repeat(iterations, [](const Ray& r, const Sphere& S) { float t = 0.0f; return r.intersects(S, t) ? t : 0.0f; }, ray, sphere);
+}
+
+BENCHMARK_BATCH(Ray, IntersectTrianglesOneByOne, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.triangles[0]);
+		intersectOneByOne(ray, scene.triangles, scene.distances);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectTriangles, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.axs[0]);
+		intersectTriangles(ray, scene.axs.data(), scene.ays.data(), scene.azs.data(),
+			scene.bxs.data(), scene.bys.data(), scene.bzs.data(),
+			scene.cxs.data(), scene.cys.data(), scene.czs.data(), scene.distances.data(), batchSize);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectBoxesOneByOne, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.boxes[0]);
+		intersectOneByOne(ray, scene.boxes, scene.distances);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectBoxes, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.minXs[0]);
+		intersectBoxes(ray, scene.minXs.data(), scene.minYs.data(), scene.minZs.data(),
+			scene.maxXs.data(), scene.maxYs.data(), scene.maxZs.data(), scene.distances.data(), batchSize);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectSpheresOneByOne, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.spheres[0]);
+		intersectOneByOne(ray, scene.spheres, scene.distances);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectSpheres, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.xs[0]);
+		intersectSpheres(ray, scene.xs.data(), scene.ys.data(), scene.zs.data(), scene.radii.data(),
+			scene.distances.data(), batchSize);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectRaysTriangleOneByOne, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.rays[0]);
+		for (std::size_t j = 0; j < batchSize; ++j)
+		{
+			float t;
+			scene.distances[j] = scene.rays[j].intersects(triangle, t) ? t : std::numeric_limits<float>::infinity();
+		}
+
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectRaysTriangle, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.oxs[0]);
+		intersectRays(scene.oxs.data(), scene.oys.data(), scene.ozs.data(),
+			scene.dxs.data(), scene.dys.data(), scene.dzs.data(), triangle, scene.distances.data(), batchSize);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectRaysBox, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.oxs[0]);
+		intersectRays(scene.oxs.data(), scene.oys.data(), scene.ozs.data(),
+			scene.dxs.data(), scene.dys.data(), scene.dzs.data(), box, scene.distances.data(), batchSize);
+		doNotOptimize(scene.distances[0]);
+	}
+}
+
+BENCHMARK_BATCH(Ray, IntersectRaysSphere, batchSize)
+{
+	Scene scene;
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		doNotOptimize(scene.oxs[0]);
+		intersectRays(scene.oxs.data(), scene.oys.data(), scene.ozs.data(),
+			scene.dxs.data(), scene.dys.data(), scene.dzs.data(), sphere, scene.distances.data(), batchSize);
+		doNotOptimize(scene.distances[0]);
+	}
+}
@@ -0,0 +1,137 @@
+#include "Benchmark.hpp"
+
+#include <M3D/TransformHierarchy.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	// Number of nodes in the scene.
+	const std::size_t nodeCount = 4096;
+
+	/**
+	 * Returns the parent of node `i`, a pseudo-random earlier node, which
+	 * gives 16 random trees of logarithmic depth.
+	 */
+	std::size_t parentOf(std::size_t i)
+	{
+		if (i < 16) return TransformHierarchy::NO_PARENT;
+		return ((i * 2654435761u) >> 8) % i;
+	}
+
+	/**
+	 * Node of a pointer-linked scene graph, for comparison.
+	 */
+	struct Node
+	{
+		Vector3 position;
+		Quaternion rotation;
+		Vector3 scale;
+		Matrix4 world;
+		std::vector<Node*> children;
+	};
+
+	void updateNode(Node& node, const Matrix4& parent)
+	{
+		node.world = parent * Matrix4::translation(node.position) * Matrix4(node.rotation) *
+			Matrix4::scaling(node.scale);
+		for (std::size_t i = 0; i < node.children.size(); ++i)
+		{
+			updateNode(*node.children[i], node.world);
+		}
+	}
+
+	/**
+	 * The same nodes as a hierarchy and as a pointer-linked graph, whose
+	 * nodes are allocated separately.
+	 */
+	struct Scene
+	{
+		Scene()
+		{
+			hierarchy.reserve(nodeCount);
+			for (std::size_t i = 0; i < nodeCount; ++i)
+			{
+				const float k = static_cast<float>(i);
+				const Vector3 position(std::sin(k), std::cos(k), 0.1f * k);
+				const Quaternion rotation = Quaternion::euler(Vector3(0.1f * k, std::sin(k), 0.3f));
+				const Vector3 scale(1.0f, 1.0f + 0.01f * std::sin(k), 1.0f);
+				const std::size_t parent = parentOf(i);
+				hierarchy.add(parent, position, rotation, scale);
+
+				nodes.push_back(std::unique_ptr<Node>(new Node()));
+				nodes.back()->position = position;
+				nodes.back()->rotation = rotation;
+				nodes.back()->scale = scale;
+				if (parent == TransformHierarchy::NO_PARENT) roots.push_back(nodes.back().get());
+				else nodes[parent]->children.push_back(nodes.back().get());
+			}
+
+			hierarchy.update();
+		}
+
+		TransformHierarchy hierarchy;
+		std::vector<std::unique_ptr<Node>> nodes;
+		std::vector<Node*> roots;
+	};
+
+	// The scene is built on first use, outside of the timed loops.
+	Scene& scene()
+	{
+		static Scene instance;
+		return instance;
+	}
+}
+
+BENCHMARK_BATCH(TransformHierarchy, UpdateLinked, nodeCount)
+{
+	Scene& s = scene();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t r = 0; r < s.roots.size(); ++r)
+		{
+			updateNode(*s.roots[r], Matrix4::IDENTITY);
+		}
+
+		doNotOptimize(s.roots[0]->world);
+	}
+}
+
+BENCHMARK_BATCH(TransformHierarchy, UpdateAll, nodeCount)
+{
+	Scene& s = scene();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t r = 0; r < 16; ++r)
+		{
+			s.hierarchy.setScale(r, s.hierarchy.scale(r));
+		}
+
+		std::size_t recomputed = s.hierarchy.update();
+		doNotOptimize(recomputed);
+	}
+}
+
+BENCHMARK_BATCH(TransformHierarchy, UpdateFewChanged, nodeCount)
+{
+	// A handful of nodes deep in the trees move each frame.
+	Scene& s = scene();
+	for (std::size_t i = 0; i < iterations; ++i)
+	{
+		for (std::size_t node = nodeCount - 64; node < nodeCount; node += 8)
+		{
+			s.hierarchy.setPosition(node, s.hierarchy.position(node));
+		}
+
+		std::size_t recomputed = s.hierarchy.update();
+		doNotOptimize(recomputed);
+	}
+}
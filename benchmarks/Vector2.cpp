@@ -0,0 +1,87 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Vector2.hpp>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Vector2 a(1.5f, -2.0f);
+	const Vector2 b(0.25f, 3.0f);
+}
+
+BENCHMARK(Vector2, Equality)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return u == v; }, a, b);
+}
+
+BENCHMARK(Vector2, Addition)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return u + v; }, a, b);
+}
+
+BENCHMARK(Vector2, Subtraction)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return u - v; }, a, b);
+}
+
+BENCHMARK(Vector2, Negation)
+{
+	repeat(iterations, [](const Vector2& u) { return -u; }, a);
+}
+
+BENCHMARK(Vector2, ScalarMultiplication)
+{
+	repeat(iterations, [](const Vector2& u, float s) { return u * s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector2, ScalarDivision)
+{
+	repeat(iterations, [](const Vector2& u, float s) { return u / s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector2, SqrMagnitude)
+{
+	repeat(iterations, [](const Vector2& u) { return u.sqrMagnitude(); }, a);
+}
+
+BENCHMARK(Vector2, Magnitude)
+{
+	repeat(iterations, [](const Vector2& u) { return u.magnitude(); }, a);
+}
+
+BENCHMARK(Vector2, Normalized)
+{
+	repeat(iterations, [](const Vector2& u) { return u.normalized(); }, a);
+}
+
+BENCHMARK(Vector2, Normalize)
+{
+	repeat(iterations, [](Vector2 u) { u.normalize(); return u; }, a);
+}
+
+BENCHMARK(Vector2, Scale)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return scale(u, v); }, a, b);
+}
+
+BENCHMARK(Vector2, Dot)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return dot(u, v); }, a, b);
+}
+
+BENCHMARK(Vector2, Angle)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return angle(u, v); }, a, b);
+}
+
+BENCHMARK(Vector2, SqrDistance)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return sqrDistance(u, v); }, a, b);
+}
+
+BENCHMARK(Vector2, Distance)
+{
+	repeat(iterations, [](const Vector2& u, const Vector2& v) { return distance(u, v); }, a, b);
+}
@@ -0,0 +1,123 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Vector3 a(1.5f, -2.0f, 0.75f);
+	const Vector3 b(0.25f, 3.0f, -1.0f);
+}
+
+BENCHMARK(Vector3, FromVector4)
+{
+	repeat(iterations, [](const Vector4& v) { return Vector3(v); }, Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+}
+
+BENCHMARK(Vector3, Equality)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return u == v; }, a, b);
+}
+
+BENCHMARK(Vector3, Addition)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return u + v; }, a, b);
+}
+
+BENCHMARK(Vector3, AdditionAssignment)
+{
+	repeat(iterations, [](Vector3 u, const Vector3& v) { return u += v; }, a, b);
+}
+
+BENCHMARK(Vector3, Subtraction)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return u - v; }, a, b);
+}
+
+BENCHMARK(Vector3, SubtractionAssignment)
+{
+	repeat(iterations, [](Vector3 u, const Vector3& v) { return u -= v; }, a, b);
+}
+
+BENCHMARK(Vector3, Negation)
+{
+	repeat(iterations, [](const Vector3& u) { return -u; }, a);
+}
+
+BENCHMARK(Vector3, ScalarMultiplication)
+{
+	repeat(iterations, [](const Vector3& u, float s) { return u * s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector3, ScalarMultiplicationAssignment)
+{
+	repeat(iterations, [](Vector3 u, float s) { return u *= s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector3, ScalarDivision)
+{
+	repeat(iterations, [](const Vector3& u, float s) { return u / s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector3, ScalarDivisionAssignment)
+{
+	repeat(iterations, [](Vector3 u, float s) { return u /= s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector3, SqrMagnitude)
+{
+	repeat(iterations, [](const Vector3& u) { return u.sqrMagnitude(); }, a);
+}
+
+BENCHMARK(Vector3, Magnitude)
+{
+	repeat(iterations, [](const Vector3& u) { return u.magnitude(); }, a);
+}
+
+BENCHMARK(Vector3, Normalized)
+{
+	repeat(iterations, [](const Vector3& u) { return u.normalized(); }, a);
+}
+
+BENCHMARK(Vector3, Normalize)
+{
+	repeat(iterations, [](Vector3 u) { u.normalize(); return u; }, a);
+}
+
+BENCHMARK(Vector3, Scale)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return scale(u, v); }, a, b);
+}
+
+BENCHMARK(Vector3, Dot)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return dot(u, v); }, a, b);
+}
+
+BENCHMARK(Vector3, Cross)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return cross(u, v); }, a, b);
+}
+
+BENCHMARK(Vector3, Lerp)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v, float t) { return lerp(u, v, t); }, a, b, 0.3f);
+}
+
+BENCHMARK(Vector3, Angle)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return angle(u, v); }, a, b);
+}
+
+BENCHMARK(Vector3, SqrDistance)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return sqrDistance(u, v); }, a, b);
+}
+
+BENCHMARK(Vector3, Distance)
+{
+	repeat(iterations, [](const Vector3& u, const Vector3& v) { return distance(u, v); }, a, b);
+}
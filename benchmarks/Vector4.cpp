@@ -0,0 +1,87 @@
+#include "Benchmark.hpp"
+
+#include <M3D/Vector4.hpp>
+
+using namespace M3D;
+using namespace M3D::benchmark;
+
+namespace
+{
+	const Vector4 a(1.5f, -2.0f, 0.75f, 1.0f);
+	const Vector4 b(0.25f, 3.0f, -1.0f, 0.5f);
+}
+
+BENCHMARK(Vector4, FromVector3)
+{
+	repeat(iterations, [](const Vector3& v, float w) { return Vector4(v, w); }, Vector3(1.0f, 2.0f, 3.0f), 1.0f);
+}
+
+BENCHMARK(Vector4, Equality)
+{
+	repeat(iterations, [](const Vector4& u, const Vector4& v) { return u == v; }, a, b);
+}
+
+BENCHMARK(Vector4, Addition)
+{
+	repeat(iterations, [](const Vector4& u, const Vector4& v) { return u + v; }, a, b);
+}
+
+BENCHMARK(Vector4, Subtraction)
+{
+	repeat(iterations, [](const Vector4& u, const Vector4& v) { return u - v; }, a, b);
+}
+
+BENCHMARK(Vector4, Negation)
+{
+	repeat(iterations, [](const Vector4& u) { return -u; }, a);
+}
+
+BENCHMARK(Vector4, ScalarMultiplication)
+{
+	repeat(iterations, [](const Vector4& u, float s) { return u * s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector4, ScalarDivision)
+{
+	repeat(iterations, [](const Vector4& u, float s) { return u / s; }, a, 2.5f);
+}
+
+BENCHMARK(Vector4, SqrMagnitude)
+{
+	repeat(iterations, [](const Vector4& u) { return u.sqrMagnitude(); }, a);
+}
+
+BENCHMARK(Vector4, Magnitude)
+{
+	repeat(iterations, [](const Vector4& u) { return u.magnitude(); }, a);
+}
+
+BENCHMARK(Vector4, Normalized)
+{
+	repeat(iterations, [](const Vector4& u) { return u.normalized(); }, a);
+}
+
+BENCHMARK(Vector4, Normalize)
+{
+	repeat(iterations, [](Vector4 u) { u.normalize(); return u; }, a);
+}
+
+BENCHMARK(Vector4, Scale)
+{
+	repeat(iterations, [](const Vector4& u, const Vector4& v) { return scale(u, v); }, a, b);
+}
+
+BENCHMARK(Vector4, Dot)
+{
+	repeat(iterations, [](const Vector4& u, const Vector4& v) { return dot(u, v); }, a, b);
+}
+
+BENCHMARK(Vector4, SqrDistance)
+{
+	repeat(iterations, [](const Vector4& u, const Vector4& v) { return sqrDistance(u, v); }, a, b);
+}
+
+BENCHMARK(Vector4, Distance)
+{
+	repeat(iterations, [](const Vector4& u, const Vector4& v) { return distance(u, v); }, a, b);
+}
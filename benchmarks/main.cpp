@@ -0,0 +1,48 @@
+#include "Benchmark.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+	void usage(const char* program)
+	{
+		std::cout << "Usage: " << program << " [options]" << std::endl
+			<< "  --filter=<substring>  Only run benchmarks whose names contain the substring." << std::endl
+			<< "  --min-time=<seconds>  Minimum time to run each benchmark for (default 0.1)." << std::endl
+			<< "  --json=<path>         Write the results to a JSON file (default M3DBenchmarks.json)." << std::endl
+			<< "                        Pass an empty path to disable." << std::endl;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::string filter;
+	double minTime = 0.1;
+	std::string jsonPath = "M3DBenchmarks.json";
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if (arg.compare(0, 9, "--filter=") == 0)
+		{
+			filter = arg.substr(9);
+		}
+		else if (arg.compare(0, 11, "--min-time=") == 0)
+		{
+			minTime = std::atof(arg.substr(11).c_str());
+		}
+		else if (arg.compare(0, 7, "--json=") == 0)
+		{
+			jsonPath = arg.substr(7);
+		}
+		else
+		{
+			usage(argv[0]);
+			return (arg == "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	return M3D::benchmark::run(filter, minTime, jsonPath) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,280 @@
+#ifndef AABB_HPP
+#define AABB_HPP
+
+#include <M3D/Vector3.hpp>
+
+#include <ostream>
+#include <cstddef>
+
+namespace M3D
+{
+	template <typename T>
+	class TMatrix4;
+	template <typename T>
+	class TAffine3;
+
+	/**
+	 * Axis-aligned bounding box.
+	 *
+	 * The box is stored as its minimum and maximum corners. A box whose
+	 * minimum exceeds its maximum along any axis is empty; the default
+	 * constructed box is empty, so that points and boxes can be merged into
+	 * it.
+	 */
+	template <typename T>
+	class TAABB
+	{
+	public:
+		/**
+		 * Scalar type of the coordinates.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs an empty box, with the minimum corner at positive
+		 * infinity and the maximum corner at negative infinity.
+		 */
+		TAABB();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the box with the specified corners.
+		 *
+		 * @param min_ The minimum corner.
+		 * @param max_ The maximum corner.
+		 */
+		TAABB(const TVector3<T>& min_, const TVector3<T>& max_);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its coordinates converted to
+		 * the scalar type of this box.
+		 *
+		 * @param other The box to convert.
+		 */
+		template <typename U>
+		explicit TAABB(const TAABB<U>& other);
+
+		/**
+		 * Equality operator.
+		 *
+		 * @param a The first box.
+		 * @param b The second box.
+		 * @return True if the corners of the two supplied boxes are equal.
+		 * False otherwise.
+		 */
+		template <typename U>
+		friend bool operator==(const TAABB<U>& a, const TAABB<U>& b);
+
+		/**
+		 * Non-equality operator.
+		 *
+		 * @param a The first box.
+		 * @param b The second box.
+		 * @return True if the corners of the two supplied boxes are not equal.
+		 * False otherwise.
+		 */
+		template <typename U>
+		friend bool operator!=(const TAABB<U>& a, const TAABB<U>& b);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param box Box to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TAABB<U>& box);
+
+		/**
+		 * Returns whether the box is empty.
+		 *
+		 * @return True if the minimum exceeds the maximum along any axis.
+		 * False otherwise.
+		 */
+		bool isEmpty() const;
+
+		/**
+		 * Returns the center of the box.
+		 *
+		 * @return The point midway between the corners.
+		 */
+		TVector3<T> center() const;
+
+		/**
+		 * Returns the extents of the box.
+		 *
+		 * @return Half of the size of the box along each axis.
+		 */
+		TVector3<T> extents() const;
+
+		/**
+		 * Returns the size of the box.
+		 *
+		 * @return The length of the box along each axis.
+		 */
+		TVector3<T> size() const;
+
+		/**
+		 * Returns the surface area of the box.
+		 *
+		 * @note The box must not be empty.
+		 *
+		 * @return The total area of the six faces.
+		 */
+		T surfaceArea() const;
+
+		/**
+		 * Returns the volume of the box.
+		 *
+		 * @note The box must not be empty.
+		 *
+		 * @return The volume.
+		 */
+		T volume() const;
+
+		/**
+		 * Returns whether the box contains the specified point. Points on the
+		 * boundary are contained.
+		 *
+		 * @param point The point to test.
+		 * @return True if the point lies inside the box. False otherwise.
+		 */
+		bool contains(const TVector3<T>& point) const;
+
+		/**
+		 * Returns whether the box contains the specified box.
+		 *
+		 * @param box The box to test.
+		 * @return True if `box` lies inside this box. False otherwise.
+		 */
+		bool contains(const TAABB& box) const;
+
+		/**
+		 * Returns whether the box intersects the specified box. Boxes that
+		 * only touch on their boundaries intersect.
+		 *
+		 * @param box The box to test.
+		 * @return True if the boxes overlap. False otherwise.
+		 */
+		bool intersects(const TAABB& box) const;
+
+		/**
+		 * Grows the box to contain the specified point.
+		 *
+		 * @param point The point to merge into the box.
+		 */
+		void merge(const TVector3<T>& point);
+
+		/**
+		 * Grows the box to contain the specified box.
+		 *
+		 * @param box The box to merge into this box.
+		 */
+		void merge(const TAABB& box);
+
+		/**
+		 * Returns the bounding box of this box transformed by the affine
+		 * transformation held in `A`.
+		 *
+		 * The box is transformed in center-extents form as described by Arvo
+		 * in "Transforming Axis-Aligned Bounding Boxes", which is much
+		 * cheaper than transforming the eight corners.
+		 *
+		 * @note The box must not be empty. The last row of `A` is ignored.
+		 *
+		 * @param A The transformation.
+		 * @return The smallest axis-aligned box containing the transformed
+		 * box.
+		 */
+		TAABB transformed(const TMatrix4<T>& A) const;
+
+		/**
+		 * Returns the bounding box of this box transformed by `A`.
+		 *
+		 * @note The box must not be empty.
+		 *
+		 * @param A The transformation.
+		 * @return The smallest axis-aligned box containing the transformed
+		 * box.
+		 */
+		TAABB transformed(const TAffine3<T>& A) const;
+
+		/**
+		 * Returns the bounding box of an array of points.
+		 *
+		 * The minimum and maximum are reduced over four (SSE2) or eight (AVX)
+		 * points at a time.
+		 *
+		 * @param points The points to bound.
+		 * @param count The number of points.
+		 * @return The smallest box containing the points, which is empty if
+		 * `count` is zero.
+		 */
+		static TAABB fromPoints(const TVector3<T>* points, std::size_t count);
+
+		/**
+		 * Returns the bounding box of an array of points stored as separate
+		 * arrays of x, y and z coordinates.
+		 *
+		 * @param xs The x-coordinates of the points.
+		 * @param ys The y-coordinates of the points.
+		 * @param zs The z-coordinates of the points.
+		 * @param count The number of points.
+		 * @return The smallest box containing the points, which is empty if
+		 * `count` is zero.
+		 */
+		static TAABB fromPoints(const T* xs, const T* ys, const T* zs, std::size_t count);
+
+	public:
+		/**
+		 * The minimum corner.
+		 */
+		TVector3<T> min;
+
+		/**
+		 * The maximum corner.
+		 */
+		TVector3<T> max;
+	};
+
+	/**
+	 * Returns the smallest box containing both of the specified boxes.
+	 *
+	 * @param a The first box.
+	 * @param b The second box.
+	 * @return The union of the two boxes.
+	 */
+	template <typename T>
+	TAABB<T> merge(const TAABB<T>& a, const TAABB<T>& b);
+
+	/**
+	 * Returns the overlap of the specified boxes.
+	 *
+	 * @param a The first box.
+	 * @param b The second box.
+	 * @return The intersection of the two boxes, which is empty if they do
+	 * not intersect.
+	 */
+	template <typename T>
+	TAABB<T> intersection(const TAABB<T>& a, const TAABB<T>& b);
+
+	/**
+	 * Single precision axis-aligned bounding box.
+	 */
+	typedef TAABB<float> AABB;
+
+	/**
+	 * Double precision axis-aligned bounding box.
+	 */
+	typedef TAABB<double> AABBd;
+}
+
+#include <M3D/AABB.inl>
+
+#endif
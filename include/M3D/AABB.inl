@@ -0,0 +1,143 @@
+#ifndef AABB_INL
+#define AABB_INL
+
+// Inline definitions of the small, frequently called AABB operations. This file
+// is included at the end of AABB.hpp and should not be included directly.
+
+#include <algorithm>
+#include <limits>
+
+namespace M3D
+{
+	template <typename T>
+	inline TAABB<T>::TAABB()
+	: min(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity())
+	, max(-std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity())
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TAABB<T>::TAABB(const TVector3<T>& min_, const TVector3<T>& max_)
+	: min(min_)
+	, max(max_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	inline TAABB<T>::TAABB(const TAABB<U>& other)
+	: min(other.min)
+	, max(other.max)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TAABB<T>& a, const TAABB<T>& b)
+	{
+		return a.min == b.min && a.max == b.max;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TAABB<T>& a, const TAABB<T>& b)
+	{
+		return !(a == b);
+	}
+
+	template <typename T>
+	inline bool TAABB<T>::isEmpty() const
+	{
+		return min.x > max.x || min.y > max.y || min.z > max.z;
+	}
+
+	template <typename T>
+	inline TVector3<T> TAABB<T>::center() const
+	{
+		return 0.5f * (min + max);
+	}
+
+	template <typename T>
+	inline TVector3<T> TAABB<T>::extents() const
+	{
+		return 0.5f * (max - min);
+	}
+
+	template <typename T>
+	inline TVector3<T> TAABB<T>::size() const
+	{
+		return max - min;
+	}
+
+	template <typename T>
+	inline T TAABB<T>::surfaceArea() const
+	{
+		const TVector3<T> d = max - min;
+		return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	template <typename T>
+	inline T TAABB<T>::volume() const
+	{
+		const TVector3<T> d = max - min;
+		return d.x * d.y * d.z;
+	}
+
+	template <typename T>
+	inline bool TAABB<T>::contains(const TVector3<T>& point) const
+	{
+		return point.x >= min.x && point.x <= max.x
+			&& point.y >= min.y && point.y <= max.y
+			&& point.z >= min.z && point.z <= max.z;
+	}
+
+	template <typename T>
+	inline bool TAABB<T>::contains(const TAABB<T>& box) const
+	{
+		return box.min.x >= min.x && box.max.x <= max.x
+			&& box.min.y >= min.y && box.max.y <= max.y
+			&& box.min.z >= min.z && box.max.z <= max.z;
+	}
+
+	template <typename T>
+	inline bool TAABB<T>::intersects(const TAABB<T>& box) const
+	{
+		return box.min.x <= max.x && box.max.x >= min.x
+			&& box.min.y <= max.y && box.max.y >= min.y
+			&& box.min.z <= max.z && box.max.z >= min.z;
+	}
+
+	template <typename T>
+	inline void TAABB<T>::merge(const TVector3<T>& point)
+	{
+		min = TVector3<T>(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+		max = TVector3<T>(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+	}
+
+	template <typename T>
+	inline void TAABB<T>::merge(const TAABB<T>& box)
+	{
+		min = TVector3<T>(std::min(min.x, box.min.x), std::min(min.y, box.min.y), std::min(min.z, box.min.z));
+		max = TVector3<T>(std::max(max.x, box.max.x), std::max(max.y, box.max.y), std::max(max.z, box.max.z));
+	}
+
+	template <typename T>
+	inline TAABB<T> merge(const TAABB<T>& a, const TAABB<T>& b)
+	{
+		TAABB<T> box(a);
+		box.merge(b);
+		return box;
+	}
+
+	template <typename T>
+	inline TAABB<T> intersection(const TAABB<T>& a, const TAABB<T>& b)
+	{
+		return TAABB<T>(
+			TVector3<T>(std::max(a.min.x, b.min.x), std::max(a.min.y, b.min.y), std::max(a.min.z, b.min.z)),
+			TVector3<T>(std::min(a.max.x, b.max.x), std::min(a.max.y, b.max.y), std::min(a.max.z, b.max.z))
+		);
+	}
+}
+
+#endif
@@ -0,0 +1,331 @@
+#ifndef AFFINE3_HPP
+#define AFFINE3_HPP
+
+#include <M3D/Matrix3.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <ostream>
+
+namespace M3D
+{
+	template <typename T>
+	class TMatrix4;
+	template <typename T>
+	class TQuaternion;
+
+	/**
+	 * Affine transformation stored as a 3x4 matrix.
+	 *
+	 * The transformation consists of a 3x3 linear part (rotation, scale and
+	 * shear) followed by a translation. It is equivalent to a 4x4 matrix whose
+	 * last row is (0, 0, 0, 1), but the constant last row is neither stored
+	 * nor multiplied, which makes composition, transformation and inversion
+	 * considerably cheaper than with Matrix4.
+	 */
+	template <typename T>
+	class TAffine3
+	{
+	public:
+		/**
+		 * Scalar type of the entries.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the identity transformation.
+		 */
+		constexpr TAffine3();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the transformation from the passed array.
+		 *
+		 * @param arr Array of the 12 entries of the 3x4 matrix in row-major
+		 * order.
+		 */
+		constexpr TAffine3(const T arr[12]);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the transformation from the specified entries of the
+		 * 3x4 matrix.
+		 *
+		 * @param entry00 Entry at row 0 column 0.
+		 * @param entry01 Entry at row 0 column 1.
+		 * @param entry02 Entry at row 0 column 2.
+		 * @param entry03 Entry at row 0 column 3.
+		 * @param entry10 Entry at row 1 column 0.
+		 * @param entry11 Entry at row 1 column 1.
+		 * @param entry12 Entry at row 1 column 2.
+		 * @param entry13 Entry at row 1 column 3.
+		 * @param entry20 Entry at row 2 column 0.
+		 * @param entry21 Entry at row 2 column 1.
+		 * @param entry22 Entry at row 2 column 2.
+		 * @param entry23 Entry at row 2 column 3.
+		 */
+		constexpr TAffine3(T entry00, T entry01, T entry02, T entry03,
+			T entry10, T entry11, T entry12, T entry13,
+			T entry20, T entry21, T entry22, T entry23);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the transformation that applies the linear
+		 * transformation `A` followed by the translation `translation`.
+		 *
+		 * @param A The linear part of the transformation.
+		 * @param translation The translation part of the transformation.
+		 */
+		constexpr TAffine3(const TMatrix3<T>& A, const TVector3<T>& translation);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the transformation that applies the rotation `q`
+		 * followed by the translation `translation`.
+		 *
+		 * @note The quaternion supplied must be a unit quaternion.
+		 *
+		 * @param q The rotation.
+		 * @param translation The translation.
+		 */
+		TAffine3(const TQuaternion<T>& q, const TVector3<T>& translation);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the transformation that applies the uniform scaling by
+		 * `scale`, the rotation `q` and the translation `translation`, in
+		 * that order.
+		 *
+		 * @note The quaternion supplied must be a unit quaternion.
+		 *
+		 * @param q The rotation.
+		 * @param translation The translation.
+		 * @param scale The uniform scale factor.
+		 */
+		TAffine3(const TQuaternion<T>& q, const TVector3<T>& translation, const T scale);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the transformation from the first three rows of the
+		 * passed 4x4 matrix. The last row of `A` is discarded, so `A` should
+		 * be an affine transformation.
+		 *
+		 * @param A The 4x4 matrix from which to construct the transformation.
+		 */
+		explicit TAffine3(const TMatrix4<T>& A);
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @param other The other transformation to copy.
+		 */
+		TAffine3(const TAffine3& other) = default;
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its entries converted to the
+		 * scalar type of this transformation.
+		 *
+		 * @param other The transformation to convert.
+		 */
+		template <typename U>
+		explicit constexpr TAffine3(const TAffine3<U>& other);
+
+		/**
+		 * Matrix entry accessor operator.
+		 *
+		 * @note Entry indicies are in the range 0 <= `index` <= 11. The
+		 * translation is held in the entries 3, 7 and 11.
+		 *
+		 * @param index Index for the entry to return.
+		 * @return Entry at position `index` of the 3x4 matrix.
+		 */
+		constexpr T operator[](std::size_t index) const;
+
+		/**
+		 * Equality operator.
+		 *
+		 * @param A The first transformation.
+		 * @param B The second transformation.
+		 * @return True if the two supplied transformations are equal. False
+		 * otherwise.
+		 */
+		template <typename U>
+		friend bool operator==(const TAffine3<U>& A, const TAffine3<U>& B);
+
+		/**
+		 * Non-equality operator.
+		 *
+		 * @param A The first transformation.
+		 * @param B The second transformation.
+		 * @return True if the two supplied transformations are not equal.
+		 * False otherwise.
+		 */
+		template <typename U>
+		friend bool operator!=(const TAffine3<U>& A, const TAffine3<U>& B);
+
+		/**
+		 * Composition operator.
+		 *
+		 * @note Composition is not commutative.
+		 *
+		 * @param lhs The transformation applied second.
+		 * @param rhs The transformation applied first.
+		 * @return The transformation that applies `rhs` followed by `lhs`.
+		 */
+		template <typename U>
+		friend TAffine3<U> operator*(const TAffine3<U>& lhs, const TAffine3<U>& rhs);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param A Transformation to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TAffine3<U>& A);
+
+		/**
+		 * Returns the linear part of the transformation.
+		 *
+		 * @return The 3x3 matrix formed by the first three columns.
+		 */
+		constexpr TMatrix3<T> linearPart() const;
+
+		/**
+		 * Returns the translation part of the transformation.
+		 *
+		 * @return The vector formed by the last column.
+		 */
+		constexpr TVector3<T> translationPart() const;
+
+		/**
+		 * Returns the rotation part of the transformation.
+		 *
+		 * Any scaling is removed from the linear part before the rotation is
+		 * extracted.
+		 *
+		 * @note The linear part must not contain any shear or reflection.
+		 *
+		 * @return Unit quaternion for the rotation.
+		 */
+		TQuaternion<T> rotationPart() const;
+
+		/**
+		 * Transforms the specified point.
+		 *
+		 * @param point The point to transform.
+		 * @return The transformed point.
+		 */
+		constexpr TVector3<T> transformPoint(const TVector3<T>& point) const;
+
+		/**
+		 * Transforms the specified vector. The translation part of the
+		 * transformation is ignored.
+		 *
+		 * @param vector The vector to transform.
+		 * @return The transformed vector.
+		 */
+		constexpr TVector3<T> transformVector(const TVector3<T>& vector) const;
+
+		/**
+		 * Returns the determinant of the linear part.
+		 *
+		 * @note An affine transformation is invertable if and only if its
+		 * determinant is nonzero.
+		 *
+		 * @return The determinant.
+		 */
+		constexpr T determinant() const;
+
+		/**
+		 * Returns the inverse of this transformation.
+		 *
+		 * @return The inverse transformation.
+		 */
+		TAffine3 inverse() const;
+
+		/**
+		 * Returns the inverse of this transformation, assuming that it is a
+		 * rigid transformation. The inverse of the linear part is then its
+		 * transpose, which is considerably cheaper than the general inverse.
+		 *
+		 * @note The linear part must be a rotation matrix.
+		 *
+		 * @return The inverse transformation.
+		 */
+		constexpr TAffine3 rigidInverse() const;
+
+		/**
+		 * Returns the inverse of this transformation, assuming that the
+		 * linear part is a rotation combined with a uniform scale. The
+		 * inverse of the linear part is then its transpose divided by the
+		 * square of the scale factor.
+		 *
+		 * @note The linear part must be a rotation matrix multiplied by a
+		 * nonzero scalar.
+		 *
+		 * @return The inverse transformation.
+		 */
+		constexpr TAffine3 uniformScaleInverse() const;
+
+		/**
+		 * Returns the transformation that scales by the specified factors.
+		 *
+		 * @param scaleFactors The factors to scale by along each axis.
+		 * @return Scaling transformation.
+		 */
+		static constexpr TAffine3 scaling(const TVector3<T>& scaleFactors);
+
+		/**
+		 * Returns the transformation that scales by the specified factor.
+		 *
+		 * @param factor The factor to scale by along all axes.
+		 * @return Scaling transformation.
+		 */
+		static constexpr TAffine3 scaling(const T factor);
+
+		/**
+		 * Returns the transformation that translates by the specified vector.
+		 *
+		 * @param translation The translation vector.
+		 * @return Translation transformation.
+		 */
+		static constexpr TAffine3 translation(const TVector3<T>& translation);
+
+	public:
+		/**
+		 * The identity transformation.
+		 */
+		static const TAffine3 IDENTITY;
+
+	private:
+		/**
+		 * The entries of the 3x4 matrix (row major).
+		 */
+		T m[12];
+	};
+
+	/**
+	 * Single precision affine transformation.
+	 */
+	typedef TAffine3<float> Affine3;
+
+	/**
+	 * Double precision affine transformation.
+	 */
+	typedef TAffine3<double> Affine3d;
+}
+
+#include <M3D/Affine3.inl>
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef AFFINE3_INL
+#define AFFINE3_INL
+
+// Inline definitions of the small, frequently called Affine3 operations. This
+// file is included at the end of Affine3.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TAffine3<T>::TAffine3()
+	: m{1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TAffine3<T>::TAffine3(const T arr[12])
+	: m{arr[0], arr[1], arr[2], arr[3],
+		arr[4], arr[5], arr[6], arr[7],
+		arr[8], arr[9], arr[10], arr[11]}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TAffine3<T>::TAffine3(T entry00, T entry01, T entry02, T entry03,
+		T entry10, T entry11, T entry12, T entry13,
+		T entry20, T entry21, T entry22, T entry23)
+	: m{entry00, entry01, entry02, entry03,
+		entry10, entry11, entry12, entry13,
+		entry20, entry21, entry22, entry23}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TAffine3<T>::TAffine3(const TMatrix3<T>& A, const TVector3<T>& translation)
+	: m{A[0], A[1], A[2], translation.x,
+		A[3], A[4], A[5], translation.y,
+		A[6], A[7], A[8], translation.z}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TAffine3<T>::TAffine3(const TAffine3<U>& other)
+	: m{static_cast<T>(other[0]), static_cast<T>(other[1]), static_cast<T>(other[2]), static_cast<T>(other[3]),
+		static_cast<T>(other[4]), static_cast<T>(other[5]), static_cast<T>(other[6]), static_cast<T>(other[7]),
+		static_cast<T>(other[8]), static_cast<T>(other[9]), static_cast<T>(other[10]), static_cast<T>(other[11])}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr T TAffine3<T>::operator[](std::size_t index) const
+	{
+		assert(index < 12);
+		return m[index];
+	}
+
+	template <typename T>
+	inline bool operator==(const TAffine3<T>& A, const TAffine3<T>& B)
+	{
+		const T epsilon = 1e-6;
+		for (std::size_t i = 0; i < 12; ++i)
+		{
+			if (std::abs(A[i] - B[i]) > epsilon) return false;
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TAffine3<T>& A, const TAffine3<T>& B)
+	{
+		return !(A == B);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> TAffine3<T>::linearPart() const
+	{
+		return TMatrix3<T>(
+			m[0], m[1], m[2],
+			m[4], m[5], m[6],
+			m[8], m[9], m[10]
+		);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> TAffine3<T>::translationPart() const
+	{
+		return TVector3<T>(m[3], m[7], m[11]);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> TAffine3<T>::transformPoint(const TVector3<T>& point) const
+	{
+		return TVector3<T>(
+			m[0] * point.x + m[1] * point.y + m[2] * point.z + m[3],
+			m[4] * point.x + m[5] * point.y + m[6] * point.z + m[7],
+			m[8] * point.x + m[9] * point.y + m[10] * point.z + m[11]
+		);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> TAffine3<T>::transformVector(const TVector3<T>& vector) const
+	{
+		return TVector3<T>(
+			m[0] * vector.x + m[1] * vector.y + m[2] * vector.z,
+			m[4] * vector.x + m[5] * vector.y + m[6] * vector.z,
+			m[8] * vector.x + m[9] * vector.y + m[10] * vector.z
+		);
+	}
+
+	template <typename T>
+	constexpr T TAffine3<T>::determinant() const
+	{
+		return m[0] * (m[5] * m[10] - m[6] * m[9])
+			- m[1] * (m[4] * m[10] - m[6] * m[8])
+			+ m[2] * (m[4] * m[9] - m[5] * m[8]);
+	}
+
+	template <typename T>
+	constexpr TAffine3<T> TAffine3<T>::rigidInverse() const
+	{
+		// The inverse of a rotation is its transpose, and the translation of
+		// the inverse is the negated translation rotated by the transpose.
+		return TAffine3<T>(
+			m[0], m[4], m[8], -(m[0] * m[3] + m[4] * m[7] + m[8] * m[11]),
+			m[1], m[5], m[9], -(m[1] * m[3] + m[5] * m[7] + m[9] * m[11]),
+			m[2], m[6], m[10], -(m[2] * m[3] + m[6] * m[7] + m[10] * m[11])
+		);
+	}
+
+	template <typename T>
+	constexpr TAffine3<T> TAffine3<T>::uniformScaleInverse() const
+	{
+		// The columns of a uniformly scaled rotation all have the squared
+		// length s^2, so the inverse is the transpose divided by s^2.
+		const T sqrScale = m[0] * m[0] + m[4] * m[4] + m[8] * m[8];
+		assert(sqrScale != 0.0f);
+
+		const T k = 1.0f / sqrScale;
+		const T a0 = m[0] * k, a1 = m[4] * k, a2 = m[8] * k;
+		const T a4 = m[1] * k, a5 = m[5] * k, a6 = m[9] * k;
+		const T a8 = m[2] * k, a9 = m[6] * k, a10 = m[10] * k;
+
+		return TAffine3<T>(
+			a0, a1, a2, -(a0 * m[3] + a1 * m[7] + a2 * m[11]),
+			a4, a5, a6, -(a4 * m[3] + a5 * m[7] + a6 * m[11]),
+			a8, a9, a10, -(a8 * m[3] + a9 * m[7] + a10 * m[11])
+		);
+	}
+
+	template <typename T>
+	constexpr TAffine3<T> TAffine3<T>::scaling(const TVector3<T>& scaleFactors)
+	{
+		return TAffine3<T>(
+			scaleFactors.x, 0.0f, 0.0f, 0.0f,
+			0.0f, scaleFactors.y, 0.0f, 0.0f,
+			0.0f, 0.0f, scaleFactors.z, 0.0f
+		);
+	}
+
+	template <typename T>
+	constexpr TAffine3<T> TAffine3<T>::scaling(const T factor)
+	{
+		return scaling(TVector3<T>(factor, factor, factor));
+	}
+
+	template <typename T>
+	constexpr TAffine3<T> TAffine3<T>::translation(const TVector3<T>& translation)
+	{
+		return TAffine3<T>(TMatrix3<T>::IDENTITY, translation);
+	}
+
+	template <typename T>
+	constexpr TAffine3<T> TAffine3<T>::IDENTITY = TAffine3<T>();
+}
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef ALIGNED_HPP
+#define ALIGNED_HPP
+
+#include <M3D/Allocator.hpp>
+#include <M3D/DualQuaternion.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace M3D
+{
+	/**
+	 * Variant of a vector, quaternion or matrix type that is aligned to
+	 * `Alignment` bytes, so that SIMD code can load and store it whole with
+	 * aligned instructions and it never straddles a cache line boundary
+	 * needlessly.
+	 *
+	 * The variant derives from `Type`, so it has the same constructors and
+	 * members and can be passed wherever `Type` is expected. Its size is
+	 * rounded up to a multiple of the alignment, so arrays of types whose
+	 * size is not already a multiple, such as `Aligned<Vector3, 16>`, are
+	 * padded.
+	 *
+	 * Before C++17, `new` and `std::vector` with the default allocator do
+	 * not respect alignments greater than that of the largest fundamental
+	 * type. Use AlignedVector or an Arena for arrays of these types.
+	 */
+	template <typename Type, std::size_t Alignment>
+	class alignas(Alignment) Aligned : public Type
+	{
+	public:
+		static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+		static_assert(Alignment >= alignof(Type), "Alignment must not be less than that of the type");
+
+		/**
+		 * Inherit the constructors of the type.
+		 */
+		using Type::Type;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the same value as the default constructor of `Type`.
+		 */
+		Aligned();
+
+		/**
+		 * Converting constructor, so that the results of the operations on
+		 * `Type` can be assigned to the aligned variant.
+		 *
+		 * @param value The value to copy.
+		 */
+		Aligned(const Type& value);
+	};
+
+	/**
+	 * Single precision 4D vector aligned for SSE.
+	 */
+	typedef Aligned<TVector4<float>, 16> Vector4A;
+
+	/**
+	 * Single precision quaternion aligned for SSE.
+	 */
+	typedef Aligned<TQuaternion<float>, 16> QuaternionA;
+
+	/**
+	 * Single precision dual quaternion aligned for AVX.
+	 */
+	typedef Aligned<TDualQuaternion<float>, 32> DualQuaternionA;
+
+	/**
+	 * Single precision 4x4 matrix aligned for AVX, so that each pair of
+	 * columns can be loaded with one aligned 256-bit load.
+	 */
+	typedef Aligned<TMatrix4<float>, 32> Matrix4A;
+
+	/**
+	 * Double precision 4D vector aligned for AVX.
+	 */
+	typedef Aligned<TVector4<double>, 32> Vector4dA;
+
+	/**
+	 * Double precision 4x4 matrix aligned for AVX.
+	 */
+	typedef Aligned<TMatrix4<double>, 32> Matrix4dA;
+
+	/**
+	 * Dynamic array whose storage is aligned to `Alignment` bytes, which
+	 * allocates from the heap or, when constructed with an
+	 * AlignedAllocator for an arena, from that arena.
+	 *
+	 * The elements are packed as in a plain array, so the batch operations
+	 * of the library apply to the whole array with SIMD loads that never
+	 * straddle the start of the storage.
+	 */
+	template <typename T, std::size_t Alignment = SIMD_ALIGNMENT>
+	using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment> >;
+
+	/**
+	 * Multiplies each column vector in an aligned array on the left by the
+	 * matrix `A`, resizing `out` to the size of `vectors`.
+	 *
+	 * @see transform(const TMatrix4<T>&, const TVector4<T>*, TVector4<T>*, std::size_t)
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The transformation matrix.
+	 * @param vectors The vectors to transform.
+	 * @param out Array to receive the transformed vectors.
+	 */
+	template <typename T, std::size_t Alignment>
+	void transform(const TMatrix4<T>& A, const AlignedVector<TVector4<T>, Alignment>& vectors,
+		AlignedVector<TVector4<T>, Alignment>& out);
+
+	/**
+	 * Transforms each point in an aligned array by the matrix `A`, resizing
+	 * `out` to the size of `points`.
+	 *
+	 * @see transformPoints(const TMatrix4<T>&, const TVector3<T>*, TVector3<T>*, std::size_t)
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The transformation matrix.
+	 * @param points The points to transform.
+	 * @param out Array to receive the transformed points.
+	 */
+	template <typename T, std::size_t Alignment>
+	void transformPoints(const TMatrix4<T>& A, const AlignedVector<TVector3<T>, Alignment>& points,
+		AlignedVector<TVector3<T>, Alignment>& out);
+
+	/**
+	 * Transforms each direction in an aligned array by the matrix `A`,
+	 * ignoring translation, and resizing `out` to the size of `directions`.
+	 *
+	 * @see transformDirections(const TMatrix4<T>&, const TVector3<T>*, TVector3<T>*, std::size_t)
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The transformation matrix.
+	 * @param directions The directions to transform.
+	 * @param out Array to receive the transformed directions.
+	 */
+	template <typename T, std::size_t Alignment>
+	void transformDirections(const TMatrix4<T>& A, const AlignedVector<TVector3<T>, Alignment>& directions,
+		AlignedVector<TVector3<T>, Alignment>& out);
+
+	/**
+	 * Rotates each vector in an aligned array by the quaternion `q`,
+	 * resizing `out` to the size of `in`.
+	 *
+	 * @see rotate(const TQuaternion<T>&, const TVector3<T>*, TVector3<T>*, std::size_t)
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param q The quaternion rotation to apply to each vector.
+	 * @param in The vectors to rotate.
+	 * @param out Array to receive the rotated vectors.
+	 */
+	template <typename T, std::size_t Alignment>
+	void rotate(const TQuaternion<T>& q, const AlignedVector<TVector3<T>, Alignment>& in,
+		AlignedVector<TVector3<T>, Alignment>& out);
+
+	/**
+	 * Rotates each vector in an aligned array by the corresponding
+	 * quaternion in a second aligned array, resizing `out` to the size of
+	 * `in`, which must be the size of `q`.
+	 *
+	 * @see rotate(const TQuaternion<T>*, const TVector3<T>*, TVector3<T>*, std::size_t)
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param q The quaternion rotations, one per vector.
+	 * @param in The vectors to rotate.
+	 * @param out Array to receive the rotated vectors.
+	 */
+	template <typename T, std::size_t Alignment>
+	void rotate(const AlignedVector<TQuaternion<T>, Alignment>& q, const AlignedVector<TVector3<T>, Alignment>& in,
+		AlignedVector<TVector3<T>, Alignment>& out);
+}
+
+#include <M3D/Aligned.inl>
+
+#endif
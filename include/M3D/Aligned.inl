@@ -0,0 +1,68 @@
+#ifndef ALIGNED_INL
+#define ALIGNED_INL
+
+// Inline definitions of the aligned types and the operations on aligned
+// arrays. This file is included at the end of Aligned.hpp and should not be
+// included directly.
+
+#include <cassert>
+
+namespace M3D
+{
+	template <typename Type, std::size_t Alignment>
+	inline Aligned<Type, Alignment>::Aligned()
+	: Type()
+	{
+		// Nothing to do.
+	}
+
+	template <typename Type, std::size_t Alignment>
+	inline Aligned<Type, Alignment>::Aligned(const Type& value)
+	: Type(value)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline void transform(const TMatrix4<T>& A, const AlignedVector<TVector4<T>, Alignment>& vectors,
+		AlignedVector<TVector4<T>, Alignment>& out)
+	{
+		out.resize(vectors.size());
+		transform(A, vectors.data(), out.data(), vectors.size());
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline void transformPoints(const TMatrix4<T>& A, const AlignedVector<TVector3<T>, Alignment>& points,
+		AlignedVector<TVector3<T>, Alignment>& out)
+	{
+		out.resize(points.size());
+		transformPoints(A, points.data(), out.data(), points.size());
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline void transformDirections(const TMatrix4<T>& A, const AlignedVector<TVector3<T>, Alignment>& directions,
+		AlignedVector<TVector3<T>, Alignment>& out)
+	{
+		out.resize(directions.size());
+		transformDirections(A, directions.data(), out.data(), directions.size());
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline void rotate(const TQuaternion<T>& q, const AlignedVector<TVector3<T>, Alignment>& in,
+		AlignedVector<TVector3<T>, Alignment>& out)
+	{
+		out.resize(in.size());
+		rotate(q, in.data(), out.data(), in.size());
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline void rotate(const AlignedVector<TQuaternion<T>, Alignment>& q, const AlignedVector<TVector3<T>, Alignment>& in,
+		AlignedVector<TVector3<T>, Alignment>& out)
+	{
+		assert(q.size() == in.size());
+		out.resize(in.size());
+		rotate(q.data(), in.data(), out.data(), in.size());
+	}
+}
+
+#endif
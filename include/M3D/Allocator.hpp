@@ -0,0 +1,334 @@
+#ifndef ALLOCATOR_HPP
+#define ALLOCATOR_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace M3D
+{
+	/**
+	 * Alignment in bytes that suits the aligned loads and stores of every
+	 * supported SIMD instruction set.
+	 */
+	const std::size_t SIMD_ALIGNMENT = 32;
+
+	/**
+	 * Allocates memory from the heap with the specified alignment.
+	 *
+	 * @throws std::bad_alloc If the memory cannot be allocated.
+	 *
+	 * @param size The number of bytes to allocate.
+	 * @param alignment The alignment in bytes, which must be a power of two.
+	 * @return Pointer to the memory, to be released by alignedFree().
+	 */
+	void* alignedAllocate(std::size_t size, std::size_t alignment);
+
+	/**
+	 * Releases memory allocated by alignedAllocate().
+	 *
+	 * @param pointer Pointer to the memory, or null.
+	 */
+	void alignedFree(void* pointer);
+
+	/**
+	 * Bump allocator for short-lived scratch memory, such as the temporary
+	 * arrays of a frame.
+	 *
+	 * Allocation advances an offset within a block of memory, and the
+	 * memory is released all at once by reset(), with no per-allocation
+	 * bookkeeping. When a block is exhausted, a further block is allocated
+	 * from the heap, and the next reset() replaces all of the blocks with a
+	 * single block large enough for all of them, so that an arena reset
+	 * every frame soon stops touching the heap.
+	 *
+	 * The arena does not run destructors, so it should only hold trivially
+	 * destructible types such as those of this library.
+	 */
+	class Arena
+	{
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param capacity The size in bytes of the first block.
+		 */
+		explicit Arena(std::size_t capacity = 1 << 20);
+
+		/**
+		 * Destructor.
+		 *
+		 * Releases all of the blocks.
+		 */
+		~Arena();
+
+		/**
+		 * Allocates memory from the arena.
+		 *
+		 * @throws std::bad_alloc If a further block cannot be allocated.
+		 *
+		 * @param size The number of bytes to allocate.
+		 * @param alignment The alignment in bytes, which must be a power of
+		 * two.
+		 * @return Pointer to the memory, which is valid until the next call
+		 * to reset().
+		 */
+		void* allocate(std::size_t size, std::size_t alignment = SIMD_ALIGNMENT);
+
+		/**
+		 * Allocates uninitialised storage for an array from the arena,
+		 * aligned to SIMD_ALIGNMENT or the alignment of `T`, whichever is
+		 * greater.
+		 *
+		 * @param count The number of elements.
+		 * @return Pointer to the first element.
+		 */
+		template <typename T>
+		T* allocate(std::size_t count);
+
+		/**
+		 * Releases all of the memory allocated from the arena.
+		 */
+		void reset();
+
+		/**
+		 * Returns the total size of the blocks.
+		 *
+		 * @return The capacity in bytes.
+		 */
+		std::size_t capacity() const;
+
+		/**
+		 * Returns the number of bytes allocated since the last reset,
+		 * including padding for alignment.
+		 *
+		 * @return The number of bytes in use.
+		 */
+		std::size_t size() const;
+
+	private:
+		/**
+		 * Block of memory from which allocations are made.
+		 */
+		struct Block
+		{
+			char* data;
+			std::size_t capacity;
+		};
+
+		Arena(const Arena&);
+		Arena& operator=(const Arena&);
+
+		/**
+		 * Allocates a block of at least the specified size and makes it
+		 * the current block.
+		 */
+		void addBlock(std::size_t capacity);
+
+		/**
+		 * The blocks, with the current block last.
+		 */
+		std::vector<Block> blocks;
+
+		/**
+		 * The offset of the first free byte in the current block.
+		 */
+		std::size_t offset;
+
+		/**
+		 * The number of bytes used in the blocks before the current one.
+		 */
+		std::size_t usedBefore;
+	};
+
+	/**
+	 * Pool of fixed-size, aligned blocks of memory, for objects that are
+	 * allocated and released individually, such as matrices that outlive a
+	 * frame.
+	 *
+	 * Blocks are carved from chunks allocated from the heap, and released
+	 * blocks are kept on a free list for reuse. The chunks are returned to
+	 * the heap when the pool is destroyed.
+	 */
+	class AlignedPool
+	{
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param blockSize The size in bytes of each block.
+		 * @param alignment The alignment in bytes of each block, which must
+		 * be a power of two.
+		 * @param blocksPerChunk The number of blocks allocated from the heap
+		 * at a time.
+		 */
+		explicit AlignedPool(std::size_t blockSize, std::size_t alignment = SIMD_ALIGNMENT,
+			std::size_t blocksPerChunk = 256);
+
+		/**
+		 * Destructor.
+		 *
+		 * Releases all of the chunks, including the blocks still in use.
+		 */
+		~AlignedPool();
+
+		/**
+		 * Allocates a block.
+		 *
+		 * @throws std::bad_alloc If a further chunk cannot be allocated.
+		 *
+		 * @return Pointer to the block.
+		 */
+		void* allocate();
+
+		/**
+		 * Returns a block to the pool.
+		 *
+		 * @param block Pointer to a block allocated from this pool, or null.
+		 */
+		void deallocate(void* block);
+
+		/**
+		 * Returns the size of each block.
+		 *
+		 * @return The block size in bytes.
+		 */
+		std::size_t blockSize() const;
+
+	private:
+		AlignedPool(const AlignedPool&);
+		AlignedPool& operator=(const AlignedPool&);
+
+		/**
+		 * The chunks allocated from the heap.
+		 */
+		std::vector<void*> chunks;
+
+		/**
+		 * The first free block, whose first bytes hold the next free block.
+		 */
+		void* freeList;
+
+		/**
+		 * The requested size of each block.
+		 */
+		std::size_t size;
+
+		/**
+		 * The distance between consecutive blocks in a chunk, which is the
+		 * block size rounded up to the alignment.
+		 */
+		std::size_t stride;
+
+		/**
+		 * The alignment of each block.
+		 */
+		std::size_t alignment;
+
+		/**
+		 * The number of blocks in each chunk.
+		 */
+		std::size_t blocksPerChunk;
+	};
+
+	/**
+	 * Standard library allocator that aligns its arrays to `Alignment`
+	 * bytes, or the alignment of `T` if that is greater.
+	 *
+	 * The memory comes from the heap, or from an arena if one is given, in
+	 * which case deallocation does nothing and the memory is released by
+	 * resetting the arena.
+	 */
+	template <typename T, std::size_t Alignment = SIMD_ALIGNMENT>
+	class AlignedAllocator
+	{
+	public:
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		/**
+		 * The same allocator for another element type.
+		 */
+		template <typename U>
+		struct rebind
+		{
+			typedef AlignedAllocator<U, Alignment> other;
+		};
+
+		/**
+		 * Constructor.
+		 *
+		 * @param arena The arena from which to allocate, or null to allocate
+		 * from the heap.
+		 */
+		AlignedAllocator(Arena* arena = nullptr);
+
+		/**
+		 * Converting constructor, for the same allocator with another
+		 * element type.
+		 *
+		 * @param other The allocator to copy.
+		 */
+		template <typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment>& other);
+
+		/**
+		 * Allocates storage for `count` elements.
+		 *
+		 * @param count The number of elements.
+		 * @return Pointer to the first element.
+		 */
+		T* allocate(std::size_t count);
+
+		/**
+		 * Releases storage allocated by allocate().
+		 *
+		 * @param pointer Pointer to the first element.
+		 * @param count The number of elements.
+		 */
+		void deallocate(T* pointer, std::size_t count);
+
+		/**
+		 * Returns the arena from which the allocator allocates.
+		 *
+		 * @return The arena, or null for the heap.
+		 */
+		Arena* arena() const;
+
+	private:
+		/**
+		 * The arena from which to allocate, or null for the heap.
+		 */
+		Arena* source;
+	};
+
+	/**
+	 * Equality operator for comparing allocators. Allocators are equal when
+	 * memory allocated by one can be released by the other.
+	 *
+	 * @param a The first allocator.
+	 * @param b The second allocator.
+	 * @return True if the allocators use the same arena, or both use the
+	 * heap. False otherwise.
+	 */
+	template <typename T, typename U, std::size_t Alignment>
+	bool operator==(const AlignedAllocator<T, Alignment>& a, const AlignedAllocator<U, Alignment>& b);
+
+	/**
+	 * Inequality operator for comparing allocators.
+	 *
+	 * @param a The first allocator.
+	 * @param b The second allocator.
+	 * @return True if the allocators are not equal. False otherwise.
+	 */
+	template <typename T, typename U, std::size_t Alignment>
+	bool operator!=(const AlignedAllocator<T, Alignment>& a, const AlignedAllocator<U, Alignment>& b);
+}
+
+#include <M3D/Allocator.inl>
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef ALLOCATOR_INL
+#define ALLOCATOR_INL
+
+// Inline definitions of the small, frequently called allocator operations.
+// This file is included at the end of Allocator.hpp and should not be
+// included directly.
+
+#include <algorithm>
+#include <cstdint>
+
+namespace M3D
+{
+	inline void* Arena::allocate(std::size_t size, std::size_t alignment)
+	{
+		// The fast path only advances the offset within the current block.
+		if (!blocks.empty())
+		{
+			const Block& block = blocks.back();
+			const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data);
+			const std::size_t start = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+			if (start + size <= block.capacity)
+			{
+				offset = start + size;
+				return block.data + start;
+			}
+		}
+
+		addBlock(size + alignment);
+		return allocate(size, alignment);
+	}
+
+	template <typename T>
+	inline T* Arena::allocate(std::size_t count)
+	{
+		return static_cast<T*>(allocate(count * sizeof(T), std::max(SIMD_ALIGNMENT, alignof(T))));
+	}
+
+	inline std::size_t Arena::size() const
+	{
+		return usedBefore + offset;
+	}
+
+	inline std::size_t AlignedPool::blockSize() const
+	{
+		return size;
+	}
+
+	inline void* AlignedPool::allocate()
+	{
+		if (freeList == nullptr)
+		{
+			char* chunk = static_cast<char*>(alignedAllocate(stride * blocksPerChunk, alignment));
+			chunks.push_back(chunk);
+
+			// Thread the new blocks onto the free list in address order.
+			for (std::size_t i = blocksPerChunk; i-- > 0;)
+			{
+				*reinterpret_cast<void**>(chunk + i * stride) = freeList;
+				freeList = chunk + i * stride;
+			}
+		}
+
+		void* block = freeList;
+		freeList = *static_cast<void**>(block);
+		return block;
+	}
+
+	inline void AlignedPool::deallocate(void* block)
+	{
+		if (block != nullptr)
+		{
+			*static_cast<void**>(block) = freeList;
+			freeList = block;
+		}
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline AlignedAllocator<T, Alignment>::AlignedAllocator(Arena* arena)
+	: source(arena)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T, std::size_t Alignment>
+	template <typename U>
+	inline AlignedAllocator<T, Alignment>::AlignedAllocator(const AlignedAllocator<U, Alignment>& other)
+	: source(other.arena())
+	{
+		// Nothing to do.
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline T* AlignedAllocator<T, Alignment>::allocate(std::size_t count)
+	{
+		const std::size_t alignment = std::max(Alignment, alignof(T));
+		void* memory = source != nullptr ? source->allocate(count * sizeof(T), alignment)
+		                                 : alignedAllocate(count * sizeof(T), alignment);
+		return static_cast<T*>(memory);
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline void AlignedAllocator<T, Alignment>::deallocate(T* pointer, std::size_t)
+	{
+		if (source == nullptr)
+		{
+			alignedFree(pointer);
+		}
+	}
+
+	template <typename T, std::size_t Alignment>
+	inline Arena* AlignedAllocator<T, Alignment>::arena() const
+	{
+		return source;
+	}
+
+	template <typename T, typename U, std::size_t Alignment>
+	inline bool operator==(const AlignedAllocator<T, Alignment>& a, const AlignedAllocator<U, Alignment>& b)
+	{
+		return a.arena() == b.arena();
+	}
+
+	template <typename T, typename U, std::size_t Alignment>
+	inline bool operator!=(const AlignedAllocator<T, Alignment>& a, const AlignedAllocator<U, Alignment>& b)
+	{
+		return !(a == b);
+	}
+}
+
+#endif
@@ -0,0 +1,289 @@
+#ifndef ANIMATIONCLIP_HPP
+#define ANIMATIONCLIP_HPP
+
+#include <M3D/Aligned.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace M3D
+{
+	/**
+	 * The translations, rotations and scales of a set of tracks at one time,
+	 * stored as structure-of-arrays so that the sampler can write, and
+	 * vectorised code read, each component of every track contiguously.
+	 */
+	class AnimationPose
+	{
+	public:
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs a pose with no tracks.
+		 */
+		AnimationPose();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs a pose with the specified number of tracks, each with
+		 * zero translation, identity rotation and unit scale.
+		 *
+		 * @param trackCount The number of tracks.
+		 */
+		explicit AnimationPose(std::size_t trackCount);
+
+		/**
+		 * Changes the number of tracks. New tracks have zero translation,
+		 * identity rotation and unit scale.
+		 *
+		 * @param trackCount The number of tracks.
+		 */
+		void resize(std::size_t trackCount);
+
+		/**
+		 * Returns the number of tracks.
+		 *
+		 * @return The number of tracks.
+		 */
+		std::size_t size() const;
+
+		/**
+		 * Returns the translation of a track.
+		 *
+		 * @param track The index of the track.
+		 * @return The translation.
+		 */
+		Vector3 translation(std::size_t track) const;
+
+		/**
+		 * Returns the rotation of a track.
+		 *
+		 * @param track The index of the track.
+		 * @return The rotation.
+		 */
+		Quaternion rotation(std::size_t track) const;
+
+		/**
+		 * Returns the scale of a track.
+		 *
+		 * @param track The index of the track.
+		 * @return The scale along each axis.
+		 */
+		Vector3 scale(std::size_t track) const;
+
+	public:
+		/**
+		 * Components of the translations.
+		 */
+		AlignedVector<float> translationX;
+		AlignedVector<float> translationY;
+		AlignedVector<float> translationZ;
+
+		/**
+		 * Components of the rotations.
+		 */
+		AlignedVector<float> rotationW;
+		AlignedVector<float> rotationX;
+		AlignedVector<float> rotationY;
+		AlignedVector<float> rotationZ;
+
+		/**
+		 * Components of the scales.
+		 */
+		AlignedVector<float> scaleX;
+		AlignedVector<float> scaleY;
+		AlignedVector<float> scaleZ;
+	};
+
+	/**
+	 * Compressed animation of a set of tracks, each with a translation,
+	 * rotation and scale, sampled at a fixed frame rate.
+	 *
+	 * The clip is divided into segments of SEGMENT_FRAMES frames. Within
+	 * each segment, the keys of every translation, rotation and scale curve
+	 * are reduced by curve fitting: a key is dropped wherever interpolating
+	 * between its neighbours reproduces it, and every frame between them, to
+	 * within the tolerance of the curve. The first and last frames of each
+	 * segment are always kept, so that a segment can be sampled on its own.
+	 * The remaining keys are quantized: translations and scales to 16 bits
+	 * per component within the range of their track, and rotations to 48
+	 * bits as PackedQuaternion48.
+	 *
+	 * Each segment is stored contiguously and the segments are in time
+	 * order, so sampling touches only the keys of the segment containing the
+	 * sample time, and playing the clip forwards streams through the keys
+	 * in memory order.
+	 *
+	 * Each component of a sampled translation or scale is within its
+	 * tolerance plus half a quantization step (1/131070 of the range of the
+	 * track) of the source, and each component of a sampled rotation is
+	 * within its tolerance plus 6e-5.
+	 */
+	class AnimationClip
+	{
+	public:
+		/**
+		 * The number of frames in each segment.
+		 */
+		static const std::size_t SEGMENT_FRAMES = 16;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs an empty clip.
+		 */
+		AnimationClip();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs a clip by compressing uniformly sampled tracks. The
+		 * source arrays hold the poses of successive frames, so the value of
+		 * track `t` at frame `f` is at index `f` * `trackCount` + `t`.
+		 *
+		 * @param translations The translations of the tracks.
+		 * @param rotations The unit rotations of the tracks.
+		 * @param scales The scales of the tracks.
+		 * @param trackCount The number of tracks.
+		 * @param frameCount The number of frames, which must be at least
+		 * one if there are any tracks.
+		 * @param frameRate The number of frames per second.
+		 * @param translationTolerance The largest error in each component
+		 * of a translation that curve fitting may introduce.
+		 * @param rotationTolerance The largest error in each component of a
+		 * rotation that curve fitting may introduce.
+		 * @param scaleTolerance The largest error in each component of a
+		 * scale that curve fitting may introduce.
+		 */
+		AnimationClip(const Vector3* translations, const Quaternion* rotations, const Vector3* scales,
+			std::size_t trackCount, std::size_t frameCount, float frameRate,
+			float translationTolerance = 1e-4f, float rotationTolerance = 1e-4f, float scaleTolerance = 1e-4f);
+
+		/**
+		 * Returns the number of tracks.
+		 *
+		 * @return The number of tracks.
+		 */
+		std::size_t trackCount() const;
+
+		/**
+		 * Returns the number of frames.
+		 *
+		 * @return The number of frames.
+		 */
+		std::size_t frameCount() const;
+
+		/**
+		 * Returns the number of frames per second.
+		 *
+		 * @return The frame rate.
+		 */
+		float frameRate() const;
+
+		/**
+		 * Returns the time of the last frame.
+		 *
+		 * @return The duration in seconds.
+		 */
+		float duration() const;
+
+		/**
+		 * Returns the size of the compressed keys and of the tables used to
+		 * find and dequantize them.
+		 *
+		 * @return The size in bytes.
+		 */
+		std::size_t size() const;
+
+		/**
+		 * Samples every track at the specified time.
+		 *
+		 * Translations and scales are interpolated linearly between the
+		 * keys either side of the time, and rotations by nlerp(), which the
+		 * curve fitting assumes.
+		 *
+		 * @param time The time in seconds, which is clamped to the duration
+		 * of the clip.
+		 * @param pose Receives the pose, and is resized to the number of
+		 * tracks.
+		 */
+		void sample(float time, AnimationPose& pose) const;
+
+		/**
+		 * Samples every track at evenly spaced times across a time range,
+		 * touching only the segments that overlap the range.
+		 *
+		 * @param startTime The time of the first pose in seconds.
+		 * @param endTime The time of the last pose in seconds.
+		 * @param poses Array to receive the poses.
+		 * @param count The number of poses.
+		 */
+		void sample(float startTime, float endTime, AnimationPose* poses, std::size_t count) const;
+
+	private:
+		/**
+		 * Ranges of the translations and scales of a track, with which their
+		 * keys are quantized.
+		 */
+		struct TrackRange
+		{
+			Vector3 translationMin;
+			Vector3 translationStep;
+			Vector3 scaleMin;
+			Vector3 scaleStep;
+		};
+
+		/**
+		 * Location of a segment within the key data.
+		 *
+		 * The segment begins with the number of keys of each curve (the
+		 * translations of all tracks, then the rotations, then the scales),
+		 * followed by the frames within the segment of the keys other than
+		 * the first and last of each curve. The 6-byte values of the keys
+		 * follow from `valuesOffset`.
+		 */
+		struct Segment
+		{
+			std::uint32_t offset;
+			std::uint32_t valuesOffset;
+		};
+
+		/**
+		 * The number of tracks.
+		 */
+		std::size_t tracks;
+
+		/**
+		 * The number of frames.
+		 */
+		std::size_t frames;
+
+		/**
+		 * The number of frames per second.
+		 */
+		float rate;
+
+		/**
+		 * The quantization ranges of the tracks.
+		 */
+		std::vector<TrackRange> ranges;
+
+		/**
+		 * The locations of the segments.
+		 */
+		std::vector<Segment> segments;
+
+		/**
+		 * The segments, one after another.
+		 */
+		std::vector<std::uint8_t> data;
+	};
+}
+
+#include <M3D/AnimationClip.inl>
+
+#endif
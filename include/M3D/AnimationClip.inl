@@ -0,0 +1,85 @@
+#ifndef ANIMATIONCLIP_INL
+#define ANIMATIONCLIP_INL
+
+// Inline definitions of the animation pose and clip accessors. This file is
+// included at the end of AnimationClip.hpp and should not be included
+// directly.
+
+#include <cassert>
+
+namespace M3D
+{
+	inline AnimationPose::AnimationPose()
+	{
+		// Nothing to do.
+	}
+
+	inline AnimationPose::AnimationPose(std::size_t trackCount)
+	{
+		resize(trackCount);
+	}
+
+	inline void AnimationPose::resize(std::size_t trackCount)
+	{
+		translationX.resize(trackCount, 0.0f);
+		translationY.resize(trackCount, 0.0f);
+		translationZ.resize(trackCount, 0.0f);
+		rotationW.resize(trackCount, 1.0f);
+		rotationX.resize(trackCount, 0.0f);
+		rotationY.resize(trackCount, 0.0f);
+		rotationZ.resize(trackCount, 0.0f);
+		scaleX.resize(trackCount, 1.0f);
+		scaleY.resize(trackCount, 1.0f);
+		scaleZ.resize(trackCount, 1.0f);
+	}
+
+	inline std::size_t AnimationPose::size() const
+	{
+		return translationX.size();
+	}
+
+	inline Vector3 AnimationPose::translation(std::size_t track) const
+	{
+		assert(track < size());
+		return Vector3(translationX[track], translationY[track], translationZ[track]);
+	}
+
+	inline Quaternion AnimationPose::rotation(std::size_t track) const
+	{
+		assert(track < size());
+		return Quaternion(rotationW[track], rotationX[track], rotationY[track], rotationZ[track]);
+	}
+
+	inline Vector3 AnimationPose::scale(std::size_t track) const
+	{
+		assert(track < size());
+		return Vector3(scaleX[track], scaleY[track], scaleZ[track]);
+	}
+
+	inline std::size_t AnimationClip::trackCount() const
+	{
+		return tracks;
+	}
+
+	inline std::size_t AnimationClip::frameCount() const
+	{
+		return frames;
+	}
+
+	inline float AnimationClip::frameRate() const
+	{
+		return rate;
+	}
+
+	inline float AnimationClip::duration() const
+	{
+		return frames > 1 ? static_cast<float>(frames - 1) / rate : 0.0f;
+	}
+
+	inline std::size_t AnimationClip::size() const
+	{
+		return data.size() + ranges.size() * sizeof(TrackRange) + segments.size() * sizeof(Segment);
+	}
+}
+
+#endif
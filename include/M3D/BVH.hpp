@@ -0,0 +1,233 @@
+#ifndef BVH_HPP
+#define BVH_HPP
+
+#include <M3D/AABB.hpp>
+#include <M3D/Ray.hpp>
+#include <M3D/Triangle.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace M3D
+{
+	/**
+	 * Bounding volume hierarchy over a set of primitives, each represented
+	 * by its axis-aligned bounding box.
+	 *
+	 * The hierarchy is a binary tree built top-down by the binned surface
+	 * area heuristic (SAH) of Wald, "On fast Construction of SAH-based
+	 * Bounding Volume Hierarchies". The nodes are stored in a single array
+	 * in depth-first order with the root at index zero, and the two children
+	 * of each interior node are adjacent, so that a node refers to its
+	 * children by one index. The primitives are referred to by their indices
+	 * in the arrays passed to build(), which the leaves store as contiguous
+	 * ranges of primitiveIndices().
+	 */
+	template <typename T>
+	class TBVH
+	{
+	public:
+		/**
+		 * Scalar type of the coordinates.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Node of the hierarchy, which is 32 bytes in size for single
+		 * precision coordinates.
+		 */
+		struct Node
+		{
+			/**
+			 * Returns whether the node is a leaf.
+			 *
+			 * @return True if the node is a leaf. False if it is an interior
+			 * node.
+			 */
+			bool isLeaf() const;
+
+			/**
+			 * The bounds of the primitives beneath the node.
+			 */
+			TAABB<T> bounds;
+
+			/**
+			 * For an interior node, the index of the first child, with the
+			 * second child following it. For a leaf, the index into
+			 * primitiveIndices() of the first primitive.
+			 */
+			std::uint32_t offset;
+
+			/**
+			 * The number of primitives in a leaf, or zero for an interior
+			 * node.
+			 */
+			std::uint32_t count;
+		};
+
+		/**
+		 * The maximum depth of the hierarchy. Ranges of primitives that
+		 * reach this depth are stored in a single leaf.
+		 */
+		static const std::size_t MAX_DEPTH = 64;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs an empty hierarchy.
+		 */
+		TBVH();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the hierarchy over the specified primitives.
+		 *
+		 * @see build
+		 *
+		 * @param bounds The bounding boxes of the primitives.
+		 * @param count The number of primitives.
+		 * @param threadCount The number of threads to build with.
+		 */
+		TBVH(const TAABB<T>* bounds, std::size_t count, std::size_t threadCount = 1);
+
+		/**
+		 * Rebuilds the hierarchy over the specified primitives.
+		 *
+		 * Each node is split at the best of 16 candidate planes under the
+		 * surface area heuristic, across the axis along which the centroids
+		 * of its primitives are most spread out, or made a leaf where that is
+		 * cheaper. When `threadCount` is greater than one, the subtrees of
+		 * large nodes are built concurrently. The hierarchy does not depend
+		 * on the number of threads.
+		 *
+		 * @param bounds The bounding boxes of the primitives.
+		 * @param count The number of primitives, which must be less than
+		 * 2^32.
+		 * @param threadCount The number of threads to build with.
+		 */
+		void build(const TAABB<T>* bounds, std::size_t count, std::size_t threadCount = 1);
+
+		/**
+		 * Updates the bounds of the nodes for new bounds of the primitives,
+		 * for example after the geometry has been animated, without changing
+		 * the structure of the hierarchy.
+		 *
+		 * Refitting is much faster than rebuilding, but the hierarchy
+		 * degrades as the primitives move away from the positions it was
+		 * built for.
+		 *
+		 * @param bounds The new bounding boxes of the primitives, in the same
+		 * order as those passed to build().
+		 */
+		void refit(const TAABB<T>* bounds);
+
+		/**
+		 * Returns the bounds of all of the primitives.
+		 *
+		 * @return The bounds of the root node, or an empty box if the
+		 * hierarchy is empty.
+		 */
+		TAABB<T> bounds() const;
+
+		/**
+		 * Returns the nodes of the hierarchy.
+		 *
+		 * @return The nodes, with the root at index zero.
+		 */
+		const std::vector<Node>& nodes() const;
+
+		/**
+		 * Returns the indices of the primitives, ordered such that each leaf
+		 * refers to a contiguous range.
+		 *
+		 * @return The primitive indices.
+		 */
+		const std::vector<std::uint32_t>& primitiveIndices() const;
+
+		/**
+		 * Calls `visitor` with the index of each primitive in the leaves
+		 * whose bounds intersect `box`.
+		 *
+		 * The primitives are candidates only: their own bounds may not
+		 * intersect the box.
+		 *
+		 * @param box The box to query.
+		 * @param visitor Function object called as `visitor(index)`.
+		 */
+		template <typename Visitor>
+		void query(const TAABB<T>& box, Visitor visitor) const;
+
+		/**
+		 * Finds the closest intersection of a ray with the primitives.
+		 *
+		 * The nodes are visited front to back, and subtrees beyond the
+		 * closest intersection found so far are skipped.
+		 *
+		 * @param ray The ray.
+		 * @param intersector Function object called as
+		 * `intersector(ray, index, t)`, which returns true and sets `t` to
+		 * the parameter of the intersection if the ray intersects the
+		 * primitive with the specified index.
+		 * @param distance Receives the parameter of the closest intersection.
+		 * @param primitive Receives the index of the closest primitive.
+		 * @return True if the ray intersects any primitive. False otherwise.
+		 */
+		template <typename Intersector>
+		bool intersect(const TRay<T>& ray, Intersector intersector, T& distance, std::size_t& primitive) const;
+
+		/**
+		 * Finds the closest intersection of a ray with triangles.
+		 *
+		 * @param ray The ray.
+		 * @param triangles The triangles, in the same order as the bounds
+		 * passed to build().
+		 * @param distance Receives the parameter of the closest intersection.
+		 * @param primitive Receives the index of the closest triangle.
+		 * @return True if the ray intersects any triangle. False otherwise.
+		 */
+		bool intersectTriangles(const TRay<T>& ray, const TTriangle<T>* triangles, T& distance, std::size_t& primitive) const;
+
+	private:
+		/**
+		 * Intersects a ray with the bounds of a node by the slab method.
+		 *
+		 * @param node The node.
+		 * @param origin The origin of the ray.
+		 * @param inverse The reciprocals of the components of the direction
+		 * of the ray.
+		 * @param limit The largest parameter of interest.
+		 * @param entry Receives the parameter at which the ray enters the
+		 * bounds, or zero if the origin is inside them.
+		 * @return True if the ray enters the bounds before `limit`. False
+		 * otherwise.
+		 */
+		static bool intersectNode(const Node& node, const TVector3<T>& origin, const TVector3<T>& inverse, T limit, T& entry);
+
+		/**
+		 * The nodes.
+		 */
+		std::vector<Node> nodeArray;
+
+		/**
+		 * The primitive indices referred to by the leaves.
+		 */
+		std::vector<std::uint32_t> indexArray;
+	};
+
+	/**
+	 * Single precision bounding volume hierarchy.
+	 */
+	typedef TBVH<float> BVH;
+
+	/**
+	 * Double precision bounding volume hierarchy.
+	 */
+	typedef TBVH<double> BVHd;
+}
+
+#include <M3D/BVH.inl>
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef BVH_INL
+#define BVH_INL
+
+// Inline definitions of the small, frequently called BVH operations and the
+// traversal templates. This file is included at the end of BVH.hpp and
+// should not be included directly.
+
+#include <algorithm>
+#include <limits>
+
+namespace M3D
+{
+	template <typename T>
+	inline bool TBVH<T>::Node::isLeaf() const
+	{
+		return count != 0;
+	}
+
+	template <typename T>
+	inline TBVH<T>::TBVH()
+	: nodeArray()
+	, indexArray()
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TBVH<T>::TBVH(const TAABB<T>* bounds, std::size_t count, std::size_t threadCount)
+	: nodeArray()
+	, indexArray()
+	{
+		build(bounds, count, threadCount);
+	}
+
+	template <typename T>
+	inline TAABB<T> TBVH<T>::bounds() const
+	{
+		return nodeArray.empty() ? TAABB<T>() : nodeArray[0].bounds;
+	}
+
+	template <typename T>
+	inline const std::vector<typename TBVH<T>::Node>& TBVH<T>::nodes() const
+	{
+		return nodeArray;
+	}
+
+	template <typename T>
+	inline const std::vector<std::uint32_t>& TBVH<T>::primitiveIndices() const
+	{
+		return indexArray;
+	}
+
+	template <typename T>
+	inline bool TBVH<T>::intersectNode(const Node& node, const TVector3<T>& origin, const TVector3<T>& inverse, T limit, T& entry)
+	{
+		const TAABB<T>& box = node.bounds;
+		T tMin = T(0);
+		T tExit = std::numeric_limits<T>::infinity();
+		TRay<T>::clipSlab((box.min.x - origin.x) * inverse.x, (box.max.x - origin.x) * inverse.x, tMin, tExit);
+		TRay<T>::clipSlab((box.min.y - origin.y) * inverse.y, (box.max.y - origin.y) * inverse.y, tMin, tExit);
+		TRay<T>::clipSlab((box.min.z - origin.z) * inverse.z, (box.max.z - origin.z) * inverse.z, tMin, tExit);
+
+		// The exit parameter is enlarged by a few units in the last place, so
+		// that rounding cannot reject rays that graze the bounds, following
+		// Ize, "Robust BVH Ray Traversal". Rays that lie on a face of the
+		// bounds give NaNs, which clipSlab discards.
+		entry = tMin;
+		return tMin <= std::min(tExit * (1.0f + 4.0f * std::numeric_limits<T>::epsilon()), limit);
+	}
+
+	template <typename T>
+	template <typename Visitor>
+	inline void TBVH<T>::query(const TAABB<T>& box, Visitor visitor) const
+	{
+		if (nodeArray.empty() || !nodeArray[0].bounds.intersects(box))
+		{
+			return;
+		}
+
+		// Each interior node defers at most one child, so the stack cannot
+		// be deeper than the hierarchy.
+		std::uint32_t stack[MAX_DEPTH];
+		std::size_t size = 0;
+		std::uint32_t index = 0;
+		for (;;)
+		{
+			const Node& node = nodeArray[index];
+			if (node.isLeaf())
+			{
+				for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+				{
+					visitor(static_cast<std::size_t>(indexArray[i]));
+				}
+			}
+			else
+			{
+				const bool first = nodeArray[node.offset].bounds.intersects(box);
+				const bool second = nodeArray[node.offset + 1].bounds.intersects(box);
+				if (first || second)
+				{
+					index = first ? node.offset : node.offset + 1;
+					if (first && second)
+					{
+						stack[size++] = node.offset + 1;
+					}
+
+					continue;
+				}
+			}
+
+			if (size == 0)
+			{
+				break;
+			}
+
+			index = stack[--size];
+		}
+	}
+
+	template <typename T>
+	template <typename Intersector>
+	inline bool TBVH<T>::intersect(const TRay<T>& ray, Intersector intersector, T& distance, std::size_t& primitive) const
+	{
+		const TVector3<T> inverse(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+		T closest = std::numeric_limits<T>::infinity();
+		T entry;
+		if (nodeArray.empty() || !intersectNode(nodeArray[0], ray.origin, inverse, closest, entry))
+		{
+			return false;
+		}
+
+		// The deferred children, with the parameters at which the ray enters
+		// them.
+		std::uint32_t stack[MAX_DEPTH];
+		T entries[MAX_DEPTH];
+		std::size_t size = 0;
+
+		bool hit = false;
+		std::uint32_t index = 0;
+		for (;;)
+		{
+			const Node& node = nodeArray[index];
+			if (node.isLeaf())
+			{
+				for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+				{
+					T t;
+					if (intersector(ray, static_cast<std::size_t>(indexArray[i]), t) && t < closest)
+					{
+						closest = t;
+						primitive = indexArray[i];
+						hit = true;
+					}
+				}
+			}
+			else
+			{
+				T firstEntry, secondEntry;
+				const bool first = intersectNode(nodeArray[node.offset], ray.origin, inverse, closest, firstEntry);
+				const bool second = intersectNode(nodeArray[node.offset + 1], ray.origin, inverse, closest, secondEntry);
+				if (first && second)
+				{
+					// Visit the nearer child first, deferring the other.
+					const bool swap = secondEntry < firstEntry;
+					index = swap ? node.offset + 1 : node.offset;
+					stack[size] = swap ? node.offset : node.offset + 1;
+					entries[size] = swap ? firstEntry : secondEntry;
+					++size;
+					continue;
+				}
+
+				if (first || second)
+				{
+					index = first ? node.offset : node.offset + 1;
+					continue;
+				}
+			}
+
+			// Resume with the most recently deferred child that the ray
+			// enters before the closest intersection found so far.
+			while (size > 0 && entries[size - 1] > closest)
+			{
+				--size;
+			}
+
+			if (size == 0)
+			{
+				break;
+			}
+
+			index = stack[--size];
+		}
+
+		if (hit)
+		{
+			distance = closest;
+		}
+
+		return hit;
+	}
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef CONVERSION_HPP
+#define CONVERSION_HPP
+
+#include <cstddef>
+
+namespace M3D
+{
+	/**
+	 * Converts an array of double precision values to single precision.
+	 *
+	 * @param in The values to convert.
+	 * @param out Array to receive the converted values.
+	 * @param count The number of values.
+	 */
+	void convert(const double* in, float* out, std::size_t count);
+
+	/**
+	 * Converts an array of single precision values to double precision.
+	 *
+	 * @param in The values to convert.
+	 * @param out Array to receive the converted values.
+	 * @param count The number of values.
+	 */
+	void convert(const float* in, double* out, std::size_t count);
+
+	/**
+	 * Converts an array of double precision vectors, quaternions or matrices
+	 * to single precision.
+	 *
+	 * This is equivalent to applying the converting constructor of `Type` to
+	 * each element, but converts several scalars at a time using the SIMD
+	 * instruction set selected at configure time.
+	 *
+	 * @param in The elements to convert.
+	 * @param out Array to receive the converted elements.
+	 * @param count The number of elements.
+	 */
+	template <template <typename> class Type>
+	void convert(const Type<double>* in, Type<float>* out, std::size_t count);
+
+	/**
+	 * Converts an array of single precision vectors, quaternions or matrices
+	 * to double precision.
+	 *
+	 * This is equivalent to applying the converting constructor of `Type` to
+	 * each element, but converts several scalars at a time using the SIMD
+	 * instruction set selected at configure time.
+	 *
+	 * @param in The elements to convert.
+	 * @param out Array to receive the converted elements.
+	 * @param count The number of elements.
+	 */
+	template <template <typename> class Type>
+	void convert(const Type<float>* in, Type<double>* out, std::size_t count);
+}
+
+#include <M3D/Conversion.inl>
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef CONVERSION_INL
+#define CONVERSION_INL
+
+// Inline definitions of the typed array conversions. This file is included at
+// the end of Conversion.hpp and should not be included directly.
+
+namespace M3D
+{
+	template <template <typename> class Type>
+	inline void convert(const Type<double>* in, Type<float>* out, std::size_t count)
+	{
+		// Every type stores nothing but its scalars, so an array of elements
+		// can be converted as one flat array of scalars.
+		static_assert(sizeof(Type<double>) == 2 * sizeof(Type<float>), "Type must be tightly packed");
+		const std::size_t scalars = sizeof(Type<float>) / sizeof(float);
+
+		convert(reinterpret_cast<const double*>(in), reinterpret_cast<float*>(out), scalars * count);
+	}
+
+	template <template <typename> class Type>
+	inline void convert(const Type<float>* in, Type<double>* out, std::size_t count)
+	{
+		static_assert(sizeof(Type<double>) == 2 * sizeof(Type<float>), "Type must be tightly packed");
+		const std::size_t scalars = sizeof(Type<float>) / sizeof(float);
+
+		convert(reinterpret_cast<const float*>(in), reinterpret_cast<double*>(out), scalars * count);
+	}
+}
+
+#endif
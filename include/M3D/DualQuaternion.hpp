@@ -0,0 +1,301 @@
+#ifndef DUALQUATERNION_HPP
+#define DUALQUATERNION_HPP
+
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <ostream>
+#include <cstddef>
+
+namespace M3D
+{
+	template <typename T>
+	class TMatrix4;
+
+	/**
+	 * Dual quaternion representing a rigid transformation.
+	 *
+	 * A unit dual quaternion `real` + ε `dual` encodes the rotation `real`
+	 * followed by the translation t, where `dual` = 0.5 (0, t) `real`. Unlike
+	 * matrices, unit dual quaternions can be blended linearly and then
+	 * normalized without introducing scale or shear, which makes them well
+	 * suited to skinning.
+	 */
+	template <typename T>
+	class TDualQuaternion
+	{
+	public:
+		/**
+		 * Scalar type of the components.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the identity dual quaternion, corresponding to no
+		 * rotation and no translation.
+		 */
+		TDualQuaternion();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs a dual quaternion from the specified real and dual
+		 * parts.
+		 *
+		 * @param real_ The real part.
+		 * @param dual_ The dual part.
+		 */
+		TDualQuaternion(const TQuaternion<T>& real_, const TQuaternion<T>& dual_);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the unit dual quaternion that applies the rotation
+		 * `rotation` followed by the translation `translation`.
+		 *
+		 * @note The quaternion supplied must be a unit quaternion.
+		 *
+		 * @param rotation The rotation.
+		 * @param translation The translation.
+		 */
+		TDualQuaternion(const TQuaternion<T>& rotation, const TVector3<T>& translation);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the unit dual quaternion from the rigid transformation
+		 * held in the passed 4x4 matrix.
+		 *
+		 * @note The upper left 3x3 block of `A` must be a rotation matrix, up
+		 * to a uniform scale which is discarded.
+		 *
+		 * @param A The 4x4 matrix from which to construct the dual quaternion.
+		 */
+		explicit TDualQuaternion(const TMatrix4<T>& A);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its components converted to the
+		 * scalar type of this dual quaternion.
+		 *
+		 * @param other The dual quaternion to convert.
+		 */
+		template <typename U>
+		explicit TDualQuaternion(const TDualQuaternion<U>& other);
+
+		/**
+		 * Equality operator.
+		 *
+		 * @param dq1 The first dual quaternion.
+		 * @param dq2 The second dual quaternion.
+		 * @return True if the two supplied dual quaternions are equal. False
+		 * otherwise.
+		 */
+		template <typename U>
+		friend bool operator==(const TDualQuaternion<U>& dq1, const TDualQuaternion<U>& dq2);
+
+		/**
+		 * Non-equality operator.
+		 *
+		 * @param dq1 The first dual quaternion.
+		 * @param dq2 The second dual quaternion.
+		 * @return True if the two supplied dual quaternions are not equal.
+		 * False otherwise.
+		 */
+		template <typename U>
+		friend bool operator!=(const TDualQuaternion<U>& dq1, const TDualQuaternion<U>& dq2);
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param dq1 The first dual quaternion.
+		 * @param dq2 The second dual quaternion.
+		 * @return The component-wise sum of the two dual quaternions.
+		 */
+		template <typename U>
+		friend TDualQuaternion<U> operator+(const TDualQuaternion<U>& dq1, const TDualQuaternion<U>& dq2);
+
+		/**
+		 * Scalar multiplication operator.
+		 *
+		 * @param s The scalar value.
+		 * @param dq The dual quaternion.
+		 * @return Dual quaternion `dq` with every component scaled by `s`.
+		 */
+		template <typename U>
+		friend TDualQuaternion<U> operator*(const typename TDualQuaternion<U>::Scalar s, const TDualQuaternion<U>& dq);
+
+		/**
+		 * Composition operator.
+		 *
+		 * @note Composition is not commutative.
+		 *
+		 * @param lhs The transformation applied second.
+		 * @param rhs The transformation applied first.
+		 * @return The dual quaternion that applies `rhs` followed by `lhs`.
+		 */
+		template <typename U>
+		friend TDualQuaternion<U> operator*(const TDualQuaternion<U>& lhs, const TDualQuaternion<U>& rhs);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param dq Dual quaternion to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TDualQuaternion<U>& dq);
+
+		/**
+		 * Returns the rotation part of this unit dual quaternion.
+		 *
+		 * @return Unit quaternion for the rotation.
+		 */
+		TQuaternion<T> rotationPart() const;
+
+		/**
+		 * Returns the translation part of this unit dual quaternion.
+		 *
+		 * @return The translation vector.
+		 */
+		TVector3<T> translationPart() const;
+
+		/**
+		 * Transforms the specified point by this unit dual quaternion.
+		 *
+		 * @param point The point to transform.
+		 * @return The rotated and translated point.
+		 */
+		TVector3<T> transformPoint(const TVector3<T>& point) const;
+
+		/**
+		 * Transforms the specified vector by this unit dual quaternion. The
+		 * translation is ignored.
+		 *
+		 * @param vector The vector to transform.
+		 * @return The rotated vector.
+		 */
+		TVector3<T> transformVector(const TVector3<T>& vector) const;
+
+		/**
+		 * Returns a copy of this dual quaternion scaled to unit magnitude.
+		 *
+		 * The real part is scaled to unit length and the dual part is made
+		 * orthogonal to it, so that the result is a rigid transformation.
+		 *
+		 * @return This dual quaternion normalized.
+		 */
+		TDualQuaternion normalized() const;
+
+		/**
+		 * Normalizes the dual quaternion so that it represents a rigid
+		 * transformation.
+		 */
+		void normalize();
+
+		/**
+		 * Returns a copy of the conjugate of this dual quaternion, obtained
+		 * by conjugating the real and dual parts.
+		 *
+		 * @note The conjugate of a unit dual quaternion is its inverse.
+		 *
+		 * @return Conjugate of the dual quaternion.
+		 */
+		TDualQuaternion conjugate() const;
+
+		/**
+		 * Returns a copy of the multiplicative inverse of this dual
+		 * quaternion.
+		 *
+		 * @note The conjugate is less expensive to compute and so should be
+		 * preferred when working with unit dual quaternions.
+		 *
+		 * @return Multiplicative inverse of this dual quaternion.
+		 */
+		TDualQuaternion inverse() const;
+
+	public:
+		/**
+		 * The real part, which holds the rotation.
+		 */
+		TQuaternion<T> real;
+
+		/**
+		 * The dual part, which holds the translation.
+		 */
+		TQuaternion<T> dual;
+
+	public:
+		/**
+		 * Dual quaternion representing the identity transformation.
+		 */
+		static const TDualQuaternion IDENTITY;
+	};
+
+	/**
+	 * Dual quaternion linear blending (DLB) of the unit dual quaternions
+	 * `dqs` with the specified `weights`.
+	 *
+	 * Each dual quaternion is negated where necessary so that it lies in the
+	 * same hemisphere as the first, ensuring that the blend takes the
+	 * shortest path. The weighted sum is then normalized.
+	 *
+	 * @param dqs The unit dual quaternions to blend.
+	 * @param weights The blend weight for each of the dual quaternions.
+	 * @param count The number of dual quaternions, which must be nonzero.
+	 * @return Unit dual quaternion for the blended transformation.
+	 */
+	template <typename T>
+	TDualQuaternion<T> blend(const TDualQuaternion<T>* dqs, const T* weights, std::size_t count);
+
+	/**
+	 * Skins an array of points, stored as separate arrays of x, y and z
+	 * coordinates, by dual quaternion linear blending of the bones that
+	 * influence each point.
+	 *
+	 * The bone indices and weights are also stored as separate arrays, one
+	 * for each influence: the `k`th influence on point `i` is the bone
+	 * `bones[boneIndices[k * count + i]]` with weight
+	 * `boneWeights[k * count + i]`. This is equivalent to transforming each
+	 * point by blend() of its influences, but the bones are transposed in
+	 * registers so that four (SSE2) or eight (AVX) points are skinned
+	 * together.
+	 *
+	 * @note The output arrays may be the same as the input arrays.
+	 *
+	 * @param bones The unit dual quaternion for each bone.
+	 * @param boneIndices The bone indices of each influence on the points.
+	 * @param boneWeights The weights of each influence on the points.
+	 * @param influences The number of influences on each point, which must
+	 * be nonzero.
+	 * @param xs The x-coordinates of the points.
+	 * @param ys The y-coordinates of the points.
+	 * @param zs The z-coordinates of the points.
+	 * @param outXs Array to receive the x-coordinates of the skinned points.
+	 * @param outYs Array to receive the y-coordinates of the skinned points.
+	 * @param outZs Array to receive the z-coordinates of the skinned points.
+	 * @param count The number of points.
+	 */
+	template <typename T>
+	void skinPoints(const TDualQuaternion<T>* bones, const unsigned int* boneIndices, const T* boneWeights,
+		std::size_t influences, const T* xs, const T* ys, const T* zs,
+		T* outXs, T* outYs, T* outZs, std::size_t count);
+
+	/**
+	 * Single precision dual quaternion.
+	 */
+	typedef TDualQuaternion<float> DualQuaternion;
+
+	/**
+	 * Double precision dual quaternion.
+	 */
+	typedef TDualQuaternion<double> DualQuaterniond;
+}
+
+#include <M3D/DualQuaternion.inl>
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef DUALQUATERNION_INL
+#define DUALQUATERNION_INL
+
+// Inline definitions of the small, frequently called DualQuaternion operations.
+// This file is included at the end of DualQuaternion.hpp and should not be
+// included directly.
+
+#include <cmath>
+#include <cassert>
+
+namespace M3D
+{
+	template <typename T>
+	inline TDualQuaternion<T>::TDualQuaternion()
+	: real(1.0f, 0.0f, 0.0f, 0.0f)
+	, dual(0.0f, 0.0f, 0.0f, 0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TDualQuaternion<T>::TDualQuaternion(const TQuaternion<T>& real_, const TQuaternion<T>& dual_)
+	: real(real_)
+	, dual(dual_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TDualQuaternion<T>::TDualQuaternion(const TQuaternion<T>& rotation, const TVector3<T>& translation)
+	: real(rotation)
+	, dual(TQuaternion<T>(0.0f, 0.5f * translation) * rotation)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	inline TDualQuaternion<T>::TDualQuaternion(const TDualQuaternion<U>& other)
+	: real(other.real)
+	, dual(other.dual)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TDualQuaternion<T>& dq1, const TDualQuaternion<T>& dq2)
+	{
+		return dq1.real == dq2.real && dq1.dual == dq2.dual;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TDualQuaternion<T>& dq1, const TDualQuaternion<T>& dq2)
+	{
+		return !(dq1 == dq2);
+	}
+
+	template <typename T>
+	inline TDualQuaternion<T> operator+(const TDualQuaternion<T>& dq1, const TDualQuaternion<T>& dq2)
+	{
+		return TDualQuaternion<T>(
+			TQuaternion<T>(dq1.real.w + dq2.real.w, dq1.real.x + dq2.real.x, dq1.real.y + dq2.real.y, dq1.real.z + dq2.real.z),
+			TQuaternion<T>(dq1.dual.w + dq2.dual.w, dq1.dual.x + dq2.dual.x, dq1.dual.y + dq2.dual.y, dq1.dual.z + dq2.dual.z)
+		);
+	}
+
+	template <typename T>
+	inline TDualQuaternion<T> operator*(const typename TDualQuaternion<T>::Scalar s, const TDualQuaternion<T>& dq)
+	{
+		return TDualQuaternion<T>(
+			TQuaternion<T>(s * dq.real.w, s * dq.real.x, s * dq.real.y, s * dq.real.z),
+			TQuaternion<T>(s * dq.dual.w, s * dq.dual.x, s * dq.dual.y, s * dq.dual.z)
+		);
+	}
+
+	template <typename T>
+	inline TDualQuaternion<T> operator*(const TDualQuaternion<T>& lhs, const TDualQuaternion<T>& rhs)
+	{
+		// The product of the infinitesimal parts vanishes since ε² = 0.
+		const TQuaternion<T> d1 = lhs.real * rhs.dual;
+		const TQuaternion<T> d2 = lhs.dual * rhs.real;
+
+		return TDualQuaternion<T>(
+			lhs.real * rhs.real,
+			TQuaternion<T>(d1.w + d2.w, d1.x + d2.x, d1.y + d2.y, d1.z + d2.z)
+		);
+	}
+
+	template <typename T>
+	inline TQuaternion<T> TDualQuaternion<T>::rotationPart() const
+	{
+		return real;
+	}
+
+	template <typename T>
+	inline TVector3<T> TDualQuaternion<T>::translationPart() const
+	{
+		// The translation is the vector part of 2 `dual` `real`*, expanded so
+		// that the scalar part is not computed.
+		const TVector3<T> rv(real.x, real.y, real.z);
+		const TVector3<T> dv(dual.x, dual.y, dual.z);
+		return 2.0f * (real.w * dv - dual.w * rv + cross(rv, dv));
+	}
+
+	template <typename T>
+	inline TVector3<T> TDualQuaternion<T>::transformPoint(const TVector3<T>& point) const
+	{
+		return real * point + translationPart();
+	}
+
+	template <typename T>
+	inline TVector3<T> TDualQuaternion<T>::transformVector(const TVector3<T>& vector) const
+	{
+		return real * vector;
+	}
+
+	template <typename T>
+	inline TDualQuaternion<T> TDualQuaternion<T>::normalized() const
+	{
+		TDualQuaternion<T> dq(*this);
+		dq.normalize();
+		return dq;
+	}
+
+	template <typename T>
+	inline void TDualQuaternion<T>::normalize()
+	{
+		assert(real.magnitude() > 0.0f);
+		const T invNorm = 1.0f / real.magnitude();
+
+		real = TQuaternion<T>(real.w * invNorm, real.x * invNorm, real.y * invNorm, real.z * invNorm);
+
+		// Scale the dual part by the same factor and remove its component
+		// along the real part.
+		const T d = dot(real, dual) * invNorm;
+		dual = TQuaternion<T>(
+			dual.w * invNorm - d * real.w,
+			dual.x * invNorm - d * real.x,
+			dual.y * invNorm - d * real.y,
+			dual.z * invNorm - d * real.z
+		);
+	}
+
+	template <typename T>
+	inline TDualQuaternion<T> TDualQuaternion<T>::conjugate() const
+	{
+		return TDualQuaternion<T>(real.conjugate(), dual.conjugate());
+	}
+}
+
+#endif
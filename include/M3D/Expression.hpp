@@ -0,0 +1,348 @@
+#ifndef EXPRESSION_HPP
+#define EXPRESSION_HPP
+
+#include <M3D/Matrix2.hpp>
+#include <M3D/Matrix3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Vector2.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace M3D
+{
+	/**
+	 * Opt-in expression templates for the element-wise arithmetic of the
+	 * vectors and matrices: sums, differences, negation and multiplication
+	 * and division by a scalar.
+	 *
+	 * Wrapping an operand in lazy() makes the operators build a description
+	 * of the expression in place of computing each intermediate result. The
+	 * expression is evaluated, one entry at a time and in a single pass, when
+	 * it is converted to the vector or matrix type:
+	 *
+	 *     using namespace M3D::expr;
+	 *     const Matrix4 C = lazy(A) * (1.0f - t) + lazy(B) * t;
+	 *
+	 * Only one operand of each operator need be an expression, so the above
+	 * could equally be written `lazy(A) * (1.0f - t) + B * t`.
+	 *
+	 * Expressions refer to their vector and matrix operands, which must
+	 * outlive them, so they should be converted within the full expression
+	 * that builds them rather than stored with `auto`. Products of matrices
+	 * are not element-wise, and are not part of this layer.
+	 */
+	namespace expr
+	{
+		/**
+		 * Describes the vector and matrix types that can take part in
+		 * expressions. Each specialization provides the scalar type, the
+		 * number of entries, access to the entries and construction from an
+		 * array of them.
+		 */
+		template <typename Type>
+		struct Traits;
+
+		/**
+		 * Base of the expression types, which marks them as expressions
+		 * for the operators.
+		 */
+		struct Expression
+		{
+		};
+
+		/**
+		 * Leaf of an expression, referring to a vector or matrix.
+		 */
+		template <typename Type>
+		class Leaf : public Expression
+		{
+		public:
+			/**
+			 * The type of the result.
+			 */
+			typedef Type Result;
+
+			/**
+			 * The scalar type of the entries.
+			 */
+			typedef typename Traits<Type>::Scalar Scalar;
+
+			/**
+			 * Constructor.
+			 *
+			 * @param value The vector or matrix, which must outlive the
+			 * expression.
+			 */
+			constexpr explicit Leaf(const Type& value);
+
+			/**
+			 * Returns an entry of the vector or matrix.
+			 *
+			 * @param index The index of the entry.
+			 * @return The entry.
+			 */
+			constexpr Scalar operator[](std::size_t index) const;
+
+			/**
+			 * Evaluates the expression.
+			 *
+			 * @return The vector or matrix.
+			 */
+			constexpr operator Result() const;
+
+		private:
+			/**
+			 * The vector or matrix.
+			 */
+			const Type& value;
+		};
+
+		/**
+		 * Sum or difference of two expressions of the same type.
+		 */
+		template <typename Lhs, typename Rhs, bool Subtract>
+		class Sum : public Expression
+		{
+		public:
+			/**
+			 * The type of the result.
+			 */
+			typedef typename Lhs::Result Result;
+
+			/**
+			 * The scalar type of the entries.
+			 */
+			typedef typename Lhs::Scalar Scalar;
+
+			/**
+			 * Constructor.
+			 *
+			 * @param lhs The left hand side expression.
+			 * @param rhs The right hand side expression.
+			 */
+			constexpr Sum(const Lhs& lhs, const Rhs& rhs);
+
+			/**
+			 * Returns an entry of the result.
+			 *
+			 * @param index The index of the entry.
+			 * @return The entry.
+			 */
+			constexpr Scalar operator[](std::size_t index) const;
+
+			/**
+			 * Evaluates the expression.
+			 *
+			 * @return The sum or difference.
+			 */
+			constexpr operator Result() const;
+
+		private:
+			/**
+			 * The operands.
+			 */
+			Lhs lhs;
+			Rhs rhs;
+		};
+
+		/**
+		 * Expression multiplied by a scalar.
+		 */
+		template <typename E>
+		class Scaled : public Expression
+		{
+		public:
+			/**
+			 * The type of the result.
+			 */
+			typedef typename E::Result Result;
+
+			/**
+			 * The scalar type of the entries.
+			 */
+			typedef typename E::Scalar Scalar;
+
+			/**
+			 * Constructor.
+			 *
+			 * @param operand The expression.
+			 * @param factor The scalar to multiply each entry by.
+			 */
+			constexpr Scaled(const E& operand, Scalar factor);
+
+			/**
+			 * Returns an entry of the result.
+			 *
+			 * @param index The index of the entry.
+			 * @return The entry.
+			 */
+			constexpr Scalar operator[](std::size_t index) const;
+
+			/**
+			 * Evaluates the expression.
+			 *
+			 * @return The scaled vector or matrix.
+			 */
+			constexpr operator Result() const;
+
+		private:
+			/**
+			 * The expression.
+			 */
+			E operand;
+
+			/**
+			 * The scalar to multiply each entry by.
+			 */
+			Scalar factor;
+		};
+
+		/**
+		 * Wraps a vector or matrix so that arithmetic on it builds an
+		 * expression.
+		 *
+		 * @param value The vector or matrix, which must outlive the
+		 * expression.
+		 * @return The leaf expression.
+		 */
+		template <typename Type>
+		constexpr Leaf<Type> lazy(const Type& value);
+
+		/**
+		 * Evaluates an expression in a single pass over the entries of its
+		 * result.
+		 *
+		 * @param expression The expression.
+		 * @return The vector or matrix.
+		 */
+		template <typename E>
+		constexpr typename E::Result evaluate(const E& expression);
+
+		/**
+		 * Whether `Type` is an expression.
+		 */
+		template <typename Type>
+		struct IsExpression : std::is_base_of<Expression, Type>
+		{
+		};
+
+		/**
+		 * The expression for an operand of an operator: expressions are used
+		 * as they are, and vectors and matrices are wrapped in a Leaf.
+		 */
+		template <typename Value, bool = IsExpression<Value>::value>
+		struct Operand
+		{
+			typedef Value Type;
+			static constexpr const Value& wrap(const Value& operand);
+		};
+
+		template <typename Value>
+		struct Operand<Value, false>
+		{
+			typedef Leaf<Value> Type;
+			static constexpr Leaf<Value> wrap(const Value& operand);
+		};
+
+		/**
+		 * The type of the value of an operand of an operator.
+		 */
+		template <typename Value, bool = IsExpression<Value>::value>
+		struct ResultOf
+		{
+			typedef typename Value::Result Type;
+		};
+
+		template <typename Value>
+		struct ResultOf<Value, false>
+		{
+			typedef Value Type;
+		};
+
+		/**
+		 * The expression for the sum or difference of `Lhs` and `Rhs`, which
+		 * is defined only if at least one of them is an expression and their
+		 * values are of the same type. This keeps the operators out of
+		 * overload resolution for other types, even where the namespace has
+		 * been imported by a using-directive.
+		 */
+		template <typename Lhs, typename Rhs, bool Subtract,
+			bool = IsExpression<Lhs>::value || IsExpression<Rhs>::value>
+		struct SumOf
+		{
+		};
+
+		template <typename Lhs, typename Rhs, bool Subtract>
+		struct SumOf<Lhs, Rhs, Subtract, true>
+		: std::enable_if<std::is_same<typename ResultOf<Lhs>::Type, typename ResultOf<Rhs>::Type>::value,
+			Sum<typename Operand<Lhs>::Type, typename Operand<Rhs>::Type, Subtract> >
+		{
+		};
+
+		/**
+		 * Expression addition operator.
+		 *
+		 * @param lhs The left hand side operand.
+		 * @param rhs The right hand side operand.
+		 * @return The expression for the sum.
+		 */
+		template <typename Lhs, typename Rhs>
+		constexpr typename SumOf<Lhs, Rhs, false>::type operator+(const Lhs& lhs, const Rhs& rhs);
+
+		/**
+		 * Expression subtraction operator.
+		 *
+		 * @param lhs The left hand side operand.
+		 * @param rhs The right hand side operand.
+		 * @return The expression for the difference.
+		 */
+		template <typename Lhs, typename Rhs>
+		constexpr typename SumOf<Lhs, Rhs, true>::type operator-(const Lhs& lhs, const Rhs& rhs);
+
+		/**
+		 * Expression negation operator.
+		 *
+		 * @param operand The expression.
+		 * @return The expression for the negation.
+		 */
+		template <typename E, typename = typename std::enable_if<IsExpression<E>::value>::type>
+		constexpr Scaled<E> operator-(const E& operand);
+
+		/**
+		 * Expression scalar multiplication operator.
+		 *
+		 * @param operand The expression.
+		 * @param s The scalar value.
+		 * @return The expression for the product.
+		 */
+		template <typename E, typename = typename std::enable_if<IsExpression<E>::value>::type>
+		constexpr Scaled<E> operator*(const E& operand, typename E::Scalar s);
+
+		/**
+		 * Expression scalar multiplication operator.
+		 *
+		 * @param s The scalar value.
+		 * @param operand The expression.
+		 * @return The expression for the product.
+		 */
+		template <typename E, typename = typename std::enable_if<IsExpression<E>::value>::type>
+		constexpr Scaled<E> operator*(typename E::Scalar s, const E& operand);
+
+		/**
+		 * Expression scalar division operator.
+		 *
+		 * @param operand The expression.
+		 * @param s The non-zero scalar value.
+		 * @return The expression for the quotient.
+		 */
+		template <typename E, typename = typename std::enable_if<IsExpression<E>::value>::type>
+		constexpr Scaled<E> operator/(const E& operand, typename E::Scalar s);
+	}
+}
+
+#include <M3D/Expression.inl>
+
+#endif
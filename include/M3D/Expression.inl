@@ -0,0 +1,251 @@
+#ifndef EXPRESSION_INL
+#define EXPRESSION_INL
+
+// Inline definitions of the expression templates. This file is included at the
+// end of Expression.hpp and should not be included directly.
+
+#include <cassert>
+#include <utility>
+
+namespace M3D
+{
+	namespace expr
+	{
+		template <typename T>
+		struct Traits<TVector2<T> >
+		{
+			typedef T Scalar;
+			static constexpr std::size_t SIZE = 2;
+
+			static constexpr T get(const TVector2<T>& v, std::size_t index)
+			{
+				return index == 0 ? v.x : v.y;
+			}
+
+			static constexpr TVector2<T> make(const T* values)
+			{
+				return TVector2<T>(values[0], values[1]);
+			}
+		};
+
+		template <typename T>
+		struct Traits<TVector3<T> >
+		{
+			typedef T Scalar;
+			static constexpr std::size_t SIZE = 3;
+
+			static constexpr T get(const TVector3<T>& v, std::size_t index)
+			{
+				return index == 0 ? v.x : (index == 1 ? v.y : v.z);
+			}
+
+			static constexpr TVector3<T> make(const T* values)
+			{
+				return TVector3<T>(values[0], values[1], values[2]);
+			}
+		};
+
+		template <typename T>
+		struct Traits<TVector4<T> >
+		{
+			typedef T Scalar;
+			static constexpr std::size_t SIZE = 4;
+
+			static constexpr T get(const TVector4<T>& v, std::size_t index)
+			{
+				return index == 0 ? v.x : (index == 1 ? v.y : (index == 2 ? v.z : v.w));
+			}
+
+			static constexpr TVector4<T> make(const T* values)
+			{
+				return TVector4<T>(values[0], values[1], values[2], values[3]);
+			}
+		};
+
+		template <typename T>
+		struct Traits<TMatrix2<T> >
+		{
+			typedef T Scalar;
+			static constexpr std::size_t SIZE = 4;
+
+			static constexpr T get(const TMatrix2<T>& A, std::size_t index)
+			{
+				return A[index];
+			}
+
+			static constexpr TMatrix2<T> make(const T* values)
+			{
+				return TMatrix2<T>(values);
+			}
+		};
+
+		template <typename T>
+		struct Traits<TMatrix3<T> >
+		{
+			typedef T Scalar;
+			static constexpr std::size_t SIZE = 9;
+
+			static constexpr T get(const TMatrix3<T>& A, std::size_t index)
+			{
+				return A[index];
+			}
+
+			static constexpr TMatrix3<T> make(const T* values)
+			{
+				return TMatrix3<T>(values);
+			}
+		};
+
+		template <typename T>
+		struct Traits<TMatrix4<T> >
+		{
+			typedef T Scalar;
+			static constexpr std::size_t SIZE = 16;
+
+			static constexpr T get(const TMatrix4<T>& A, std::size_t index)
+			{
+				return A[index];
+			}
+
+			static constexpr TMatrix4<T> make(const T* values)
+			{
+				return TMatrix4<T>(values);
+			}
+		};
+
+		template <typename Type>
+		constexpr Leaf<Type>::Leaf(const Type& value_)
+		: value(value_)
+		{
+			// Nothing to do.
+		}
+
+		template <typename Type>
+		constexpr typename Leaf<Type>::Scalar Leaf<Type>::operator[](std::size_t index) const
+		{
+			return Traits<Type>::get(value, index);
+		}
+
+		template <typename Type>
+		constexpr Leaf<Type>::operator Result() const
+		{
+			return value;
+		}
+
+		template <typename Lhs, typename Rhs, bool Subtract>
+		constexpr Sum<Lhs, Rhs, Subtract>::Sum(const Lhs& lhs_, const Rhs& rhs_)
+		: lhs(lhs_)
+		, rhs(rhs_)
+		{
+			// Nothing to do.
+		}
+
+		template <typename Lhs, typename Rhs, bool Subtract>
+		constexpr typename Sum<Lhs, Rhs, Subtract>::Scalar Sum<Lhs, Rhs, Subtract>::operator[](std::size_t index) const
+		{
+			return Subtract ? lhs[index] - rhs[index] : lhs[index] + rhs[index];
+		}
+
+		template <typename Lhs, typename Rhs, bool Subtract>
+		constexpr Sum<Lhs, Rhs, Subtract>::operator Result() const
+		{
+			return evaluate(*this);
+		}
+
+		template <typename E>
+		constexpr Scaled<E>::Scaled(const E& operand_, Scalar factor_)
+		: operand(operand_)
+		, factor(factor_)
+		{
+			// Nothing to do.
+		}
+
+		template <typename E>
+		constexpr typename Scaled<E>::Scalar Scaled<E>::operator[](std::size_t index) const
+		{
+			return operand[index] * factor;
+		}
+
+		template <typename E>
+		constexpr Scaled<E>::operator Result() const
+		{
+			return evaluate(*this);
+		}
+
+		template <typename Type>
+		constexpr Leaf<Type> lazy(const Type& value)
+		{
+			return Leaf<Type>(value);
+		}
+
+		namespace detail
+		{
+			template <typename E, std::size_t... Indices>
+			constexpr typename E::Result evaluate(const E& expression, std::index_sequence<Indices...>)
+			{
+				// The entries are listed out, rather than computed in a loop,
+				// so that each is a straight-line expression of the operands
+				// that the compiler can vectorise across the entries.
+				const typename E::Scalar values[] = {expression[Indices]...};
+				return Traits<typename E::Result>::make(values);
+			}
+		}
+
+		template <typename E>
+		constexpr typename E::Result evaluate(const E& expression)
+		{
+			return detail::evaluate(expression, std::make_index_sequence<Traits<typename E::Result>::SIZE>());
+		}
+
+		template <typename Value, bool IsExpr>
+		constexpr const Value& Operand<Value, IsExpr>::wrap(const Value& operand)
+		{
+			return operand;
+		}
+
+		template <typename Value>
+		constexpr Leaf<Value> Operand<Value, false>::wrap(const Value& operand)
+		{
+			return Leaf<Value>(operand);
+		}
+
+		template <typename Lhs, typename Rhs>
+		constexpr typename SumOf<Lhs, Rhs, false>::type operator+(const Lhs& lhs, const Rhs& rhs)
+		{
+			return typename SumOf<Lhs, Rhs, false>::type(Operand<Lhs>::wrap(lhs), Operand<Rhs>::wrap(rhs));
+		}
+
+		template <typename Lhs, typename Rhs>
+		constexpr typename SumOf<Lhs, Rhs, true>::type operator-(const Lhs& lhs, const Rhs& rhs)
+		{
+			return typename SumOf<Lhs, Rhs, true>::type(Operand<Lhs>::wrap(lhs), Operand<Rhs>::wrap(rhs));
+		}
+
+		template <typename E, typename>
+		constexpr Scaled<E> operator-(const E& operand)
+		{
+			return Scaled<E>(operand, -1.0f);
+		}
+
+		template <typename E, typename>
+		constexpr Scaled<E> operator*(const E& operand, typename E::Scalar s)
+		{
+			return Scaled<E>(operand, s);
+		}
+
+		template <typename E, typename>
+		constexpr Scaled<E> operator*(typename E::Scalar s, const E& operand)
+		{
+			return Scaled<E>(operand, s);
+		}
+
+		template <typename E, typename>
+		constexpr Scaled<E> operator/(const E& operand, typename E::Scalar s)
+		{
+			assert(s != 0.0f);
+			return Scaled<E>(operand, 1.0f / s);
+		}
+	}
+}
+
+#endif
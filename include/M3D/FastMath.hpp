@@ -0,0 +1,189 @@
+#ifndef FASTMATH_HPP
+#define FASTMATH_HPP
+
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <cstddef>
+
+namespace M3D
+{
+	/**
+	 * Opt-in approximations of the square root and trigonometric functions
+	 * used by the library, trading a bounded loss of accuracy for speed.
+	 *
+	 * Nothing else in the library uses these functions, so the precise
+	 * results of the member functions are unaffected. The approximations are
+	 * tuned for single precision; the double precision overloads compute the
+	 * precise functions, so that templates can use this namespace for either
+	 * scalar type.
+	 *
+	 * The error bounds below are the largest errors measured over dense
+	 * samples of the stated domains, and are checked by the unit tests.
+	 */
+	namespace fast
+	{
+		/**
+		 * Returns an approximation of 1 / sqrt(`x`).
+		 *
+		 * With SSE (selected by the SIMD CMake option, which defines
+		 * M3D_SIMD_SSE2), this is the hardware estimate refined by one
+		 * Newton-Raphson step, with a relative error below 3e-7 (about two
+		 * units in the last place) for positive normal `x`. Without SSE, it
+		 * is computed exactly.
+		 *
+		 * @param x The value, which must be positive.
+		 * @return The approximate reciprocal square root.
+		 */
+		float rsqrt(float x);
+
+		/**
+		 * Returns 1 / sqrt(`x`).
+		 *
+		 * @param x The value, which must be positive.
+		 * @return The reciprocal square root.
+		 */
+		double rsqrt(double x);
+
+		/**
+		 * Computes the sine and cosine of an angle together, sharing the
+		 * range reduction between them.
+		 *
+		 * The absolute error is below 1.5e-7 for |`angle`| <= 10^4. Beyond
+		 * that, the range reduction loses accuracy, and above about 10^7 the
+		 * results are meaningless, though still defined.
+		 *
+		 * @param angle The angle in radians, which must be finite.
+		 * @param s Receives the sine.
+		 * @param c Receives the cosine.
+		 */
+		void sincos(float angle, float& s, float& c);
+
+		/**
+		 * Computes the sine and cosine of an angle.
+		 *
+		 * @param angle The angle in radians.
+		 * @param s Receives the sine.
+		 * @param c Receives the cosine.
+		 */
+		void sincos(double angle, double& s, double& c);
+
+		/**
+		 * Returns an approximation of the arc cosine, by the polynomial
+		 * of Abramowitz and Stegun 4.4.46.
+		 *
+		 * The absolute error is below 5e-7 radians.
+		 *
+		 * @param x The cosine, in [-1, 1].
+		 * @return The angle in [0, pi] radians.
+		 */
+		float acos(float x);
+
+		/**
+		 * Returns the arc cosine.
+		 *
+		 * @param x The cosine, in [-1, 1].
+		 * @return The angle in [0, pi] radians.
+		 */
+		double acos(double x);
+
+		/**
+		 * Returns an approximation of the angle of the point (`x`, `y`),
+		 * reducing the ratio of the coordinates to [0, tan(pi/8)] and
+		 * evaluating the polynomial of the Cephes atanf.
+		 *
+		 * The absolute error is below 3e-7 radians. Unlike std::atan2,
+		 * atan2(0, 0) is zero whatever the signs of the zeros.
+		 *
+		 * @param y The y coordinate.
+		 * @param x The x coordinate.
+		 * @return The angle in [-pi, pi] radians.
+		 */
+		float atan2(float y, float x);
+
+		/**
+		 * Returns the angle of the point (`x`, `y`).
+		 *
+		 * @param y The y coordinate.
+		 * @param x The x coordinate.
+		 * @return The angle in [-pi, pi] radians.
+		 */
+		double atan2(double y, double x);
+
+		/**
+		 * Returns the magnitude of a vector using rsqrt().
+		 *
+		 * @param v The vector.
+		 * @return The approximate magnitude, or zero for the zero vector.
+		 */
+		template <typename T>
+		T magnitude(const TVector3<T>& v);
+
+		/**
+		 * Returns the vector scaled to unit length using rsqrt().
+		 *
+		 * @param v The vector, which must not be the zero vector.
+		 * @return The approximately normalized vector.
+		 */
+		template <typename T>
+		TVector3<T> normalized(const TVector3<T>& v);
+
+		/**
+		 * Returns the vector scaled to unit length using rsqrt().
+		 *
+		 * @param v The vector, which must not be the zero vector.
+		 * @return The approximately normalized vector.
+		 */
+		template <typename T>
+		TVector4<T> normalized(const TVector4<T>& v);
+
+		/**
+		 * Returns the quaternion scaled to unit norm using rsqrt().
+		 *
+		 * @param q The quaternion, which must not be zero.
+		 * @return The approximately normalized quaternion.
+		 */
+		template <typename T>
+		TQuaternion<T> normalized(const TQuaternion<T>& q);
+
+		/**
+		 * Equivalent to TQuaternion::angleAxis(), using sincos().
+		 *
+		 * @param angle The angle of rotation in radians.
+		 * @param axis The unit axis of rotation.
+		 * @return The rotation.
+		 */
+		template <typename T>
+		TQuaternion<T> angleAxis(T angle, const TVector3<T>& axis);
+
+		/**
+		 * Equivalent to TQuaternion::euler(), using sincos().
+		 *
+		 * @param eulerAngles The roll, pitch and yaw in radians.
+		 * @return The rotation.
+		 */
+		template <typename T>
+		TQuaternion<T> euler(const TVector3<T>& eulerAngles);
+
+		/**
+		 * Normalizes each vector in an array using the reciprocal square root
+		 * estimate of the SIMD instruction set selected at configure time,
+		 * refined by one Newton-Raphson step, for four (SSE2) or eight (AVX)
+		 * vectors at a time. The results agree with those of normalized() to
+		 * within its error bound.
+		 *
+		 * @note The output array may be the same as the input array.
+		 *
+		 * @param in The vectors to normalize, none of which may be zero.
+		 * @param out Array to receive the normalized vectors.
+		 * @param count The number of vectors.
+		 */
+		template <typename T>
+		void normalize(const TVector3<T>* in, TVector3<T>* out, std::size_t count);
+	}
+}
+
+#include <M3D/FastMath.inl>
+
+#endif
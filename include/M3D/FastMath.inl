@@ -0,0 +1,207 @@
+#ifndef FASTMATH_INL
+#define FASTMATH_INL
+
+// Inline definitions of the fast approximations. This file is included at the
+// end of FastMath.hpp and should not be included directly.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// The hardware reciprocal square root estimate is used when SSE is both
+// selected by the SIMD CMake option and targeted by the compiler.
+#if defined(M3D_SIMD_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define M3D_FASTMATH_SSE 1
+	#include <xmmintrin.h>
+#endif
+
+namespace M3D
+{
+	namespace fast
+	{
+		inline float rsqrt(float x)
+		{
+#if defined(M3D_FASTMATH_SSE)
+			// The estimate has a relative error of up to 1.5 * 2^-12, which
+			// one Newton-Raphson step squares.
+			const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+			return y * (1.5f - 0.5f * x * y * y);
+#else
+			return 1.0f / std::sqrt(x);
+#endif
+		}
+
+		inline double rsqrt(double x)
+		{
+			return 1.0 / std::sqrt(x);
+		}
+
+		inline void sincos(float angle, float& s, float& c)
+		{
+			assert(std::isfinite(angle));
+
+			// Reduce the angle to r in [-pi/4, pi/4], where angle = r + q pi/2.
+			// The multiple of pi/2 is subtracted in three parts, the first of
+			// which has few enough bits that its product with q is exact.
+			// Quotients of 2^23 and above are already integers, which need not
+			// fit in an int, so only their quadrant is converted.
+			const float v = angle * 0.636619772f;
+			float fq;
+			int q;
+			if (std::abs(v) < 8388608.0f)
+			{
+				q = static_cast<int>(v + (v >= 0.0f ? 0.5f : -0.5f));
+				fq = static_cast<float>(q);
+			}
+			else
+			{
+				q = static_cast<int>(std::fmod(v, 4.0f));
+				fq = v;
+			}
+
+			const float r = ((angle - fq * 1.5703125f) - fq * 4.837512969970703125e-4f) - fq * 7.54978995489188216e-8f;
+			const float r2 = r * r;
+
+			// Minimax polynomials of the Cephes sinf and cosf on [-pi/4, pi/4].
+			const float sinR = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+			const float cosR = 1.0f - 0.5f * r2
+				+ r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+
+			switch (q & 3)
+			{
+				case 0: s = sinR; c = cosR; break;
+				case 1: s = cosR; c = -sinR; break;
+				case 2: s = -sinR; c = -cosR; break;
+				default: s = -cosR; c = sinR; break;
+			}
+		}
+
+		inline void sincos(double angle, double& s, double& c)
+		{
+			s = std::sin(angle);
+			c = std::cos(angle);
+		}
+
+		inline float acos(float x)
+		{
+			// acos(x) = sqrt(1 - x) p(x) for x in [0, 1], and
+			// acos(-x) = pi - acos(x).
+			const float a = std::abs(x);
+			const float p = ((((((-0.0012624911f * a + 0.0066700901f) * a - 0.0170881256f) * a + 0.0308918810f) * a
+				- 0.0501743046f) * a + 0.0889789874f) * a - 0.2145988016f) * a + 1.5707963050f;
+			const float r = std::sqrt(1.0f - a) * p;
+			return x < 0.0f ? 3.14159265f - r : r;
+		}
+
+		inline double acos(double x)
+		{
+			return std::acos(x);
+		}
+
+		inline float atan2(float y, float x)
+		{
+			const float ax = std::abs(x);
+			const float ay = std::abs(y);
+			const float large = std::max(ax, ay);
+			const float small = std::min(ax, ay);
+			if (large == 0.0f)
+			{
+				return 0.0f;
+			}
+
+			// Find atan(small / large) in [0, pi/4], using
+			// atan(t) = pi/4 + atan((t - 1) / (t + 1)) for t above tan(pi/8)
+			// so that the polynomial is only evaluated on [0, tan(pi/8)].
+			float t, r;
+			if (small > 0.41421356f * large)
+			{
+				t = (small - large) / (small + large);
+				r = 0.785398163f;
+			}
+			else
+			{
+				t = small / large;
+				r = 0.0f;
+			}
+
+			const float z = t * t;
+			r += (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * t + t;
+
+			// Unfold the octant.
+			if (ay > ax)
+			{
+				r = 1.57079633f - r;
+			}
+
+			if (x < 0.0f)
+			{
+				r = 3.14159265f - r;
+			}
+
+			return y < 0.0f ? -r : r;
+		}
+
+		inline double atan2(double y, double x)
+		{
+			return std::atan2(y, x);
+		}
+
+		template <typename T>
+		inline T magnitude(const TVector3<T>& v)
+		{
+			const T sqr = v.sqrMagnitude();
+			return sqr > 0.0f ? sqr * rsqrt(sqr) : T(0);
+		}
+
+		template <typename T>
+		inline TVector3<T> normalized(const TVector3<T>& v)
+		{
+			const T sqr = v.sqrMagnitude();
+			assert(sqr != 0.0f);
+			return v * rsqrt(sqr);
+		}
+
+		template <typename T>
+		inline TVector4<T> normalized(const TVector4<T>& v)
+		{
+			const T sqr = v.sqrMagnitude();
+			assert(sqr != 0.0f);
+			return v * rsqrt(sqr);
+		}
+
+		template <typename T>
+		inline TQuaternion<T> normalized(const TQuaternion<T>& q)
+		{
+			const T sqr = q.sqrMagnitude();
+			assert(sqr > 0.0f);
+			const T invNorm = rsqrt(sqr);
+			return TQuaternion<T>(q.w * invNorm, q.x * invNorm, q.y * invNorm, q.z * invNorm);
+		}
+
+		template <typename T>
+		inline TQuaternion<T> angleAxis(T angle, const TVector3<T>& axis)
+		{
+			T s, c;
+			sincos(0.5f * angle, s, c);
+			return TQuaternion<T>(c, axis * s);
+		}
+
+		template <typename T>
+		inline TQuaternion<T> euler(const TVector3<T>& eulerAngles)
+		{
+			T sinHalfPhi, cosHalfPhi, sinHalfTheta, cosHalfTheta, sinHalfPsi, cosHalfPsi;
+			sincos(0.5f * eulerAngles.x, sinHalfPhi, cosHalfPhi);
+			sincos(0.5f * eulerAngles.y, sinHalfTheta, cosHalfTheta);
+			sincos(0.5f * eulerAngles.z, sinHalfPsi, cosHalfPsi);
+
+			return TQuaternion<T>(
+				cosHalfPhi * cosHalfTheta * cosHalfPsi - sinHalfPhi * sinHalfTheta * sinHalfPsi,
+				sinHalfPhi * cosHalfTheta * cosHalfPsi + cosHalfPhi * sinHalfTheta * sinHalfPsi,
+				cosHalfPhi * sinHalfTheta * cosHalfPsi - sinHalfPhi * cosHalfTheta * sinHalfPsi,
+				cosHalfPhi * cosHalfTheta * sinHalfPsi + sinHalfPhi * sinHalfTheta * cosHalfPsi
+			);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef FRUSTUM_HPP
+#define FRUSTUM_HPP
+
+#include <M3D/AABB.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+
+namespace M3D
+{
+	/**
+	 * View frustum bounded by six planes.
+	 *
+	 * Each plane is stored as a 4D vector (a, b, c, d) with unit normal
+	 * (a, b, c) pointing into the frustum, so that the signed distance of a
+	 * point p from the plane is a*p.x + b*p.y + c*p.z + d and is non-negative
+	 * on the inside. The planes are held in the order left, right, bottom,
+	 * top, near, far.
+	 */
+	template <typename T>
+	class TFrustum
+	{
+	public:
+		/**
+		 * Scalar type of the plane coefficients.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the frustum of the identity projection, which is the
+		 * cube [-1, 1]^3.
+		 */
+		TFrustum();
+
+		/**
+		 * Constructor.
+		 *
+		 * Extracts the planes from a projection or view-projection matrix
+		 * using the method described by Gribb and Hartmann in "Fast
+		 * Extraction of Viewing Frustum Planes from the World-View-Projection
+		 * Matrix". The planes are in the space that `A` transforms from, so
+		 * passing the view-projection matrix gives world space planes.
+		 *
+		 * A reversed-Z projection uses the [0, 1] depth range, but maps the
+		 * near plane to depth 1, so the near and far planes of the frustum
+		 * are then swapped.
+		 *
+		 * @param A The matrix that transforms points, as column vectors, to
+		 * clip space.
+		 * @param depth The clip space depth range of `A`.
+		 */
+		explicit TFrustum(const TMatrix4<T>& A, ClipDepth depth = CLIP_DEPTH_NEGATIVE_ONE_TO_ONE);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its plane coefficients
+		 * converted to the scalar type of this frustum.
+		 *
+		 * @param other The frustum to convert.
+		 */
+		template <typename U>
+		explicit TFrustum(const TFrustum<U>& other);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param frustum Frustum to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TFrustum<U>& frustum);
+
+		/**
+		 * Returns the plane at the specified index.
+		 *
+		 * @param index The index of the plane, in the order left, right,
+		 * bottom, top, near, far.
+		 * @return The normalized plane coefficients.
+		 */
+		const TVector4<T>& plane(std::size_t index) const;
+
+		/**
+		 * Returns whether the frustum contains the specified point. Points on
+		 * the boundary are contained.
+		 *
+		 * @param point The point to test.
+		 * @return True if the point lies inside all six planes. False
+		 * otherwise.
+		 */
+		bool contains(const TVector3<T>& point) const;
+
+		/**
+		 * Returns whether the specified sphere may intersect the frustum.
+		 *
+		 * The test is conservative: a sphere that lies outside the frustum
+		 * but not wholly outside any single plane, near a corner of the
+		 * frustum, is reported as intersecting.
+		 *
+		 * @param center The center of the sphere.
+		 * @param radius The radius of the sphere.
+		 * @return False if the sphere lies wholly outside one of the planes.
+		 * True otherwise.
+		 */
+		bool intersects(const TVector3<T>& center, T radius) const;
+
+		/**
+		 * Returns whether the specified box may intersect the frustum.
+		 *
+		 * The test is conservative in the same way as the sphere test.
+		 *
+		 * @note The box must not be empty.
+		 *
+		 * @param box The box to test.
+		 * @return False if the box lies wholly outside one of the planes.
+		 * True otherwise.
+		 */
+		bool intersects(const TAABB<T>& box) const;
+
+		/**
+		 * Culls an array of spheres, stored as separate arrays of center
+		 * coordinates and radii, against the frustum.
+		 *
+		 * The spheres are tested four (SSE2) or eight (AVX) at a time. Bit
+		 * (i % 32) of `visibility[i / 32]` is set if sphere i passes the
+		 * test of intersects(const TVector3<T>&, T) and cleared otherwise;
+		 * the unused high bits of the last word are cleared.
+		 *
+		 * @param xs The x-coordinates of the centers.
+		 * @param ys The y-coordinates of the centers.
+		 * @param zs The z-coordinates of the centers.
+		 * @param radii The radii.
+		 * @param visibility Array of (count + 31) / 32 words to receive the
+		 * visibility bitmask.
+		 * @param count The number of spheres.
+		 */
+		void cullSpheres(const T* xs, const T* ys, const T* zs, const T* radii,
+			std::uint32_t* visibility, std::size_t count) const;
+
+		/**
+		 * Culls an array of boxes, stored as separate arrays of the
+		 * coordinates of their minimum and maximum corners, against the
+		 * frustum.
+		 *
+		 * The boxes are tested four (SSE2) or eight (AVX) at a time. Bit
+		 * (i % 32) of `visibility[i / 32]` is set if box i passes the test of
+		 * intersects(const TAABB<T>&) and cleared otherwise; the unused high
+		 * bits of the last word are cleared.
+		 *
+		 * @param minXs The x-coordinates of the minimum corners.
+		 * @param minYs The y-coordinates of the minimum corners.
+		 * @param minZs The z-coordinates of the minimum corners.
+		 * @param maxXs The x-coordinates of the maximum corners.
+		 * @param maxYs The y-coordinates of the maximum corners.
+		 * @param maxZs The z-coordinates of the maximum corners.
+		 * @param visibility Array of (count + 31) / 32 words to receive the
+		 * visibility bitmask.
+		 * @param count The number of boxes.
+		 */
+		void cullBoxes(const T* minXs, const T* minYs, const T* minZs,
+			const T* maxXs, const T* maxYs, const T* maxZs,
+			std::uint32_t* visibility, std::size_t count) const;
+
+	private:
+		/**
+		 * The planes, in the order left, right, bottom, top, near, far.
+		 */
+		TVector4<T> planes[6];
+	};
+
+	/**
+	 * Single precision view frustum.
+	 */
+	typedef TFrustum<float> Frustum;
+
+	/**
+	 * Double precision view frustum.
+	 */
+	typedef TFrustum<double> Frustumd;
+}
+
+#include <M3D/Frustum.inl>
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef FRUSTUM_INL
+#define FRUSTUM_INL
+
+// Inline definitions of the small, frequently called Frustum operations. This
+// file is included at the end of Frustum.hpp and should not be included
+// directly.
+
+#include <cmath>
+
+namespace M3D
+{
+	template <typename T>
+	inline TFrustum<T>::TFrustum()
+	{
+		planes[0] = TVector4<T>(1, 0, 0, 1);
+		planes[1] = TVector4<T>(-1, 0, 0, 1);
+		planes[2] = TVector4<T>(0, 1, 0, 1);
+		planes[3] = TVector4<T>(0, -1, 0, 1);
+		planes[4] = TVector4<T>(0, 0, 1, 1);
+		planes[5] = TVector4<T>(0, 0, -1, 1);
+	}
+
+	template <typename T>
+	template <typename U>
+	inline TFrustum<T>::TFrustum(const TFrustum<U>& other)
+	{
+		for (std::size_t i = 0; i < 6; ++i)
+		{
+			planes[i] = TVector4<T>(other.plane(i));
+		}
+	}
+
+	template <typename T>
+	inline const TVector4<T>& TFrustum<T>::plane(std::size_t index) const
+	{
+		return planes[index];
+	}
+
+	template <typename T>
+	inline bool TFrustum<T>::contains(const TVector3<T>& point) const
+	{
+		return intersects(point, 0);
+	}
+
+	template <typename T>
+	inline bool TFrustum<T>::intersects(const TVector3<T>& center, T radius) const
+	{
+		for (std::size_t i = 0; i < 6; ++i)
+		{
+			const TVector4<T>& p = planes[i];
+			if (p.x * center.x + p.y * center.y + p.z * center.z + p.w < -radius)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	inline bool TFrustum<T>::intersects(const TAABB<T>& box) const
+	{
+		// The box is outside a plane when its center is further behind the
+		// plane than the projection of its extents onto the plane normal.
+		const TVector3<T> c = box.center();
+		const TVector3<T> e = box.extents();
+		for (std::size_t i = 0; i < 6; ++i)
+		{
+			const TVector4<T>& p = planes[i];
+			const T distance = p.x * c.x + p.y * c.y + p.z * c.z + p.w;
+			const T radius = std::abs(p.x) * e.x + std::abs(p.y) * e.y + std::abs(p.z) * e.z;
+			if (distance < -radius)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+#endif
@@ -6,15 +6,21 @@
 
 namespace M3D
 {
-	class Matrix2
+	template <typename T>
+	class TMatrix2
 	{
 	public:
+		/**
+		 * Scalar type of the entries.
+		 */
+		typedef T Scalar;
+
 		/**
 		 * Default constructor.
 		 *
 		 * Constructs the identity matrix.
 		 */
-		Matrix2();
+		constexpr TMatrix2();
 
 		/**
 		 * Constructor.
@@ -23,7 +29,7 @@ namespace M3D
 		 *
 		 * @param arr Array of floating point values in row-major order.
 		 */
-		Matrix2(const float arr[4]);
+		constexpr TMatrix2(const T arr[4]);
 
 		/**
 		 * Constructor.
@@ -36,14 +42,25 @@ namespace M3D
 		 * @param entry11 Entry at row 1 column 1.
 		 * @param entry20 Entry at row 2 column 0.
 		 */
-		Matrix2(float entry00, float entry01, float entry10, float entry11);
+		constexpr TMatrix2(T entry00, T entry01, T entry10, T entry11);
 
 		/**
 		 * Copy constructor.
 		 *
 		 * @param other The other matrix to copy.
 		 */
-		Matrix2(const Matrix2& other) = default;
+		TMatrix2(const TMatrix2& other) = default;
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its entries converted to the
+		 * scalar type of this matrix.
+		 *
+		 * @param other The matrix to convert.
+		 */
+		template <typename U>
+		explicit constexpr TMatrix2(const TMatrix2<U>& other);
 
 		/**
 		 * Matrix entry accessor operator.
@@ -53,7 +70,7 @@ namespace M3D
 		 * @param index Index for the entry to return.
 		 * @return Entry at position `index`.
 		 */
-		float operator[](std::size_t index) const;
+		constexpr T operator[](std::size_t index) const;
 
 		/**
 		 * Equality operator.
@@ -62,7 +79,8 @@ namespace M3D
 		 * @param B The second matrix.
 		 * @return True if the two supplied matrices are equal. False otherwise.
 		 */
-		friend bool operator==(const Matrix2& A, const Matrix2& B);
+		template <typename U>
+		friend bool operator==(const TMatrix2<U>& A, const TMatrix2<U>& B);
 
 		/**
 		 * Non-equality operator.
@@ -72,7 +90,8 @@ namespace M3D
 		 * @return True if the two supplied matrices are not equal. False
 		 * otherwise.
 		 */
-		friend bool operator!=(const Matrix2& A, const Matrix2& B);
+		template <typename U>
+		friend bool operator!=(const TMatrix2<U>& A, const TMatrix2<U>& B);
 
 		/**
 		 * Matrix addition operator.
@@ -83,7 +102,8 @@ namespace M3D
 		 * @param B The second matrix.
 		 * @return The matrix equal to the sum of `A` and `B`.
 		 */
-		friend Matrix2 operator+(const Matrix2& A, const Matrix2& B);
+		template <typename U>
+		friend constexpr TMatrix2<U> operator+(const TMatrix2<U>& A, const TMatrix2<U>& B);
 
 		/**
 		 * Matrix subtraction operator.
@@ -95,7 +115,8 @@ namespace M3D
 		 * @return The matrix equal to the `rhs` matrix subtracted from the `lhs`
 		 * matrix.
 		 */
-		friend Matrix2 operator-(const Matrix2& lhs, const Matrix2& rhs);
+		template <typename U>
+		friend constexpr TMatrix2<U> operator-(const TMatrix2<U>& lhs, const TMatrix2<U>& rhs);
 
 		/**
 		 * Matrix negation operator.
@@ -103,7 +124,8 @@ namespace M3D
 		 * @param A The matrix to negate.
 		 * @return The additive inverse of the matrix `A`.
 		 */
-		friend Matrix2 operator-(const Matrix2 &A);
+		template <typename U>
+		friend constexpr TMatrix2<U> operator-(const TMatrix2<U> &A);
 
 		/**
 		 * Scalar multiplication operator.
@@ -114,7 +136,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return The matrix `A` multiplied by the scalar `s`.
 		 */
-		friend Matrix2 operator*(const Matrix2& A, const float s);
+		template <typename U>
+		friend constexpr TMatrix2<U> operator*(const TMatrix2<U>& A, const typename TMatrix2<U>::Scalar s);
 
 		/**
 		 * Scalar multiplication operator.
@@ -125,7 +148,8 @@ namespace M3D
 		 * @param A The matrix to be multiplied by the given scalar.
 		 * @return The matrix `A` multiplied by the scalar `s`.
 		 */
-		friend Matrix2 operator*(const float s, const Matrix2& A);
+		template <typename U>
+		friend constexpr TMatrix2<U> operator*(const typename TMatrix2<U>::Scalar s, const TMatrix2<U>& A);
 
 		/**
 		 * Vector multiplication operator.
@@ -137,7 +161,8 @@ namespace M3D
 		 * @param rhs The column vector.
 		 * @return The vector `rhs` multiplied by the matrix `lhs` on the left.
 		 */
-		friend Vector2 operator*(const Matrix2& lhs, const Vector2& rhs);
+		template <typename U>
+		friend constexpr TVector2<U> operator*(const TMatrix2<U>& lhs, const TVector2<U>& rhs);
 
 		/**
 		 * Vector multiplication operator.
@@ -149,7 +174,8 @@ namespace M3D
 		 * @param rhs The row vector.
 		 * @return The vector `lhs` multiplied by the matrix `rhs` on the right.
 		 */
-		friend Vector2 operator*(const Vector2& lhs, const Matrix2& rhs);
+		template <typename U>
+		friend constexpr TVector2<U> operator*(const TVector2<U>& lhs, const TMatrix2<U>& rhs);
 
 		/**
 		 * Matrix multiplication operator.
@@ -160,7 +186,8 @@ namespace M3D
 		 * @param rhs The right hand side matrix.
 		 * @return The matrix equal to the product `lhs` x `rhs`.
 		 */
-		friend Matrix2 operator*(const Matrix2& lhs, const Matrix2& rhs);
+		template <typename U>
+		friend constexpr TMatrix2<U> operator*(const TMatrix2<U>& lhs, const TMatrix2<U>& rhs);
 
 		/**
 		 * Stream output operator.
@@ -169,7 +196,8 @@ namespace M3D
 		 * @param A Matrix to output.
 		 * @return Output stream.
 		 */
-		friend std::ostream& operator <<(std::ostream& out, const Matrix2& A);
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TMatrix2<U>& A);
 
 		/**
 		 * Returns a copy of this matrix transposed so that the rows now form
@@ -177,7 +205,7 @@ namespace M3D
 		 *
 		 * @return Transposed copy of this matrix.
 		 */
-		Matrix2 transposed() const;
+		constexpr TMatrix2 transposed() const;
 
 		/**
 		 * Transposes this matrix so that the rows now form columns.
@@ -192,14 +220,27 @@ namespace M3D
 		 *
 		 * @return The determinant.
 		 */
-		float determinant() const;
+		constexpr T determinant() const;
 
 		/**
 		 * Returns a copy of the multiplicitive inverse of this matrix.
 		 *
 		 * @return The multiplicitive inverse of this matrix.
 		 */
-		Matrix2 inverse() const;
+		TMatrix2 inverse() const;
+
+		/**
+		 * Computes the multiplicitive inverse of this matrix if the magnitude
+		 * of its determinant exceeds `epsilon`.
+		 *
+		 * @param out Matrix to receive the inverse, which is left unchanged
+		 * if this matrix is singular. It may be this matrix.
+		 * @param epsilon The largest magnitude of the determinant for which
+		 * the matrix is treated as singular.
+		 * @return True if the inverse was computed, or false if the matrix
+		 * is singular.
+		 */
+		bool tryInverse(TMatrix2& out, const T epsilon = 0.0f) const;
 
 		/**
 		 * Returns a scaling matrix that scales by `scaleFactors.x` and
@@ -208,7 +249,7 @@ namespace M3D
 		 * @param scaleFactors Scale factors.
 		 * @return Scaling matrix.
 		 */
-		static Matrix2 scaling(const Vector2& scaleFactors);
+		static TMatrix2 scaling(const TVector2<T>& scaleFactors);
 
 		/**
 		 * Returns a scaling matrix that scales by `factor` uniformly.
@@ -216,7 +257,7 @@ namespace M3D
 		 * @param scale Uniform scale factor.
 		 * @return Scaling matrix.
 		 */
-		static Matrix2 scaling(const float factor);
+		static TMatrix2 scaling(const T factor);
 
 		/**
 		 * Returns a rotation matrix that rotates by `angle` radians.
@@ -225,7 +266,7 @@ namespace M3D
 		 * @return Rotation matrix that rotates `angle` radians
 		 * counter-clockwise.
 		 */
-		static Matrix2 angleRotation(const float angle);
+		static TMatrix2 angleRotation(const T angle);
 
 		/**
 		 * Returns a rotation matrix that represents the sortest rotation from
@@ -236,25 +277,57 @@ namespace M3D
 		 * @return Rotation matrix corresponding to the rotation from
 		 * `fromDirection` to `toDirection`.
 		 */
-		static Matrix2 fromToRotation(const Vector2& fromDirection, const Vector2& toDirection);
+		static TMatrix2 fromToRotation(const TVector2<T>& fromDirection, const TVector2<T>& toDirection);
 
 	public:
 		/**
 		 * The multiplicitive identity matrix.
 		 */
-		static const Matrix2 IDENTITY;
+		static const TMatrix2 IDENTITY;
 
 		/**
 		 * The additive identity matrix.
 		 */
-		static const Matrix2 ZERO;
+		static const TMatrix2 ZERO;
 
 	private:
 		/**
 		 * The matrix entries (row major).
 		 */
-		float m[4];
+		T m[4];
 	};
+
+	/**
+	 * Inverts each matrix in an array whose determinant exceeds `epsilon` in
+	 * magnitude, in the manner of TMatrix2::tryInverse().
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param matrices The matrices to invert.
+	 * @param out Array to receive the inverses. The entries for singular
+	 * matrices are left unchanged.
+	 * @param valid Array to receive, for each matrix, whether it was
+	 * inverted.
+	 * @param count The number of matrices.
+	 * @param epsilon The largest magnitude of the determinant for which a
+	 * matrix is treated as singular.
+	 * @return The number of matrices inverted.
+	 */
+	template <typename T>
+	std::size_t tryInverse(const TMatrix2<T>* matrices, TMatrix2<T>* out, bool* valid, std::size_t count,
+		const typename TMatrix2<T>::Scalar epsilon = 0.0f);
+
+	/**
+	 * Single precision 2x2 matrix.
+	 */
+	typedef TMatrix2<float> Matrix2;
+
+	/**
+	 * Double precision 2x2 matrix.
+	 */
+	typedef TMatrix2<double> Matrix2d;
 }
 
+#include <M3D/Matrix2.inl>
+
 #endif
@@ -0,0 +1,167 @@
+#ifndef MATRIX2_INL
+#define MATRIX2_INL
+
+// Inline definitions of the small, frequently called Matrix2 operations. This
+// file is included at the end of Matrix2.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+#include <utility>
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TMatrix2<T>::TMatrix2()
+	: m{1.0f, 0.0f, 0.0f, 1.0f}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T>::TMatrix2(const T arr[4])
+	: m{arr[0], arr[1], arr[2], arr[3]}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T>::TMatrix2(T entry00, T entry01, T entry10, T entry11)
+	: m{entry00, entry01, entry10, entry11}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TMatrix2<T>::TMatrix2(const TMatrix2<U>& other)
+	: m{static_cast<T>(other[0]), static_cast<T>(other[1]), static_cast<T>(other[2]), static_cast<T>(other[3])}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr T TMatrix2<T>::operator[](std::size_t index) const
+	{
+		assert(index < 4);
+		return m[index];
+	}
+
+	template <typename T>
+	inline bool operator==(const TMatrix2<T>& A, const TMatrix2<T>& B)
+	{
+		const T epsilon = 1e-6;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			if (std::abs(A[i] - B[i]) > epsilon) return false;
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TMatrix2<T>& A, const TMatrix2<T>& B)
+	{
+		return !(A == B);
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> operator+(const TMatrix2<T>& A, const TMatrix2<T>& B)
+	{
+		return TMatrix2<T>(
+			A[0] + B[0], A[1] + B[1],
+			A[2] + B[2], A[3] + B[3]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> operator-(const TMatrix2<T>& lhs, const TMatrix2<T>& rhs)
+	{
+		return TMatrix2<T>(
+			lhs[0] - rhs[0], lhs[1] - rhs[1],
+			lhs[2] - rhs[2], lhs[3] - rhs[3]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> operator-(const TMatrix2<T>& A)
+	{
+		return TMatrix2<T>(
+			-A[0], -A[1],
+			-A[2], -A[3]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> operator*(const TMatrix2<T>& A, const typename TMatrix2<T>::Scalar s)
+	{
+		return TMatrix2<T>(
+			A[0] * s, A[1] * s,
+			A[2] * s, A[3] * s
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> operator*(const typename TMatrix2<T>::Scalar s, const TMatrix2<T>& A)
+	{
+		return A * s;
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator*(const TMatrix2<T>& lhs, const TVector2<T>& rhs)
+	{
+		return TVector2<T>(
+			lhs[0] * rhs.x + lhs[1] * rhs.y,
+			lhs[2] * rhs.x + lhs[3] * rhs.y
+		);
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator*(const TVector2<T>& lhs, const TMatrix2<T>& rhs)
+	{
+		return TVector2<T>(
+			lhs.x * rhs[0] + lhs.y * rhs[2],
+			lhs.x * rhs[1] + lhs.y * rhs[3]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> operator*(const TMatrix2<T>& lhs, const TMatrix2<T>& rhs)
+	{
+		return TMatrix2<T>(
+			lhs[0] * rhs[0] + lhs[1] * rhs[2],
+			lhs[0] * rhs[1] + lhs[1] * rhs[3],
+
+			lhs[2] * rhs[0] + lhs[3] * rhs[2],
+			lhs[2] * rhs[1] + lhs[3] * rhs[3]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> TMatrix2<T>::transposed() const
+	{
+		return TMatrix2<T>(
+			m[0], m[2],
+			m[1], m[3]
+		);
+	}
+
+	template <typename T>
+	inline void TMatrix2<T>::transpose()
+	{
+		std::swap(m[1], m[2]);
+	}
+
+	template <typename T>
+	constexpr T TMatrix2<T>::determinant() const
+	{
+		return m[0] * m[3] - m[1] * m[2];
+	}
+
+	template <typename T>
+	constexpr TMatrix2<T> TMatrix2<T>::IDENTITY = TMatrix2<T>();
+	template <typename T>
+	constexpr TMatrix2<T> TMatrix2<T>::ZERO = TMatrix2<T>({0.0f, 0.0f, 0.0f, 0.0f});
+}
+
+#endif
@@ -6,15 +6,21 @@
 
 namespace M3D
 {
-	class Matrix3
+	template <typename T>
+	class TMatrix3
 	{
 	public:
+		/**
+		 * Scalar type of the entries.
+		 */
+		typedef T Scalar;
+
 		/**
 		 * Default constructor.
 		 *
 		 * Constructs the identity matrix.
 		 */
-		Matrix3();
+		constexpr TMatrix3();
 
 		/**
 		 * Constructor.
@@ -23,7 +29,7 @@ namespace M3D
 		 *
 		 * @param arr Array of floating point values in row-major order.
 		 */
-		Matrix3(const float arr[9]);
+		constexpr TMatrix3(const T arr[9]);
 
 		/**
 		 * Constructor.
@@ -40,16 +46,27 @@ namespace M3D
 		 * @param entry21 Entry at row 2 column 1.
 		 * @param entry22 Entry at row 2 column 2.
 		 */
-		Matrix3(float entry00, float entry01, float entry02,
-			float entry10, float entry11, float entry12,
-			float entry20, float entry21, float entry22);
+		constexpr TMatrix3(T entry00, T entry01, T entry02,
+			T entry10, T entry11, T entry12,
+			T entry20, T entry21, T entry22);
 
 		/**
 		 * Copy constructor.
 		 *
 		 * @param other The other matrix to copy.
 		 */
-		Matrix3(const Matrix3& other) = default;
+		TMatrix3(const TMatrix3& other) = default;
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its entries converted to the
+		 * scalar type of this matrix.
+		 *
+		 * @param other The matrix to convert.
+		 */
+		template <typename U>
+		explicit constexpr TMatrix3(const TMatrix3<U>& other);
 
 		/**
 		 * Matrix entry accessor operator.
@@ -59,7 +76,7 @@ namespace M3D
 		 * @param index Index for the entry to return.
 		 * @return Entry at position `index`.
 		 */
-		float operator[](std::size_t index) const;
+		constexpr T operator[](std::size_t index) const;
 
 		/**
 		 * Equality operator.
@@ -68,7 +85,8 @@ namespace M3D
 		 * @param B The second matrix.
 		 * @return True if the two supplied matrices are equal. False otherwise.
 		 */
-		friend bool operator==(const Matrix3& A, const Matrix3& B);
+		template <typename U>
+		friend bool operator==(const TMatrix3<U>& A, const TMatrix3<U>& B);
 
 		/**
 		 * Non-equality operator.
@@ -78,7 +96,8 @@ namespace M3D
 		 * @return True if the two supplied matrices are not equal. False
 		 * otherwise.
 		 */
-		friend bool operator!=(const Matrix3& A, const Matrix3& B);
+		template <typename U>
+		friend bool operator!=(const TMatrix3<U>& A, const TMatrix3<U>& B);
 
 		/**
 		 * Matrix addition operator.
@@ -89,7 +108,8 @@ namespace M3D
 		 * @param B The second matrix.
 		 * @return The matrix equal to the sum of `A` and `B`.
 		 */
-		friend Matrix3 operator+(const Matrix3& A, const Matrix3& B);
+		template <typename U>
+		friend constexpr TMatrix3<U> operator+(const TMatrix3<U>& A, const TMatrix3<U>& B);
 
 		/**
 		 * Matrix subtraction operator.
@@ -101,7 +121,8 @@ namespace M3D
 		 * @return The matrix equal to the `rhs` matrix subtracted from the `lhs`
 		 * matrix.
 		 */
-		friend Matrix3 operator-(const Matrix3& lhs, const Matrix3& rhs);
+		template <typename U>
+		friend constexpr TMatrix3<U> operator-(const TMatrix3<U>& lhs, const TMatrix3<U>& rhs);
 
 		/**
 		 * Matrix negation operator.
@@ -109,7 +130,8 @@ namespace M3D
 		 * @param A The matrix to negate.
 		 * @return The additive inverse of the matrix `A`.
 		 */
-		friend Matrix3 operator-(const Matrix3 &A);
+		template <typename U>
+		friend constexpr TMatrix3<U> operator-(const TMatrix3<U> &A);
 
 		/**
 		 * Scalar multiplication operator.
@@ -120,7 +142,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return The matrix `A` multiplied by the scalar `s`.
 		 */
-		friend Matrix3 operator*(const Matrix3& A, const float s);
+		template <typename U>
+		friend constexpr TMatrix3<U> operator*(const TMatrix3<U>& A, const typename TMatrix3<U>::Scalar s);
 
 		/**
 		 * Scalar multiplication operator.
@@ -131,7 +154,8 @@ namespace M3D
 		 * @param A The matrix to be multiplied by the given scalar.
 		 * @return The matrix `A` multiplied by the scalar `s`.
 		 */
-		friend Matrix3 operator*(const float s, const Matrix3& A);
+		template <typename U>
+		friend constexpr TMatrix3<U> operator*(const typename TMatrix3<U>::Scalar s, const TMatrix3<U>& A);
 
 		/**
 		 * Vector multiplication operator.
@@ -143,7 +167,8 @@ namespace M3D
 		 * @param rhs The column vector.
 		 * @return The vector `rhs` multiplied by the matrix `lhs` on the left.
 		 */
-		friend Vector3 operator*(const Matrix3& lhs, const Vector3& rhs);
+		template <typename U>
+		friend constexpr TVector3<U> operator*(const TMatrix3<U>& lhs, const TVector3<U>& rhs);
 
 		/**
 		 * Vector multiplication operator.
@@ -155,7 +180,8 @@ namespace M3D
 		 * @param rhs The row vector.
 		 * @return The vector `lhs` multiplied by the matrix `rhs` on the right.
 		 */
-		friend Vector3 operator*(const Vector3& lhs, const Matrix3& rhs);
+		template <typename U>
+		friend constexpr TVector3<U> operator*(const TVector3<U>& lhs, const TMatrix3<U>& rhs);
 
 		/**
 		 * Matrix multiplication operator.
@@ -166,7 +192,8 @@ namespace M3D
 		 * @param rhs The right hand side matrix.
 		 * @return The matrix equal to the product `lhs` x `rhs`.
 		 */
-		friend Matrix3 operator*(const Matrix3& lhs, const Matrix3& rhs);
+		template <typename U>
+		friend constexpr TMatrix3<U> operator*(const TMatrix3<U>& lhs, const TMatrix3<U>& rhs);
 
 		/**
 		 * Stream output operator.
@@ -175,7 +202,8 @@ namespace M3D
 		 * @param A Matrix to output.
 		 * @return Output stream.
 		 */
-		friend std::ostream& operator <<(std::ostream& out, const Matrix3& A);
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TMatrix3<U>& A);
 
 		/**
 		 * Returns a copy of this matrix transposed so that the rows now form
@@ -183,7 +211,7 @@ namespace M3D
 		 *
 		 * @return Transposed copy of this matrix.
 		 */
-		Matrix3 transposed() const;
+		constexpr TMatrix3 transposed() const;
 
 		/**
 		 * Transposes this matrix so that the rows now form columns.
@@ -198,14 +226,27 @@ namespace M3D
 		 *
 		 * @return The determinant.
 		 */
-		float determinant() const;
+		constexpr T determinant() const;
 
 		/**
 		 * Returns a copy of the multiplicitive inverse of this matrix.
 		 *
 		 * @return The multiplicitive inverse of this matrix.
 		 */
-		Matrix3 inverse() const;
+		TMatrix3 inverse() const;
+
+		/**
+		 * Computes the multiplicitive inverse of this matrix if the magnitude
+		 * of its determinant exceeds `epsilon`.
+		 *
+		 * @param out Matrix to receive the inverse, which is left unchanged
+		 * if this matrix is singular. It may be this matrix.
+		 * @param epsilon The largest magnitude of the determinant for which
+		 * the matrix is treated as singular.
+		 * @return True if the inverse was computed, or false if the matrix
+		 * is singular.
+		 */
+		bool tryInverse(TMatrix3& out, const T epsilon = 0.0f) const;
 
 		/**
 		 * Returns a rotation matrix corresponding to the rotation around the
@@ -218,7 +259,7 @@ namespace M3D
 		 * @return Rotation matrix corresponding to the angle-axis rotation
 		 * provided.
 		 */
-		static Matrix3 angleAxis(const float angle, const Vector3& axis);
+		static TMatrix3 angleAxis(const T angle, const TVector3<T>& axis);
 
 		/**
 		 * Returns a rotation matrix corresponding to the rotation of z radians
@@ -229,7 +270,7 @@ namespace M3D
 		 * @return Rotation matrix corresponding to the rotation specified by
 		 * the supplied euler angles.
 		 */
-		static Matrix3 euler(const Vector3& eulerAngles);
+		static TMatrix3 euler(const TVector3<T>& eulerAngles);
 
 		/**
 		 * Returns a rotation matrix that represents the sortest rotation from
@@ -240,7 +281,7 @@ namespace M3D
 		 * @return Rotation matrix corresponding to the rotation from
 		 * `fromDirection` to `toDirection`.
 		 */
-		static Matrix3 fromToRotation(const Vector3& fromDirection, const Vector3& toDirection);
+		static TMatrix3 fromToRotation(const TVector3<T>& fromDirection, const TVector3<T>& toDirection);
 
 		/**
 		 * Returns a rotation matrix that rotates the Vector3::FORWARD to look
@@ -252,25 +293,57 @@ namespace M3D
 		 * @return Rotation matrix representing the rotation that looks in the
 		 * `forward` direction.
 		 */
-		static Matrix3 lookRotation(const Vector3& forward, const Vector3& upwards);
+		static TMatrix3 lookRotation(const TVector3<T>& forward, const TVector3<T>& upwards);
 
 	public:
 		/**
 		 * The multiplicitive identity matrix.
 		 */
-		static const Matrix3 IDENTITY;
+		static const TMatrix3 IDENTITY;
 
 		/**
 		 * The additive identity matrix.
 		 */
-		static const Matrix3 ZERO;
+		static const TMatrix3 ZERO;
 
 	private:
 		/**
 		 * The matrix entries (row major).
 		 */
-		float m[9];
+		T m[9];
 	};
+
+	/**
+	 * Inverts each matrix in an array whose determinant exceeds `epsilon` in
+	 * magnitude, in the manner of TMatrix3::tryInverse().
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param matrices The matrices to invert.
+	 * @param out Array to receive the inverses. The entries for singular
+	 * matrices are left unchanged.
+	 * @param valid Array to receive, for each matrix, whether it was
+	 * inverted.
+	 * @param count The number of matrices.
+	 * @param epsilon The largest magnitude of the determinant for which a
+	 * matrix is treated as singular.
+	 * @return The number of matrices inverted.
+	 */
+	template <typename T>
+	std::size_t tryInverse(const TMatrix3<T>* matrices, TMatrix3<T>* out, bool* valid, std::size_t count,
+		const typename TMatrix3<T>::Scalar epsilon = 0.0f);
+
+	/**
+	 * Single precision 3x3 matrix.
+	 */
+	typedef TMatrix3<float> Matrix3;
+
+	/**
+	 * Double precision 3x3 matrix.
+	 */
+	typedef TMatrix3<double> Matrix3d;
 }
 
+#include <M3D/Matrix3.inl>
+
 #endif
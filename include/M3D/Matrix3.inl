@@ -0,0 +1,189 @@
+#ifndef MATRIX3_INL
+#define MATRIX3_INL
+
+// Inline definitions of the small, frequently called Matrix3 operations. This
+// file is included at the end of Matrix3.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+#include <utility>
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TMatrix3<T>::TMatrix3()
+	: m{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T>::TMatrix3(const T arr[9])
+	: m{arr[0], arr[1], arr[2],
+		arr[3], arr[4], arr[5],
+		arr[6], arr[7], arr[8]}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T>::TMatrix3(T entry00, T entry01, T entry02,
+		T entry10, T entry11, T entry12,
+		T entry20, T entry21, T entry22)
+	: m{entry00, entry01, entry02, entry10, entry11, entry12, entry20, entry21, entry22}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TMatrix3<T>::TMatrix3(const TMatrix3<U>& other)
+	: m{static_cast<T>(other[0]), static_cast<T>(other[1]), static_cast<T>(other[2]),
+		static_cast<T>(other[3]), static_cast<T>(other[4]), static_cast<T>(other[5]),
+		static_cast<T>(other[6]), static_cast<T>(other[7]), static_cast<T>(other[8])}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr T TMatrix3<T>::operator[](std::size_t index) const
+	{
+		assert(index < 9);
+		return m[index];
+	}
+
+	template <typename T>
+	inline bool operator==(const TMatrix3<T>& A, const TMatrix3<T>& B)
+	{
+		const T epsilon = 1e-6;
+		for (std::size_t i = 0; i < 9; ++i)
+		{
+			if (std::abs(A[i] - B[i]) > epsilon) return false;
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TMatrix3<T>& A, const TMatrix3<T>& B)
+	{
+		return !(A == B);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> operator+(const TMatrix3<T>& A, const TMatrix3<T>& B)
+	{
+		return TMatrix3<T>(
+			A[0] + B[0], A[1] + B[1], A[2] + B[2],
+			A[3] + B[3], A[4] + B[4], A[5] + B[5],
+			A[6] + B[6], A[7] + B[7], A[8] + B[8]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> operator-(const TMatrix3<T>& lhs, const TMatrix3<T>& rhs)
+	{
+		return TMatrix3<T>(
+			lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2],
+			lhs[3] - rhs[3], lhs[4] - rhs[4], lhs[5] - rhs[5],
+			lhs[6] - rhs[6], lhs[7] - rhs[7], lhs[8] - rhs[8]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> operator-(const TMatrix3<T>& A)
+	{
+		return TMatrix3<T>(
+			-A[0], -A[1], -A[2],
+			-A[3], -A[4], -A[5],
+			-A[6], -A[7], -A[8]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> operator*(const TMatrix3<T>& A, const typename TMatrix3<T>::Scalar s)
+	{
+		return TMatrix3<T>(
+			A[0] * s, A[1] * s, A[2] * s,
+			A[3] * s, A[4] * s, A[5] * s,
+			A[6] * s, A[7] * s, A[8] * s
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> operator*(const typename TMatrix3<T>::Scalar s, const TMatrix3<T>& A)
+	{
+		return A * s;
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator*(const TMatrix3<T>& lhs, const TVector3<T>& rhs)
+	{
+		return TVector3<T>(
+			lhs[0] * rhs.x + lhs[1] * rhs.y + lhs[2] * rhs.z,
+			lhs[3] * rhs.x + lhs[4] * rhs.y + lhs[5] * rhs.z,
+			lhs[6] * rhs.x + lhs[7] * rhs.y + lhs[8] * rhs.z
+		);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator*(const TVector3<T>& lhs, const TMatrix3<T>& rhs)
+	{
+		return TVector3<T>(
+			lhs.x * rhs[0] + lhs.y * rhs[3] + lhs.z * rhs[6],
+			lhs.x * rhs[1] + lhs.y * rhs[4] + lhs.z * rhs[7],
+			lhs.x * rhs[2] + lhs.y * rhs[5] + lhs.z * rhs[8]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> operator*(const TMatrix3<T>& lhs, const TMatrix3<T>& rhs)
+	{
+		return TMatrix3<T>(
+			lhs[0] * rhs[0] + lhs[1] * rhs[3] + lhs[2] * rhs[6],
+			lhs[0] * rhs[1] + lhs[1] * rhs[4] + lhs[2] * rhs[7],
+			lhs[0] * rhs[2] + lhs[1] * rhs[5] + lhs[2] * rhs[8],
+
+			lhs[3] * rhs[0] + lhs[4] * rhs[3] + lhs[5] * rhs[6],
+			lhs[3] * rhs[1] + lhs[4] * rhs[4] + lhs[5] * rhs[7],
+			lhs[3] * rhs[2] + lhs[4] * rhs[5] + lhs[5] * rhs[8],
+
+			lhs[6] * rhs[0] + lhs[7] * rhs[3] + lhs[8] * rhs[6],
+			lhs[6] * rhs[1] + lhs[7] * rhs[4] + lhs[8] * rhs[7],
+			lhs[6] * rhs[2] + lhs[7] * rhs[5] + lhs[8] * rhs[8]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> TMatrix3<T>::transposed() const
+	{
+		return TMatrix3<T>(
+			m[0], m[3], m[6],
+			m[1], m[4], m[7],
+			m[2], m[5], m[8]
+		);
+	}
+
+	template <typename T>
+	inline void TMatrix3<T>::transpose()
+	{
+		std::swap(m[1], m[3]);
+		std::swap(m[2], m[6]);
+		std::swap(m[5], m[7]);
+	}
+
+	template <typename T>
+	constexpr T TMatrix3<T>::determinant() const
+	{
+		return m[0] * m[4] * m[8] + m[1] * m[5] * m[6] + m[2] * m[3] * m[7]
+			- m[6] * m[4] * m[2] - m[7] * m[5] * m[0] - m[8] * m[3] * m[1];
+	}
+
+	template <typename T>
+	constexpr TMatrix3<T> TMatrix3<T>::IDENTITY = TMatrix3<T>();
+	template <typename T>
+	constexpr TMatrix3<T> TMatrix3<T>::ZERO = TMatrix3<T>({0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+}
+
+#endif
@@ -2,24 +2,52 @@
 #define MATRIX4_HPP
 
 #include <M3D/Matrix3.hpp>
+#include <M3D/Affine3.hpp>
 
 #include <ostream>
 
 namespace M3D
 {
-	class Vector3;
-	class Vector4;
-	class Quaternion;
+	template <typename T>
+	class TVector3;
+	template <typename T>
+	class TVector4;
+	template <typename T>
+	class TQuaternion;
+	template <typename T>
+	class TDualQuaternion;
+
+	/**
+	 * Range of the clip space depth coordinate z/w after projection.
+	 */
+	enum ClipDepth
+	{
+		/**
+		 * Depth in [-1, 1], as used by OpenGL.
+		 */
+		CLIP_DEPTH_NEGATIVE_ONE_TO_ONE,
+
+		/**
+		 * Depth in [0, 1], as used by DirectX, Vulkan and Metal.
+		 */
+		CLIP_DEPTH_ZERO_TO_ONE
+	};
 
-	class Matrix4
+	template <typename T>
+	class TMatrix4
 	{
 	public:
+		/**
+		 * Scalar type of the entries.
+		 */
+		typedef T Scalar;
+
 		/**
 		 * Default constructor.
 		 *
 		 * Constructs the identity matrix.
 		 */
-		Matrix4();
+		constexpr TMatrix4();
 
 		/**
 		 * Constructor.
@@ -28,7 +56,7 @@ namespace M3D
 		 *
 		 * @param arr Array of floating point values in row-major order.
 		 */
-		Matrix4(const float arr[16]);
+		constexpr TMatrix4(const T arr[16]);
 
 		/**
 		 * Constructor.
@@ -52,10 +80,10 @@ namespace M3D
 		 * @param entry32 Entry at row 3 column 2.
 		 * @param entry33 Entry at row 3 column 3.
 		 */
-		Matrix4(float entry00, float entry01, float entry02, float entry03,
-			float entry10, float entry11, float entry12, float entry13,
-			float entry20, float entry21, float entry22, float entry23,
-			float entry30, float entry31, float entry32, float entry33);
+		constexpr TMatrix4(T entry00, T entry01, T entry02, T entry03,
+			T entry10, T entry11, T entry12, T entry13,
+			T entry20, T entry21, T entry22, T entry23,
+			T entry30, T entry31, T entry32, T entry33);
 
 		/**
 		 * Constructor.
@@ -64,7 +92,7 @@ namespace M3D
 		 *
 		 * @param A The 3x3 matrix from which to construct this matrix.
 		 */
-		Matrix4(const Matrix3& A);
+		constexpr TMatrix4(const TMatrix3<T>& A);
 
 		/**
 		 * Constructor.
@@ -73,14 +101,47 @@ namespace M3D
 		 *
 		 * @param q The quaternion from which to construct the matrix.
 		 */
-		Matrix4(const Quaternion& q);
+		constexpr TMatrix4(const TQuaternion<T>& q);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the matrix from the passed affine transformation. The
+		 * last row of the matrix is set to (0, 0, 0, 1).
+		 *
+		 * @param A The affine transformation from which to construct the
+		 * matrix.
+		 */
+		constexpr TMatrix4(const TAffine3<T>& A);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the matrix for the rigid transformation represented by
+		 * the passed unit dual quaternion.
+		 *
+		 * @param dq The unit dual quaternion from which to construct the
+		 * matrix.
+		 */
+		TMatrix4(const TDualQuaternion<T>& dq);
 
 		/**
 		 * Copy constructor.
 		 *
 		 * @param other The other matrix to copy.
 		 */
-		Matrix4(const Matrix4& other) = default;
+		TMatrix4(const TMatrix4& other) = default;
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its entries converted to the
+		 * scalar type of this matrix.
+		 *
+		 * @param other The matrix to convert.
+		 */
+		template <typename U>
+		explicit constexpr TMatrix4(const TMatrix4<U>& other);
 
 		/**
 		 * Matrix entry accessor operator.
@@ -90,7 +151,7 @@ namespace M3D
 		 * @param index Index for the entry to return.
 		 * @return Entry at position `index`.
 		 */
-		float operator[](std::size_t index) const;
+		constexpr T operator[](std::size_t index) const;
 
 		/**
 		 * Equality operator.
@@ -99,7 +160,8 @@ namespace M3D
 		 * @param B The second matrix.
 		 * @return True if the two supplied matrices are equal. False otherwise.
 		 */
-		friend bool operator==(const Matrix4& A, const Matrix4& B);
+		template <typename U>
+		friend bool operator==(const TMatrix4<U>& A, const TMatrix4<U>& B);
 
 		/**
 		 * Non-equality operator.
@@ -109,7 +171,8 @@ namespace M3D
 		 * @return True if the two supplied matrices are not equal. False
 		 * otherwise.
 		 */
-		friend bool operator!=(const Matrix4& A, const Matrix4& B);
+		template <typename U>
+		friend bool operator!=(const TMatrix4<U>& A, const TMatrix4<U>& B);
 
 		/**
 		 * Matrix addition operator.
@@ -120,7 +183,8 @@ namespace M3D
 		 * @param B The second matrix.
 		 * @return The matrix equal to the sum of `A` and `B`.
 		 */
-		friend Matrix4 operator+(const Matrix4& A, const Matrix4& B);
+		template <typename U>
+		friend constexpr TMatrix4<U> operator+(const TMatrix4<U>& A, const TMatrix4<U>& B);
 
 		/**
 		 * Matrix subtraction operator.
@@ -132,7 +196,8 @@ namespace M3D
 		 * @return The matrix equal to the `rhs` matrix subtracted from the `lhs`
 		 * matrix.
 		 */
-		friend Matrix4 operator-(const Matrix4& lhs, const Matrix4& rhs);
+		template <typename U>
+		friend constexpr TMatrix4<U> operator-(const TMatrix4<U>& lhs, const TMatrix4<U>& rhs);
 
 		/**
 		 * Matrix negation operator.
@@ -140,7 +205,8 @@ namespace M3D
 		 * @param A The matrix to negate.
 		 * @return The additive inverse of the matrix `A`.
 		 */
-		friend Matrix4 operator-(const Matrix4 &A);
+		template <typename U>
+		friend constexpr TMatrix4<U> operator-(const TMatrix4<U> &A);
 
 		/**
 		 * Scalar multiplication operator.
@@ -151,7 +217,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return The matrix `A` multiplied by the scalar `s`.
 		 */
-		friend Matrix4 operator*(const Matrix4& A, const float s);
+		template <typename U>
+		friend constexpr TMatrix4<U> operator*(const TMatrix4<U>& A, const typename TMatrix4<U>::Scalar s);
 
 		/**
 		 * Scalar multiplication operator.
@@ -162,7 +229,8 @@ namespace M3D
 		 * @param A The matrix to be multiplied by the given scalar.
 		 * @return The matrix `A` multiplied by the scalar `s`.
 		 */
-		friend Matrix4 operator*(const float s, const Matrix4& A);
+		template <typename U>
+		friend constexpr TMatrix4<U> operator*(const typename TMatrix4<U>::Scalar s, const TMatrix4<U>& A);
 
 		/**
 		 * Vector multiplication operator.
@@ -174,7 +242,8 @@ namespace M3D
 		 * @param rhs The column vector.
 		 * @return The vector `rhs` multiplied by the matrix `lhs` on the left.
 		 */
-		friend Vector4 operator*(const Matrix4& lhs, const Vector4& rhs);
+		template <typename U>
+		friend constexpr TVector4<U> operator*(const TMatrix4<U>& lhs, const TVector4<U>& rhs);
 
 		/**
 		 * Vector multiplication operator.
@@ -186,7 +255,8 @@ namespace M3D
 		 * @param rhs The row vector.
 		 * @return The vector `lhs` multiplied by the matrix `rhs` on the right.
 		 */
-		friend Vector4 operator*(const Vector4& lhs, const Matrix4& rhs);
+		template <typename U>
+		friend constexpr TVector4<U> operator*(const TVector4<U>& lhs, const TMatrix4<U>& rhs);
 
 		/**
 		 * Matrix multiplication operator.
@@ -197,7 +267,8 @@ namespace M3D
 		 * @param rhs The right hand side matrix.
 		 * @return The matrix equal to the product `lhs` x `rhs`.
 		 */
-		friend Matrix4 operator*(const Matrix4& lhs, const Matrix4& rhs);
+		template <typename U>
+		friend constexpr TMatrix4<U> operator*(const TMatrix4<U>& lhs, const TMatrix4<U>& rhs);
 
 		/**
 		 * Stream output operator.
@@ -206,7 +277,8 @@ namespace M3D
 		 * @param A Matrix to output.
 		 * @return Output stream.
 		 */
-		friend std::ostream& operator <<(std::ostream& out, const Matrix4& A);
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TMatrix4<U>& A);
 
 		/**
 		 * Returns a copy of this matrix transposed so that the rows now form
@@ -214,7 +286,7 @@ namespace M3D
 		 *
 		 * @return Transposed copy of this matrix.
 		 */
-		Matrix4 transposed() const;
+		TMatrix4 transposed() const;
 
 		/**
 		 * Transposes this matrix so that the rows now form columns.
@@ -229,14 +301,81 @@ namespace M3D
 		 *
 		 * @return The determinant.
 		 */
-		float determinant() const;
+		T determinant() const;
 
 		/**
 		 * Returns a copy of the multiplicitive inverse of this matrix.
 		 *
 		 * @return The multiplicitive inverse of this matrix.
 		 */
-		Matrix4 inverse() const;
+		TMatrix4 inverse() const;
+
+		/**
+		 * Computes the multiplicitive inverse of this matrix if the magnitude
+		 * of its determinant exceeds `epsilon`. The determinant is found as
+		 * part of the inverse, so this is as cheap as inverse() and cheaper
+		 * than checking determinant() first.
+		 *
+		 * @param out Matrix to receive the inverse, which is left unchanged
+		 * if this matrix is singular. It may be this matrix.
+		 * @param epsilon The largest magnitude of the determinant for which
+		 * the matrix is treated as singular.
+		 * @return True if the inverse was computed, or false if the matrix
+		 * is singular.
+		 */
+		bool tryInverse(TMatrix4& out, const T epsilon = 0.0f) const;
+
+		/**
+		 * Returns the transpose of the inverse of this matrix, which
+		 * transforms normals and planes by the transformation that this
+		 * matrix applies to points. This is equivalent to, but faster than,
+		 * `inverse().transposed()`.
+		 *
+		 * @return The transpose of the inverse of this matrix.
+		 */
+		TMatrix4 inverseTranspose() const;
+
+		/**
+		 * Returns the normal matrix of this transformation: the transpose of
+		 * the inverse of the upper left 3x3 block. Normals transformed by it
+		 * remain perpendicular to the transformed surfaces under non-uniform
+		 * scaling. Only the 3x3 block is inverted, which is much cheaper than
+		 * inverseTranspose().
+		 *
+		 * @note The upper left 3x3 block must be non-singular.
+		 *
+		 * @return The normal matrix.
+		 */
+		TMatrix3<T> normalMatrix() const;
+
+		/**
+		 * Returns the inverse of this matrix, assuming that it is a
+		 * projection matrix of the form produced by perspective(),
+		 * infinitePerspective(), reversedPerspective(),
+		 * reversedInfinitePerspective() or orthographic(), or an off-center
+		 * variant of these. Such a matrix is block upper triangular, with a
+		 * diagonal upper left 2x2 block, so its inverse has a closed form that
+		 * is much cheaper than the general inverse.
+		 *
+		 * @note The entries (1, 0), (0, 1) and the first two entries of the
+		 * last two rows must be zero.
+		 *
+		 * @return The inverse of the projection.
+		 */
+		TMatrix4 projectionInverse() const;
+
+		/**
+		 * Returns the inverse of this matrix, assuming that it is a rigid
+		 * transformation, such as the view matrix produced by lookAt(). The
+		 * inverse of the rotation part is then its transpose, which is
+		 * considerably cheaper than the general inverse.
+		 *
+		 * @note The upper left 3x3 block must be orthonormal and the last row
+		 * must be (0, 0, 0, 1).
+		 *
+		 * @return The inverse transformation.
+		 */
+		TMatrix4 rigidInverse() const;
 
 		/**
 		 * Returns a scaling matrix that scales by `scaleFactors.x`,
@@ -246,7 +385,7 @@ namespace M3D
 		 * @param scaleFactors Scale factors.
 		 * @return Scaling matrix.
 		 */
-		static Matrix4 scaling(const Vector3& scaleFactors);
+		static constexpr TMatrix4 scaling(const TVector3<T>& scaleFactors);
 
 		/**
 		 * Returns a scaling matrix that scales by `factor` uniformly in the
@@ -255,7 +394,7 @@ namespace M3D
 		 * @param scale Uniform scale factor.
 		 * @return Scaling matrix.
 		 */
-		static Matrix4 scaling(const float factor);
+		static constexpr TMatrix4 scaling(const T factor);
 
 		/**
 		 * Returns a translation matrix that translates by the vector
@@ -264,7 +403,7 @@ namespace M3D
 		 * @param translation Translation vector.
 		 * @return Matrix that translates by the translation vector.
 		 */
-		static Matrix4 translation(const Vector3& translation);
+		static constexpr TMatrix4 translation(const TVector3<T>& translation);
 
 		/**
 		 * Returns a rotation matrix corresponding to the rotation around the
@@ -277,7 +416,7 @@ namespace M3D
 		 * @return Rotation matrix corresponding to the angle-axis rotation
 		 * provided.
 		 */
-		static Matrix4 angleAxis(const float angle, const Vector3& axis);
+		static TMatrix4 angleAxis(const T angle, const TVector3<T>& axis);
 
 		/**
 		 * Returns a rotation matrix corresponding to the rotation of z radians
@@ -288,7 +427,7 @@ namespace M3D
 		 * @return Rotation matrix corresponding to the rotation specified by
 		 * the supplied euler angles.
 		 */
-		static Matrix4 euler(const Vector3& eulerAngles);
+		static TMatrix4 euler(const TVector3<T>& eulerAngles);
 
 		/**
 		 * Returns a rotation matrix that represents the sortest rotation from
@@ -299,7 +438,7 @@ namespace M3D
 		 * @return Rotation matrix corresponding to the rotation from
 		 * `fromDirection` to `toDirection`.
 		 */
-		static Matrix4 fromToRotation(const Vector3& fromDirection, const Vector3& toDirection);
+		static TMatrix4 fromToRotation(const TVector3<T>& fromDirection, const TVector3<T>& toDirection);
 
 		/**
 		 * Returns a rotation matrix that rotates Vector3::FORWARD to look
@@ -311,7 +450,7 @@ namespace M3D
 		 * @return Rotation matrix representing the rotation that looks in the
 		 * `forward` direction.
 		 */
-		static Matrix4 lookRotation(const Vector3& forward, const Vector3& upwards);
+		static TMatrix4 lookRotation(const TVector3<T>& forward, const TVector3<T>& upwards);
 
 		/**
 		 * Returns a rotation matrix that rotates Vector3::FORWARD from the
@@ -324,25 +463,343 @@ namespace M3D
 		 * @return Rotation matrix representing the rotation for the `eye`
 		 * positioned object to "look at" the `target` point.
 		 */
-		static Matrix4 lookRotation(const Vector3& target, const Vector3& eye, const Vector3& upwards);
+		static TMatrix4 lookRotation(const TVector3<T>& target, const TVector3<T>& eye, const TVector3<T>& upwards);
+
+		/**
+		 * Returns a right-handed view matrix for a camera positioned at `eye`
+		 * looking at the `target` point, with the specified `upwards`
+		 * direction.
+		 *
+		 * The camera looks down its negative z-axis, with its x-axis to the
+		 * right and its y-axis up, as expected by the projection matrices
+		 * below. The view matrix is rigid, so it can be inverted with
+		 * rigidInverse().
+		 *
+		 * @note The direction from `eye` to `target` must not be parallel to
+		 * `upwards`.
+		 *
+		 * @param eye The position of the camera.
+		 * @param target The point to look at.
+		 * @param upwards The vector that defines which direction is up.
+		 * @return Matrix that transforms from world space to view space.
+		 */
+		static TMatrix4 lookAt(const TVector3<T>& eye, const TVector3<T>& target, const TVector3<T>& upwards);
+
+		/**
+		 * Returns a perspective projection matrix.
+		 *
+		 * View space is right-handed with the camera looking down the
+		 * negative z-axis. Points at distance `zNear` and `zFar` in front of
+		 * the camera are mapped to the near and far ends of the clip space
+		 * depth range.
+		 *
+		 * @param fieldOfView Vertical field of view in radians.
+		 * @param aspect Ratio of the width to the height of the viewport.
+		 * @param zNear Distance to the near clipping plane, greater than zero.
+		 * @param zFar Distance to the far clipping plane, greater than
+		 * `zNear`.
+		 * @param depth The clip space depth range.
+		 * @return Perspective projection matrix.
+		 */
+		static TMatrix4 perspective(const T fieldOfView, const T aspect, const T zNear, const T zFar,
+			ClipDepth depth = CLIP_DEPTH_NEGATIVE_ONE_TO_ONE);
+
+		/**
+		 * Returns a perspective projection matrix with the far clipping plane
+		 * at infinity.
+		 *
+		 * This is the limit of perspective() as `zFar` tends to infinity, and
+		 * avoids clipping distant geometry.
+		 *
+		 * @param fieldOfView Vertical field of view in radians.
+		 * @param aspect Ratio of the width to the height of the viewport.
+		 * @param zNear Distance to the near clipping plane, greater than zero.
+		 * @param depth The clip space depth range.
+		 * @return Perspective projection matrix.
+		 */
+		static TMatrix4 infinitePerspective(const T fieldOfView, const T aspect, const T zNear,
+			ClipDepth depth = CLIP_DEPTH_NEGATIVE_ONE_TO_ONE);
+
+		/**
+		 * Returns a reversed-Z perspective projection matrix.
+		 *
+		 * The near clipping plane is mapped to depth 1 and the far clipping
+		 * plane to depth 0, for use with the [0, 1] clip space depth range
+		 * and a floating point depth buffer. The uneven distribution of
+		 * floating point values then largely cancels the hyperbolic
+		 * distribution of depth, giving much better precision far from the
+		 * camera.
+		 *
+		 * @param fieldOfView Vertical field of view in radians.
+		 * @param aspect Ratio of the width to the height of the viewport.
+		 * @param zNear Distance to the near clipping plane, greater than zero.
+		 * @param zFar Distance to the far clipping plane, greater than
+		 * `zNear`.
+		 * @return Perspective projection matrix.
+		 */
+		static TMatrix4 reversedPerspective(const T fieldOfView, const T aspect, const T zNear, const T zFar);
+
+		/**
+		 * Returns a reversed-Z perspective projection matrix with the far
+		 * clipping plane at infinity, which maps to depth 0.
+		 *
+		 * @param fieldOfView Vertical field of view in radians.
+		 * @param aspect Ratio of the width to the height of the viewport.
+		 * @param zNear Distance to the near clipping plane, greater than zero.
+		 * @return Perspective projection matrix.
+		 */
+		static TMatrix4 reversedInfinitePerspective(const T fieldOfView, const T aspect, const T zNear);
+
+		/**
+		 * Returns an orthographic projection matrix.
+		 *
+		 * The box with the specified bounds in view space, which lies in front
+		 * of the camera along the negative z-axis, is mapped to the clip
+		 * space volume.
+		 *
+		 * @param left The x-coordinate of the left clipping plane.
+		 * @param right The x-coordinate of the right clipping plane.
+		 * @param bottom The y-coordinate of the bottom clipping plane.
+		 * @param top The y-coordinate of the top clipping plane.
+		 * @param zNear Distance to the near clipping plane.
+		 * @param zFar Distance to the far clipping plane.
+		 * @param depth The clip space depth range.
+		 * @return Orthographic projection matrix.
+		 */
+		static TMatrix4 orthographic(const T left, const T right, const T bottom, const T top,
+			const T zNear, const T zFar, ClipDepth depth = CLIP_DEPTH_NEGATIVE_ONE_TO_ONE);
 
 	public:
 		/**
 		 * The multiplicitive identity matrix.
 		 */
-		static const Matrix4 IDENTITY;
+		static const TMatrix4 IDENTITY;
 
 		/**
 		 * The additive identity matrix.
 		 */
-		static const Matrix4 ZERO;
+		static const TMatrix4 ZERO;
 
 	private:
+		/**
+		 * Run time implementations of the products, which use the SIMD
+		 * kernels where they are available.
+		 */
+		static TVector4<T> multiply(const TMatrix4& lhs, const TVector4<T>& rhs);
+		static TVector4<T> multiply(const TVector4<T>& lhs, const TMatrix4& rhs);
+		static TMatrix4 multiply(const TMatrix4& lhs, const TMatrix4& rhs);
+
 		/**
 		 * The matrix entries (row major).
 		 */
-		float m[16];
+		T m[16];
 	};
+
+	/**
+	 * Transforms an array of points, stored as separate arrays of x, y and z
+	 * coordinates, by the matrix `A`.
+	 *
+	 * Each point is treated as the column vector (x, y, z, 1) and multiplied
+	 * on the left by `A`. The homogeneous coordinate of the result is
+	 * discarded, so `A` should be an affine transformation.
+	 *
+	 * @note The output arrays may be the same as the input arrays.
+	 *
+	 * @param A The transformation matrix.
+	 * @param xs The x-coordinates of the points.
+	 * @param ys The y-coordinates of the points.
+	 * @param zs The z-coordinates of the points.
+	 * @param outXs Array to receive the x-coordinates of the transformed points.
+	 * @param outYs Array to receive the y-coordinates of the transformed points.
+	 * @param outZs Array to receive the z-coordinates of the transformed points.
+	 * @param count The number of points.
+	 */
+	template <typename T>
+	void transformPoints(const TMatrix4<T>& A, const T* xs, const T* ys, const T* zs,
+		T* outXs, T* outYs, T* outZs, std::size_t count);
+
+	/**
+	 * Transforms an array of points by the matrix `A`.
+	 *
+	 * Each point is treated as the column vector (x, y, z, 1) and multiplied
+	 * on the left by `A`. The homogeneous coordinate of the result is
+	 * discarded, so `A` should be an affine transformation.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The transformation matrix.
+	 * @param points The points to transform.
+	 * @param out Array to receive the transformed points.
+	 * @param count The number of points.
+	 */
+	template <typename T>
+	void transformPoints(const TMatrix4<T>& A, const TVector3<T>* points, TVector3<T>* out, std::size_t count);
+
+	/**
+	 * Transforms an array of directions, stored as separate arrays of x, y
+	 * and z components, by the matrix `A`.
+	 *
+	 * Each direction is treated as the column vector (x, y, z, 0) and
+	 * multiplied on the left by `A`, so the translation part of `A` is
+	 * ignored.
+	 *
+	 * @note The output arrays may be the same as the input arrays.
+	 *
+	 * @param A The transformation matrix.
+	 * @param xs The x-components of the directions.
+	 * @param ys The y-components of the directions.
+	 * @param zs The z-components of the directions.
+	 * @param outXs Array to receive the x-components of the transformed
+	 * directions.
+	 * @param outYs Array to receive the y-components of the transformed
+	 * directions.
+	 * @param outZs Array to receive the z-components of the transformed
+	 * directions.
+	 * @param count The number of directions.
+	 */
+	template <typename T>
+	void transformDirections(const TMatrix4<T>& A, const T* xs, const T* ys, const T* zs,
+		T* outXs, T* outYs, T* outZs, std::size_t count);
+
+	/**
+	 * Transforms an array of directions by the matrix `A`.
+	 *
+	 * Each direction is treated as the column vector (x, y, z, 0) and
+	 * multiplied on the left by `A`, so the translation part of `A` is
+	 * ignored.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The transformation matrix.
+	 * @param directions The directions to transform.
+	 * @param out Array to receive the transformed directions.
+	 * @param count The number of directions.
+	 */
+	template <typename T>
+	void transformDirections(const TMatrix4<T>& A, const TVector3<T>* directions, TVector3<T>* out, std::size_t count);
+
+	/**
+	 * Multiplies each column vector in an array on the left by the matrix
+	 * `A`. This is equivalent to, but faster than, evaluating `A * v` for
+	 * each vector `v`.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The transformation matrix.
+	 * @param vectors The vectors to transform.
+	 * @param out Array to receive the transformed vectors.
+	 * @param count The number of vectors.
+	 */
+	template <typename T>
+	void transform(const TMatrix4<T>& A, const TVector4<T>* vectors, TVector4<T>* out, std::size_t count);
+
+	/**
+	 * Multiplies corresponding matrices in two arrays, such that `out[i]` is
+	 * `A[i] * B[i]`. This is equivalent to, but faster than, evaluating each
+	 * product with the multiplication operator.
+	 *
+	 * @note The output array may be the same as either input array.
+	 *
+	 * @param A The left-hand matrices.
+	 * @param B The right-hand matrices.
+	 * @param out Array to receive the products.
+	 * @param count The number of matrices in each array.
+	 */
+	template <typename T>
+	void multiply(const TMatrix4<T>* A, const TMatrix4<T>* B, TMatrix4<T>* out, std::size_t count);
+
+	/**
+	 * Multiplies each matrix in an array on the left by the matrix `A`, such
+	 * that `out[i]` is `A * B[i]`. This suits applying a view-projection
+	 * matrix to many model matrices, and keeps the entries of `A` in
+	 * registers for the whole array.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The left-hand matrix.
+	 * @param B The right-hand matrices.
+	 * @param out Array to receive the products.
+	 * @param count The number of matrices.
+	 */
+	template <typename T>
+	void multiply(const TMatrix4<T>& A, const TMatrix4<T>* B, TMatrix4<T>* out, std::size_t count);
+
+	/**
+	 * Multiplies each matrix in an array on the right by the matrix `B`,
+	 * such that `out[i]` is `A[i] * B`, keeping the rows of `B` in registers
+	 * for the whole array.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param A The left-hand matrices.
+	 * @param B The right-hand matrix.
+	 * @param out Array to receive the products.
+	 * @param count The number of matrices.
+	 */
+	template <typename T>
+	void multiply(const TMatrix4<T>* A, const TMatrix4<T>& B, TMatrix4<T>* out, std::size_t count);
+
+	/**
+	 * Inverts each matrix in an array, such that `out[i]` is
+	 * `matrices[i].inverse()`. The matrices are inverted in groups, held in
+	 * structure of arrays form with one matrix in each SIMD lane, which is
+	 * considerably faster than inverting them one at a time.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param matrices The non-singular matrices to invert.
+	 * @param out Array to receive the inverses.
+	 * @param count The number of matrices.
+	 */
+	template <typename T>
+	void inverse(const TMatrix4<T>* matrices, TMatrix4<T>* out, std::size_t count);
+
+	/**
+	 * Computes the transpose of the inverse of each matrix in an array, such
+	 * that `out[i]` is `matrices[i].inverseTranspose()`, in the manner of
+	 * inverse(const TMatrix4<T>*, TMatrix4<T>*, std::size_t).
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param matrices The non-singular matrices.
+	 * @param out Array to receive the transposes of the inverses.
+	 * @param count The number of matrices.
+	 */
+	template <typename T>
+	void inverseTranspose(const TMatrix4<T>* matrices, TMatrix4<T>* out, std::size_t count);
+
+	/**
+	 * Inverts each matrix in an array whose determinant exceeds `epsilon` in
+	 * magnitude, in the manner of TMatrix4::tryInverse() and with the
+	 * grouping of inverse(const TMatrix4<T>*, TMatrix4<T>*, std::size_t).
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param matrices The matrices to invert.
+	 * @param out Array to receive the inverses. The entries for singular
+	 * matrices are left unchanged.
+	 * @param valid Array to receive, for each matrix, whether it was
+	 * inverted.
+	 * @param count The number of matrices.
+	 * @param epsilon The largest magnitude of the determinant for which a
+	 * matrix is treated as singular.
+	 * @return The number of matrices inverted.
+	 */
+	template <typename T>
+	std::size_t tryInverse(const TMatrix4<T>* matrices, TMatrix4<T>* out, bool* valid, std::size_t count,
+		const typename TMatrix4<T>::Scalar epsilon = 0.0f);
+
+	/**
+	 * Single precision 4x4 matrix.
+	 */
+	typedef TMatrix4<float> Matrix4;
+
+	/**
+	 * Double precision 4x4 matrix.
+	 */
+	typedef TMatrix4<double> Matrix4d;
 }
 
+#include <M3D/Matrix4.inl>
+
 #endif
@@ -0,0 +1,277 @@
+#ifndef MATRIX4_INL
+#define MATRIX4_INL
+
+// Inline definitions of the small, frequently called Matrix4 operations. This
+// file is included at the end of Matrix4.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+#include <type_traits>
+
+// Whether the enclosing constexpr function is being evaluated as a constant
+// expression. The products use the SIMD kernels at run time, and fall back to
+// scalar code that the compiler can evaluate during constant evaluation. If
+// the compiler cannot tell the two apart, the products are run time only.
+#if defined(__cpp_lib_is_constant_evaluated)
+#define M3D_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define M3D_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define M3D_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#if !defined(M3D_CONSTANT_EVALUATED)
+#define M3D_CONSTANT_EVALUATED() false
+#endif
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TMatrix4<T>::TMatrix4()
+	: m{1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T>::TMatrix4(const T arr[16])
+	: m{arr[0], arr[1], arr[2], arr[3],
+		arr[4], arr[5], arr[6], arr[7],
+		arr[8], arr[9], arr[10], arr[11],
+		arr[12], arr[13], arr[14], arr[15]}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T>::TMatrix4(T entry00, T entry01, T entry02, T entry03,
+		T entry10, T entry11, T entry12, T entry13,
+		T entry20, T entry21, T entry22, T entry23,
+		T entry30, T entry31, T entry32, T entry33)
+	: m{entry00, entry01, entry02, entry03,
+		entry10, entry11, entry12, entry13,
+		entry20, entry21, entry22, entry23,
+		entry30, entry31, entry32, entry33}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T>::TMatrix4(const TMatrix3<T>& A)
+	: m{A[0], A[1], A[2], 0.0f,
+		A[3], A[4], A[5], 0.0f,
+		A[6], A[7], A[8], 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T>::TMatrix4(const TAffine3<T>& A)
+	: m{A[0], A[1], A[2], A[3],
+		A[4], A[5], A[6], A[7],
+		A[8], A[9], A[10], A[11],
+		0.0f, 0.0f, 0.0f, 1.0f}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T>::TMatrix4(const TQuaternion<T>& q)
+	: m{1.0f - 2.0f * q.y * q.y - 2.0f * q.z * q.z,
+		2.0f * q.x * q.y - 2.0f * q.w * q.z,
+		2.0f * q.x * q.z + 2.0f * q.w * q.y,
+		0.0f,
+		2.0f * q.x * q.y + 2.0f * q.w * q.z,
+		1.0f - 2.0f * q.x * q.x - 2.0f * q.z * q.z,
+		2.0f * q.y * q.z - 2.0f * q.w * q.x,
+		0.0f,
+		2.0f * q.x * q.z - 2.0f * q.w * q.y,
+		2.0f * q.y * q.z + 2.0f * q.w * q.x,
+		1.0f - 2.0f * q.x * q.x - 2.0f * q.y * q.y,
+		0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TMatrix4<T>::TMatrix4(const TMatrix4<U>& other)
+	: m{static_cast<T>(other[0]), static_cast<T>(other[1]), static_cast<T>(other[2]), static_cast<T>(other[3]),
+		static_cast<T>(other[4]), static_cast<T>(other[5]), static_cast<T>(other[6]), static_cast<T>(other[7]),
+		static_cast<T>(other[8]), static_cast<T>(other[9]), static_cast<T>(other[10]), static_cast<T>(other[11]),
+		static_cast<T>(other[12]), static_cast<T>(other[13]), static_cast<T>(other[14]), static_cast<T>(other[15])}
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr T TMatrix4<T>::operator[](std::size_t index) const
+	{
+		assert(index < 16);
+		return m[index];
+	}
+
+	template <typename T>
+	inline bool operator==(const TMatrix4<T>& A, const TMatrix4<T>& B)
+	{
+		const T epsilon = 1e-6;
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			if (std::abs(A[i] - B[i]) > epsilon) return false;
+		}
+
+		return true;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TMatrix4<T>& A, const TMatrix4<T>& B)
+	{
+		return !(A == B);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> operator+(const TMatrix4<T>& A, const TMatrix4<T>& B)
+	{
+		return TMatrix4<T>(
+			A[0] + B[0], A[1] + B[1], A[2] + B[2], A[3] + B[3],
+			A[4] + B[4], A[5] + B[5], A[6] + B[6], A[7] + B[7],
+			A[8] + B[8], A[9] + B[9], A[10] + B[10], A[11] + B[11],
+			A[12] + B[12], A[13] + B[13], A[14] + B[14], A[15] + B[15]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> operator-(const TMatrix4<T>& lhs, const TMatrix4<T>& rhs)
+	{
+		return TMatrix4<T>(
+			lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3],
+			lhs[4] - rhs[4], lhs[5] - rhs[5], lhs[6] - rhs[6], lhs[7] - rhs[7],
+			lhs[8] - rhs[8], lhs[9] - rhs[9], lhs[10] - rhs[10], lhs[11] - rhs[11],
+			lhs[12] - rhs[12], lhs[13] - rhs[13], lhs[14] - rhs[14], lhs[15] - rhs[15]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> operator-(const TMatrix4<T>& A)
+	{
+		return TMatrix4<T>(
+			-A[0], -A[1], -A[2], -A[3],
+			-A[4], -A[5], -A[6], -A[7],
+			-A[8], -A[9], -A[10], -A[11],
+			-A[12], -A[13], -A[14], -A[15]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> operator*(const TMatrix4<T>& A, const typename TMatrix4<T>::Scalar s)
+	{
+		return TMatrix4<T>(
+			A[0] * s, A[1] * s, A[2] * s, A[3] * s,
+			A[4] * s, A[5] * s, A[6] * s, A[7] * s,
+			A[8] * s, A[9] * s, A[10] * s, A[11] * s,
+			A[12] * s, A[13] * s, A[14] * s, A[15] * s
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> operator*(const typename TMatrix4<T>::Scalar s, const TMatrix4<T>& A)
+	{
+		return A * s;
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator*(const TMatrix4<T>& lhs, const TVector4<T>& rhs)
+	{
+		if (!M3D_CONSTANT_EVALUATED()) return TMatrix4<T>::multiply(lhs, rhs);
+
+		return TVector4<T>(
+			lhs[0] * rhs.x + lhs[1] * rhs.y + lhs[2] * rhs.z + lhs[3] * rhs.w,
+			lhs[4] * rhs.x + lhs[5] * rhs.y + lhs[6] * rhs.z + lhs[7] * rhs.w,
+			lhs[8] * rhs.x + lhs[9] * rhs.y + lhs[10] * rhs.z + lhs[11] * rhs.w,
+			lhs[12] * rhs.x + lhs[13] * rhs.y + lhs[14] * rhs.z + lhs[15] * rhs.w
+		);
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator*(const TVector4<T>& lhs, const TMatrix4<T>& rhs)
+	{
+		if (!M3D_CONSTANT_EVALUATED()) return TMatrix4<T>::multiply(lhs, rhs);
+
+		return TVector4<T>(
+			lhs.x * rhs[0] + lhs.y * rhs[4] + lhs.z * rhs[8] + lhs.w * rhs[12],
+			lhs.x * rhs[1] + lhs.y * rhs[5] + lhs.z * rhs[9] + lhs.w * rhs[13],
+			lhs.x * rhs[2] + lhs.y * rhs[6] + lhs.z * rhs[10] + lhs.w * rhs[14],
+			lhs.x * rhs[3] + lhs.y * rhs[7] + lhs.z * rhs[11] + lhs.w * rhs[15]
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> operator*(const TMatrix4<T>& lhs, const TMatrix4<T>& rhs)
+	{
+		if (!M3D_CONSTANT_EVALUATED()) return TMatrix4<T>::multiply(lhs, rhs);
+
+		T C[16] = {};
+		for (std::size_t i = 0; i < 16; i += 4)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				C[i + j] = lhs[i] * rhs[j] + lhs[i + 1] * rhs[4 + j] + lhs[i + 2] * rhs[8 + j] + lhs[i + 3] * rhs[12 + j];
+			}
+		}
+
+		return TMatrix4<T>(C);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> TMatrix4<T>::scaling(const TVector3<T>& scaleFactors)
+	{
+		return TMatrix4<T>(
+			scaleFactors.x, 0.0f, 0.0f, 0.0f,
+			0.0f, scaleFactors.y, 0.0f, 0.0f,
+			0.0f, 0.0f, scaleFactors.z, 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> TMatrix4<T>::scaling(const T factor)
+	{
+		return TMatrix4<T>(
+			factor, 0.0f, 0.0f, 0.0f,
+			0.0f, factor, 0.0f, 0.0f,
+			0.0f, 0.0f, factor, 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> TMatrix4<T>::translation(const TVector3<T>& translation)
+	{
+		return TMatrix4<T>(
+			1.0f, 0.0f, 0.0f, translation.x,
+			0.0f, 1.0f, 0.0f, translation.y,
+			0.0f, 0.0f, 1.0f, translation.z,
+			0.0f, 0.0f, 0.0f, 1.0f
+		);
+	}
+
+	template <typename T>
+	constexpr TMatrix4<T> TMatrix4<T>::IDENTITY = TMatrix4<T>();
+	template <typename T>
+	constexpr TMatrix4<T> TMatrix4<T>::ZERO = TMatrix4<T>({
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f
+	});
+}
+
+#endif
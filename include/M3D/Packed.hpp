@@ -0,0 +1,340 @@
+#ifndef PACKED_HPP
+#define PACKED_HPP
+
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace M3D
+{
+	/**
+	 * Converts a single precision value to IEEE 754 half precision,
+	 * rounding to nearest even.
+	 *
+	 * Values beyond the range of half precision become infinities, values
+	 * below it become denormals or zeros, and NaNs remain NaNs.
+	 *
+	 * @param value The value to convert.
+	 * @return The bits of the half precision value.
+	 */
+	std::uint16_t floatToHalf(float value);
+
+	/**
+	 * Converts an IEEE 754 half precision value to single precision. The
+	 * conversion is exact.
+	 *
+	 * @param value The bits of the half precision value.
+	 * @return The converted value.
+	 */
+	float halfToFloat(std::uint16_t value);
+
+	/**
+	 * Three-component vector of IEEE 754 half precision values, occupying 6
+	 * bytes rather than the 12 of a Vector3.
+	 *
+	 * Half precision has 11 significant bits, so the relative error of a
+	 * packed component is at most 2^-11, and its magnitude at most 65504.
+	 */
+	class Vector3h
+	{
+	public:
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the zero vector.
+		 */
+		Vector3h();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs a vector with the specified half precision components.
+		 *
+		 * @param x_ The bits of the x-component.
+		 * @param y_ The bits of the y-component.
+		 * @param z_ The bits of the z-component.
+		 */
+		Vector3h(std::uint16_t x_, std::uint16_t y_, std::uint16_t z_);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs a vector by converting each of the components of `v` to
+		 * half precision with floatToHalf().
+		 *
+		 * @param v The vector to pack.
+		 */
+		explicit Vector3h(const Vector3& v);
+
+		/**
+		 * Converts the vector back to single precision.
+		 *
+		 * @return The unpacked vector.
+		 */
+		Vector3 unpack() const;
+
+	public:
+		/**
+		 * Bits of the first component.
+		 */
+		std::uint16_t x;
+
+		/**
+		 * Bits of the second component.
+		 */
+		std::uint16_t y;
+
+		/**
+		 * Bits of the third component.
+		 */
+		std::uint16_t z;
+	};
+
+	/**
+	 * Three-component vector with each component in [-1, 1] stored as a
+	 * normalized 16-bit integer, occupying 6 bytes rather than the 12 of a
+	 * Vector3.
+	 *
+	 * A component c is stored as round(c * 32767), so the error of a packed
+	 * component is at most 1 / 65534. This suits unit vectors such as
+	 * normals; other vectors may be divided by a known bound before packing.
+	 */
+	class Vector3s
+	{
+	public:
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the zero vector.
+		 */
+		Vector3s();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs a vector with the specified normalized components.
+		 *
+		 * @param x_ The x-component, in units of 1 / 32767.
+		 * @param y_ The y-component, in units of 1 / 32767.
+		 * @param z_ The z-component, in units of 1 / 32767.
+		 */
+		Vector3s(std::int16_t x_, std::int16_t y_, std::int16_t z_);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs a vector by quantizing each of the components of `v`,
+		 * which are clamped to [-1, 1].
+		 *
+		 * @param v The vector to pack.
+		 */
+		explicit Vector3s(const Vector3& v);
+
+		/**
+		 * Converts the vector back to single precision.
+		 *
+		 * @return The unpacked vector, with components in [-1, 1].
+		 */
+		Vector3 unpack() const;
+
+	public:
+		/**
+		 * First component.
+		 */
+		std::int16_t x;
+
+		/**
+		 * Second component.
+		 */
+		std::int16_t y;
+
+		/**
+		 * Third component.
+		 */
+		std::int16_t z;
+	};
+
+	/**
+	 * Unit quaternion packed into 32 bits by the "smallest three" method.
+	 *
+	 * The component of greatest magnitude is dropped, after negating the
+	 * quaternion if necessary so that it is positive, and the remaining
+	 * three, which lie in [-1/sqrt(2), 1/sqrt(2)], are each quantized to 10
+	 * bits. The top two bits hold the index of the dropped component, which
+	 * is recovered on unpacking from the unit norm.
+	 *
+	 * Each component of the unpacked quaternion (or its negation, which
+	 * represents the same rotation) is within 2e-3 of the original.
+	 */
+	class PackedQuaternion32
+	{
+	public:
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the identity quaternion.
+		 */
+		PackedQuaternion32();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the packed form of `q`.
+		 *
+		 * @param q The quaternion, which must have unit norm.
+		 */
+		explicit PackedQuaternion32(const Quaternion& q);
+
+		/**
+		 * Unpacks the quaternion.
+		 *
+		 * @return The unpacked quaternion, which has unit norm and a
+		 * non-negative component of greatest magnitude.
+		 */
+		Quaternion unpack() const;
+
+	public:
+		/**
+		 * The packed bits.
+		 */
+		std::uint32_t bits;
+	};
+
+	/**
+	 * Unit quaternion packed into 48 bits by the "smallest three" method,
+	 * as for PackedQuaternion32 but with 15 bits for each of the three
+	 * smallest components.
+	 *
+	 * Each component of the unpacked quaternion (or its negation) is within
+	 * 6e-5 of the original.
+	 */
+	class PackedQuaternion48
+	{
+	public:
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the identity quaternion.
+		 */
+		PackedQuaternion48();
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the packed form of `q`.
+		 *
+		 * @param q The quaternion, which must have unit norm.
+		 */
+		explicit PackedQuaternion48(const Quaternion& q);
+
+		/**
+		 * Unpacks the quaternion.
+		 *
+		 * @return The unpacked quaternion, which has unit norm and a
+		 * non-negative component of greatest magnitude.
+		 */
+		Quaternion unpack() const;
+
+	public:
+		/**
+		 * The packed bits, most significant first. Only the low 47 of the
+		 * 48 bits are used.
+		 */
+		std::uint16_t bits[3];
+	};
+
+	/**
+	 * Packs an array of vectors to half precision.
+	 *
+	 * This is equivalent to constructing a Vector3h from each vector, but
+	 * converts several components at a time using the SIMD instruction set
+	 * selected at configure time (and the F16C instructions, where the
+	 * compiler targets them).
+	 *
+	 * @param in The vectors to pack.
+	 * @param out Array to receive the packed vectors.
+	 * @param count The number of vectors.
+	 */
+	void pack(const Vector3* in, Vector3h* out, std::size_t count);
+
+	/**
+	 * Unpacks an array of half precision vectors.
+	 *
+	 * @param in The vectors to unpack.
+	 * @param out Array to receive the unpacked vectors.
+	 * @param count The number of vectors.
+	 */
+	void unpack(const Vector3h* in, Vector3* out, std::size_t count);
+
+	/**
+	 * Packs an array of vectors to normalized 16-bit integers.
+	 *
+	 * This is equivalent to constructing a Vector3s from each vector, but
+	 * converts several components at a time using the SIMD instruction set
+	 * selected at configure time.
+	 *
+	 * @param in The vectors to pack.
+	 * @param out Array to receive the packed vectors.
+	 * @param count The number of vectors.
+	 */
+	void pack(const Vector3* in, Vector3s* out, std::size_t count);
+
+	/**
+	 * Unpacks an array of normalized 16-bit integer vectors.
+	 *
+	 * @param in The vectors to unpack.
+	 * @param out Array to receive the unpacked vectors.
+	 * @param count The number of vectors.
+	 */
+	void unpack(const Vector3s* in, Vector3* out, std::size_t count);
+
+	/**
+	 * Packs an array of unit quaternions into 32 bits each.
+	 *
+	 * This is equivalent to constructing a PackedQuaternion32 from each
+	 * quaternion, but packs four quaternions at a time using the SIMD
+	 * instruction set selected at configure time.
+	 *
+	 * @param in The quaternions to pack.
+	 * @param out Array to receive the packed quaternions.
+	 * @param count The number of quaternions.
+	 */
+	void pack(const Quaternion* in, PackedQuaternion32* out, std::size_t count);
+
+	/**
+	 * Unpacks an array of 32-bit packed quaternions.
+	 *
+	 * @param in The quaternions to unpack.
+	 * @param out Array to receive the unpacked quaternions.
+	 * @param count The number of quaternions.
+	 */
+	void unpack(const PackedQuaternion32* in, Quaternion* out, std::size_t count);
+
+	/**
+	 * Packs an array of unit quaternions into 48 bits each.
+	 *
+	 * This is equivalent to constructing a PackedQuaternion48 from each
+	 * quaternion, but packs four quaternions at a time using the SIMD
+	 * instruction set selected at configure time.
+	 *
+	 * @param in The quaternions to pack.
+	 * @param out Array to receive the packed quaternions.
+	 * @param count The number of quaternions.
+	 */
+	void pack(const Quaternion* in, PackedQuaternion48* out, std::size_t count);
+
+	/**
+	 * Unpacks an array of 48-bit packed quaternions.
+	 *
+	 * @param in The quaternions to unpack.
+	 * @param out Array to receive the unpacked quaternions.
+	 * @param count The number of quaternions.
+	 */
+	void unpack(const PackedQuaternion48* in, Quaternion* out, std::size_t count);
+}
+
+#include <M3D/Packed.inl>
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef PACKED_INL
+#define PACKED_INL
+
+// Inline definitions of the scalar packing operations. This file is included
+// at the end of Packed.hpp and should not be included directly.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace M3D
+{
+	inline std::uint16_t floatToHalf(float value)
+	{
+		// After Giesen, "float->half variants". The exponent is rebiased by
+		// integer addition, with the rounding to nearest even done by the
+		// carry out of the discarded bits.
+		std::uint32_t f;
+		std::memcpy(&f, &value, sizeof(f));
+		const std::uint32_t sign = f & 0x80000000u;
+		f ^= sign;
+
+		std::uint32_t h;
+		if (f >= 0x47800000u)
+		{
+			// At least 2^16: infinity, or NaN.
+			h = f > 0x7f800000u ? 0x7e00u : 0x7c00u;
+		}
+		else if (f < 0x38800000u)
+		{
+			// Below 2^-14, the result is a denormal. Adding 0.5 shifts the
+			// significand so that the floating point addition rounds it to
+			// the 10 bits of the denormal.
+			float denormal;
+			std::memcpy(&denormal, &f, sizeof(f));
+			denormal += 0.5f;
+			std::memcpy(&h, &denormal, sizeof(h));
+			h -= 0x3f000000u;
+		}
+		else
+		{
+			const std::uint32_t odd = (f >> 13) & 1u;
+			h = (f + 0xc8000fffu + odd) >> 13;
+		}
+
+		return static_cast<std::uint16_t>(h | (sign >> 16));
+	}
+
+	inline float halfToFloat(std::uint16_t value)
+	{
+		const std::uint32_t shiftedExponent = 0x7c00u << 13;
+		std::uint32_t f = (value & 0x7fffu) << 13;
+		const std::uint32_t exponent = f & shiftedExponent;
+		f += 0x38000000u;
+
+		if (exponent == shiftedExponent)
+		{
+			// Infinity or NaN.
+			f += 0x38000000u;
+		}
+		else if (exponent == 0)
+		{
+			// Denormal, normalized by subtracting 2^-14.
+			f += 0x00800000u;
+			float normalized;
+			std::memcpy(&normalized, &f, sizeof(f));
+			normalized -= 6.103515625e-05f;
+			std::memcpy(&f, &normalized, sizeof(f));
+		}
+
+		f |= static_cast<std::uint32_t>(value & 0x8000u) << 16;
+
+		float result;
+		std::memcpy(&result, &f, sizeof(result));
+		return result;
+	}
+
+	inline Vector3h::Vector3h()
+	: x(0)
+	, y(0)
+	, z(0)
+	{
+		// Nothing to do.
+	}
+
+	inline Vector3h::Vector3h(std::uint16_t x_, std::uint16_t y_, std::uint16_t z_)
+	: x(x_)
+	, y(y_)
+	, z(z_)
+	{
+		// Nothing to do.
+	}
+
+	inline Vector3h::Vector3h(const Vector3& v)
+	: x(floatToHalf(v.x))
+	, y(floatToHalf(v.y))
+	, z(floatToHalf(v.z))
+	{
+		// Nothing to do.
+	}
+
+	inline Vector3 Vector3h::unpack() const
+	{
+		return Vector3(halfToFloat(x), halfToFloat(y), halfToFloat(z));
+	}
+
+	inline Vector3s::Vector3s()
+	: x(0)
+	, y(0)
+	, z(0)
+	{
+		// Nothing to do.
+	}
+
+	inline Vector3s::Vector3s(std::int16_t x_, std::int16_t y_, std::int16_t z_)
+	: x(x_)
+	, y(y_)
+	, z(z_)
+	{
+		// Nothing to do.
+	}
+
+	inline Vector3s::Vector3s(const Vector3& v)
+	: x(static_cast<std::int16_t>(std::lrint(std::min(std::max(v.x, -1.0f), 1.0f) * 32767.0f)))
+	, y(static_cast<std::int16_t>(std::lrint(std::min(std::max(v.y, -1.0f), 1.0f) * 32767.0f)))
+	, z(static_cast<std::int16_t>(std::lrint(std::min(std::max(v.z, -1.0f), 1.0f) * 32767.0f)))
+	{
+		// Nothing to do.
+	}
+
+	inline Vector3 Vector3s::unpack() const
+	{
+		// -32768 lies just beyond -1, so is clamped.
+		const float scale = 1.0f / 32767.0f;
+		return Vector3(
+			std::max(static_cast<float>(x) * scale, -1.0f),
+			std::max(static_cast<float>(y) * scale, -1.0f),
+			std::max(static_cast<float>(z) * scale, -1.0f)
+		);
+	}
+
+	inline PackedQuaternion32::PackedQuaternion32()
+	: bits((511u << 20) | (511u << 10) | 511u)
+	{
+		// The identity: w is the greatest component, and the others are at
+		// the middle of their range.
+	}
+
+	inline PackedQuaternion48::PackedQuaternion48()
+	{
+		// The identity, as for PackedQuaternion32.
+		const std::uint64_t packed = (16383ull << 30) | (16383ull << 15) | 16383ull;
+		bits[0] = static_cast<std::uint16_t>(packed >> 32);
+		bits[1] = static_cast<std::uint16_t>(packed >> 16);
+		bits[2] = static_cast<std::uint16_t>(packed);
+	}
+}
+
+#endif
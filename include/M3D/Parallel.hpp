@@ -0,0 +1,287 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace M3D
+{
+	namespace parallel
+	{
+		/**
+		 * Small work-stealing thread pool for splitting batch operations
+		 * across cores.
+		 *
+		 * Each call to run() deals the tasks out in contiguous blocks to the
+		 * queues of the participating threads, which are the workers and the
+		 * calling thread. Each thread takes tasks from the front of its own
+		 * queue and, once that is empty, steals from the back of the others,
+		 * so that threads that finish early take over the work of those that
+		 * are slow or were descheduled.
+		 *
+		 * A pool with a thread count of one has no workers and runs every
+		 * task on the calling thread, in order, so that the same code can be
+		 * used single-threaded.
+		 */
+		class ThreadPool
+		{
+		public:
+			/**
+			 * Constructor.
+			 *
+			 * @param threadCount The number of threads that run tasks,
+			 * including the thread that calls run(). Zero selects the number
+			 * of hardware threads.
+			 */
+			explicit ThreadPool(std::size_t threadCount = 0);
+
+			/**
+			 * Destructor.
+			 *
+			 * Stops and joins the worker threads.
+			 */
+			~ThreadPool();
+
+			/**
+			 * Returns the number of threads that run tasks, including the
+			 * thread that calls run().
+			 *
+			 * @return The number of threads.
+			 */
+			std::size_t threadCount() const;
+
+			/**
+			 * Calls `task(i)` once for each index `i` in [0, `taskCount`),
+			 * spread across the threads of the pool, and returns when all of
+			 * the calls have returned.
+			 *
+			 * The tasks must not throw, and must not call run() on the same
+			 * pool. Calls to run() from different threads are serialised.
+			 *
+			 * @param taskCount The number of tasks.
+			 * @param task Function object called as `task(index)`.
+			 */
+			template <typename Task>
+			void run(std::size_t taskCount, const Task& task);
+
+		private:
+			/**
+			 * Type-erased task function, called with the task object and the
+			 * task index.
+			 */
+			typedef void (*Function)(const void*, std::size_t);
+
+			/**
+			 * Queue of task indices belonging to one thread.
+			 */
+			struct Queue
+			{
+				std::mutex mutex;
+				std::deque<std::size_t> tasks;
+			};
+
+			ThreadPool(const ThreadPool&);
+			ThreadPool& operator=(const ThreadPool&);
+
+			/**
+			 * Calls `function(task, i)` for each index `i` in
+			 * [0, `taskCount`).
+			 */
+			void run(std::size_t taskCount, Function function, const void* task);
+
+			/**
+			 * Body of the worker thread with the specified queue.
+			 */
+			void work(std::size_t self);
+
+			/**
+			 * Runs tasks from the queue `self`, then tasks stolen from the
+			 * other queues, until none are left to take.
+			 */
+			void drain(std::size_t self);
+
+			/**
+			 * Takes the next task from the queue `self`, or steals one from
+			 * the back of another queue. Returns false if all are empty.
+			 */
+			bool take(std::size_t self, std::size_t& task);
+
+			/**
+			 * The task queues, with that of the calling thread first.
+			 */
+			std::vector< std::unique_ptr<Queue> > queues;
+
+			/**
+			 * The worker threads.
+			 */
+			std::vector<std::thread> workers;
+
+			/**
+			 * The function and task object of the current call to run().
+			 */
+			Function function;
+			const void* task;
+
+			/**
+			 * The number of tasks of the current call to run() that have not
+			 * yet returned.
+			 */
+			std::atomic<std::size_t> remaining;
+
+			/**
+			 * Serialises calls to run().
+			 */
+			std::mutex runMutex;
+
+			/**
+			 * Guards `generation` and `stopping`, and the waits on `wake` and
+			 * `done`.
+			 */
+			std::mutex mutex;
+			std::condition_variable wake;
+			std::condition_variable done;
+
+			/**
+			 * Incremented by each call to run() to wake the workers.
+			 */
+			std::size_t generation;
+
+			/**
+			 * Set by the destructor to stop the workers.
+			 */
+			bool stopping;
+		};
+
+		/**
+		 * Splits the range [0, `count`) into consecutive chunks of
+		 * `chunkSize` elements, the last of which may be shorter, and calls
+		 * `kernel(first, n)` for each chunk on the threads of `pool`.
+		 *
+		 * The chunk boundaries depend only on `count` and `chunkSize`, never
+		 * on the number of threads.
+		 *
+		 * @param pool The thread pool.
+		 * @param count The number of elements.
+		 * @param chunkSize The number of elements in each chunk, which must
+		 * be greater than zero.
+		 * @param kernel Function object called as `kernel(first, n)`.
+		 */
+		template <typename Kernel>
+		void forEach(ThreadPool& pool, std::size_t count, std::size_t chunkSize, const Kernel& kernel);
+
+		/**
+		 * Multiplies each column vector in an array on the left by the matrix
+		 * `A`, across the threads of `pool`.
+		 *
+		 * The array is split into chunks of a few tens of kilobytes, at
+		 * multiples of the SIMD width, each of which is transformed by
+		 * M3D::transform(). The results are therefore identical to those of
+		 * M3D::transform() over the whole array, whatever the number of
+		 * threads.
+		 *
+		 * @note The output array may be the same as the input array.
+		 *
+		 * @param pool The thread pool.
+		 * @param A The transformation matrix.
+		 * @param vectors The vectors to transform.
+		 * @param out Array to receive the transformed vectors.
+		 * @param count The number of vectors.
+		 */
+		template <typename T>
+		void transform(ThreadPool& pool, const TMatrix4<T>& A, const TVector4<T>* vectors, TVector4<T>* out,
+			std::size_t count);
+
+		/**
+		 * Rotates each vector in an array by the quaternion `q`, across the
+		 * threads of `pool`. The results are identical to those of
+		 * M3D::rotate() over the whole array.
+		 *
+		 * @note The output array may be the same as the input array.
+		 *
+		 * @param pool The thread pool.
+		 * @param q The quaternion rotation to apply to each vector.
+		 * @param in The vectors to rotate.
+		 * @param out Array to receive the rotated vectors.
+		 * @param count The number of vectors.
+		 */
+		template <typename T>
+		void rotate(ThreadPool& pool, const TQuaternion<T>& q, const TVector3<T>* in, TVector3<T>* out,
+			std::size_t count);
+
+		/**
+		 * Rotates each vector in an array by the corresponding quaternion in
+		 * a second array, across the threads of `pool`. The results are
+		 * identical to those of M3D::rotate() over the whole arrays.
+		 *
+		 * @note The output array may be the same as the input array.
+		 *
+		 * @param pool The thread pool.
+		 * @param q The quaternion rotations, one per vector.
+		 * @param in The vectors to rotate.
+		 * @param out Array to receive the rotated vectors.
+		 * @param count The number of quaternions and vectors.
+		 */
+		template <typename T>
+		void rotate(ThreadPool& pool, const TQuaternion<T>* q, const TVector3<T>* in, TVector3<T>* out,
+			std::size_t count);
+
+		/**
+		 * Multiplies corresponding matrices in two arrays, across the threads
+		 * of `pool`, such that `out[i]` is `A[i] * B[i]`.
+		 *
+		 * @note The output array may be the same as either input array.
+		 *
+		 * @param pool The thread pool.
+		 * @param A The left-hand matrices.
+		 * @param B The right-hand matrices.
+		 * @param out Array to receive the products.
+		 * @param count The number of matrices in each array.
+		 */
+		template <typename T>
+		void multiply(ThreadPool& pool, const TMatrix4<T>* A, const TMatrix4<T>* B, TMatrix4<T>* out,
+			std::size_t count);
+
+		/**
+		 * Normalizes each vector in an array, across the threads of `pool`,
+		 * such that `out[i]` is `in[i].normalized()`.
+		 *
+		 * @note The output array may be the same as the input array.
+		 *
+		 * @param pool The thread pool.
+		 * @param in The vectors to normalize.
+		 * @param out Array to receive the unit vectors.
+		 * @param count The number of vectors.
+		 */
+		template <typename T>
+		void normalize(ThreadPool& pool, const TVector3<T>* in, TVector3<T>* out, std::size_t count);
+
+		/**
+		 * Normalizes each vector in an array, across the threads of `pool`,
+		 * such that `out[i]` is `in[i].normalized()`.
+		 *
+		 * @note The output array may be the same as the input array.
+		 *
+		 * @param pool The thread pool.
+		 * @param in The vectors to normalize.
+		 * @param out Array to receive the unit vectors.
+		 * @param count The number of vectors.
+		 */
+		template <typename T>
+		void normalize(ThreadPool& pool, const TVector4<T>* in, TVector4<T>* out, std::size_t count);
+	}
+}
+
+#include <M3D/Parallel.inl>
+
+#endif
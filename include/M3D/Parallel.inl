@@ -0,0 +1,44 @@
+#ifndef PARALLEL_INL
+#define PARALLEL_INL
+
+// Inline definitions of the ThreadPool templates. This file is included at
+// the end of Parallel.hpp and should not be included directly.
+
+#include <algorithm>
+
+namespace M3D
+{
+	namespace parallel
+	{
+		inline std::size_t ThreadPool::threadCount() const
+		{
+			return queues.size();
+		}
+
+		template <typename Task>
+		inline void ThreadPool::run(std::size_t taskCount, const Task& task)
+		{
+			struct Call
+			{
+				static void invoke(const void* object, std::size_t index)
+				{
+					(*static_cast<const Task*>(object))(index);
+				}
+			};
+
+			run(taskCount, &Call::invoke, &task);
+		}
+
+		template <typename Kernel>
+		inline void forEach(ThreadPool& pool, std::size_t count, std::size_t chunkSize, const Kernel& kernel)
+		{
+			pool.run((count + chunkSize - 1) / chunkSize, [&](std::size_t chunk)
+			{
+				const std::size_t first = chunk * chunkSize;
+				kernel(first, std::min(chunkSize, count - first));
+			});
+		}
+	}
+}
+
+#endif
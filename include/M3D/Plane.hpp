@@ -0,0 +1,176 @@
+#ifndef PLANE_HPP
+#define PLANE_HPP
+
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <ostream>
+
+namespace M3D
+{
+	/**
+	 * Plane in 3D space.
+	 *
+	 * The plane is stored as a unit normal and a distance, such that the
+	 * points p on the plane satisfy dot(normal, p) + distance = 0. The
+	 * signed distance of a point from the plane is positive on the side that
+	 * the normal points towards.
+	 */
+	template <typename T>
+	class TPlane
+	{
+	public:
+		/**
+		 * Scalar type of the coefficients.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the plane y = 0, with normal Vector3::UP.
+		 */
+		TPlane();
+
+		/**
+		 * Constructor.
+		 *
+		 * @note The normal must be a unit vector.
+		 *
+		 * @param normal_ The unit normal.
+		 * @param distance_ The signed distance of the origin from the plane.
+		 */
+		TPlane(const TVector3<T>& normal_, T distance_);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the plane with the specified normal passing through the
+		 * specified point.
+		 *
+		 * @note The normal must be a unit vector.
+		 *
+		 * @param normal_ The unit normal.
+		 * @param point A point on the plane.
+		 */
+		TPlane(const TVector3<T>& normal_, const TVector3<T>& point);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the plane passing through three points. The normal
+		 * points towards the side from which the points appear in
+		 * counter-clockwise order.
+		 *
+		 * @note The points must not be colinear.
+		 *
+		 * @param a The first point.
+		 * @param b The second point.
+		 * @param c The third point.
+		 */
+		TPlane(const TVector3<T>& a, const TVector3<T>& b, const TVector3<T>& c);
+
+		/**
+		 * Constructor.
+		 *
+		 * Constructs the plane from the coefficients (a, b, c, d) of the
+		 * equation a*x + b*y + c*z + d = 0, such as the planes of a Frustum.
+		 * The coefficients are normalized.
+		 *
+		 * @param coefficients The plane coefficients.
+		 */
+		explicit TPlane(const TVector4<T>& coefficients);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with its coefficients converted to the
+		 * scalar type of this plane.
+		 *
+		 * @param other The plane to convert.
+		 */
+		template <typename U>
+		explicit TPlane(const TPlane<U>& other);
+
+		/**
+		 * Equality operator.
+		 *
+		 * @param a The first plane.
+		 * @param b The second plane.
+		 * @return True if the normals and distances of the two supplied
+		 * planes are equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator==(const TPlane<U>& a, const TPlane<U>& b);
+
+		/**
+		 * Non-equality operator.
+		 *
+		 * @param a The first plane.
+		 * @param b The second plane.
+		 * @return True if the normals or distances of the two supplied
+		 * planes are not equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator!=(const TPlane<U>& a, const TPlane<U>& b);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param plane Plane to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TPlane<U>& plane);
+
+		/**
+		 * Returns the signed distance of the specified point from the plane.
+		 *
+		 * @param point The point.
+		 * @return The distance, which is positive on the side that the normal
+		 * points towards.
+		 */
+		T signedDistance(const TVector3<T>& point) const;
+
+		/**
+		 * Returns the point on the plane closest to the specified point.
+		 *
+		 * @param point The point.
+		 * @return The projection of the point onto the plane.
+		 */
+		TVector3<T> closestPoint(const TVector3<T>& point) const;
+
+		/**
+		 * Returns the plane with the same points and the opposite normal.
+		 *
+		 * @return The flipped plane.
+		 */
+		TPlane flipped() const;
+
+	public:
+		/**
+		 * The unit normal.
+		 */
+		TVector3<T> normal;
+
+		/**
+		 * The signed distance of the origin from the plane.
+		 */
+		T distance;
+	};
+
+	/**
+	 * Single precision plane.
+	 */
+	typedef TPlane<float> Plane;
+
+	/**
+	 * Double precision plane.
+	 */
+	typedef TPlane<double> Planed;
+}
+
+#include <M3D/Plane.inl>
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef PLANE_INL
+#define PLANE_INL
+
+// Inline definitions of the small, frequently called Plane operations. This
+// file is included at the end of Plane.hpp and should not be included
+// directly.
+
+#include <cmath>
+
+namespace M3D
+{
+	template <typename T>
+	inline TPlane<T>::TPlane()
+	: normal(0.0f, 1.0f, 0.0f)
+	, distance(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TPlane<T>::TPlane(const TVector3<T>& normal_, T distance_)
+	: normal(normal_)
+	, distance(distance_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TPlane<T>::TPlane(const TVector3<T>& normal_, const TVector3<T>& point)
+	: normal(normal_)
+	, distance(-dot(normal_, point))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TPlane<T>::TPlane(const TVector3<T>& a, const TVector3<T>& b, const TVector3<T>& c)
+	: normal(cross(b - a, c - a).normalized())
+	, distance(-dot(normal, a))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TPlane<T>::TPlane(const TVector4<T>& coefficients)
+	{
+		const T invLength = 1.0f / std::sqrt(coefficients.x * coefficients.x
+			+ coefficients.y * coefficients.y + coefficients.z * coefficients.z);
+		normal = TVector3<T>(coefficients.x, coefficients.y, coefficients.z) * invLength;
+		distance = coefficients.w * invLength;
+	}
+
+	template <typename T>
+	template <typename U>
+	inline TPlane<T>::TPlane(const TPlane<U>& other)
+	: normal(other.normal)
+	, distance(static_cast<T>(other.distance))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TPlane<T>& a, const TPlane<T>& b)
+	{
+		const T epsilon = 1e-6;
+		return a.normal == b.normal && std::abs(a.distance - b.distance) < epsilon;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TPlane<T>& a, const TPlane<T>& b)
+	{
+		return !(a == b);
+	}
+
+	template <typename T>
+	inline T TPlane<T>::signedDistance(const TVector3<T>& point) const
+	{
+		return dot(normal, point) + distance;
+	}
+
+	template <typename T>
+	inline TVector3<T> TPlane<T>::closestPoint(const TVector3<T>& point) const
+	{
+		return point - signedDistance(point) * normal;
+	}
+
+	template <typename T>
+	inline TPlane<T> TPlane<T>::flipped() const
+	{
+		return TPlane<T>(-normal, -distance);
+	}
+}
+
+#endif
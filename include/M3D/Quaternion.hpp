@@ -2,14 +2,21 @@
 #define QUATERNION_HPP
 
 #include <ostream>
+#include <cstddef>
 
 #include <M3D/Vector3.hpp>
 
 namespace M3D
 {
-	class Quaternion
+	template <typename T>
+	class TQuaternion
 	{
 	public:
+		/**
+		 * Scalar type of the components.
+		 */
+		typedef T Scalar;
+
 		/**
 		 * Default constructor.
 		 *
@@ -17,7 +24,7 @@ namespace M3D
 		 * This quaternion has real (scalar) part equal to 1 and vector part
 		 * equal to the zero vector.
 		 */
-		Quaternion();
+		constexpr TQuaternion();
 
 		/**
 		 * Constructor.
@@ -29,7 +36,7 @@ namespace M3D
 		 * @param y_ The y-component of the vector part.
 		 * @param z_ The z-component of the vector part.
 		 */
-		Quaternion(float w_, float x_, float y_, float z_);
+		constexpr TQuaternion(T w_, T x_, T y_, T z_);
 
 		/**
 		 * Constructor.
@@ -39,7 +46,18 @@ namespace M3D
 		 * @param s Scalar (real) part.
 		 * @param v Vector part.
 		 */
-		Quaternion(const float s, const Vector3& v);
+		constexpr TQuaternion(const T s, const TVector3<T>& v);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its components converted to the
+		 * scalar type of this quaternion.
+		 *
+		 * @param other The quaternion to convert.
+		 */
+		template <typename U>
+		explicit constexpr TQuaternion(const TQuaternion<U>& other);
 
 		/**
 		 * Equality operator.
@@ -49,7 +67,8 @@ namespace M3D
 		 * @return True if the two supplied quaternions are equal. False
 		 * otherwise.
 		 */
-		friend float operator==(const Quaternion& q1, const Quaternion& q2);
+		template <typename U>
+		friend bool operator==(const TQuaternion<U>& q1, const TQuaternion<U>& q2);
 
 		/**
 		 * Non-equality operator.
@@ -59,7 +78,8 @@ namespace M3D
 		 * @return True if the two supplied quaternions are not equal. False
 		 * otherwise.
 		 */
-		friend float operator!=(const Quaternion& q1, const Quaternion& q2);
+		template <typename U>
+		friend bool operator!=(const TQuaternion<U>& q1, const TQuaternion<U>& q2);
 
 		/**
 		 * Hamilton product. Combines the `lhs` and `rhs` rotations.
@@ -73,7 +93,8 @@ namespace M3D
 		 * @param rhs The right hand side quaternion.
 		 * @return Returns the product of the two quaternions.
 		 */
-		friend Quaternion operator*(const Quaternion& lhs, const Quaternion& rhs);
+		template <typename U>
+		friend constexpr TQuaternion<U> operator*(const TQuaternion<U>& lhs, const TQuaternion<U>& rhs);
 
 		/**
 		 * Rotates the vector `v` by applying the quaternion rotation `q`.
@@ -82,7 +103,8 @@ namespace M3D
 		 * @param v The vector to be rotated.
 		 * @return The vector `v` rotated by `q`.
 		 */
-		friend Vector3 operator*(const Quaternion& q, const Vector3& v);
+		template <typename U>
+		friend constexpr TVector3<U> operator*(const TQuaternion<U>& q, const TVector3<U>& v);
 
 		/**
 		 * Stream output operator.
@@ -91,21 +113,22 @@ namespace M3D
 		 * @param q Quaternion to output.
 		 * @return Output stream.
 		 */
-		friend std::ostream& operator <<(std::ostream& out, const Quaternion& q);
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TQuaternion<U>& q);
 
 		/**
 		 * Returns the squared magnitude of the quaternion.
 		 *
 		 * @return Squared magnitude of the quaternion.
 		 */
-		float sqrMagnitude() const;
+		constexpr T sqrMagnitude() const;
 
 		/**
 		 * Returns the magnitude of the quaternion.
 		 *
 		 * @return Magnitude of the quaternion.
 		 */
-		float magnitude() const;
+		T magnitude() const;
 
 		/**
 		 * Returns a copy of this quaternion representing the same rotation but
@@ -113,7 +136,7 @@ namespace M3D
 		 *
 		 * @return This quaternion normalized.
 		 */
-		Quaternion normalized() const;
+		TQuaternion normalized() const;
 
 		/**
 		 * Normalizes the quaternion so that it represents the same rotation,
@@ -129,7 +152,7 @@ namespace M3D
 		 * @param target Target unit quaternion rotation.
 		 * @param maxRadiansDelta Maximum number of radians to rotate.
 		 */
-		void rotateTowards(const Quaternion& target, float maxRadiansDelta);
+		void rotateTowards(const TQuaternion& target, T maxRadiansDelta);
 
 		/**
 		 * Returns a unit quaternion corresponding to the rotation around the
@@ -142,7 +165,7 @@ namespace M3D
 		 * @return Unit quaternion corresponding to the angle-axis rotation
 		 * provided.
 		 */
-		static Quaternion angleAxis(const float angle, const Vector3& axis);
+		static TQuaternion angleAxis(const T angle, const TVector3<T>& axis);
 
 		/**
 		 * Returns a unit quaternion corresponding to the rotation of z radians
@@ -153,7 +176,7 @@ namespace M3D
 		 * @return Unit quaternion corresponding to the rotation specified by
 		 * the supplied euler angles.
 		 */
-		static Quaternion euler(const Vector3& eulerAngles);
+		static TQuaternion euler(const TVector3<T>& eulerAngles);
 
 		/**
 		 * Returns a unit quaternion that represents the sortest rotation from
@@ -164,7 +187,7 @@ namespace M3D
 		 * @return Unit quaternion corresponding to the rotation from
 		 * `fromDirection` to `toDirection`.
 		 */
-		static Quaternion fromToRotation(const Vector3& fromDirection, const Vector3& toDirection);
+		static TQuaternion fromToRotation(const TVector3<T>& fromDirection, const TVector3<T>& toDirection);
 
 		/**
 		 * Returns a unit quaternion that rotates to look in the specified
@@ -180,7 +203,7 @@ namespace M3D
 		 * @return Unit quaternion representing the rotation that looks in
 		 * the `forward` direction.
 		 */
-		static Quaternion lookRotation(const Vector3& forward);
+		static TQuaternion lookRotation(const TVector3<T>& forward);
 
 		/**
 		 * Returns a unit quaternion that rotates to look in the specified
@@ -191,14 +214,14 @@ namespace M3D
 		 * @return Unit quaternion representing the rotation that looks in
 		 * the `forward` direction.
 		 */
-		static Quaternion lookRotation(const Vector3& forward, const Vector3& upwards);
+		static TQuaternion lookRotation(const TVector3<T>& forward, const TVector3<T>& upwards);
 
 		/**
 		 * Returns a copy of the conjugate of this quaternion.
 		 *
 		 * @return Conjugate of the quaternion.
 		 */
-		Quaternion conjugate() const;
+		constexpr TQuaternion conjugate() const;
 
 		/**
 		 * Returns a copy of the multiplicitive inverse of this quaternion.
@@ -209,34 +232,34 @@ namespace M3D
 		 *
 		 * @return Multiplicitive inverse of this quaternion.
 		 */
-		Quaternion inverse() const;
+		constexpr TQuaternion inverse() const;
 
 	public:
 		/**
 		 * The real (scalar) component.
 		 */
-		float w;
+		T w;
 
 		/**
 		 * The x-component of the vector part.
 		 */
-		float x;
+		T x;
 
 		/**
 		 * The y-component of the vector part.
 		 */
-		float y;
+		T y;
 
 		/**
 		 * The z-component of the vector part.
 		 */
-		float z;
+		T z;
 
 	public:
 		/**
 		 * Quaternion representing the zero rotation.
 		 */
-		static const Quaternion IDENTITY;
+		static const TQuaternion IDENTITY;
 	};
 
 	/**
@@ -248,7 +271,8 @@ namespace M3D
 	 * @param rhs The right hand side quaternion.
 	 * @return Dot product of the two quaternions.
 	 */
-	float dot(const Quaternion& lhs, const Quaternion& rhs);
+	template <typename T>
+	constexpr T dot(const TQuaternion<T>& lhs, const TQuaternion<T>& rhs);
 
 	/**
 	 * Returns the angle (in radians) between the two unit quaternion rotations
@@ -258,7 +282,139 @@ namespace M3D
 	 * @param to The unit quaternion that the angle should be measured to.
 	 * @return Angle (radians) between the two rotations.
 	 */
-	float angle(const Quaternion& from, const Quaternion& to);
+	template <typename T>
+	T angle(const TQuaternion<T>& from, const TQuaternion<T>& to);
+
+	/**
+	 * Normalized linear interpolation between the unit quaternions `from` and
+	 * `to` by the fraction `factor`.
+	 *
+	 * The interpolation takes the shortest path and is much cheaper than
+	 * slerp, but the angular velocity is not constant.
+	 *
+	 * @param from The unit quaternion to interpolate from.
+	 * @param to The unit quaternion to interpolate towards.
+	 * @param factor The interpolation fraction in the range [0, 1].
+	 * @return Unit quaternion between `from` and `to`.
+	 */
+	template <typename T>
+	TQuaternion<T> nlerp(const TQuaternion<T>& from, const TQuaternion<T>& to, typename TQuaternion<T>::Scalar factor);
+
+	/**
+	 * Spherical linear interpolation between the unit quaternions `from` and
+	 * `to` by the fraction `factor`.
+	 *
+	 * The interpolation takes the shortest path with constant angular
+	 * velocity.
+	 *
+	 * @param from The unit quaternion to interpolate from.
+	 * @param to The unit quaternion to interpolate towards.
+	 * @param factor The interpolation fraction in the range [0, 1].
+	 * @return Unit quaternion between `from` and `to`.
+	 */
+	template <typename T>
+	TQuaternion<T> slerp(const TQuaternion<T>& from, const TQuaternion<T>& to, typename TQuaternion<T>::Scalar factor);
+
+	/**
+	 * Spherical cubic interpolation between the unit quaternions `from` and
+	 * `to` by the fraction `factor`.
+	 *
+	 * Unlike slerp, the interpolation of a sequence of keys with squad has a
+	 * continuous angular velocity across the keys. The control points should
+	 * be computed with squadControlPoint().
+	 *
+	 * @param from The unit quaternion to interpolate from.
+	 * @param to The unit quaternion to interpolate towards.
+	 * @param fromControl The control point for `from`.
+	 * @param toControl The control point for `to`.
+	 * @param factor The interpolation fraction in the range [0, 1].
+	 * @return Unit quaternion between `from` and `to`.
+	 */
+	template <typename T>
+	TQuaternion<T> squad(const TQuaternion<T>& from, const TQuaternion<T>& to,
+		const TQuaternion<T>& fromControl, const TQuaternion<T>& toControl,
+		typename TQuaternion<T>::Scalar factor);
+
+	/**
+	 * Returns the squad control point for the key `current` in a sequence of
+	 * unit quaternion keys.
+	 *
+	 * @param previous The key before `current`.
+	 * @param current The key for which to compute the control point.
+	 * @param next The key after `current`.
+	 * @return Control point for `current`.
+	 */
+	template <typename T>
+	TQuaternion<T> squadControlPoint(const TQuaternion<T>& previous, const TQuaternion<T>& current,
+		const TQuaternion<T>& next);
+
+	/**
+	 * Spherical linear interpolation of arrays of unit quaternion pairs.
+	 *
+	 * Computes `out[i]` = slerp(`from[i]`, `to[i]`, `factors[i]`) for each
+	 * pair, using a polynomial approximation of the slerp weights that
+	 * requires no trigonometric functions, so that four (SSE2) or eight (AVX)
+	 * pairs are evaluated together. The error in each component of the result
+	 * is below 3e-5 and is much smaller when the keys are close together.
+	 *
+	 * @note The output array may be the same as either of the input arrays.
+	 *
+	 * @param from The unit quaternions to interpolate from.
+	 * @param to The unit quaternions to interpolate towards.
+	 * @param factors The interpolation fractions in the range [0, 1].
+	 * @param out Array to receive the interpolated quaternions.
+	 * @param count The number of quaternion pairs.
+	 */
+	template <typename T>
+	void slerp(const TQuaternion<T>* from, const TQuaternion<T>* to, const T* factors,
+		TQuaternion<T>* out, std::size_t count);
+
+	/**
+	 * Rotates an array of vectors by the quaternion `q`.
+	 *
+	 * This is equivalent to computing `q` * `in[i]` for each vector, but
+	 * processes several vectors at a time using the SIMD instruction set
+	 * selected at configure time.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param q The quaternion rotation to apply to each vector.
+	 * @param in The vectors to rotate.
+	 * @param out Array to receive the rotated vectors.
+	 * @param count The number of vectors.
+	 */
+	template <typename T>
+	void rotate(const TQuaternion<T>& q, const TVector3<T>* in, TVector3<T>* out, std::size_t count);
+
+	/**
+	 * Rotates each vector in an array by the corresponding quaternion in a
+	 * second array.
+	 *
+	 * This is equivalent to computing `q[i]` * `in[i]` for each vector. The
+	 * quaternions are transposed in registers so that four (SSE2) or eight
+	 * (AVX) rotations are evaluated together.
+	 *
+	 * @note The output array may be the same as the input array.
+	 *
+	 * @param q The quaternion rotations, one per vector.
+	 * @param in The vectors to rotate.
+	 * @param out Array to receive the rotated vectors.
+	 * @param count The number of quaternions and vectors.
+	 */
+	template <typename T>
+	void rotate(const TQuaternion<T>* q, const TVector3<T>* in, TVector3<T>* out, std::size_t count);
+
+	/**
+	 * Single precision quaternion.
+	 */
+	typedef TQuaternion<float> Quaternion;
+
+	/**
+	 * Double precision quaternion.
+	 */
+	typedef TQuaternion<double> Quaterniond;
 }
 
+#include <M3D/Quaternion.inl>
+
 #endif
@@ -0,0 +1,170 @@
+#ifndef QUATERNION_INL
+#define QUATERNION_INL
+
+// Inline definitions of the small, frequently called Quaternion operations. This
+// file is included at the end of Quaternion.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TQuaternion<T>::TQuaternion()
+	: w(1.0f)
+	, x(0.0f)
+	, y(0.0f)
+	, z(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TQuaternion<T>::TQuaternion(T w_, T x_, T y_, T z_)
+	: w(w_)
+	, x(x_)
+	, y(y_)
+	, z(z_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TQuaternion<T>::TQuaternion(const TQuaternion<U>& other)
+	: w(static_cast<T>(other.w))
+	, x(static_cast<T>(other.x))
+	, y(static_cast<T>(other.y))
+	, z(static_cast<T>(other.z))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TQuaternion<T>::TQuaternion(const T s, const TVector3<T>& v)
+	: w(s)
+	, x(v.x)
+	, y(v.y)
+	, z(v.z)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TQuaternion<T>& q1, const TQuaternion<T>& q2)
+	{
+		const T epsilon = 1e-6;
+		return std::abs(q1.w - q2.w) < epsilon && std::abs(q1.x - q2.x) < epsilon
+			&& std::abs(q1.y - q2.y) < epsilon && std::abs(q1.z - q2.z) < epsilon;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TQuaternion<T>& q1, const TQuaternion<T>& q2)
+	{
+		return !(q1 == q2);
+	}
+
+	template <typename T>
+	constexpr TQuaternion<T> operator*(const TQuaternion<T>& lhs, const TQuaternion<T>& rhs)
+	{
+		return TQuaternion<T>(
+			lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
+			lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+			lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+			lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w
+		);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator*(const TQuaternion<T>& q, const TVector3<T>& v)
+	{
+		// Quaternion r = q * Quaternion(0.0f, v.x, v.y, v.z) * q.conjugate();
+		// return Vector3(r.x, r.y, r.z);
+
+		// This faster method is described:
+		// http://molecularmusings.wordpress.com/2013/05/24/a-faster-quaternion-vector-multiplication/
+		const TVector3<T> qv = TVector3<T>(q.x, q.y, q.z);
+		const TVector3<T> t = 2.0f * cross(qv, v);
+		return v + q.w * t + cross(qv, t);
+	}
+
+	template <typename T>
+	constexpr T TQuaternion<T>::sqrMagnitude() const
+	{
+		return w * w + x * x + y * y + z * z;
+	}
+
+	template <typename T>
+	inline T TQuaternion<T>::magnitude() const
+	{
+		return std::sqrt(sqrMagnitude());
+	}
+
+	template <typename T>
+	inline TQuaternion<T> TQuaternion<T>::normalized() const
+	{
+		const T sqrNorm = sqrMagnitude();
+		assert(sqrNorm > 0.0f);
+		const T invNorm = 1.0f / std::sqrt(sqrNorm);
+
+		return TQuaternion<T>(w * invNorm, x * invNorm, y * invNorm, z * invNorm);
+	}
+
+	template <typename T>
+	inline void TQuaternion<T>::normalize()
+	{
+		const T sqrNorm = sqrMagnitude();
+		assert(sqrNorm > 0.0f);
+		const T invNorm = 1.0f / std::sqrt(sqrNorm);
+
+		w *= invNorm;
+		x *= invNorm;
+		y *= invNorm;
+		z *= invNorm;
+	}
+
+	template <typename T>
+	constexpr TQuaternion<T> TQuaternion<T>::conjugate() const
+	{
+		return TQuaternion<T>(w, -x, -y, -z);
+	}
+
+	template <typename T>
+	constexpr TQuaternion<T> TQuaternion<T>::inverse() const
+	{
+		const T sqr = sqrMagnitude();
+		assert(sqr > 0.0f);
+
+		const T invSqr = 1.0f / sqr;
+		return TQuaternion<T>(w * invSqr, -x * invSqr, -y * invSqr, -z * invSqr);
+	}
+
+	template <typename T>
+	constexpr T dot(const TQuaternion<T>& lhs, const TQuaternion<T>& rhs)
+	{
+		return lhs.w * rhs.w + lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+	}
+
+	template <typename T>
+	inline TQuaternion<T> nlerp(const TQuaternion<T>& from, const TQuaternion<T>& to, typename TQuaternion<T>::Scalar factor)
+	{
+		// The quaternions q and -q represent the same rotation. Interpolate
+		// towards whichever of the two is closer in order to take the shortest
+		// path.
+		const T f = dot(from, to) < 0.0f ? -factor : factor;
+		const T g = 1.0f - factor;
+
+		return TQuaternion<T>(
+			g * from.w + f * to.w,
+			g * from.x + f * to.x,
+			g * from.y + f * to.y,
+			g * from.z + f * to.z
+		).normalized();
+	}
+
+	template <typename T>
+	constexpr TQuaternion<T> TQuaternion<T>::IDENTITY = TQuaternion<T>(1.0f, 0.0f, 0.0f, 0.0f);
+}
+
+#endif
@@ -0,0 +1,325 @@
+#ifndef RAY_HPP
+#define RAY_HPP
+
+#include <M3D/AABB.hpp>
+#include <M3D/Plane.hpp>
+#include <M3D/Sphere.hpp>
+#include <M3D/Triangle.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <ostream>
+#include <cstddef>
+
+namespace M3D
+{
+	/**
+	 * Half-line starting at an origin and extending in a direction.
+	 *
+	 * The point at parameter t along the ray is origin + t * direction, for
+	 * t >= 0. The direction need not be a unit vector; the distances returned
+	 * by the intersection tests are values of t, so they are in units of the
+	 * length of the direction.
+	 */
+	template <typename T>
+	class TRay
+	{
+	public:
+		/**
+		 * Scalar type of the coordinates.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the ray from the origin in the direction
+		 * Vector3::FORWARD.
+		 */
+		TRay();
+
+		/**
+		 * Constructor.
+		 *
+		 * @param origin_ The origin.
+		 * @param direction_ The direction, which must be nonzero.
+		 */
+		TRay(const TVector3<T>& origin_, const TVector3<T>& direction_);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its coordinates converted
+		 * to the scalar type of this ray.
+		 *
+		 * @param other The ray to convert.
+		 */
+		template <typename U>
+		explicit TRay(const TRay<U>& other);
+
+		/**
+		 * Equality operator.
+		 *
+		 * @param a The first ray.
+		 * @param b The second ray.
+		 * @return True if the origins and directions of the two supplied rays
+		 * are equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator==(const TRay<U>& a, const TRay<U>& b);
+
+		/**
+		 * Non-equality operator.
+		 *
+		 * @param a The first ray.
+		 * @param b The second ray.
+		 * @return True if the origins or directions of the two supplied rays
+		 * are not equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator!=(const TRay<U>& a, const TRay<U>& b);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param ray Ray to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TRay<U>& ray);
+
+		/**
+		 * Returns the point at the specified parameter along the ray.
+		 *
+		 * @param t The parameter.
+		 * @return The point origin + t * direction.
+		 */
+		TVector3<T> pointAt(T t) const;
+
+		/**
+		 * Intersects the ray with a plane.
+		 *
+		 * @param plane The plane.
+		 * @param distance Receives the parameter of the intersection point if
+		 * the ray intersects the plane.
+		 * @return True if the ray intersects the plane. False if it is
+		 * parallel to the plane or points away from it.
+		 */
+		bool intersects(const TPlane<T>& plane, T& distance) const;
+
+		/**
+		 * Intersects the ray with a sphere.
+		 *
+		 * @param sphere The sphere.
+		 * @param distance Receives the parameter of the first intersection
+		 * point if the ray intersects the sphere, which is zero if the origin
+		 * is inside the sphere.
+		 * @return True if the ray intersects the sphere. False otherwise.
+		 */
+		bool intersects(const TSphere<T>& sphere, T& distance) const;
+
+		/**
+		 * Intersects the ray with a box using the slab method. The box is
+		 * closed, so a ray that lies on one of its faces intersects it.
+		 *
+		 * @param box The box.
+		 * @param distance Receives the parameter of the first intersection
+		 * point if the ray intersects the box, which is zero if the origin is
+		 * inside the box.
+		 * @return True if the ray intersects the box. False otherwise.
+		 */
+		bool intersects(const TAABB<T>& box, T& distance) const;
+
+		/**
+		 * Intersects the ray with a triangle using the method of Moller and
+		 * Trumbore, "Fast, Minimum Storage Ray/Triangle Intersection". Both
+		 * faces of the triangle are hit.
+		 *
+		 * @param triangle The triangle.
+		 * @param distance Receives the parameter of the intersection point if
+		 * the ray intersects the triangle.
+		 * @return True if the ray intersects the triangle. False otherwise,
+		 * including when the ray is parallel to the triangle or the triangle
+		 * is degenerate.
+		 */
+		bool intersects(const TTriangle<T>& triangle, T& distance) const;
+
+		/**
+		 * Clips a range of the parameter to a pair of slabs of the slab
+		 * method.
+		 *
+		 * A ray that is parallel to the slabs, with its origin on one of
+		 * them, gives NaN (zero times infinity) for one or both parameters.
+		 * It lies within the closed slabs, so the range is then not clipped.
+		 *
+		 * @param t0 The parameter at which the ray crosses the first slab.
+		 * @param t1 The parameter at which the ray crosses the second slab.
+		 * @param entry The start of the range, which is raised to the entry
+		 * into the slabs.
+		 * @param exit The end of the range, which is lowered to the exit from
+		 * the slabs.
+		 */
+		static void clipSlab(T t0, T t1, T& entry, T& exit);
+
+	public:
+		/**
+		 * The origin.
+		 */
+		TVector3<T> origin;
+
+		/**
+		 * The direction.
+		 */
+		TVector3<T> direction;
+	};
+
+	/**
+	 * Intersects a ray with an array of triangles, stored as separate arrays
+	 * of the coordinates of their vertices.
+	 *
+	 * The triangles are tested four (SSE2) or eight (AVX) at a time with the
+	 * Moller-Trumbore test of TRay::intersects(const TTriangle<T>&, T&).
+	 *
+	 * @param ray The ray.
+	 * @param axs The x-coordinates of the first vertices.
+	 * @param ays The y-coordinates of the first vertices.
+	 * @param azs The z-coordinates of the first vertices.
+	 * @param bxs The x-coordinates of the second vertices.
+	 * @param bys The y-coordinates of the second vertices.
+	 * @param bzs The z-coordinates of the second vertices.
+	 * @param cxs The x-coordinates of the third vertices.
+	 * @param cys The y-coordinates of the third vertices.
+	 * @param czs The z-coordinates of the third vertices.
+	 * @param distances Array to receive the parameter of the intersection
+	 * with each triangle, or positive infinity where the ray misses.
+	 * @param count The number of triangles.
+	 */
+	template <typename T>
+	void intersectTriangles(const TRay<T>& ray,
+		const T* axs, const T* ays, const T* azs,
+		const T* bxs, const T* bys, const T* bzs,
+		const T* cxs, const T* cys, const T* czs,
+		T* distances, std::size_t count);
+
+	/**
+	 * Intersects a ray with an array of boxes, stored as separate arrays of
+	 * the coordinates of their minimum and maximum corners.
+	 *
+	 * The boxes are tested four (SSE2) or eight (AVX) at a time with the slab
+	 * test of TRay::intersects(const TAABB<T>&, T&).
+	 *
+	 * @param ray The ray.
+	 * @param minXs The x-coordinates of the minimum corners.
+	 * @param minYs The y-coordinates of the minimum corners.
+	 * @param minZs The z-coordinates of the minimum corners.
+	 * @param maxXs The x-coordinates of the maximum corners.
+	 * @param maxYs The y-coordinates of the maximum corners.
+	 * @param maxZs The z-coordinates of the maximum corners.
+	 * @param distances Array to receive the parameter of the first
+	 * intersection with each box, or positive infinity where the ray misses.
+	 * @param count The number of boxes.
+	 */
+	template <typename T>
+	void intersectBoxes(const TRay<T>& ray,
+		const T* minXs, const T* minYs, const T* minZs,
+		const T* maxXs, const T* maxYs, const T* maxZs,
+		T* distances, std::size_t count);
+
+	/**
+	 * Intersects a ray with an array of spheres, stored as separate arrays of
+	 * center coordinates and radii.
+	 *
+	 * The spheres are tested four (SSE2) or eight (AVX) at a time with the
+	 * test of TRay::intersects(const TSphere<T>&, T&).
+	 *
+	 * @param ray The ray.
+	 * @param xs The x-coordinates of the centers.
+	 * @param ys The y-coordinates of the centers.
+	 * @param zs The z-coordinates of the centers.
+	 * @param radii The radii.
+	 * @param distances Array to receive the parameter of the first
+	 * intersection with each sphere, or positive infinity where the ray
+	 * misses.
+	 * @param count The number of spheres.
+	 */
+	template <typename T>
+	void intersectSpheres(const TRay<T>& ray, const T* xs, const T* ys, const T* zs, const T* radii,
+		T* distances, std::size_t count);
+
+	/**
+	 * Intersects an array of rays, stored as separate arrays of the
+	 * coordinates of their origins and directions, with a triangle.
+	 *
+	 * The rays are tested four (SSE2) or eight (AVX) at a time with the
+	 * Moller-Trumbore test of TRay::intersects(const TTriangle<T>&, T&).
+	 *
+	 * @param originXs The x-coordinates of the origins.
+	 * @param originYs The y-coordinates of the origins.
+	 * @param originZs The z-coordinates of the origins.
+	 * @param directionXs The x-components of the directions.
+	 * @param directionYs The y-components of the directions.
+	 * @param directionZs The z-components of the directions.
+	 * @param triangle The triangle.
+	 * @param distances Array to receive the parameter of the intersection of
+	 * each ray, or positive infinity where the ray misses.
+	 * @param count The number of rays.
+	 */
+	template <typename T>
+	void intersectRays(const T* originXs, const T* originYs, const T* originZs,
+		const T* directionXs, const T* directionYs, const T* directionZs,
+		const TTriangle<T>& triangle, T* distances, std::size_t count);
+
+	/**
+	 * Intersects an array of rays, stored as separate arrays of the
+	 * coordinates of their origins and directions, with a box.
+	 *
+	 * @param originXs The x-coordinates of the origins.
+	 * @param originYs The y-coordinates of the origins.
+	 * @param originZs The z-coordinates of the origins.
+	 * @param directionXs The x-components of the directions.
+	 * @param directionYs The y-components of the directions.
+	 * @param directionZs The z-components of the directions.
+	 * @param box The box.
+	 * @param distances Array to receive the parameter of the first
+	 * intersection of each ray, or positive infinity where the ray misses.
+	 * @param count The number of rays.
+	 */
+	template <typename T>
+	void intersectRays(const T* originXs, const T* originYs, const T* originZs,
+		const T* directionXs, const T* directionYs, const T* directionZs,
+		const TAABB<T>& box, T* distances, std::size_t count);
+
+	/**
+	 * Intersects an array of rays, stored as separate arrays of the
+	 * coordinates of their origins and directions, with a sphere.
+	 *
+	 * @param originXs The x-coordinates of the origins.
+	 * @param originYs The y-coordinates of the origins.
+	 * @param originZs The z-coordinates of the origins.
+	 * @param directionXs The x-components of the directions.
+	 * @param directionYs The y-components of the directions.
+	 * @param directionZs The z-components of the directions.
+	 * @param sphere The sphere.
+	 * @param distances Array to receive the parameter of the first
+	 * intersection of each ray, or positive infinity where the ray misses.
+	 * @param count The number of rays.
+	 */
+	template <typename T>
+	void intersectRays(const T* originXs, const T* originYs, const T* originZs,
+		const T* directionXs, const T* directionYs, const T* directionZs,
+		const TSphere<T>& sphere, T* distances, std::size_t count);
+
+	/**
+	 * Single precision ray.
+	 */
+	typedef TRay<float> Ray;
+
+	/**
+	 * Double precision ray.
+	 */
+	typedef TRay<double> Rayd;
+}
+
+#include <M3D/Ray.inl>
+
+#endif
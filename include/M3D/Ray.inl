@@ -0,0 +1,159 @@
+#ifndef RAY_INL
+#define RAY_INL
+
+// Inline definitions of the small, frequently called Ray operations. This file
+// is included at the end of Ray.hpp and should not be included directly.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace M3D
+{
+	template <typename T>
+	inline TRay<T>::TRay()
+	: origin()
+	, direction(0.0f, 0.0f, 1.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TRay<T>::TRay(const TVector3<T>& origin_, const TVector3<T>& direction_)
+	: origin(origin_)
+	, direction(direction_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	inline TRay<T>::TRay(const TRay<U>& other)
+	: origin(other.origin)
+	, direction(other.direction)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TRay<T>& a, const TRay<T>& b)
+	{
+		return a.origin == b.origin && a.direction == b.direction;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TRay<T>& a, const TRay<T>& b)
+	{
+		return !(a == b);
+	}
+
+	template <typename T>
+	inline TVector3<T> TRay<T>::pointAt(T t) const
+	{
+		return origin + t * direction;
+	}
+
+	template <typename T>
+	inline bool TRay<T>::intersects(const TPlane<T>& plane, T& distance) const
+	{
+		const T t = -plane.signedDistance(origin) / dot(plane.normal, direction);
+
+		// A ray parallel to the plane gives an infinite or NaN parameter.
+		if (t >= 0.0f && t < std::numeric_limits<T>::infinity())
+		{
+			distance = t;
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename T>
+	inline bool TRay<T>::intersects(const TSphere<T>& sphere, T& distance) const
+	{
+		// Solve |m + t d|^2 = r^2 for t, where m is the origin relative to
+		// the center of the sphere.
+		const TVector3<T> m = origin - sphere.center;
+		const T b = dot(m, direction);
+		const T c = dot(m, m) - sphere.radius * sphere.radius;
+
+		// Exit if the origin is outside the sphere and the ray points away
+		// from it.
+		if (c > 0.0f && b > 0.0f)
+		{
+			return false;
+		}
+
+		const T a = dot(direction, direction);
+		const T discriminant = b * b - a * c;
+		if (discriminant < 0.0f)
+		{
+			return false;
+		}
+
+		distance = std::max(T(0), (-b - std::sqrt(discriminant)) / a);
+		return true;
+	}
+
+	template <typename T>
+	inline bool TRay<T>::intersects(const TAABB<T>& box, T& distance) const
+	{
+		const T invX = 1.0f / direction.x;
+		const T invY = 1.0f / direction.y;
+		const T invZ = 1.0f / direction.z;
+
+		// Clip the parameter range against each pair of slabs in turn.
+		T tMin = T(0);
+		T tMax = std::numeric_limits<T>::infinity();
+		clipSlab((box.min.x - origin.x) * invX, (box.max.x - origin.x) * invX, tMin, tMax);
+		clipSlab((box.min.y - origin.y) * invY, (box.max.y - origin.y) * invY, tMin, tMax);
+		clipSlab((box.min.z - origin.z) * invZ, (box.max.z - origin.z) * invZ, tMin, tMax);
+		if (tMin <= tMax)
+		{
+			distance = tMin;
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename T>
+	inline void TRay<T>::clipSlab(T t0, T t1, T& entry, T& exit)
+	{
+		if (!std::isnan(t0) && !std::isnan(t1))
+		{
+			entry = std::max(entry, std::min(t0, t1));
+			exit = std::min(exit, std::max(t0, t1));
+		}
+	}
+
+	template <typename T>
+	inline bool TRay<T>::intersects(const TTriangle<T>& triangle, T& distance) const
+	{
+		const TVector3<T> e1 = triangle.b - triangle.a;
+		const TVector3<T> e2 = triangle.c - triangle.a;
+
+		// The barycentric coordinates (u, v) and parameter t are found by
+		// Cramer's rule, sharing the cross products p and q between them.
+		const TVector3<T> p = cross(direction, e2);
+		const T invDet = 1.0f / dot(e1, p);
+
+		const TVector3<T> s = origin - triangle.a;
+		const T u = dot(s, p) * invDet;
+
+		const TVector3<T> q = cross(s, e1);
+		const T v = dot(direction, q) * invDet;
+		const T t = dot(e2, q) * invDet;
+
+		// The comparisons fail for the NaNs that a zero determinant gives.
+		if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t >= 0.0f)
+		{
+			distance = t;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+#endif
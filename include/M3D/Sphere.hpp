@@ -0,0 +1,139 @@
+#ifndef SPHERE_HPP
+#define SPHERE_HPP
+
+#include <M3D/AABB.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <ostream>
+
+namespace M3D
+{
+	/**
+	 * Sphere, stored as its center and radius.
+	 */
+	template <typename T>
+	class TSphere
+	{
+	public:
+		/**
+		 * Scalar type of the coordinates.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the sphere of radius zero at the origin.
+		 */
+		TSphere();
+
+		/**
+		 * Constructor.
+		 *
+		 * @param center_ The center.
+		 * @param radius_ The radius.
+		 */
+		TSphere(const TVector3<T>& center_, T radius_);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with its center and radius converted to
+		 * the scalar type of this sphere.
+		 *
+		 * @param other The sphere to convert.
+		 */
+		template <typename U>
+		explicit TSphere(const TSphere<U>& other);
+
+		/**
+		 * Equality operator.
+		 *
+		 * @param a The first sphere.
+		 * @param b The second sphere.
+		 * @return True if the centers and radii of the two supplied spheres are
+		 * equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator==(const TSphere<U>& a, const TSphere<U>& b);
+
+		/**
+		 * Non-equality operator.
+		 *
+		 * @param a The first sphere.
+		 * @param b The second sphere.
+		 * @return True if the centers or radii of the two supplied spheres are
+		 * not equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator!=(const TSphere<U>& a, const TSphere<U>& b);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param sphere Sphere to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TSphere<U>& sphere);
+
+		/**
+		 * Returns whether the sphere contains the specified point. Points on
+		 * the boundary are contained.
+		 *
+		 * @param point The point to test.
+		 * @return True if the point lies inside the sphere. False otherwise.
+		 */
+		bool contains(const TVector3<T>& point) const;
+
+		/**
+		 * Returns whether the sphere intersects the specified sphere.
+		 *
+		 * @param sphere The sphere to test.
+		 * @return True if the spheres overlap or touch. False otherwise.
+		 */
+		bool intersects(const TSphere& sphere) const;
+
+		/**
+		 * Returns whether the sphere intersects the specified box.
+		 *
+		 * @param box The box to test.
+		 * @return True if the sphere and box overlap or touch. False
+		 * otherwise.
+		 */
+		bool intersects(const TAABB<T>& box) const;
+
+		/**
+		 * Returns the bounding box of the sphere.
+		 *
+		 * @return The smallest axis-aligned box containing the sphere.
+		 */
+		TAABB<T> bounds() const;
+
+	public:
+		/**
+		 * The center.
+		 */
+		TVector3<T> center;
+
+		/**
+		 * The radius.
+		 */
+		T radius;
+	};
+
+	/**
+	 * Single precision sphere.
+	 */
+	typedef TSphere<float> Sphere;
+
+	/**
+	 * Double precision sphere.
+	 */
+	typedef TSphere<double> Sphered;
+}
+
+#include <M3D/Sphere.inl>
+
+#endif
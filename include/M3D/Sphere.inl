@@ -0,0 +1,84 @@
+#ifndef SPHERE_INL
+#define SPHERE_INL
+
+// Inline definitions of the small, frequently called Sphere operations. This
+// file is included at the end of Sphere.hpp and should not be included
+// directly.
+
+#include <algorithm>
+#include <cmath>
+
+namespace M3D
+{
+	template <typename T>
+	inline TSphere<T>::TSphere()
+	: center()
+	, radius(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TSphere<T>::TSphere(const TVector3<T>& center_, T radius_)
+	: center(center_)
+	, radius(radius_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	inline TSphere<T>::TSphere(const TSphere<U>& other)
+	: center(other.center)
+	, radius(static_cast<T>(other.radius))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TSphere<T>& a, const TSphere<T>& b)
+	{
+		const T epsilon = 1e-6;
+		return a.center == b.center && std::abs(a.radius - b.radius) < epsilon;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TSphere<T>& a, const TSphere<T>& b)
+	{
+		return !(a == b);
+	}
+
+	template <typename T>
+	inline bool TSphere<T>::contains(const TVector3<T>& point) const
+	{
+		return (point - center).sqrMagnitude() <= radius * radius;
+	}
+
+	template <typename T>
+	inline bool TSphere<T>::intersects(const TSphere<T>& sphere) const
+	{
+		const T r = radius + sphere.radius;
+		return (sphere.center - center).sqrMagnitude() <= r * r;
+	}
+
+	template <typename T>
+	inline bool TSphere<T>::intersects(const TAABB<T>& box) const
+	{
+		// Compare the radius with the distance to the closest point of the
+		// box.
+		const TVector3<T> closest(
+			std::min(std::max(center.x, box.min.x), box.max.x),
+			std::min(std::max(center.y, box.min.y), box.max.y),
+			std::min(std::max(center.z, box.min.z), box.max.z));
+		return (closest - center).sqrMagnitude() <= radius * radius;
+	}
+
+	template <typename T>
+	inline TAABB<T> TSphere<T>::bounds() const
+	{
+		const TVector3<T> r(radius, radius, radius);
+		return TAABB<T>(center - r, center + r);
+	}
+}
+
+#endif
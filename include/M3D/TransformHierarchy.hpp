@@ -0,0 +1,223 @@
+#ifndef TRANSFORMHIERARCHY_HPP
+#define TRANSFORMHIERARCHY_HPP
+
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace M3D
+{
+	/**
+	 * A tree of transforms, each with a local position, rotation and scale
+	 * relative to its parent, from which the world transform of every node is
+	 * computed.
+	 *
+	 * The local positions, rotations, scales, parents and world transforms
+	 * are stored in separate arrays indexed by node, rather than in linked
+	 * node objects. A node can only be added once its parent exists, so
+	 * parents always precede their children and update() computes every
+	 * world transform in a single pass through the arrays, in memory order.
+	 *
+	 * Changing a local transform marks the node dirty. update() recomputes
+	 * the world transforms of the dirty nodes and their descendants only,
+	 * starting from the first dirty node.
+	 */
+	class TransformHierarchy
+	{
+	public:
+		/**
+		 * The parent of the root nodes.
+		 */
+		static const std::size_t NO_PARENT = static_cast<std::size_t>(-1);
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs an empty hierarchy.
+		 */
+		TransformHierarchy();
+
+		/**
+		 * Reserves storage for the specified number of nodes.
+		 *
+		 * @param capacity The number of nodes.
+		 */
+		void reserve(std::size_t capacity);
+
+		/**
+		 * Adds a node. The node is dirty until the next update().
+		 *
+		 * @param parent The index of the parent, which must be an existing
+		 * node, or NO_PARENT for a root node.
+		 * @param position The position relative to the parent.
+		 * @param rotation The unit rotation relative to the parent.
+		 * @param scale The scale along each axis relative to the parent.
+		 * @return The index of the node.
+		 */
+		std::size_t add(std::size_t parent,
+			const Vector3& position = Vector3(),
+			const Quaternion& rotation = Quaternion(),
+			const Vector3& scale = Vector3(1.0f, 1.0f, 1.0f));
+
+		/**
+		 * Returns the number of nodes.
+		 *
+		 * @return The number of nodes.
+		 */
+		std::size_t size() const;
+
+		/**
+		 * Returns the parent of a node.
+		 *
+		 * @param node The index of the node.
+		 * @return The index of the parent, which is less than `node`, or
+		 * NO_PARENT for a root node.
+		 */
+		std::size_t parent(std::size_t node) const;
+
+		/**
+		 * Returns the position of a node relative to its parent.
+		 *
+		 * @param node The index of the node.
+		 * @return The local position.
+		 */
+		const Vector3& position(std::size_t node) const;
+
+		/**
+		 * Returns the rotation of a node relative to its parent.
+		 *
+		 * @param node The index of the node.
+		 * @return The local rotation.
+		 */
+		const Quaternion& rotation(std::size_t node) const;
+
+		/**
+		 * Returns the scale of a node relative to its parent.
+		 *
+		 * @param node The index of the node.
+		 * @return The local scale.
+		 */
+		const Vector3& scale(std::size_t node) const;
+
+		/**
+		 * Sets the position of a node relative to its parent and marks the
+		 * node dirty.
+		 *
+		 * @param node The index of the node.
+		 * @param position The local position.
+		 */
+		void setPosition(std::size_t node, const Vector3& position);
+
+		/**
+		 * Sets the rotation of a node relative to its parent and marks the
+		 * node dirty.
+		 *
+		 * @param node The index of the node.
+		 * @param rotation The unit local rotation.
+		 */
+		void setRotation(std::size_t node, const Quaternion& rotation);
+
+		/**
+		 * Sets the scale of a node relative to its parent and marks the node
+		 * dirty.
+		 *
+		 * @param node The index of the node.
+		 * @param scale The local scale.
+		 */
+		void setScale(std::size_t node, const Vector3& scale);
+
+		/**
+		 * Sets the position, rotation and scale of a node relative to its
+		 * parent and marks the node dirty.
+		 *
+		 * @param node The index of the node.
+		 * @param position The local position.
+		 * @param rotation The unit local rotation.
+		 * @param scale The local scale.
+		 */
+		void setLocal(std::size_t node, const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+		/**
+		 * Returns whether a node has been changed since the last update().
+		 *
+		 * @param node The index of the node.
+		 * @return True if the node is dirty, false otherwise.
+		 */
+		bool isDirty(std::size_t node) const;
+
+		/**
+		 * Recomputes the world transforms of the dirty nodes and of their
+		 * descendants, and marks every node clean.
+		 *
+		 * @return The number of world transforms recomputed.
+		 */
+		std::size_t update();
+
+		/**
+		 * Returns the world transform of a node, which scales, then rotates,
+		 * then translates by the local transform of the node and then those
+		 * of each of its ancestors in turn.
+		 *
+		 * @note The transform is that computed by the last update(), so is
+		 * out of date while the node or any of its ancestors is dirty.
+		 *
+		 * @param node The index of the node.
+		 * @return The world transform.
+		 */
+		const Affine3& world(std::size_t node) const;
+
+		/**
+		 * Returns the world transform of a node as a 4x4 matrix.
+		 *
+		 * @param node The index of the node.
+		 * @return The world transform.
+		 */
+		Matrix4 worldMatrix(std::size_t node) const;
+
+	private:
+		/**
+		 * The parents of the nodes.
+		 */
+		std::vector<std::size_t> parents;
+
+		/**
+		 * The local positions of the nodes.
+		 */
+		std::vector<Vector3> positions;
+
+		/**
+		 * The local rotations of the nodes.
+		 */
+		std::vector<Quaternion> rotations;
+
+		/**
+		 * The local scales of the nodes.
+		 */
+		std::vector<Vector3> scales;
+
+		/**
+		 * Whether each node has changed since the last update. During
+		 * update(), whether each world transform has been recomputed.
+		 */
+		std::vector<std::uint8_t> dirty;
+
+		/**
+		 * The index of the first dirty node, or size() if there is none.
+		 */
+		std::size_t firstDirty;
+
+		/**
+		 * The world transforms of the nodes.
+		 */
+		std::vector<Affine3> worlds;
+	};
+}
+
+#include <M3D/TransformHierarchy.inl>
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef TRANSFORMHIERARCHY_INL
+#define TRANSFORMHIERARCHY_INL
+
+// Inline definitions of the transform hierarchy accessors. This file is
+// included at the end of TransformHierarchy.hpp and should not be included
+// directly.
+
+#include <algorithm>
+#include <cassert>
+
+namespace M3D
+{
+	inline TransformHierarchy::TransformHierarchy()
+	: firstDirty(0)
+	{
+		// Nothing to do.
+	}
+
+	inline std::size_t TransformHierarchy::size() const
+	{
+		return parents.size();
+	}
+
+	inline std::size_t TransformHierarchy::parent(std::size_t node) const
+	{
+		assert(node < size());
+		return parents[node];
+	}
+
+	inline const Vector3& TransformHierarchy::position(std::size_t node) const
+	{
+		assert(node < size());
+		return positions[node];
+	}
+
+	inline const Quaternion& TransformHierarchy::rotation(std::size_t node) const
+	{
+		assert(node < size());
+		return rotations[node];
+	}
+
+	inline const Vector3& TransformHierarchy::scale(std::size_t node) const
+	{
+		assert(node < size());
+		return scales[node];
+	}
+
+	inline void TransformHierarchy::setPosition(std::size_t node, const Vector3& position)
+	{
+		assert(node < size());
+		positions[node] = position;
+		dirty[node] = 1;
+		firstDirty = std::min(firstDirty, node);
+	}
+
+	inline void TransformHierarchy::setRotation(std::size_t node, const Quaternion& rotation)
+	{
+		assert(node < size());
+		rotations[node] = rotation;
+		dirty[node] = 1;
+		firstDirty = std::min(firstDirty, node);
+	}
+
+	inline void TransformHierarchy::setScale(std::size_t node, const Vector3& scale)
+	{
+		assert(node < size());
+		scales[node] = scale;
+		dirty[node] = 1;
+		firstDirty = std::min(firstDirty, node);
+	}
+
+	inline void TransformHierarchy::setLocal(std::size_t node, const Vector3& position, const Quaternion& rotation,
+		const Vector3& scale)
+	{
+		assert(node < size());
+		positions[node] = position;
+		rotations[node] = rotation;
+		scales[node] = scale;
+		dirty[node] = 1;
+		firstDirty = std::min(firstDirty, node);
+	}
+
+	inline bool TransformHierarchy::isDirty(std::size_t node) const
+	{
+		assert(node < size());
+		return dirty[node] != 0;
+	}
+
+	inline const Affine3& TransformHierarchy::world(std::size_t node) const
+	{
+		assert(node < size());
+		return worlds[node];
+	}
+
+	inline Matrix4 TransformHierarchy::worldMatrix(std::size_t node) const
+	{
+		return Matrix4(world(node));
+	}
+}
+
+#endif
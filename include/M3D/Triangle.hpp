@@ -0,0 +1,150 @@
+#ifndef TRIANGLE_HPP
+#define TRIANGLE_HPP
+
+#include <M3D/AABB.hpp>
+#include <M3D/Plane.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <ostream>
+
+namespace M3D
+{
+	/**
+	 * Triangle, stored as its three vertices.
+	 *
+	 * The front face of the triangle is the side from which the vertices
+	 * appear in counter-clockwise order.
+	 */
+	template <typename T>
+	class TTriangle
+	{
+	public:
+		/**
+		 * Scalar type of the coordinates.
+		 */
+		typedef T Scalar;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Constructs the degenerate triangle with all three vertices at the
+		 * origin.
+		 */
+		TTriangle();
+
+		/**
+		 * Constructor.
+		 *
+		 * @param a_ The first vertex.
+		 * @param b_ The second vertex.
+		 * @param c_ The third vertex.
+		 */
+		TTriangle(const TVector3<T>& a_, const TVector3<T>& b_, const TVector3<T>& c_);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its coordinates converted
+		 * to the scalar type of this triangle.
+		 *
+		 * @param other The triangle to convert.
+		 */
+		template <typename U>
+		explicit TTriangle(const TTriangle<U>& other);
+
+		/**
+		 * Equality operator.
+		 *
+		 * @param lhs The first triangle.
+		 * @param rhs The second triangle.
+		 * @return True if the corresponding vertices of the two supplied
+		 * triangles are equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator==(const TTriangle<U>& lhs, const TTriangle<U>& rhs);
+
+		/**
+		 * Non-equality operator.
+		 *
+		 * @param lhs The first triangle.
+		 * @param rhs The second triangle.
+		 * @return True if any of the corresponding vertices of the two
+		 * supplied triangles are not equal. False otherwise.
+		 */
+		template <typename U>
+		friend bool operator!=(const TTriangle<U>& lhs, const TTriangle<U>& rhs);
+
+		/**
+		 * Stream output operator.
+		 *
+		 * @param out Output stream.
+		 * @param triangle Triangle to output.
+		 * @return Output stream.
+		 */
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TTriangle<U>& triangle);
+
+		/**
+		 * Returns the unit normal of the front face.
+		 *
+		 * @note The triangle must not be degenerate.
+		 *
+		 * @return The unit normal.
+		 */
+		TVector3<T> normal() const;
+
+		/**
+		 * Returns the area of the triangle.
+		 *
+		 * @return The area.
+		 */
+		T area() const;
+
+		/**
+		 * Returns the plane containing the triangle, with the normal of the
+		 * front face.
+		 *
+		 * @note The triangle must not be degenerate.
+		 *
+		 * @return The supporting plane.
+		 */
+		TPlane<T> plane() const;
+
+		/**
+		 * Returns the bounding box of the triangle.
+		 *
+		 * @return The smallest axis-aligned box containing the vertices.
+		 */
+		TAABB<T> bounds() const;
+
+	public:
+		/**
+		 * The first vertex.
+		 */
+		TVector3<T> a;
+
+		/**
+		 * The second vertex.
+		 */
+		TVector3<T> b;
+
+		/**
+		 * The third vertex.
+		 */
+		TVector3<T> c;
+	};
+
+	/**
+	 * Single precision triangle.
+	 */
+	typedef TTriangle<float> Triangle;
+
+	/**
+	 * Double precision triangle.
+	 */
+	typedef TTriangle<double> Triangled;
+}
+
+#include <M3D/Triangle.inl>
+
+#endif
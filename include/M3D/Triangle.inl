@@ -0,0 +1,78 @@
+#ifndef TRIANGLE_INL
+#define TRIANGLE_INL
+
+// Inline definitions of the small, frequently called Triangle operations. This
+// file is included at the end of Triangle.hpp and should not be included
+// directly.
+
+namespace M3D
+{
+	template <typename T>
+	inline TTriangle<T>::TTriangle()
+	: a()
+	, b()
+	, c()
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline TTriangle<T>::TTriangle(const TVector3<T>& a_, const TVector3<T>& b_, const TVector3<T>& c_)
+	: a(a_)
+	, b(b_)
+	, c(c_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	inline TTriangle<T>::TTriangle(const TTriangle<U>& other)
+	: a(other.a)
+	, b(other.b)
+	, c(other.c)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TTriangle<T>& lhs, const TTriangle<T>& rhs)
+	{
+		return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TTriangle<T>& lhs, const TTriangle<T>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template <typename T>
+	inline TVector3<T> TTriangle<T>::normal() const
+	{
+		return cross(b - a, c - a).normalized();
+	}
+
+	template <typename T>
+	inline T TTriangle<T>::area() const
+	{
+		return 0.5f * cross(b - a, c - a).magnitude();
+	}
+
+	template <typename T>
+	inline TPlane<T> TTriangle<T>::plane() const
+	{
+		return TPlane<T>(a, b, c);
+	}
+
+	template <typename T>
+	inline TAABB<T> TTriangle<T>::bounds() const
+	{
+		TAABB<T> box(a, a);
+		box.merge(b);
+		box.merge(c);
+		return box;
+	}
+}
+
+#endif
@@ -5,15 +5,21 @@
 
 namespace M3D
 {
-	class Vector2
+	template <typename T>
+	class TVector2
 	{
 	public:
+		/**
+		 * Scalar type of the components.
+		 */
+		typedef T Scalar;
+
 		/**
 		 * Default constructor.
 		 *
 		 * Constructs the zero vector.
 		 */
-		Vector2();
+		constexpr TVector2();
 
 		/**
 		 * Constructor.
@@ -21,7 +27,18 @@ namespace M3D
 		 * @param x_ The first component.
 		 * @param y_ The second component.
 		 */
-		Vector2(float x_, float y_);
+		constexpr TVector2(T x_, T y_);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its components converted to the
+		 * scalar type of this vector.
+		 *
+		 * @param other The vector to convert.
+		 */
+		template <typename U>
+		explicit constexpr TVector2(const TVector2<U>& other);
 
 		/**
 		 * Vector equality operator.
@@ -30,7 +47,8 @@ namespace M3D
 		 * @param v2 The second vector.
 		 * @return True if the two supplied vectors are equal. False otherwise.
 		 */
-		friend float operator==(const Vector2& v1, const Vector2& v2);
+		template <typename U>
+		friend bool operator==(const TVector2<U>& v1, const TVector2<U>& v2);
 
 		/**
 		 * Vector non-equality operator.
@@ -40,7 +58,8 @@ namespace M3D
 		 * @return True if the two supplied vectors are not equal. False
 		 * otherwise.
 		 */
-		friend float operator!=(const Vector2& v1, const Vector2& v2);
+		template <typename U>
+		friend bool operator!=(const TVector2<U>& v1, const TVector2<U>& v2);
 
 		/**
 		 * Vector addition operator.
@@ -49,7 +68,8 @@ namespace M3D
 		 * @param v2 Second vector.
 		 * @return Result of adding the first vector to the second vector.
 		 */
-		friend Vector2 operator+(const Vector2& v1, const Vector2& v2);
+		template <typename U>
+		friend constexpr TVector2<U> operator+(const TVector2<U>& v1, const TVector2<U>& v2);
 
 		/**
 		 * Vector subtraction operator.
@@ -59,7 +79,8 @@ namespace M3D
 		 * @return Result of subtracting the second vector from the first
 		 * vector.
 		 */
-		friend Vector2 operator-(const Vector2& v1, const Vector2& v2);
+		template <typename U>
+		friend constexpr TVector2<U> operator-(const TVector2<U>& v1, const TVector2<U>& v2);
 
 		/**
 		 * Vector negation operator.
@@ -67,7 +88,8 @@ namespace M3D
 		 * @param v The vector to negate.
 		 * @return The additive inverse of the vector `v`.
 		 */
-		friend Vector2 operator-(const Vector2 &v);
+		template <typename U>
+		friend constexpr TVector2<U> operator-(const TVector2<U> &v);
 
 		/**
 		 * Scalar multiplication operator.
@@ -76,7 +98,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Vector `v` scaled by `s`.
 		 */
-		friend Vector2 operator*(const Vector2& v, const float s);
+		template <typename U>
+		friend constexpr TVector2<U> operator*(const TVector2<U>& v, const typename TVector2<U>::Scalar s);
 
 		/**
 		 * Scalar multiplication operator.
@@ -85,7 +108,8 @@ namespace M3D
 		 * @param v The vector.
 		 * @return Vector `v` scaled by `s`.
 		 */
-		friend Vector2 operator*(const float s, const Vector2& v);
+		template <typename U>
+		friend constexpr TVector2<U> operator*(const typename TVector2<U>::Scalar s, const TVector2<U>& v);
 
 		/**
 		 * Scalar division operator.
@@ -94,7 +118,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Vector `v` scaled by the reciprocal of `s`.
 		 */
-		friend Vector2 operator/(const Vector2& v, const float s);
+		template <typename U>
+		friend constexpr TVector2<U> operator/(const TVector2<U>& v, const typename TVector2<U>::Scalar s);
 
 		/**
 		 * Stream output operator.
@@ -103,14 +128,15 @@ namespace M3D
 		 * @param v Vector to output.
 		 * @return Output stream.
 		 */
-		friend std::ostream& operator <<(std::ostream& out, const Vector2& v);
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TVector2<U>& v);
 
 		/**
 		 * Returns the squared length of the vector.
 		 *
 		 * @return Squared length of the vector.
 		 */
-		float sqrMagnitude() const;
+		constexpr T sqrMagnitude() const;
 
 		/**
 		 * Returns the length of the vector.
@@ -120,7 +146,7 @@ namespace M3D
 		 *
 		 * @return Length of the vector.
 		 */
-		float magnitude() const;
+		T magnitude() const;
 
 		/**
 		 * Returns a copy of this vector that points in the same direction, but
@@ -128,7 +154,7 @@ namespace M3D
 		 *
 		 * @return This vector with a magnitude of 1.
 		 */
-		Vector2 normalized() const;
+		TVector2 normalized() const;
 
 		/**
 		 * Normalizes the vector so that it points in the same direction but
@@ -140,47 +166,47 @@ namespace M3D
 		/**
 		 * First component.
 		 */
-		float x;
+		T x;
 
 		/**
 		 * Second component.
 		 */
-		float y;
+		T y;
 
 	public:
 		/**
 		 * Vector representing the up direction.
 		 * This is shorthand for writing Vector2(0.0f, 1.0f).
 		 */
-		static const Vector2 UP;
+		static const TVector2 UP;
 
 		/**
 		 * Vector representing the down direction.
 		 * This is shorthand for writing Vector2(0.0f, -1.0f).
 		 */
-		static const Vector2 DOWN;
+		static const TVector2 DOWN;
 
 		/**
 		 * Vector representing the right direction.
 		 * This is shorthand for writing Vector2(1.0f, 0.0f).
 		 */
-		static const Vector2 RIGHT;
+		static const TVector2 RIGHT;
 
 		/**
 		 * Vector representing the left direction.
 		 * This is shorthand for writing Vector2(-1.0f, 0.0f).
 		 */
-		static const Vector2 LEFT;
+		static const TVector2 LEFT;
 
 		/**
 		 * Shorthand for writing Vector3(1.0f, 1.0f).
 		 */
-		static const Vector2 ONE;
+		static const TVector2 ONE;
 
 		/**
 		 * Shorthand for writing Vector3(0.0f, 0.0f).
 		 */
-		static const Vector2 ZERO;
+		static const TVector2 ZERO;
 	};
 
 	/**
@@ -191,7 +217,8 @@ namespace M3D
 	 * @param v2 The right hand side vector.
 	 * @return Result of scaling the first vector by the second vector.
 	 */
-	Vector2 scale(const Vector2& v1, const Vector2& v2);
+	template <typename T>
+	constexpr TVector2<T> scale(const TVector2<T>& v1, const TVector2<T>& v2);
 
 	/**
 	 * Returns the dot product of two vectors.
@@ -205,7 +232,8 @@ namespace M3D
 	 * @param rhs The right hand side vector.
 	 * @return Dot product of the two vectors.
 	 */
-	float dot(const Vector2& lhs, const Vector2& rhs);
+	template <typename T>
+	constexpr T dot(const TVector2<T>& lhs, const TVector2<T>& rhs);
 
 	/**
 	 * Returns the smallest angle in radians between `from` and `to`.
@@ -214,7 +242,8 @@ namespace M3D
 	 * @param to The angle extends round to this vector.
 	 * @return Angle in radians.
 	 */
-	float angle(const Vector2& from, const Vector2& to);
+	template <typename T>
+	T angle(const TVector2<T>& from, const TVector2<T>& to);
 
 	/**
 	 * Returns the square distance between vectors `p1` and `p2`.
@@ -226,7 +255,8 @@ namespace M3D
 	 * @param p2 The vector representing the second point.
 	 * @return Square of the distance between the two points.
 	 */
-	float sqrDistance(const Vector2& p1, const Vector2& p2);
+	template <typename T>
+	constexpr T sqrDistance(const TVector2<T>& p1, const TVector2<T>& p2);
 
 	/**
 	 * Returns the distance between vectors `p1` and `p2`.
@@ -238,7 +268,20 @@ namespace M3D
 	 * @param p2 The vector representing the second point.
 	 * @return Distance between the two points.
 	 */
-	float distance(const Vector2& p1, const Vector2& p2);
+	template <typename T>
+	T distance(const TVector2<T>& p1, const TVector2<T>& p2);
+
+	/**
+	 * Single precision 2D vector.
+	 */
+	typedef TVector2<float> Vector2;
+
+	/**
+	 * Double precision 2D vector.
+	 */
+	typedef TVector2<double> Vector2d;
 }
 
+#include <M3D/Vector2.inl>
+
 #endif
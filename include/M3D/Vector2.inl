@@ -0,0 +1,159 @@
+#ifndef VECTOR2_INL
+#define VECTOR2_INL
+
+// Inline definitions of the small, frequently called Vector2 operations. This
+// file is included at the end of Vector2.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TVector2<T>::TVector2()
+	: x(0.0f)
+	, y(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TVector2<T>::TVector2(T x_, T y_)
+	: x(x_)
+	, y(y_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TVector2<T>::TVector2(const TVector2<U>& other)
+	: x(static_cast<T>(other.x))
+	, y(static_cast<T>(other.y))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TVector2<T>& v1, const TVector2<T>& v2)
+	{
+		const T epsilon = 1e-6;
+		return std::abs(v1.x - v2.x) < epsilon && std::abs(v1.y - v2.y) < epsilon;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TVector2<T>& v1, const TVector2<T>& v2)
+	{
+		return !(v1 == v2);
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator+(const TVector2<T>& v1, const TVector2<T>& v2)
+	{
+		return TVector2<T>(v1.x + v2.x, v1.y + v2.y);
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator-(const TVector2<T>& v1, const TVector2<T>& v2)
+	{
+		return TVector2<T>(v1.x - v2.x, v1.y - v2.y);
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator-(const TVector2<T>& v)
+	{
+		return TVector2<T>(-v.x, -v.y);
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator*(const TVector2<T>& v, const typename TVector2<T>::Scalar s)
+	{
+		return TVector2<T>(v.x * s, v.y * s);
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator*(const typename TVector2<T>::Scalar s, const TVector2<T>& v)
+	{
+		return v * s;
+	}
+
+	template <typename T>
+	constexpr TVector2<T> operator/(const TVector2<T>& v, const typename TVector2<T>::Scalar s)
+	{
+		assert(s != 0.0f);
+		return v * (1.0f / s);
+	}
+
+	template <typename T>
+	constexpr T TVector2<T>::sqrMagnitude() const
+	{
+		// Take the dot product of this vector with itself.
+		return dot(*this, *this);
+	}
+
+	template <typename T>
+	inline T TVector2<T>::magnitude() const
+	{
+		return std::sqrt(sqrMagnitude());
+	}
+
+	template <typename T>
+	inline TVector2<T> TVector2<T>::normalized() const
+	{
+		const T sqrLength = sqrMagnitude();
+		assert(sqrLength != 0.0f);
+		const T invLength = 1.0f / std::sqrt(sqrLength);
+		return *this * invLength;
+	}
+
+	template <typename T>
+	inline void TVector2<T>::normalize()
+	{
+		const T sqrLength = sqrMagnitude();
+		assert(sqrLength != 0.0f);
+		const T invLength = 1.0f / std::sqrt(sqrLength);
+
+		x *= invLength;
+		y *= invLength;
+	}
+
+	template <typename T>
+	constexpr TVector2<T> scale(const TVector2<T>& v1, const TVector2<T>& v2)
+	{
+		return TVector2<T>(v1.x * v2.x, v1.y * v2.y);
+	}
+
+	template <typename T>
+	constexpr T dot(const TVector2<T>& lhs, const TVector2<T>& rhs)
+	{
+		return lhs.x * rhs.x + lhs.y * rhs.y;
+	}
+
+	template <typename T>
+	constexpr T sqrDistance(const TVector2<T>& p1, const TVector2<T>& p2)
+	{
+		return (p1 - p2).sqrMagnitude();
+	}
+
+	template <typename T>
+	inline T distance(const TVector2<T>& p1, const TVector2<T>& p2)
+	{
+		return (p1 - p2).magnitude();
+	}
+
+	template <typename T>
+	constexpr TVector2<T> TVector2<T>::UP		= TVector2<T>(0.0f, 1.0f);
+	template <typename T>
+	constexpr TVector2<T> TVector2<T>::DOWN		= TVector2<T>(0.0f, -1.0f);
+	template <typename T>
+	constexpr TVector2<T> TVector2<T>::RIGHT	= TVector2<T>(1.0f, 0.0f);
+	template <typename T>
+	constexpr TVector2<T> TVector2<T>::LEFT		= TVector2<T>(-1.0f, 0.0f);
+	template <typename T>
+	constexpr TVector2<T> TVector2<T>::ONE		= TVector2<T>(1.0f, 1.0f);
+	template <typename T>
+	constexpr TVector2<T> TVector2<T>::ZERO		= TVector2<T>(0.0f, 0.0f);
+}
+
+#endif
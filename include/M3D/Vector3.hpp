@@ -5,17 +5,24 @@
 
 namespace M3D
 {
-	class Vector4;
+	template <typename T>
+	class TVector4;
 
-	class Vector3
+	template <typename T>
+	class TVector3
 	{
 	public:
+		/**
+		 * Scalar type of the components.
+		 */
+		typedef T Scalar;
+
 		/**
 		 * Default constructor.
 		 *
 		 * Constructs the zero vector.
 		 */
-		Vector3();
+		constexpr TVector3();
 
 		/**
 		 * Constructor.
@@ -24,7 +31,7 @@ namespace M3D
 		 * @param y_ The second component.
 		 * @param z_ The third component.
 		 */
-		Vector3(float x_, float y_, float z_);
+		constexpr TVector3(T x_, T y_, T z_);
 
 		/**
 		 * Constructor.
@@ -34,7 +41,18 @@ namespace M3D
 		 *
 		 * @param v Vector4 from which to construct the vector.
 		 */
-		Vector3(const Vector4& v);
+		constexpr TVector3(const TVector4<T>& v);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its components converted to the
+		 * scalar type of this vector.
+		 *
+		 * @param other The vector to convert.
+		 */
+		template <typename U>
+		explicit constexpr TVector3(const TVector3<U>& other);
 
 		/**
 		 * Vector equality operator.
@@ -43,7 +61,8 @@ namespace M3D
 		 * @param v2 The second vector.
 		 * @return True if the two supplied vectors are equal. False otherwise.
 		 */
-		friend float operator==(const Vector3& v1, const Vector3& v2);
+		template <typename U>
+		friend bool operator==(const TVector3<U>& v1, const TVector3<U>& v2);
 
 		/**
 		 * Vector non-equality operator.
@@ -53,7 +72,8 @@ namespace M3D
 		 * @return True if the two supplied vectors are not equal. False
 		 * otherwise.
 		 */
-		friend float operator!=(const Vector3& v1, const Vector3& v2);
+		template <typename U>
+		friend bool operator!=(const TVector3<U>& v1, const TVector3<U>& v2);
 
 		/**
 		 * Vector addition operator.
@@ -62,7 +82,8 @@ namespace M3D
 		 * @param v2 Second vector.
 		 * @return Result of adding the first vector to the second vector.
 		 */
-		friend Vector3 operator+(const Vector3& v1, const Vector3& v2);
+		template <typename U>
+		friend constexpr TVector3<U> operator+(const TVector3<U>& v1, const TVector3<U>& v2);
 
 		/**
 		 * Vector addition and assignment operator.
@@ -71,7 +92,8 @@ namespace M3D
 		 * @param v2 Second vector.
 		 * @return Adds the second vector to the first vector.
 		 */
-		friend Vector3& operator+=(Vector3& v1, const Vector3& v2);
+		template <typename U>
+		friend constexpr TVector3<U>& operator+=(TVector3<U>& v1, const TVector3<U>& v2);
 
 		/**
 		 * Vector subtraction operator.
@@ -81,7 +103,8 @@ namespace M3D
 		 * @return Result of subtracting the second vector from the first
 		 * vector.
 		 */
-		friend Vector3 operator-(const Vector3& v1, const Vector3& v2);
+		template <typename U>
+		friend constexpr TVector3<U> operator-(const TVector3<U>& v1, const TVector3<U>& v2);
 
 		/**
 		 * Vector subtraction and assignment operator.
@@ -90,7 +113,8 @@ namespace M3D
 		 * @param v2 Second vector.
 		 * @return Subtracts the second vector from the first vector.
 		 */
-		friend Vector3& operator-=(Vector3& v1, const Vector3& v2);
+		template <typename U>
+		friend constexpr TVector3<U>& operator-=(TVector3<U>& v1, const TVector3<U>& v2);
 
 		/**
 		 * Vector negation operator.
@@ -98,7 +122,8 @@ namespace M3D
 		 * @param v The vector to negate.
 		 * @return The additive inverse of the vector `v`.
 		 */
-		friend Vector3 operator-(const Vector3 &v);
+		template <typename U>
+		friend constexpr TVector3<U> operator-(const TVector3<U> &v);
 
 		/**
 		 * Scalar multiplication operator.
@@ -107,7 +132,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Vector `v` scaled by `s`.
 		 */
-		friend Vector3 operator*(const Vector3& v, const float s);
+		template <typename U>
+		friend constexpr TVector3<U> operator*(const TVector3<U>& v, const typename TVector3<U>::Scalar s);
 
 		/**
 		 * Scalar multiplication and assignment operator.
@@ -116,7 +142,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Scales vector `v` by `s`.
 		 */
-		friend Vector3& operator*=(Vector3& v, const float s);
+		template <typename U>
+		friend constexpr TVector3<U>& operator*=(TVector3<U>& v, const typename TVector3<U>::Scalar s);
 
 		/**
 		 * Scalar multiplication operator.
@@ -125,7 +152,8 @@ namespace M3D
 		 * @param v The vector.
 		 * @return Vector `v` scaled by `s`.
 		 */
-		friend Vector3 operator*(const float s, const Vector3& v);
+		template <typename U>
+		friend constexpr TVector3<U> operator*(const typename TVector3<U>::Scalar s, const TVector3<U>& v);
 
 		/**
 		 * Scalar division operator.
@@ -134,7 +162,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Vector `v` scaled by the reciprocal of `s`.
 		 */
-		friend Vector3 operator/(const Vector3& v, const float s);
+		template <typename U>
+		friend constexpr TVector3<U> operator/(const TVector3<U>& v, const typename TVector3<U>::Scalar s);
 
 		/**
 		 * Scalar division and assignment operator.
@@ -143,7 +172,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Scales vector `v` by the reciprocal `s`.
 		 */
-		friend Vector3& operator/=(Vector3& v, const float s);
+		template <typename U>
+		friend constexpr TVector3<U>& operator/=(TVector3<U>& v, const typename TVector3<U>::Scalar s);
 
 		/**
 		 * Stream output operator.
@@ -152,14 +182,15 @@ namespace M3D
 		 * @param v Vector to output.
 		 * @return Output stream.
 		 */
-		friend std::ostream& operator <<(std::ostream& out, const Vector3& v);
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TVector3<U>& v);
 
 		/**
 		 * Returns the squared length of the vector.
 		 *
 		 * @return Squared length of the vector.
 		 */
-		float sqrMagnitude() const;
+		constexpr T sqrMagnitude() const;
 
 		/**
 		 * Returns the length of the vector.
@@ -169,7 +200,7 @@ namespace M3D
 		 *
 		 * @return Length of the vector.
 		 */
-		float magnitude() const;
+		T magnitude() const;
 
 		/**
 		 * Returns a copy of this vector that points in the same direction, but
@@ -177,7 +208,7 @@ namespace M3D
 		 *
 		 * @return This vector with a magnitude of 1.
 		 */
-		Vector3 normalized() const;
+		TVector3 normalized() const;
 
 		/**
 		 * Normalizes the vector so that it points in the same direction but
@@ -189,64 +220,64 @@ namespace M3D
 		/**
 		 * First component.
 		 */
-		float x;
+		T x;
 
 		/**
 		 * Second component.
 		 */
-		float y;
+		T y;
 
 		/**
 		 * Third component.
 		 */
-		float z;
+		T z;
 
 	public:
 		/**
 		 * Vector representing the forward direction.
 		 * This is shorthand for writing Vector3(0.0f, 0.0f, 1.0f).
 		 */
-		static const Vector3 FORWARD;
+		static const TVector3 FORWARD;
 
 		/**
 		 * Vector representing the back direction.
 		 * This is shorthand for writing Vector3(0.0f, 0.0f, -1.0f).
 		 */
-		static const Vector3 BACK;
+		static const TVector3 BACK;
 
 		/**
 		 * Vector representing the up direction.
 		 * This is shorthand for writing Vector3(0.0f, 1.0f, 0.0f).
 		 */
-		static const Vector3 UP;
+		static const TVector3 UP;
 
 		/**
 		 * Vector representing the down direction.
 		 * This is shorthand for writing Vector3(0.0f, -1.0f, 0.0f).
 		 */
-		static const Vector3 DOWN;
+		static const TVector3 DOWN;
 
 		/**
 		 * Vector representing the right direction.
 		 * This is shorthand for writing Vector3(1.0f, 0.0f, 0.0f).
 		 */
-		static const Vector3 RIGHT;
+		static const TVector3 RIGHT;
 
 		/**
 		 * Vector representing the left direction.
 		 * This is shorthand for writing Vector3(-1.0f, 0.0f, 0.0f).
 		 */
-		static const Vector3 LEFT;
+		static const TVector3 LEFT;
 
 		/**
 		 * Shorthand for writing Vector3(1.0f, 1.0f, 1.0f).
 		 */
-		static const Vector3 ONE;
+		static const TVector3 ONE;
 
 		/**
 		 * Shorthand for writing Vector3(0.0f, 0.0f, 0.0f).
 		 */
-		static const Vector3 ZERO;
+		static const TVector3 ZERO;
 	};
 
 	/**
@@ -257,7 +288,8 @@ namespace M3D
 	 * @param v2 The right hand side vector.
 	 * @return Result of scaling the first vector by the second vector.
 	 */
-	Vector3 scale(const Vector3& v1, const Vector3& v2);
+	template <typename T>
+	constexpr TVector3<T> scale(const TVector3<T>& v1, const TVector3<T>& v2);
 
 	/**
 	 * Returns the dot product of two vectors.
@@ -271,7 +303,8 @@ namespace M3D
 	 * @param rhs The right hand side vector.
 	 * @return Dot product of the two vectors.
 	 */
-	float dot(const Vector3& lhs, const Vector3& rhs);
+	template <typename T>
+	constexpr T dot(const TVector3<T>& lhs, const TVector3<T>& rhs);
 
 	/**
 	 * Returns the cross product (sometimes called the vector product) of two
@@ -290,7 +323,8 @@ namespace M3D
 	 * @param rhs The right hand side vector.
 	 * @return Returns the cross product `lhs` x `rhs`.
 	 */
-	Vector3 cross(const Vector3& lhs, const Vector3& rhs);
+	template <typename T>
+	constexpr TVector3<T> cross(const TVector3<T>& lhs, const TVector3<T>& rhs);
 
 	/**
 	 * Linearly interpolates between `from` and `to` by the fraction `factor`.
@@ -301,7 +335,8 @@ namespace M3D
 	 * @return Interpolated vector that is `factor` distance between `to` and
 	 * `from`.
 	 */
-	Vector3 lerp(const Vector3& from, const Vector3& to, float factor);
+	template <typename T>
+	constexpr TVector3<T> lerp(const TVector3<T>& from, const TVector3<T>& to, typename TVector3<T>::Scalar factor);
 
 	/**
 	 * Returns the smallest angle in radians between `from` and `to`.
@@ -310,7 +345,8 @@ namespace M3D
 	 * @param to The angle extends round to this vector.
 	 * @return Angle in radians.
 	 */
-	float angle(const Vector3& from, const Vector3& to);
+	template <typename T>
+	T angle(const TVector3<T>& from, const TVector3<T>& to);
 
 	/**
 	 * Returns the square distance between vectors `p1` and `p2`.
@@ -322,7 +358,8 @@ namespace M3D
 	 * @param p2 The vector representing the second point.
 	 * @return Square of the distance between the two points.
 	 */
-	float sqrDistance(const Vector3& p1, const Vector3& p2);
+	template <typename T>
+	constexpr T sqrDistance(const TVector3<T>& p1, const TVector3<T>& p2);
 
 	/**
 	 * Returns the distance between vectors `p1` and `p2`.
@@ -334,7 +371,20 @@ namespace M3D
 	 * @param p2 The vector representing the second point.
 	 * @return Distance between the two points.
 	 */
-	float distance(const Vector3& p1, const Vector3& p2);
+	template <typename T>
+	T distance(const TVector3<T>& p1, const TVector3<T>& p2);
+
+	/**
+	 * Single precision 3D vector.
+	 */
+	typedef TVector3<float> Vector3;
+
+	/**
+	 * Double precision 3D vector.
+	 */
+	typedef TVector3<double> Vector3d;
 }
 
+#include <M3D/Vector3.inl>
+
 #endif
@@ -0,0 +1,234 @@
+#ifndef VECTOR3_INL
+#define VECTOR3_INL
+
+// Inline definitions of the small, frequently called Vector3 operations. This
+// file is included at the end of Vector3.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TVector3<T>::TVector3()
+	: x(0.0f)
+	, y(0.0f)
+	, z(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TVector3<T>::TVector3(T x_, T y_, T z_)
+	: x(x_)
+	, y(y_)
+	, z(z_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TVector3<T>::TVector3(const TVector4<T>& v)
+	: x(v.x)
+	, y(v.y)
+	, z(v.z)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TVector3<T>::TVector3(const TVector3<U>& other)
+	: x(static_cast<T>(other.x))
+	, y(static_cast<T>(other.y))
+	, z(static_cast<T>(other.z))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TVector3<T>& v1, const TVector3<T>& v2)
+	{
+		const T epsilon = 1e-6;
+		return std::abs(v1.x - v2.x) < epsilon && std::abs(v1.y - v2.y) < epsilon
+			&& std::abs(v1.z - v2.z) < epsilon;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TVector3<T>& v1, const TVector3<T>& v2)
+	{
+		return !(v1 == v2);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator+(const TVector3<T>& v1, const TVector3<T>& v2)
+	{
+		return TVector3<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
+	}
+
+	template <typename T>
+	constexpr TVector3<T>& operator+=(TVector3<T>& v1, const TVector3<T>& v2)
+	{
+		v1.x += v2.x;
+		v1.y += v2.y;
+		v1.z += v2.z;
+
+		return v1;
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator-(const TVector3<T>& v1, const TVector3<T>& v2)
+	{
+		return TVector3<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z);
+	}
+
+	template <typename T>
+	constexpr TVector3<T>& operator-=(TVector3<T>& v1, const TVector3<T>& v2)
+	{
+		v1.x -= v2.x;
+		v1.y -= v2.y;
+		v1.z -= v2.z;
+
+		return v1;
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator-(const TVector3<T>& v)
+	{
+		return TVector3<T>(-v.x, -v.y, -v.z);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator*(const TVector3<T>& v, const typename TVector3<T>::Scalar s)
+	{
+		return TVector3<T>(v.x * s, v.y * s, v.z * s);
+	}
+
+	template <typename T>
+	constexpr TVector3<T>& operator*=(TVector3<T>& v, const typename TVector3<T>::Scalar s)
+	{
+		v.x *= s;
+		v.y *= s;
+		v.z *= s;
+
+		return v;
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator*(const typename TVector3<T>::Scalar s, const TVector3<T>& v)
+	{
+		return v * s;
+	}
+
+	template <typename T>
+	constexpr TVector3<T> operator/(const TVector3<T>& v, const typename TVector3<T>::Scalar s)
+	{
+		assert(s != 0.0f);
+		return v * (1.0f / s);
+	}
+
+	template <typename T>
+	constexpr TVector3<T>& operator/=(TVector3<T>& v, const typename TVector3<T>::Scalar s)
+	{
+		assert(s != 0.0f);
+		v.x /= s;
+		v.y /= s;
+		v.z /= s;
+
+		return v;
+	}
+
+	template <typename T>
+	constexpr T TVector3<T>::sqrMagnitude() const
+	{
+		// Take the dot product of this vector with itself.
+		return dot(*this, *this);
+	}
+
+	template <typename T>
+	inline T TVector3<T>::magnitude() const
+	{
+		return std::sqrt(sqrMagnitude());
+	}
+
+	template <typename T>
+	inline TVector3<T> TVector3<T>::normalized() const
+	{
+		const T sqrLength = sqrMagnitude();
+		assert(sqrLength != 0.0f);
+		const T invLength = 1.0f / std::sqrt(sqrLength);
+		return *this * invLength;
+	}
+
+	template <typename T>
+	inline void TVector3<T>::normalize()
+	{
+		const T sqrLength = sqrMagnitude();
+		assert(sqrLength != 0.0f);
+		const T invLength = 1.0f / std::sqrt(sqrLength);
+
+		x *= invLength;
+		y *= invLength;
+		z *= invLength;
+	}
+
+	template <typename T>
+	constexpr TVector3<T> scale(const TVector3<T>& v1, const TVector3<T>& v2)
+	{
+		return TVector3<T>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+	}
+
+	template <typename T>
+	constexpr T dot(const TVector3<T>& lhs, const TVector3<T>& rhs)
+	{
+		return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+	}
+
+	template <typename T>
+	constexpr TVector3<T> cross(const TVector3<T>& lhs, const TVector3<T>& rhs)
+	{
+		return TVector3<T>(
+			lhs.y * rhs.z - lhs.z * rhs.y,
+			lhs.z * rhs.x - lhs.x * rhs.z,
+			lhs.x * rhs.y - lhs.y * rhs.x
+		);
+	}
+
+	template <typename T>
+	constexpr TVector3<T> lerp(const TVector3<T>& from, const TVector3<T>& to, typename TVector3<T>::Scalar factor)
+	{
+		return from * (1.0f - factor) + to * factor;
+	}
+
+	template <typename T>
+	constexpr T sqrDistance(const TVector3<T>& p1, const TVector3<T>& p2)
+	{
+		return (p1 - p2).sqrMagnitude();
+	}
+
+	template <typename T>
+	inline T distance(const TVector3<T>& p1, const TVector3<T>& p2)
+	{
+		return (p1 - p2).magnitude();
+	}
+
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::FORWARD	= TVector3<T>(0.0f, 0.0f, 1.0f);
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::BACK		= TVector3<T>(0.0f, 0.0f, -1.0f);
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::UP		= TVector3<T>(0.0f, 1.0f, 0.0f);
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::DOWN		= TVector3<T>(0.0f, -1.0f, 0.0f);
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::RIGHT	= TVector3<T>(1.0f, 0.0f, 0.0f);
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::LEFT		= TVector3<T>(-1.0f, 0.0f, 0.0f);
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::ONE		= TVector3<T>(1.0f, 1.0f, 1.0f);
+	template <typename T>
+	constexpr TVector3<T> TVector3<T>::ZERO		= TVector3<T>(0.0f, 0.0f, 0.0f);
+}
+
+#endif
@@ -7,15 +7,21 @@
 
 namespace M3D
 {
-	class Vector4
+	template <typename T>
+	class TVector4
 	{
 	public:
+		/**
+		 * Scalar type of the components.
+		 */
+		typedef T Scalar;
+
 		/**
 		 * Default constructor.
 		 *
 		 * Constructs the zero vector.
 		 */
-		Vector4();
+		constexpr TVector4();
 
 		/**
 		 * Constructor.
@@ -25,7 +31,7 @@ namespace M3D
 		 * @param z_ The third component.
 		 * @param w_ The fourth component.
 		 */
-		Vector4(float x_, float y_, float z_, float w_);
+		constexpr TVector4(T x_, T y_, T z_, T w_);
 
 		/**
 		 * Constructor.
@@ -33,7 +39,7 @@ namespace M3D
 		 * Constructs a 4D vector from a 3D vector by setting the fourth
 		 * component equal to zero.
 		 */
-		Vector4(const Vector3& v);
+		constexpr TVector4(const TVector3<T>& v);
 
 		/**
 		 * Constructor.
@@ -41,7 +47,18 @@ namespace M3D
 		 * Constructs a 4D vector from a 3D vector and specified fourth
 		 * component value.
 		 */
-		Vector4(const Vector3& v, float w_);
+		constexpr TVector4(const TVector3<T>& v, T w_);
+
+		/**
+		 * Converting constructor.
+		 *
+		 * Constructs a copy of `other` with each of its components converted to the
+		 * scalar type of this vector.
+		 *
+		 * @param other The vector to convert.
+		 */
+		template <typename U>
+		explicit constexpr TVector4(const TVector4<U>& other);
 
 		/**
 		 * Vector equality operator.
@@ -50,7 +67,8 @@ namespace M3D
 		 * @param v2 The second vector.
 		 * @return True if the two supplied vectors are equal. False otherwise.
 		 */
-		friend float operator==(const Vector4& v1, const Vector4& v2);
+		template <typename U>
+		friend bool operator==(const TVector4<U>& v1, const TVector4<U>& v2);
 
 		/**
 		 * Vector non-equality operator.
@@ -60,7 +78,8 @@ namespace M3D
 		 * @return True if the two supplied vectors are not equal. False
 		 * otherwise.
 		 */
-		friend float operator!=(const Vector4& v1, const Vector4& v2);
+		template <typename U>
+		friend bool operator!=(const TVector4<U>& v1, const TVector4<U>& v2);
 
 		/**
 		 * Vector addition operator.
@@ -69,7 +88,8 @@ namespace M3D
 		 * @param v2 Second vector.
 		 * @return Result of adding the first vector to the second vector.
 		 */
-		friend Vector4 operator+(const Vector4& v1, const Vector4& v2);
+		template <typename U>
+		friend constexpr TVector4<U> operator+(const TVector4<U>& v1, const TVector4<U>& v2);
 
 		/**
 		 * Vector subtraction operator.
@@ -79,7 +99,8 @@ namespace M3D
 		 * @return Result of subtracting the second vector from the first
 		 * vector.
 		 */
-		friend Vector4 operator-(const Vector4& v1, const Vector4& v2);
+		template <typename U>
+		friend constexpr TVector4<U> operator-(const TVector4<U>& v1, const TVector4<U>& v2);
 
 		/**
 		 * Vector negation operator.
@@ -87,7 +108,8 @@ namespace M3D
 		 * @param v The vector to negate.
 		 * @return The additive inverse of the vector `v`.
 		 */
-		friend Vector4 operator-(const Vector4 &v);
+		template <typename U>
+		friend constexpr TVector4<U> operator-(const TVector4<U> &v);
 
 		/**
 		 * Scalar multiplication operator.
@@ -96,7 +118,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Vector `v` scaled by `s`.
 		 */
-		friend Vector4 operator*(const Vector4& v, const float s);
+		template <typename U>
+		friend constexpr TVector4<U> operator*(const TVector4<U>& v, const typename TVector4<U>::Scalar s);
 
 		/**
 		 * Scalar multiplication operator.
@@ -105,7 +128,8 @@ namespace M3D
 		 * @param v The vector.
 		 * @return Vector `v` scaled by `s`.
 		 */
-		friend Vector4 operator*(const float s, const Vector4& v);
+		template <typename U>
+		friend constexpr TVector4<U> operator*(const typename TVector4<U>::Scalar s, const TVector4<U>& v);
 
 		/**
 		 * Scalar division operator.
@@ -114,7 +138,8 @@ namespace M3D
 		 * @param s The scalar value.
 		 * @return Vector `v` scaled by the reciprocal of `s`.
 		 */
-		friend Vector4 operator/(const Vector4& v, const float s);
+		template <typename U>
+		friend constexpr TVector4<U> operator/(const TVector4<U>& v, const typename TVector4<U>::Scalar s);
 
 		/**
 		 * Stream output operator.
@@ -123,14 +148,15 @@ namespace M3D
 		 * @param v Vector to output.
 		 * @return Output stream.
 		 */
-		friend std::ostream& operator <<(std::ostream& out, const Vector4& v);
+		template <typename U>
+		friend std::ostream& operator <<(std::ostream& out, const TVector4<U>& v);
 
 		/**
 		 * Returns the squared length of the vector.
 		 *
 		 * @return Squared length of the vector.
 		 */
-		float sqrMagnitude() const;
+		constexpr T sqrMagnitude() const;
 
 		/**
 		 * Returns the length of the vector.
@@ -140,7 +166,7 @@ namespace M3D
 		 *
 		 * @return Length of the vector.
 		 */
-		float magnitude() const;
+		T magnitude() const;
 
 		/**
 		 * Returns a copy of this vector that points in the same direction, but
@@ -148,7 +174,7 @@ namespace M3D
 		 *
 		 * @return This vector with a magnitude of 1.
 		 */
-		Vector4 normalized() const;
+		TVector4 normalized() const;
 
 		/**
 		 * Normalizes the vector so that it points in the same direction but
@@ -160,69 +186,69 @@ namespace M3D
 		/**
 		 * First component.
 		 */
-		float x;
+		T x;
 
 		/**
 		 * Second component.
 		 */
-		float y;
+		T y;
 
 		/**
 		 * Third component.
 		 */
-		float z;
+		T z;
 
 		/**
 		 * Fourth component.
 		 */
-		float w;
+		T w;
 
 	public:
 		/**
 		 * Vector representing the forward direction.
 		 * This is shorthand for writing Vector4(0.0f, 0.0f, 1.0f, 0.0f).
 		 */
-		static const Vector4 FORWARD;
+		static const TVector4 FORWARD;
 
 		/**
 		 * Vector representing the back direction.
 		 * This is shorthand for writing Vector4(0.0f, 0.0f, -1.0f, 0.0f).
 		 */
-		static const Vector4 BACK;
+		static const TVector4 BACK;
 
 		/**
 		 * Vector representing the up direction.
 		 * This is shorthand for writing Vector4(0.0f, 1.0f, 0.0f, 0.0f).
 		 */
-		static const Vector4 UP;
+		static const TVector4 UP;
 
 		/**
 		 * Vector representing the down direction.
 		 * This is shorthand for writing Vector4(0.0f, -1.0f, 0.0f, 0.0f).
 		 */
-		static const Vector4 DOWN;
+		static const TVector4 DOWN;
 
 		/**
 		 * Vector representing the right direction.
 		 * This is shorthand for writing Vector4(1.0f, 0.0f, 0.0f, 0.0f).
 		 */
-		static const Vector4 RIGHT;
+		static const TVector4 RIGHT;
 
 		/**
 		 * Vector representing the left direction.
 		 * This is shorthand for writing Vector4(-1.0f, 0.0f, 0.0f, 0.0f).
 		 */
-		static const Vector4 LEFT;
+		static const TVector4 LEFT;
 
 		/**
 		 * Shorthand for writing Vector4(1.0f, 1.0f, 1.0f, 1.0f).
 		 */
-		static const Vector4 ONE;
+		static const TVector4 ONE;
 
 		/**
 		 * Shorthand for writing Vector4(0.0f, 0.0f, 0.0f, 0.0f).
 		 */
-		static const Vector4 ZERO;
+		static const TVector4 ZERO;
 	};
 
 	/**
@@ -233,7 +259,8 @@ namespace M3D
 	 * @param v2 The right hand side vector.
 	 * @return Result of scaling the first vector by the second vector.
 	 */
-	Vector4 scale(const Vector4& v1, const Vector4& v2);
+	template <typename T>
+	constexpr TVector4<T> scale(const TVector4<T>& v1, const TVector4<T>& v2);
 
 	/**
 	 * Returns the dot product of two vectors.
@@ -244,7 +271,8 @@ namespace M3D
 	 * @param rhs The right hand side vector.
 	 * @return Dot product of the two vectors.
 	 */
-	float dot(const Vector4& lhs, const Vector4& rhs);
+	template <typename T>
+	constexpr T dot(const TVector4<T>& lhs, const TVector4<T>& rhs);
 
 	/**
 	 * Returns the square distance between vectors `p1` and `p2`.
@@ -253,7 +281,8 @@ namespace M3D
 	 * @param p2 The vector representing the second point.
 	 * @return Square of the distance between the two points.
 	 */
-	float sqrDistance(const Vector4& p1, const Vector4& p2);
+	template <typename T>
+	constexpr T sqrDistance(const TVector4<T>& p1, const TVector4<T>& p2);
 
 	/**
 	 * Returns the distance between vectors `p1` and `p2`.
@@ -262,7 +291,20 @@ namespace M3D
 	 * @param p2 The vector representing the second point.
 	 * @return Distance between the two points.
 	 */
-	float distance(const Vector4& p1, const Vector4& p2);
+	template <typename T>
+	T distance(const TVector4<T>& p1, const TVector4<T>& p2);
+
+	/**
+	 * Single precision 4D vector.
+	 */
+	typedef TVector4<float> Vector4;
+
+	/**
+	 * Double precision 4D vector.
+	 */
+	typedef TVector4<double> Vector4d;
 }
 
+#include <M3D/Vector4.inl>
+
 #endif
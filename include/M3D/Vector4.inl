@@ -0,0 +1,194 @@
+#ifndef VECTOR4_INL
+#define VECTOR4_INL
+
+// Inline definitions of the small, frequently called Vector4 operations. This
+// file is included at the end of Vector4.hpp and should not be included
+// directly.
+
+#include <cmath>
+#include <cassert>
+
+namespace M3D
+{
+	template <typename T>
+	constexpr TVector4<T>::TVector4()
+	: x(0.0f)
+	, y(0.0f)
+	, z(0.0f)
+	, w(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TVector4<T>::TVector4(T x_, T y_, T z_, T w_)
+	: x(x_)
+	, y(y_)
+	, z(z_)
+	, w(w_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	template <typename U>
+	constexpr TVector4<T>::TVector4(const TVector4<U>& other)
+	: x(static_cast<T>(other.x))
+	, y(static_cast<T>(other.y))
+	, z(static_cast<T>(other.z))
+	, w(static_cast<T>(other.w))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TVector4<T>::TVector4(const TVector3<T>& v)
+	: x(v.x)
+	, y(v.y)
+	, z(v.z)
+	, w(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	constexpr TVector4<T>::TVector4(const TVector3<T>& v, T w_)
+	: x(v.x)
+	, y(v.y)
+	, z(v.z)
+	, w(w_)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	inline bool operator==(const TVector4<T>& v1, const TVector4<T>& v2)
+	{
+		const T epsilon = 1e-6;
+		return std::abs(v1.x - v2.x) < epsilon &&
+			std::abs(v1.y - v2.y) < epsilon &&
+			std::abs(v1.z - v2.z) < epsilon &&
+			std::abs(v1.w - v2.w) < epsilon;
+	}
+
+	template <typename T>
+	inline bool operator!=(const TVector4<T>& v1, const TVector4<T>& v2)
+	{
+		return !(v1 == v2);
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator+(const TVector4<T>& v1, const TVector4<T>& v2)
+	{
+		return TVector4<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z, v1.w + v2.w);
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator-(const TVector4<T>& v1, const TVector4<T>& v2)
+	{
+		return TVector4<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w - v2.w);
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator-(const TVector4<T>& v)
+	{
+		return TVector4<T>(-v.x, -v.y, -v.z, -v.w);
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator*(const TVector4<T>& v, const typename TVector4<T>::Scalar s)
+	{
+		return TVector4<T>(v.x * s, v.y * s, v.z * s, v.w * s);
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator*(const typename TVector4<T>::Scalar s, const TVector4<T>& v)
+	{
+		return v * s;
+	}
+
+	template <typename T>
+	constexpr TVector4<T> operator/(const TVector4<T>& v, const typename TVector4<T>::Scalar s)
+	{
+		assert(s != 0.0f);
+		return v * (1.0f / s);
+	}
+
+	template <typename T>
+	constexpr T TVector4<T>::sqrMagnitude() const
+	{
+		// Take the dot product of this vector with itself.
+		return dot(*this, *this);
+	}
+
+	template <typename T>
+	inline T TVector4<T>::magnitude() const
+	{
+		return std::sqrt(sqrMagnitude());
+	}
+
+	template <typename T>
+	inline TVector4<T> TVector4<T>::normalized() const
+	{
+		const T sqrLength = sqrMagnitude();
+		assert(sqrLength != 0.0f);
+		const T invLength = 1.0f / std::sqrt(sqrLength);
+		return (*this) * invLength;
+	}
+
+	template <typename T>
+	inline void TVector4<T>::normalize()
+	{
+		const T sqrLength = sqrMagnitude();
+		assert(sqrLength != 0.0f);
+		const T invLength = 1.0f / std::sqrt(sqrLength);
+
+		x *= invLength;
+		y *= invLength;
+		z *= invLength;
+		w *= invLength;
+	}
+
+	template <typename T>
+	constexpr TVector4<T> scale(const TVector4<T>& v1, const TVector4<T>& v2)
+	{
+		return TVector4<T>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z, v1.w * v2.w);
+	}
+
+	template <typename T>
+	constexpr T dot(const TVector4<T>& lhs, const TVector4<T>& rhs)
+	{
+		return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
+	}
+
+	template <typename T>
+	constexpr T sqrDistance(const TVector4<T>& p1, const TVector4<T>& p2)
+	{
+		return (p1 - p2).sqrMagnitude();
+	}
+
+	template <typename T>
+	inline T distance(const TVector4<T>& p1, const TVector4<T>& p2)
+	{
+		return (p1 - p2).magnitude();
+	}
+
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::FORWARD	= TVector4<T>(0.0f, 0.0f, 1.0f, 0.0f);
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::BACK		= TVector4<T>(0.0f, 0.0f, -1.0f, 0.0f);
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::UP		= TVector4<T>(0.0f, 1.0f, 0.0f, 0.0f);
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::DOWN		= TVector4<T>(0.0f, -1.0f, 0.0f, 0.0f);
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::RIGHT	= TVector4<T>(1.0f, 0.0f, 0.0f, 0.0f);
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::LEFT		= TVector4<T>(-1.0f, 0.0f, 0.0f, 0.0f);
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::ONE		= TVector4<T>(1.0f, 1.0f, 1.0f, 1.0f);
+	template <typename T>
+	constexpr TVector4<T> TVector4<T>::ZERO		= TVector4<T>(0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+#endif
@@ -0,0 +1,283 @@
+#include <M3D/AABB.hpp>
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+
+#include "SIMD.hpp"
+
+#include <cmath>
+
+namespace M3D
+{
+	namespace
+	{
+		// Transforms `box` by the affine transformation whose first three
+		// rows are held in the row-major entries `m`, using Arvo's method:
+		// the center is transformed as a point and the extents by the
+		// absolute values of the linear part.
+		template <typename T>
+		TAABB<T> transformBox(const TAABB<T>& box, const T m[12])
+		{
+			const TVector3<T> c = box.center();
+			const TVector3<T> e = box.extents();
+
+			T center[3], extents[3];
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				const T* row = &m[4 * i];
+				center[i] = row[0] * c.x + row[1] * c.y + row[2] * c.z + row[3];
+				extents[i] = std::abs(row[0]) * e.x + std::abs(row[1]) * e.y + std::abs(row[2]) * e.z;
+			}
+
+			return TAABB<T>(
+				TVector3<T>(center[0] - extents[0], center[1] - extents[1], center[2] - extents[2]),
+				TVector3<T>(center[0] + extents[0], center[1] + extents[1], center[2] + extents[2])
+			);
+		}
+
+		// Merges the points in `points`, starting from the point at index
+		// `first`, into `box`.
+		template <typename T>
+		void boundArray(const TVector3<T>* points, TAABB<T>& box, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				box.merge(points[i]);
+			}
+		}
+
+		// Merges the points in `xs`, `ys` and `zs`, starting from the point
+		// at index `first`, into `box`.
+		template <typename T>
+		void boundArrays(const T* xs, const T* ys, const T* zs, TAABB<T>& box, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				box.merge(TVector3<T>(xs[i], ys[i], zs[i]));
+			}
+		}
+
+#if defined(M3D_SSE2)
+		TAABB<float> transformBox(const TAABB<float>& box, const float m[12])
+		{
+			// Transpose the rows so that the columns of the linear part and
+			// the translation are each held in a register.
+			__m128 c0 = _mm_loadu_ps(&m[0]);
+			__m128 c1 = _mm_loadu_ps(&m[4]);
+			__m128 c2 = _mm_loadu_ps(&m[8]);
+			__m128 c3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			const TVector3<float> c = box.center();
+			const TVector3<float> e = box.extents();
+			const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+			__m128 center = simd::madd(c0, _mm_set1_ps(c.x), c3);
+			center = simd::madd(c1, _mm_set1_ps(c.y), center);
+			center = simd::madd(c2, _mm_set1_ps(c.z), center);
+
+			__m128 extents = _mm_mul_ps(_mm_and_ps(c0, absMask), _mm_set1_ps(e.x));
+			extents = simd::madd(_mm_and_ps(c1, absMask), _mm_set1_ps(e.y), extents);
+			extents = simd::madd(_mm_and_ps(c2, absMask), _mm_set1_ps(e.z), extents);
+
+			float lo[4], hi[4];
+			_mm_storeu_ps(lo, _mm_sub_ps(center, extents));
+			_mm_storeu_ps(hi, _mm_add_ps(center, extents));
+
+			return TAABB<float>(TVector3<float>(lo[0], lo[1], lo[2]), TVector3<float>(hi[0], hi[1], hi[2]));
+		}
+
+		// Merges the minimum of the lanes of `minX`, `minY` and `minZ` and the
+		// maximum of the lanes of `maxX`, `maxY` and `maxZ` into `box`.
+		void mergeLanes(__m128 minX, __m128 minY, __m128 minZ, __m128 maxX, __m128 maxY, __m128 maxZ, TAABB<float>& box)
+		{
+			// After transposing, each register holds the x, y and z
+			// coordinates of one lane, so that the reduction over the lanes
+			// handles all three axes together.
+			__m128 minW = minZ, maxW = maxZ;
+			_MM_TRANSPOSE4_PS(minX, minY, minZ, minW);
+			_MM_TRANSPOSE4_PS(maxX, maxY, maxZ, maxW);
+
+			float lo[4], hi[4];
+			_mm_storeu_ps(lo, _mm_min_ps(_mm_min_ps(minX, minY), _mm_min_ps(minZ, minW)));
+			_mm_storeu_ps(hi, _mm_max_ps(_mm_max_ps(maxX, maxY), _mm_max_ps(maxZ, maxW)));
+			box.merge(TAABB<float>(TVector3<float>(lo[0], lo[1], lo[2]), TVector3<float>(hi[0], hi[1], hi[2])));
+		}
+#endif
+
+#if defined(M3D_AVX)
+		// Eight lane version of the above.
+		void mergeLanes(__m256 minX, __m256 minY, __m256 minZ, __m256 maxX, __m256 maxY, __m256 maxZ, TAABB<float>& box)
+		{
+			mergeLanes(
+				_mm_min_ps(_mm256_castps256_ps128(minX), _mm256_extractf128_ps(minX, 1)),
+				_mm_min_ps(_mm256_castps256_ps128(minY), _mm256_extractf128_ps(minY, 1)),
+				_mm_min_ps(_mm256_castps256_ps128(minZ), _mm256_extractf128_ps(minZ, 1)),
+				_mm_max_ps(_mm256_castps256_ps128(maxX), _mm256_extractf128_ps(maxX, 1)),
+				_mm_max_ps(_mm256_castps256_ps128(maxY), _mm256_extractf128_ps(maxY, 1)),
+				_mm_max_ps(_mm256_castps256_ps128(maxZ), _mm256_extractf128_ps(maxZ, 1)),
+				box);
+		}
+#endif
+
+#if defined(M3D_SSE2)
+		void boundArray(const TVector3<float>* points, TAABB<float>& box, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			if (i + 8 <= count)
+			{
+				__m256 minX, minY, minZ;
+				simd::loadPacked3(&points[i].x, minX, minY, minZ);
+				__m256 maxX = minX, maxY = minY, maxZ = minZ;
+
+				for (i += 8; i + 8 <= count; i += 8)
+				{
+					__m256 x, y, z;
+					simd::loadPacked3(&points[i].x, x, y, z);
+					minX = _mm256_min_ps(minX, x);
+					minY = _mm256_min_ps(minY, y);
+					minZ = _mm256_min_ps(minZ, z);
+					maxX = _mm256_max_ps(maxX, x);
+					maxY = _mm256_max_ps(maxY, y);
+					maxZ = _mm256_max_ps(maxZ, z);
+				}
+
+				mergeLanes(minX, minY, minZ, maxX, maxY, maxZ, box);
+			}
+#endif
+
+			if (i + 4 <= count)
+			{
+				__m128 minX, minY, minZ;
+				simd::loadPacked3(&points[i].x, minX, minY, minZ);
+				__m128 maxX = minX, maxY = minY, maxZ = minZ;
+
+				for (i += 4; i + 4 <= count; i += 4)
+				{
+					__m128 x, y, z;
+					simd::loadPacked3(&points[i].x, x, y, z);
+					minX = _mm_min_ps(minX, x);
+					minY = _mm_min_ps(minY, y);
+					minZ = _mm_min_ps(minZ, z);
+					maxX = _mm_max_ps(maxX, x);
+					maxY = _mm_max_ps(maxY, y);
+					maxZ = _mm_max_ps(maxZ, z);
+				}
+
+				mergeLanes(minX, minY, minZ, maxX, maxY, maxZ, box);
+			}
+
+			// Remaining points.
+			boundArray<float>(points, box, i, count);
+		}
+
+		void boundArrays(const float* xs, const float* ys, const float* zs, TAABB<float>& box, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			if (i + 8 <= count)
+			{
+				__m256 minX = _mm256_loadu_ps(xs + i), minY = _mm256_loadu_ps(ys + i), minZ = _mm256_loadu_ps(zs + i);
+				__m256 maxX = minX, maxY = minY, maxZ = minZ;
+
+				for (i += 8; i + 8 <= count; i += 8)
+				{
+					const __m256 x = _mm256_loadu_ps(xs + i);
+					const __m256 y = _mm256_loadu_ps(ys + i);
+					const __m256 z = _mm256_loadu_ps(zs + i);
+					minX = _mm256_min_ps(minX, x);
+					minY = _mm256_min_ps(minY, y);
+					minZ = _mm256_min_ps(minZ, z);
+					maxX = _mm256_max_ps(maxX, x);
+					maxY = _mm256_max_ps(maxY, y);
+					maxZ = _mm256_max_ps(maxZ, z);
+				}
+
+				mergeLanes(minX, minY, minZ, maxX, maxY, maxZ, box);
+			}
+#endif
+
+			if (i + 4 <= count)
+			{
+				__m128 minX = _mm_loadu_ps(xs + i), minY = _mm_loadu_ps(ys + i), minZ = _mm_loadu_ps(zs + i);
+				__m128 maxX = minX, maxY = minY, maxZ = minZ;
+
+				for (i += 4; i + 4 <= count; i += 4)
+				{
+					const __m128 x = _mm_loadu_ps(xs + i);
+					const __m128 y = _mm_loadu_ps(ys + i);
+					const __m128 z = _mm_loadu_ps(zs + i);
+					minX = _mm_min_ps(minX, x);
+					minY = _mm_min_ps(minY, y);
+					minZ = _mm_min_ps(minZ, z);
+					maxX = _mm_max_ps(maxX, x);
+					maxY = _mm_max_ps(maxY, y);
+					maxZ = _mm_max_ps(maxZ, z);
+				}
+
+				mergeLanes(minX, minY, minZ, maxX, maxY, maxZ, box);
+			}
+
+			// Remaining points.
+			boundArrays<float>(xs, ys, zs, box, i, count);
+		}
+#endif
+	}
+
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TAABB<T>& box)
+	{
+		out << "[" << box.min << ", " << box.max << "]";
+		return out;
+	}
+
+	template <typename T>
+	TAABB<T> TAABB<T>::transformed(const TMatrix4<T>& A) const
+	{
+		T m[12];
+		for (std::size_t i = 0; i < 12; ++i)
+		{
+			m[i] = A[i];
+		}
+
+		return transformBox(*this, m);
+	}
+
+	template <typename T>
+	TAABB<T> TAABB<T>::transformed(const TAffine3<T>& A) const
+	{
+		T m[12];
+		for (std::size_t i = 0; i < 12; ++i)
+		{
+			m[i] = A[i];
+		}
+
+		return transformBox(*this, m);
+	}
+
+	template <typename T>
+	TAABB<T> TAABB<T>::fromPoints(const TVector3<T>* points, std::size_t count)
+	{
+		TAABB<T> box;
+		boundArray(points, box, 0, count);
+		return box;
+	}
+
+	template <typename T>
+	TAABB<T> TAABB<T>::fromPoints(const T* xs, const T* ys, const T* zs, std::size_t count)
+	{
+		TAABB<T> box;
+		boundArrays(xs, ys, zs, box, 0, count);
+		return box;
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TAABB<float>;
+	template class TAABB<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TAABB<float>& box);
+
+	template std::ostream& operator <<(std::ostream& out, const TAABB<double>& box);
+}
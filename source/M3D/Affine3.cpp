@@ -0,0 +1,233 @@
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+
+#include "SIMD.hpp"
+
+#include <cmath>
+#include <cassert>
+#include <string>
+
+namespace M3D
+{
+	namespace
+	{
+		// Computes the composition `c` = `a` * `b` of the 3x4 row-major
+		// matrices, treating each as a 4x4 matrix with the last row
+		// (0, 0, 0, 1). The implicit last rows only contribute the translation
+		// of `a` to the last column of the product.
+		template <typename T>
+		void compose(const T* a, const T* b, T* c)
+		{
+			for (std::size_t i = 0; i < 12; i += 4)
+			{
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					c[i + j] = a[i] * b[j] + a[i + 1] * b[4 + j] + a[i + 2] * b[8 + j];
+				}
+
+				c[i + 3] += a[i + 3];
+			}
+		}
+
+#if defined(M3D_SSE2)
+		void compose(const float* a, const float* b, float* c)
+		{
+			// Each row of the product is a linear combination of the rows of
+			// `b`, plus the translation of the corresponding row of `a`.
+			const __m128 translationMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+			const __m128 b0 = _mm_loadu_ps(&b[0]);
+			const __m128 b1 = _mm_loadu_ps(&b[4]);
+			const __m128 b2 = _mm_loadu_ps(&b[8]);
+
+			for (std::size_t i = 0; i < 12; i += 4)
+			{
+				const __m128 row = _mm_loadu_ps(&a[i]);
+
+				__m128 r = _mm_and_ps(row, translationMask);
+				r = simd::madd(simd::splat<0>(row), b0, r);
+				r = simd::madd(simd::splat<1>(row), b1, r);
+				r = simd::madd(simd::splat<2>(row), b2, r);
+				_mm_storeu_ps(&c[i], r);
+			}
+		}
+#endif
+	}
+
+	template <typename T>
+	TAffine3<T>::TAffine3(const TQuaternion<T>& q, const TVector3<T>& translation)
+	: TAffine3<T>(q, translation, 1.0f)
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	TAffine3<T>::TAffine3(const TQuaternion<T>& q, const TVector3<T>& translation, const T scale)
+	{
+		const T s2 = 2.0f * scale;
+
+		const T xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		const T xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		const T wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+		m[0] = scale - s2 * (yy + zz);
+		m[1] = s2 * (xy - wz);
+		m[2] = s2 * (xz + wy);
+		m[3] = translation.x;
+
+		m[4] = s2 * (xy + wz);
+		m[5] = scale - s2 * (xx + zz);
+		m[6] = s2 * (yz - wx);
+		m[7] = translation.y;
+
+		m[8] = s2 * (xz - wy);
+		m[9] = s2 * (yz + wx);
+		m[10] = scale - s2 * (xx + yy);
+		m[11] = translation.z;
+	}
+
+	template <typename T>
+	TAffine3<T>::TAffine3(const TMatrix4<T>& A)
+	{
+		for (std::size_t i = 0; i < 12; ++i)
+		{
+			m[i] = A[i];
+		}
+	}
+
+	template <typename T>
+	TAffine3<T> operator*(const TAffine3<T>& lhs, const TAffine3<T>& rhs)
+	{
+		TAffine3<T> C;
+		compose(lhs.m, rhs.m, C.m);
+		return C;
+	}
+
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TAffine3<T>& A)
+	{
+		std::string stringMatrix[12];
+		std::size_t columnLengths[4] = {0, 0, 0, 0};
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				const std::string str = std::to_string(A[4 * i + j]);
+
+				const std::size_t len = str.length();
+				if (len > columnLengths[j]) columnLengths[j] = len;
+
+				stringMatrix[4 * i + j] = str;
+			}
+		}
+
+		const std::size_t totalLength = columnLengths[0] + columnLengths[1] +
+			columnLengths[2] + columnLengths[3] + 3;
+
+		out << "┌─";
+		for (std::size_t i = 0; i < totalLength; ++i) out << " ";
+		out << "─┐" << std::endl;
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			out << "│";
+
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				const std::string str = stringMatrix[4 * i + j];
+				const std::size_t len = str.length();
+
+				for (std::size_t k = 0; k < columnLengths[j] - len; ++k)
+				{
+					out << " ";
+				}
+
+				out << " " << str;
+			}
+
+			out << " │" << std::endl;
+		}
+
+		out << "└─";
+		for (std::size_t i = 0; i < totalLength; ++i) out << " ";
+		out << "─┘";
+
+		return out;
+	}
+
+	template <typename T>
+	TQuaternion<T> TAffine3<T>::rotationPart() const
+	{
+		// Remove the scale from each of the columns.
+		const T sx = 1.0f / std::sqrt(m[0] * m[0] + m[4] * m[4] + m[8] * m[8]);
+		const T sy = 1.0f / std::sqrt(m[1] * m[1] + m[5] * m[5] + m[9] * m[9]);
+		const T sz = 1.0f / std::sqrt(m[2] * m[2] + m[6] * m[6] + m[10] * m[10]);
+
+		const T r00 = m[0] * sx, r01 = m[1] * sy, r02 = m[2] * sz;
+		const T r10 = m[4] * sx, r11 = m[5] * sy, r12 = m[6] * sz;
+		const T r20 = m[8] * sx, r21 = m[9] * sy, r22 = m[10] * sz;
+
+		// Extract the quaternion from the rotation matrix, dividing by the
+		// largest of the four possible pivots to avoid loss of precision.
+		const T trace = r00 + r11 + r22;
+		if (trace > 0.0f)
+		{
+			const T s = 0.5f / std::sqrt(trace + 1.0f);
+			return TQuaternion<T>(0.25f / s, (r21 - r12) * s, (r02 - r20) * s, (r10 - r01) * s);
+		}
+		else if (r00 > r11 && r00 > r22)
+		{
+			const T s = 0.5f / std::sqrt(1.0f + r00 - r11 - r22);
+			return TQuaternion<T>((r21 - r12) * s, 0.25f / s, (r01 + r10) * s, (r02 + r20) * s);
+		}
+		else if (r11 > r22)
+		{
+			const T s = 0.5f / std::sqrt(1.0f + r11 - r00 - r22);
+			return TQuaternion<T>((r02 - r20) * s, (r01 + r10) * s, 0.25f / s, (r12 + r21) * s);
+		}
+		else
+		{
+			const T s = 0.5f / std::sqrt(1.0f + r22 - r00 - r11);
+			return TQuaternion<T>((r10 - r01) * s, (r02 + r20) * s, (r12 + r21) * s, 0.25f / s);
+		}
+	}
+
+	template <typename T>
+	TAffine3<T> TAffine3<T>::inverse() const
+	{
+		// Ensure that the transformation is not singular.
+		const T det = determinant();
+		assert(det != 0.0f);
+
+		// Invert the linear part using the cofactors.
+		const T invDet = 1.0f / det;
+		const T a0 = (m[5] * m[10] - m[6] * m[9]) * invDet;
+		const T a1 = (m[9] * m[2] - m[10] * m[1]) * invDet;
+		const T a2 = (m[1] * m[6] - m[2] * m[5]) * invDet;
+		const T a4 = (m[8] * m[6] - m[4] * m[10]) * invDet;
+		const T a5 = (m[0] * m[10] - m[8] * m[2]) * invDet;
+		const T a6 = (m[4] * m[2] - m[0] * m[6]) * invDet;
+		const T a8 = (m[4] * m[9] - m[8] * m[5]) * invDet;
+		const T a9 = (m[8] * m[1] - m[0] * m[9]) * invDet;
+		const T a10 = (m[0] * m[5] - m[4] * m[1]) * invDet;
+
+		// The translation of the inverse is the negated translation
+		// transformed by the inverse of the linear part.
+		return TAffine3<T>(
+			a0, a1, a2, -(a0 * m[3] + a1 * m[7] + a2 * m[11]),
+			a4, a5, a6, -(a4 * m[3] + a5 * m[7] + a6 * m[11]),
+			a8, a9, a10, -(a8 * m[3] + a9 * m[7] + a10 * m[11])
+		);
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TAffine3<float>;
+	template class TAffine3<double>;
+
+	template TAffine3<float> operator*(const TAffine3<float>& lhs, const TAffine3<float>& rhs);
+	template std::ostream& operator <<(std::ostream& out, const TAffine3<float>& A);
+
+	template TAffine3<double> operator*(const TAffine3<double>& lhs, const TAffine3<double>& rhs);
+	template std::ostream& operator <<(std::ostream& out, const TAffine3<double>& A);
+}
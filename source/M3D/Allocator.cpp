@@ -0,0 +1,127 @@
+#include <M3D/Allocator.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace M3D
+{
+	void* alignedAllocate(std::size_t size, std::size_t alignment)
+	{
+		assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+		// Over-allocate, and store the pointer returned by malloc just before
+		// the aligned memory so that alignedFree() can release it.
+		alignment = std::max(alignment, sizeof(void*));
+		void* original = std::malloc(size + alignment + sizeof(void*));
+		if (original == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(original) + sizeof(void*);
+		void* aligned = reinterpret_cast<void*>((address + alignment - 1) & ~(alignment - 1));
+		static_cast<void**>(aligned)[-1] = original;
+		return aligned;
+	}
+
+	void alignedFree(void* pointer)
+	{
+		if (pointer != nullptr)
+		{
+			std::free(static_cast<void**>(pointer)[-1]);
+		}
+	}
+
+	Arena::Arena(std::size_t capacity)
+	: blocks()
+	, offset(0)
+	, usedBefore(0)
+	{
+		if (capacity > 0)
+		{
+			addBlock(capacity);
+		}
+	}
+
+	Arena::~Arena()
+	{
+		for (std::size_t i = 0; i < blocks.size(); ++i)
+		{
+			alignedFree(blocks[i].data);
+		}
+	}
+
+	void Arena::reset()
+	{
+		// Replace several blocks by one that holds them all, so that the
+		// next cycle of allocations fits in a single block.
+		if (blocks.size() > 1)
+		{
+			const std::size_t total = capacity();
+			for (std::size_t i = 0; i < blocks.size(); ++i)
+			{
+				alignedFree(blocks[i].data);
+			}
+
+			blocks.clear();
+			addBlock(total);
+		}
+
+		offset = 0;
+		usedBefore = 0;
+	}
+
+	std::size_t Arena::capacity() const
+	{
+		std::size_t total = 0;
+		for (std::size_t i = 0; i < blocks.size(); ++i)
+		{
+			total += blocks[i].capacity;
+		}
+
+		return total;
+	}
+
+	void Arena::addBlock(std::size_t capacity)
+	{
+		// Each block is at least as large as the last, so that the number
+		// of blocks grows slowly with the total size.
+		if (!blocks.empty())
+		{
+			capacity = std::max(capacity, blocks.back().capacity);
+			usedBefore += offset;
+		}
+
+		Block block;
+		block.data = static_cast<char*>(alignedAllocate(capacity, SIMD_ALIGNMENT));
+		block.capacity = capacity;
+		blocks.push_back(block);
+		offset = 0;
+	}
+
+	AlignedPool::AlignedPool(std::size_t blockSize, std::size_t alignment_, std::size_t blocksPerChunk_)
+	: chunks()
+	, freeList(nullptr)
+	, size(blockSize)
+	, stride(0)
+	, alignment(std::max(alignment_, alignof(void*)))
+	, blocksPerChunk(std::max(blocksPerChunk_, std::size_t(1)))
+	{
+		assert((alignment_ & (alignment_ - 1)) == 0);
+
+		// Free blocks hold the pointer to the next free block.
+		const std::size_t minimum = std::max(blockSize, sizeof(void*));
+		stride = (minimum + alignment - 1) & ~(alignment - 1);
+	}
+
+	AlignedPool::~AlignedPool()
+	{
+		for (std::size_t i = 0; i < chunks.size(); ++i)
+		{
+			alignedFree(chunks[i]);
+		}
+	}
+}
@@ -0,0 +1,378 @@
+#include <M3D/AnimationClip.hpp>
+#include <M3D/Packed.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace M3D
+{
+	namespace
+	{
+		// Size in bytes of a quantized key of any of the curves.
+		const std::size_t KEY_SIZE = 6;
+
+		// Number of quantization steps across the range of a translation or
+		// scale component.
+		const float STEPS = 65535.0f;
+
+		// Number of rotations unpacked together when sampling.
+		const std::size_t ROTATION_CHUNK = 64;
+
+		inline Vector3 interpolate(const Vector3& a, const Vector3& b, float t)
+		{
+			return a + (b - a) * t;
+		}
+
+		// Rotations are interpolated by nlerp rather than slerp, which is much
+		// cheaper and as accurate between keys that the curve fitting has
+		// placed close together.
+		inline Quaternion interpolate(const Quaternion& a, const Quaternion& b, float t)
+		{
+			return nlerp(a, b, t);
+		}
+
+		inline float error(const Vector3& a, const Vector3& b)
+		{
+			return std::max(std::max(std::abs(a.x - b.x), std::abs(a.y - b.y)), std::abs(a.z - b.z));
+		}
+
+		// The error of a rotation is that of the nearer of `b` and its
+		// negation, which represent the same rotation.
+		inline float error(const Quaternion& a, const Quaternion& b)
+		{
+			const float sign = dot(a, b) < 0.0f ? -1.0f : 1.0f;
+			return std::max(
+				std::max(std::abs(a.w - sign * b.w), std::abs(a.x - sign * b.x)),
+				std::max(std::abs(a.y - sign * b.y), std::abs(a.z - sign * b.z)));
+		}
+
+		// Returns whether interpolating between the values at frames `first`
+		// and `last` reproduces the values of the frames between them to
+		// within `tolerance`.
+		template <typename Type>
+		bool fits(const Type* values, std::size_t stride, std::size_t first, std::size_t last, float tolerance)
+		{
+			const Type& a = values[first * stride];
+			const Type& b = values[last * stride];
+			for (std::size_t frame = first + 1; frame < last; ++frame)
+			{
+				const float t = static_cast<float>(frame - first) / static_cast<float>(last - first);
+				if (error(interpolate(a, b, t), values[frame * stride]) > tolerance)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// Finds the frames of the keys that reproduce the `length` + 1 values
+		// of a curve within a segment, whose values are `stride` elements
+		// apart. Each key is extended greedily to the furthest frame that
+		// fits() allows. The first and last frames are always keys.
+		template <typename Type>
+		void fitCurve(const Type* values, std::size_t stride, std::size_t length, float tolerance,
+			std::vector<std::uint8_t>& keys)
+		{
+			keys.assign(1, 0);
+
+			std::size_t first = 0;
+			while (first < length)
+			{
+				std::size_t last = first + 1;
+				while (last < length && fits(values, stride, first, last + 1, tolerance))
+				{
+					++last;
+				}
+
+				keys.push_back(static_cast<std::uint8_t>(last));
+				first = last;
+			}
+		}
+
+		// Finds the range of a translation or scale curve across the whole
+		// clip, returning its minimum and the size of a quantization step.
+		void findRange(const Vector3* values, std::size_t stride, std::size_t count, Vector3& min, Vector3& step)
+		{
+			Vector3 lower = values[0];
+			Vector3 upper = values[0];
+			for (std::size_t i = 1; i < count; ++i)
+			{
+				const Vector3& v = values[i * stride];
+				lower = Vector3(std::min(lower.x, v.x), std::min(lower.y, v.y), std::min(lower.z, v.z));
+				upper = Vector3(std::max(upper.x, v.x), std::max(upper.y, v.y), std::max(upper.z, v.z));
+			}
+
+			min = lower;
+			step = (upper - lower) / STEPS;
+		}
+
+		inline std::uint16_t quantize(float value, float min, float step)
+		{
+			const float q = step > 0.0f ? (value - min) / step + 0.5f : 0.0f;
+			return static_cast<std::uint16_t>(std::min(std::max(q, 0.0f), STEPS));
+		}
+
+		void appendKey(const Vector3& v, const Vector3& min, const Vector3& step, std::vector<std::uint8_t>& keys)
+		{
+			const std::uint16_t q[3] =
+			{
+				quantize(v.x, min.x, step.x),
+				quantize(v.y, min.y, step.y),
+				quantize(v.z, min.z, step.z)
+			};
+
+			const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(q);
+			keys.insert(keys.end(), bytes, bytes + KEY_SIZE);
+		}
+
+		void appendKey(const Quaternion& q, std::vector<std::uint8_t>& keys)
+		{
+			const PackedQuaternion48 packed(q);
+			const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(packed.bits);
+			keys.insert(keys.end(), bytes, bytes + KEY_SIZE);
+		}
+
+		inline Vector3 readKey(const std::uint8_t* key, const Vector3& min, const Vector3& step)
+		{
+			std::uint16_t q[3];
+			std::memcpy(q, key, KEY_SIZE);
+			return Vector3(
+				min.x + static_cast<float>(q[0]) * step.x,
+				min.y + static_cast<float>(q[1]) * step.y,
+				min.z + static_cast<float>(q[2]) * step.z
+			);
+		}
+
+		// Finds the keys either side of the frame `local` within a segment of
+		// `length` frames, for a curve of `count` keys whose interior key
+		// frames start at `interior`. Returns the index of the first key and
+		// sets the index of the second and the interpolation parameter.
+		inline std::size_t findKeys(const std::uint8_t* interior, std::size_t count, std::size_t length, float local,
+			std::size_t& next, float& t)
+		{
+			if (count == 1)
+			{
+				next = 0;
+				t = 0.0f;
+				return 0;
+			}
+
+			std::size_t key = 0;
+			while (key + 2 < count && static_cast<float>(interior[key]) <= local)
+			{
+				++key;
+			}
+
+			const float start = key == 0 ? 0.0f : static_cast<float>(interior[key - 1]);
+			const float end = key + 2 == count ? static_cast<float>(length) : static_cast<float>(interior[key]);
+			next = key + 1;
+			t = (local - start) / (end - start);
+			return key;
+		}
+	}
+
+	const std::size_t AnimationClip::SEGMENT_FRAMES;
+
+	AnimationClip::AnimationClip()
+	: tracks(0)
+	, frames(0)
+	, rate(0.0f)
+	{
+		// Nothing to do.
+	}
+
+	AnimationClip::AnimationClip(const Vector3* translations, const Quaternion* rotations, const Vector3* scales,
+		std::size_t trackCount, std::size_t frameCount, float frameRate,
+		float translationTolerance, float rotationTolerance, float scaleTolerance)
+	: tracks(trackCount)
+	, frames(frameCount)
+	, rate(frameRate)
+	{
+		assert(trackCount == 0 || frameCount > 0);
+		assert(frameRate > 0.0f);
+
+		if (trackCount == 0)
+		{
+			return;
+		}
+
+		ranges.resize(trackCount);
+		for (std::size_t track = 0; track < trackCount; ++track)
+		{
+			TrackRange& range = ranges[track];
+			findRange(translations + track, trackCount, frameCount, range.translationMin, range.translationStep);
+			findRange(scales + track, trackCount, frameCount, range.scaleMin, range.scaleStep);
+		}
+
+		const std::size_t lastFrame = frameCount - 1;
+		const std::size_t segmentCount = lastFrame == 0 ? 1 : (lastFrame + SEGMENT_FRAMES - 1) / SEGMENT_FRAMES;
+		segments.resize(segmentCount);
+
+		std::vector<std::uint8_t> counts(3 * trackCount);
+		std::vector<std::uint8_t> interior;
+		std::vector<std::uint8_t> keys;
+		std::vector<std::uint8_t> frameKeys;
+
+		for (std::size_t s = 0; s < segmentCount; ++s)
+		{
+			const std::size_t start = s * SEGMENT_FRAMES;
+			const std::size_t length = std::min(SEGMENT_FRAMES, lastFrame - start);
+			interior.clear();
+			keys.clear();
+
+			for (std::size_t curve = 0; curve < 3 * trackCount; ++curve)
+			{
+				const std::size_t track = curve % trackCount;
+				const std::size_t first = start * trackCount + track;
+				const TrackRange& range = ranges[track];
+
+				if (curve < trackCount)
+				{
+					fitCurve(translations + first, trackCount, length, translationTolerance, frameKeys);
+					for (std::size_t k = 0; k < frameKeys.size(); ++k)
+					{
+						appendKey(translations[first + frameKeys[k] * trackCount], range.translationMin, range.translationStep, keys);
+					}
+				}
+				else if (curve < 2 * trackCount)
+				{
+					fitCurve(rotations + first, trackCount, length, rotationTolerance, frameKeys);
+					for (std::size_t k = 0; k < frameKeys.size(); ++k)
+					{
+						appendKey(rotations[first + frameKeys[k] * trackCount], keys);
+					}
+				}
+				else
+				{
+					fitCurve(scales + first, trackCount, length, scaleTolerance, frameKeys);
+					for (std::size_t k = 0; k < frameKeys.size(); ++k)
+					{
+						appendKey(scales[first + frameKeys[k] * trackCount], range.scaleMin, range.scaleStep, keys);
+					}
+				}
+
+				counts[curve] = static_cast<std::uint8_t>(frameKeys.size());
+				if (frameKeys.size() > 2)
+				{
+					interior.insert(interior.end(), frameKeys.begin() + 1, frameKeys.end() - 1);
+				}
+			}
+
+			Segment& segment = segments[s];
+			segment.offset = static_cast<std::uint32_t>(data.size());
+			data.insert(data.end(), counts.begin(), counts.end());
+			data.insert(data.end(), interior.begin(), interior.end());
+			segment.valuesOffset = static_cast<std::uint32_t>(data.size());
+			data.insert(data.end(), keys.begin(), keys.end());
+		}
+	}
+
+	void AnimationClip::sample(float time, AnimationPose& pose) const
+	{
+		pose.resize(tracks);
+		if (tracks == 0)
+		{
+			return;
+		}
+
+		const std::size_t lastFrame = frames - 1;
+		const float frame = std::min(std::max(time * rate, 0.0f), static_cast<float>(lastFrame));
+		const std::size_t index = std::min(static_cast<std::size_t>(frame) / SEGMENT_FRAMES, segments.size() - 1);
+		const std::size_t start = index * SEGMENT_FRAMES;
+		const std::size_t length = std::min(SEGMENT_FRAMES, lastFrame - start);
+		const float local = frame - static_cast<float>(start);
+
+		const Segment& segment = segments[index];
+		const std::uint8_t* counts = &data[segment.offset];
+		const std::uint8_t* interior = counts + 3 * tracks;
+		const std::uint8_t* keys = data.data() + segment.valuesOffset;
+
+		// The curves are stored in the order they are decoded, so the
+		// interior frames and keys are read sequentially.
+		for (std::size_t track = 0; track < tracks; ++track)
+		{
+			const std::size_t count = counts[track];
+			std::size_t next;
+			float t;
+			const std::size_t key = findKeys(interior, count, length, local, next, t);
+
+			const TrackRange& range = ranges[track];
+			const Vector3 v = interpolate(
+				readKey(keys + key * KEY_SIZE, range.translationMin, range.translationStep),
+				readKey(keys + next * KEY_SIZE, range.translationMin, range.translationStep), t);
+			pose.translationX[track] = v.x;
+			pose.translationY[track] = v.y;
+			pose.translationZ[track] = v.z;
+
+			interior += count - std::min<std::size_t>(count, 2);
+			keys += count * KEY_SIZE;
+		}
+
+		// The rotation keys either side of the time are gathered in chunks
+		// and unpacked by the batch kernel, which is several times faster
+		// than unpacking them one at a time.
+		for (std::size_t first = 0; first < tracks; first += ROTATION_CHUNK)
+		{
+			const std::size_t chunk = std::min(ROTATION_CHUNK, tracks - first);
+			PackedQuaternion48 packed[2 * ROTATION_CHUNK];
+			float factors[ROTATION_CHUNK];
+
+			for (std::size_t i = 0; i < chunk; ++i)
+			{
+				const std::size_t count = counts[tracks + first + i];
+				std::size_t next;
+				const std::size_t key = findKeys(interior, count, length, local, next, factors[i]);
+				std::memcpy(packed[i].bits, keys + key * KEY_SIZE, KEY_SIZE);
+				std::memcpy(packed[ROTATION_CHUNK + i].bits, keys + next * KEY_SIZE, KEY_SIZE);
+
+				interior += count - std::min<std::size_t>(count, 2);
+				keys += count * KEY_SIZE;
+			}
+
+			Quaternion from[ROTATION_CHUNK];
+			Quaternion to[ROTATION_CHUNK];
+			unpack(packed, from, chunk);
+			unpack(packed + ROTATION_CHUNK, to, chunk);
+
+			for (std::size_t i = 0; i < chunk; ++i)
+			{
+				const Quaternion q = interpolate(from[i], to[i], factors[i]);
+				pose.rotationW[first + i] = q.w;
+				pose.rotationX[first + i] = q.x;
+				pose.rotationY[first + i] = q.y;
+				pose.rotationZ[first + i] = q.z;
+			}
+		}
+
+		for (std::size_t track = 0; track < tracks; ++track)
+		{
+			const std::size_t count = counts[2 * tracks + track];
+			std::size_t next;
+			float t;
+			const std::size_t key = findKeys(interior, count, length, local, next, t);
+
+			const TrackRange& range = ranges[track];
+			const Vector3 v = interpolate(
+				readKey(keys + key * KEY_SIZE, range.scaleMin, range.scaleStep),
+				readKey(keys + next * KEY_SIZE, range.scaleMin, range.scaleStep), t);
+			pose.scaleX[track] = v.x;
+			pose.scaleY[track] = v.y;
+			pose.scaleZ[track] = v.z;
+
+			interior += count - std::min<std::size_t>(count, 2);
+			keys += count * KEY_SIZE;
+		}
+	}
+
+	void AnimationClip::sample(float startTime, float endTime, AnimationPose* poses, std::size_t count) const
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const float t = count > 1 ? static_cast<float>(i) / static_cast<float>(count - 1) : 0.0f;
+			sample(startTime + (endTime - startTime) * t, poses[i]);
+		}
+	}
+}
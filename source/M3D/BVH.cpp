@@ -0,0 +1,333 @@
+#include <M3D/BVH.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace M3D
+{
+	namespace
+	{
+		// Largest number of bins into which the centroids are sorted along
+		// each axis. Nodes with fewer primitives use one bin per primitive.
+		const int BIN_COUNT = 16;
+
+		// Largest number of primitives in a leaf, unless they cannot be
+		// separated.
+		const std::size_t MAX_LEAF_SIZE = 8;
+
+		// Cost of traversing a node relative to intersecting a primitive.
+		const float TRAVERSAL_COST = 1.0f;
+
+		// Smallest number of primitives for which the two subtrees of a node
+		// are built on separate threads.
+		const std::size_t PARALLEL_THRESHOLD = 4096;
+
+		// Best split of a node found by binning.
+		template <typename T>
+		struct Split
+		{
+			std::size_t axis;
+			int binCount;
+			int plane;
+			T centroidMin;
+			T scale;
+			T cost;
+			TAABB<T> left;
+			TAABB<T> right;
+		};
+
+		// Bounds of a primitive with its index. The builder partitions an
+		// array of these in place rather than an array of indices, so that
+		// the passes over each node read memory sequentially.
+		template <typename T>
+		struct Reference
+		{
+			TAABB<T> bounds;
+			std::uint32_t index;
+		};
+
+		// Returns twice the coordinate of the centroid of `box` along `axis`.
+		// The factor of two cancels out of the binning.
+		template <typename T>
+		inline T centroid(const TAABB<T>& box, std::size_t axis)
+		{
+			return axis == 0 ? box.min.x + box.max.x : axis == 1 ? box.min.y + box.max.y : box.min.z + box.max.z;
+		}
+
+		// Builds the hierarchy top-down, partitioning the range of
+		// references belonging to each node in place.
+		template <typename T>
+		class Builder
+		{
+		public:
+			typedef typename TBVH<T>::Node Node;
+
+			explicit Builder(Reference<T>* references_)
+			: references(references_)
+			{
+				// Nothing to do.
+			}
+
+			// Builds the subtree of `nodes[nodeIndex]`, which must be a leaf
+			// holding the primitives of the subtree, appending its descendants
+			// to `nodes` in depth-first order.
+			void buildSubtree(std::vector<Node>& nodes, std::size_t nodeIndex, std::size_t depth, std::size_t threadCount) const
+			{
+				const Node node = nodes[nodeIndex];
+				const std::size_t first = node.offset;
+				const std::size_t count = node.count;
+				if (count == 1 || depth + 1 >= TBVH<T>::MAX_DEPTH)
+				{
+					return;
+				}
+
+				Split<T> split;
+				std::size_t leftCount;
+				if (findSplit(first, count, split))
+				{
+					const T area = node.bounds.surfaceArea();
+					if (count <= MAX_LEAF_SIZE && count * area <= TRAVERSAL_COST * area + split.cost)
+					{
+						return;
+					}
+
+					Reference<T>* middle = std::partition(references + first, references + first + count,
+						[&](const Reference<T>& reference)
+						{
+							return binIndex(centroid(reference.bounds, split.axis), split.centroidMin, split.scale, split.binCount) <= split.plane;
+						});
+					leftCount = static_cast<std::size_t>(middle - (references + first));
+				}
+				else if (count <= MAX_LEAF_SIZE)
+				{
+					return;
+				}
+				else
+				{
+					// The centroids coincide, so split the range in half.
+					leftCount = count / 2;
+					split.left = rangeBounds(first, leftCount);
+					split.right = rangeBounds(first + leftCount, count - leftCount);
+				}
+
+				const std::size_t childIndex = nodes.size();
+				nodes.push_back(leaf(split.left, first, leftCount));
+				nodes.push_back(leaf(split.right, first + leftCount, count - leftCount));
+				nodes[nodeIndex].offset = static_cast<std::uint32_t>(childIndex);
+				nodes[nodeIndex].count = 0;
+
+				if (threadCount > 1 && count >= PARALLEL_THRESHOLD)
+				{
+					// Build the second subtree into a separate array on another
+					// thread, then append it after the first subtree, offsetting
+					// its child indices, so that the layout is the same as that
+					// of the serial build.
+					std::vector<Node> second(1, nodes[childIndex + 1]);
+					std::thread thread([&]() { buildSubtree(second, 0, depth + 1, threadCount / 2); });
+					buildSubtree(nodes, childIndex, depth + 1, threadCount - threadCount / 2);
+					thread.join();
+
+					const std::uint32_t base = static_cast<std::uint32_t>(nodes.size() - 1);
+					for (std::size_t i = 0; i < second.size(); ++i)
+					{
+						if (!second[i].isLeaf())
+						{
+							second[i].offset += base;
+						}
+					}
+
+					nodes[childIndex + 1] = second[0];
+					nodes.insert(nodes.end(), second.begin() + 1, second.end());
+				}
+				else
+				{
+					buildSubtree(nodes, childIndex, depth + 1, threadCount);
+					buildSubtree(nodes, childIndex + 1, depth + 1, threadCount);
+				}
+			}
+
+		private:
+			// Returns a leaf holding `count` primitives from index `first`.
+			static Node leaf(const TAABB<T>& box, std::size_t first, std::size_t count)
+			{
+				Node node;
+				node.bounds = box;
+				node.offset = static_cast<std::uint32_t>(first);
+				node.count = static_cast<std::uint32_t>(count);
+				return node;
+			}
+
+			// Returns the bin of the centroid coordinate `c`.
+			static int binIndex(T c, T centroidMin, T scale, int binCount)
+			{
+				return std::min(binCount - 1, static_cast<int>((c - centroidMin) * scale));
+			}
+
+			// Returns the bounds of `count` primitives from index `first`.
+			TAABB<T> rangeBounds(std::size_t first, std::size_t count) const
+			{
+				TAABB<T> box;
+				for (std::size_t i = first; i < first + count; ++i)
+				{
+					box.merge(references[i].bounds);
+				}
+
+				return box;
+			}
+
+			// Finds the split of the primitives in the specified range with
+			// the lowest surface area cost, which is the sum over the two
+			// sides of the number of primitives times the surface area of
+			// their bounds. As in Wald's paper, only planes across the axis
+			// along which the centroids are most spread out are considered,
+			// which costs little in quality and a third of the time of
+			// binning along all three. Returns false if the centroids
+			// coincide.
+			bool findSplit(std::size_t first, std::size_t count, Split<T>& best) const
+			{
+				TAABB<T> centroidBounds;
+				for (std::size_t i = first; i < first + count; ++i)
+				{
+					centroidBounds.merge(references[i].bounds.min + references[i].bounds.max);
+				}
+
+				const TVector3<T> extents = centroidBounds.max - centroidBounds.min;
+				const std::size_t axis = extents.x >= extents.y ? (extents.x >= extents.z ? 0 : 2) : (extents.y >= extents.z ? 1 : 2);
+				const T extent = axis == 0 ? extents.x : axis == 1 ? extents.y : extents.z;
+				if (!(extent > 0.0f))
+				{
+					return false;
+				}
+
+				best.axis = axis;
+				best.binCount = static_cast<int>(std::min(static_cast<std::size_t>(BIN_COUNT), count));
+				best.centroidMin = axis == 0 ? centroidBounds.min.x : axis == 1 ? centroidBounds.min.y : centroidBounds.min.z;
+				best.scale = best.binCount / extent;
+
+				TAABB<T> binBounds[BIN_COUNT];
+				int binCounts[BIN_COUNT] = { 0 };
+				for (std::size_t i = first; i < first + count; ++i)
+				{
+					const TAABB<T>& box = references[i].bounds;
+					const int b = binIndex(centroid(box, axis), best.centroidMin, best.scale, best.binCount);
+					binBounds[b].merge(box);
+					++binCounts[b];
+				}
+
+				// Sweep from the right to find the cost of the right side of
+				// each plane, then from the left to find the total costs. The
+				// plane after bin b puts bins 0 to b on the left. Both sides of
+				// every plane are non-empty, since the first and last bins hold
+				// the extreme centroids.
+				T rightCosts[BIN_COUNT - 1];
+				TAABB<T> box;
+				int n = 0;
+				for (int b = best.binCount - 1; b > 0; --b)
+				{
+					box.merge(binBounds[b]);
+					n += binCounts[b];
+					rightCosts[b - 1] = static_cast<T>(n) * box.surfaceArea();
+				}
+
+				best.plane = 0;
+				best.cost = std::numeric_limits<T>::infinity();
+				box = TAABB<T>();
+				n = 0;
+				for (int b = 0; b + 1 < best.binCount; ++b)
+				{
+					box.merge(binBounds[b]);
+					n += binCounts[b];
+					const T cost = static_cast<T>(n) * box.surfaceArea() + rightCosts[b];
+					if (cost < best.cost)
+					{
+						best.plane = b;
+						best.cost = cost;
+					}
+				}
+
+				best.left = TAABB<T>();
+				best.right = TAABB<T>();
+				for (int b = 0; b < best.binCount; ++b)
+				{
+					(b <= best.plane ? best.left : best.right).merge(binBounds[b]);
+				}
+
+				return true;
+			}
+
+			Reference<T>* references;
+		};
+	}
+
+	template <typename T>
+	const std::size_t TBVH<T>::MAX_DEPTH;
+
+	template <typename T>
+	void TBVH<T>::build(const TAABB<T>* bounds, std::size_t count, std::size_t threadCount)
+	{
+		nodeArray.clear();
+		indexArray.resize(count);
+		if (count == 0)
+		{
+			return;
+		}
+
+		std::vector< Reference<T> > references(count);
+		Node root;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			references[i].bounds = bounds[i];
+			references[i].index = static_cast<std::uint32_t>(i);
+			root.bounds.merge(bounds[i]);
+		}
+
+		root.offset = 0;
+		root.count = static_cast<std::uint32_t>(count);
+		nodeArray.push_back(root);
+
+		const Builder<T> builder(references.data());
+		builder.buildSubtree(nodeArray, 0, 0, std::max(threadCount, std::size_t(1)));
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			indexArray[i] = references[i].index;
+		}
+	}
+
+	template <typename T>
+	void TBVH<T>::refit(const TAABB<T>* bounds)
+	{
+		// The children of each node follow it, so visiting the nodes in
+		// reverse order updates the children before their parents.
+		for (std::size_t i = nodeArray.size(); i-- > 0;)
+		{
+			Node& node = nodeArray[i];
+			if (node.isLeaf())
+			{
+				TAABB<T> box;
+				for (std::uint32_t j = node.offset; j < node.offset + node.count; ++j)
+				{
+					box.merge(bounds[indexArray[j]]);
+				}
+
+				node.bounds = box;
+			}
+			else
+			{
+				node.bounds = merge(nodeArray[node.offset].bounds, nodeArray[node.offset + 1].bounds);
+			}
+		}
+	}
+
+	template <typename T>
+	bool TBVH<T>::intersectTriangles(const TRay<T>& ray, const TTriangle<T>* triangles, T& distance, std::size_t& primitive) const
+	{
+		return intersect(ray, [triangles](const TRay<T>& r, std::size_t i, T& t) { return r.intersects(triangles[i], t); },
+			distance, primitive);
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TBVH<float>;
+	template class TBVH<double>;
+}
@@ -0,0 +1,62 @@
+#include <M3D/Conversion.hpp>
+
+#include "SIMD.hpp"
+
+namespace M3D
+{
+	void convert(const double* in, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if defined(M3D_AVX)
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm_storeu_ps(out + i, _mm256_cvtpd_ps(_mm256_loadu_pd(in + i)));
+			_mm_storeu_ps(out + i + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(in + i + 4)));
+		}
+#endif
+
+#if defined(M3D_SSE2)
+		// Each conversion produces two floats in the low half of a register.
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(in + i));
+			const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(in + i + 2));
+			_mm_storeu_ps(out + i, _mm_movelh_ps(lo, hi));
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = static_cast<float>(in[i]);
+		}
+	}
+
+	void convert(const float* in, double* out, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if defined(M3D_AVX)
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm_loadu_ps(in + i)));
+			_mm256_storeu_pd(out + i + 4, _mm256_cvtps_pd(_mm_loadu_ps(in + i + 4)));
+		}
+#endif
+
+#if defined(M3D_SSE2)
+		// Each conversion widens the two floats in the low half of a register.
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 v = _mm_loadu_ps(in + i);
+			_mm_storeu_pd(out + i, _mm_cvtps_pd(v));
+			_mm_storeu_pd(out + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			out[i] = in[i];
+		}
+	}
+}
@@ -0,0 +1,313 @@
+#include <M3D/DualQuaternion.hpp>
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+
+#include "SIMD.hpp"
+
+#include <cmath>
+#include <cassert>
+
+namespace M3D
+{
+	namespace
+	{
+		// Skins the points in `xs`, `ys` and `zs`, starting from the point at
+		// index `first`, by blending the bones that influence them.
+		template <typename T>
+		void skinArrays(const TDualQuaternion<T>* bones, const unsigned int* boneIndices, const T* boneWeights,
+			std::size_t influences, const T* xs, const T* ys, const T* zs,
+			T* outXs, T* outYs, T* outZs, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const TDualQuaternion<T>& pivot = bones[boneIndices[i]];
+				TDualQuaternion<T> b = boneWeights[i] * pivot;
+
+				for (std::size_t k = 1; k < influences; ++k)
+				{
+					const TDualQuaternion<T>& dq = bones[boneIndices[k * count + i]];
+					const T weight = boneWeights[k * count + i];
+					b = b + (dot(pivot.real, dq.real) < 0.0f ? -weight : weight) * dq;
+				}
+
+				const TVector3<T> p = b.normalized().transformPoint(TVector3<T>(xs[i], ys[i], zs[i]));
+				outXs[i] = p.x;
+				outYs[i] = p.y;
+				outZs[i] = p.z;
+			}
+		}
+
+#if defined(M3D_SSE2)
+		// Loads the bones with the four indices starting at `indices` in
+		// structure-of-arrays form.
+		inline void loadBones(const TDualQuaternion<float>* bones, const unsigned int* indices, __m128 r[4], __m128 d[4])
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				r[j] = _mm_loadu_ps(&bones[indices[j]].real.w);
+				d[j] = _mm_loadu_ps(&bones[indices[j]].dual.w);
+			}
+
+			_MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+			_MM_TRANSPOSE4_PS(d[0], d[1], d[2], d[3]);
+		}
+
+		// Blends the bones that influence the four points starting at index
+		// `i` and transforms the points, given in structure-of-arrays form,
+		// by the blended dual quaternions.
+		void skinLanes(const TDualQuaternion<float>* bones, const unsigned int* boneIndices, const float* boneWeights,
+			std::size_t influences, std::size_t i, std::size_t count, __m128& x, __m128& y, __m128& z)
+		{
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+			// The first influence is the pivot that determines the hemisphere
+			// of the blend.
+			__m128 pivot[4], dual[4];
+			loadBones(bones, &boneIndices[i], pivot, dual);
+
+			__m128 br[4], bd[4];
+			const __m128 w0 = _mm_loadu_ps(&boneWeights[i]);
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				br[j] = _mm_mul_ps(w0, pivot[j]);
+				bd[j] = _mm_mul_ps(w0, dual[j]);
+			}
+
+			for (std::size_t k = 1; k < influences; ++k)
+			{
+				__m128 r[4], d[4];
+				loadBones(bones, &boneIndices[k * count + i], r, d);
+
+				// Negate the weights of the bones in the opposite hemisphere.
+				const __m128 dp = simd::madd(pivot[3], r[3], simd::madd(pivot[2], r[2],
+					simd::madd(pivot[1], r[1], _mm_mul_ps(pivot[0], r[0]))));
+				const __m128 w = _mm_xor_ps(_mm_loadu_ps(&boneWeights[k * count + i]), _mm_and_ps(dp, signMask));
+
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					br[j] = simd::madd(w, r[j], br[j]);
+					bd[j] = simd::madd(w, d[j], bd[j]);
+				}
+			}
+
+			// Normalize the blend. The component of the dual part along the
+			// real part does not contribute to the translation, so it need
+			// not be removed.
+			const __m128 sqrNorm = simd::madd(br[3], br[3], simd::madd(br[2], br[2],
+				simd::madd(br[1], br[1], _mm_mul_ps(br[0], br[0]))));
+			const __m128 invNorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(sqrNorm));
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				br[j] = _mm_mul_ps(br[j], invNorm);
+				bd[j] = _mm_mul_ps(bd[j], invNorm);
+			}
+
+			const __m128 two = _mm_set1_ps(2.0f);
+			const __m128 rw = br[0], rx = br[1], ry = br[2], rz = br[3];
+			const __m128 dw = bd[0], dx = bd[1], dy = bd[2], dz = bd[3];
+
+			// Translation 2 (rw dv - dw rv + cross(rv, dv)).
+			const __m128 tx = _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dx), _mm_mul_ps(dw, rx)),
+				_mm_sub_ps(_mm_mul_ps(ry, dz), _mm_mul_ps(rz, dy))));
+			const __m128 ty = _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dy), _mm_mul_ps(dw, ry)),
+				_mm_sub_ps(_mm_mul_ps(rz, dx), _mm_mul_ps(rx, dz))));
+			const __m128 tz = _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dz), _mm_mul_ps(dw, rz)),
+				_mm_sub_ps(_mm_mul_ps(rx, dy), _mm_mul_ps(ry, dx))));
+
+			// Rotation v + rw c + cross(rv, c), where c = 2 cross(rv, v).
+			const __m128 cx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(ry, z), _mm_mul_ps(rz, y)));
+			const __m128 cy = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(rz, x), _mm_mul_ps(rx, z)));
+			const __m128 cz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(rx, y), _mm_mul_ps(ry, x)));
+
+			x = _mm_add_ps(_mm_add_ps(simd::madd(rw, cx, x), _mm_sub_ps(_mm_mul_ps(ry, cz), _mm_mul_ps(rz, cy))), tx);
+			y = _mm_add_ps(_mm_add_ps(simd::madd(rw, cy, y), _mm_sub_ps(_mm_mul_ps(rz, cx), _mm_mul_ps(rx, cz))), ty);
+			z = _mm_add_ps(_mm_add_ps(simd::madd(rw, cz, z), _mm_sub_ps(_mm_mul_ps(rx, cy), _mm_mul_ps(ry, cx))), tz);
+		}
+#endif
+
+#if defined(M3D_AVX)
+		// Eight lane version of the above.
+		inline void loadBones(const TDualQuaternion<float>* bones, const unsigned int* indices, __m256 r[4], __m256 d[4])
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				const TDualQuaternion<float>& lo = bones[indices[j]];
+				const TDualQuaternion<float>& hi = bones[indices[j + 4]];
+				r[j] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&lo.real.w)), _mm_loadu_ps(&hi.real.w), 1);
+				d[j] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&lo.dual.w)), _mm_loadu_ps(&hi.dual.w), 1);
+			}
+
+			simd::transpose4(r[0], r[1], r[2], r[3]);
+			simd::transpose4(d[0], d[1], d[2], d[3]);
+		}
+
+		// Eight lane version of the above.
+		void skinLanes(const TDualQuaternion<float>* bones, const unsigned int* boneIndices, const float* boneWeights,
+			std::size_t influences, std::size_t i, std::size_t count, __m256& x, __m256& y, __m256& z)
+		{
+			const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+			__m256 pivot[4], dual[4];
+			loadBones(bones, &boneIndices[i], pivot, dual);
+
+			__m256 br[4], bd[4];
+			const __m256 w0 = _mm256_loadu_ps(&boneWeights[i]);
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				br[j] = _mm256_mul_ps(w0, pivot[j]);
+				bd[j] = _mm256_mul_ps(w0, dual[j]);
+			}
+
+			for (std::size_t k = 1; k < influences; ++k)
+			{
+				__m256 r[4], d[4];
+				loadBones(bones, &boneIndices[k * count + i], r, d);
+
+				const __m256 dp = simd::madd(pivot[3], r[3], simd::madd(pivot[2], r[2],
+					simd::madd(pivot[1], r[1], _mm256_mul_ps(pivot[0], r[0]))));
+				const __m256 w = _mm256_xor_ps(_mm256_loadu_ps(&boneWeights[k * count + i]), _mm256_and_ps(dp, signMask));
+
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					br[j] = simd::madd(w, r[j], br[j]);
+					bd[j] = simd::madd(w, d[j], bd[j]);
+				}
+			}
+
+			const __m256 sqrNorm = simd::madd(br[3], br[3], simd::madd(br[2], br[2],
+				simd::madd(br[1], br[1], _mm256_mul_ps(br[0], br[0]))));
+			const __m256 invNorm = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(sqrNorm));
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				br[j] = _mm256_mul_ps(br[j], invNorm);
+				bd[j] = _mm256_mul_ps(bd[j], invNorm);
+			}
+
+			const __m256 two = _mm256_set1_ps(2.0f);
+			const __m256 rw = br[0], rx = br[1], ry = br[2], rz = br[3];
+			const __m256 dw = bd[0], dx = bd[1], dy = bd[2], dz = bd[3];
+
+			const __m256 tx = _mm256_mul_ps(two, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(rw, dx), _mm256_mul_ps(dw, rx)),
+				_mm256_sub_ps(_mm256_mul_ps(ry, dz), _mm256_mul_ps(rz, dy))));
+			const __m256 ty = _mm256_mul_ps(two, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(rw, dy), _mm256_mul_ps(dw, ry)),
+				_mm256_sub_ps(_mm256_mul_ps(rz, dx), _mm256_mul_ps(rx, dz))));
+			const __m256 tz = _mm256_mul_ps(two, _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(rw, dz), _mm256_mul_ps(dw, rz)),
+				_mm256_sub_ps(_mm256_mul_ps(rx, dy), _mm256_mul_ps(ry, dx))));
+
+			const __m256 cx = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(ry, z), _mm256_mul_ps(rz, y)));
+			const __m256 cy = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(rz, x), _mm256_mul_ps(rx, z)));
+			const __m256 cz = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(rx, y), _mm256_mul_ps(ry, x)));
+
+			x = _mm256_add_ps(_mm256_add_ps(simd::madd(rw, cx, x), _mm256_sub_ps(_mm256_mul_ps(ry, cz), _mm256_mul_ps(rz, cy))), tx);
+			y = _mm256_add_ps(_mm256_add_ps(simd::madd(rw, cy, y), _mm256_sub_ps(_mm256_mul_ps(rz, cx), _mm256_mul_ps(rx, cz))), ty);
+			z = _mm256_add_ps(_mm256_add_ps(simd::madd(rw, cz, z), _mm256_sub_ps(_mm256_mul_ps(rx, cy), _mm256_mul_ps(ry, cx))), tz);
+		}
+#endif
+
+#if defined(M3D_SSE2)
+		void skinArrays(const TDualQuaternion<float>* bones, const unsigned int* boneIndices, const float* boneWeights,
+			std::size_t influences, const float* xs, const float* ys, const float* zs,
+			float* outXs, float* outYs, float* outZs, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x = _mm256_loadu_ps(xs + i);
+				__m256 y = _mm256_loadu_ps(ys + i);
+				__m256 z = _mm256_loadu_ps(zs + i);
+				skinLanes(bones, boneIndices, boneWeights, influences, i, count, x, y, z);
+				_mm256_storeu_ps(outXs + i, x);
+				_mm256_storeu_ps(outYs + i, y);
+				_mm256_storeu_ps(outZs + i, z);
+			}
+#endif
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 x = _mm_loadu_ps(xs + i);
+				__m128 y = _mm_loadu_ps(ys + i);
+				__m128 z = _mm_loadu_ps(zs + i);
+				skinLanes(bones, boneIndices, boneWeights, influences, i, count, x, y, z);
+				_mm_storeu_ps(outXs + i, x);
+				_mm_storeu_ps(outYs + i, y);
+				_mm_storeu_ps(outZs + i, z);
+			}
+
+			// Remaining points.
+			skinArrays<float>(bones, boneIndices, boneWeights, influences, xs, ys, zs, outXs, outYs, outZs, i, count);
+		}
+#endif
+	}
+
+	template <typename T>
+	const TDualQuaternion<T> TDualQuaternion<T>::IDENTITY = TDualQuaternion<T>();
+
+	template <typename T>
+	TDualQuaternion<T>::TDualQuaternion(const TMatrix4<T>& A)
+	: TDualQuaternion<T>(TAffine3<T>(A).rotationPart(), TVector3<T>(A[3], A[7], A[11]))
+	{
+		// Nothing to do.
+	}
+
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TDualQuaternion<T>& dq)
+	{
+		out << dq.real << " + ε(" << dq.dual << ")";
+		return out;
+	}
+
+	template <typename T>
+	TDualQuaternion<T> TDualQuaternion<T>::inverse() const
+	{
+		// (r + ε d)^-1 = r^-1 - ε r^-1 d r^-1
+		const TQuaternion<T> invReal = real.inverse();
+		const TQuaternion<T> d = invReal * dual * invReal;
+
+		return TDualQuaternion<T>(invReal, TQuaternion<T>(-d.w, -d.x, -d.y, -d.z));
+	}
+
+	template <typename T>
+	TDualQuaternion<T> blend(const TDualQuaternion<T>* dqs, const T* weights, std::size_t count)
+	{
+		assert(count > 0);
+
+		TDualQuaternion<T> b = weights[0] * dqs[0];
+		for (std::size_t i = 1; i < count; ++i)
+		{
+			// The dual quaternions dq and -dq represent the same
+			// transformation. Blend whichever of the two is closer to the
+			// first.
+			const T weight = dot(dqs[0].real, dqs[i].real) < 0.0f ? -weights[i] : weights[i];
+			b = b + weight * dqs[i];
+		}
+
+		return b.normalized();
+	}
+
+	template <typename T>
+	void skinPoints(const TDualQuaternion<T>* bones, const unsigned int* boneIndices, const T* boneWeights,
+		std::size_t influences, const T* xs, const T* ys, const T* zs,
+		T* outXs, T* outYs, T* outZs, std::size_t count)
+	{
+		assert(influences > 0);
+		skinArrays(bones, boneIndices, boneWeights, influences, xs, ys, zs, outXs, outYs, outZs, 0, count);
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TDualQuaternion<float>;
+	template class TDualQuaternion<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TDualQuaternion<float>& dq);
+	template TDualQuaternion<float> blend(const TDualQuaternion<float>* dqs, const float* weights, std::size_t count);
+	template void skinPoints(const TDualQuaternion<float>* bones, const unsigned int* boneIndices, const float* boneWeights,
+		std::size_t influences, const float* xs, const float* ys, const float* zs,
+		float* outXs, float* outYs, float* outZs, std::size_t count);
+
+	template std::ostream& operator <<(std::ostream& out, const TDualQuaternion<double>& dq);
+	template TDualQuaternion<double> blend(const TDualQuaternion<double>* dqs, const double* weights, std::size_t count);
+	template void skinPoints(const TDualQuaternion<double>* bones, const unsigned int* boneIndices, const double* boneWeights,
+		std::size_t influences, const double* xs, const double* ys, const double* zs,
+		double* outXs, double* outYs, double* outZs, std::size_t count);
+}
@@ -0,0 +1,96 @@
+#include <M3D/FastMath.hpp>
+
+#include "SIMD.hpp"
+
+#include <cassert>
+
+namespace M3D
+{
+	namespace fast
+	{
+		namespace
+		{
+			template <typename T>
+			void normalizeArray(const TVector3<T>* in, TVector3<T>* out, std::size_t first, std::size_t count)
+			{
+				for (std::size_t i = first; i < count; ++i)
+				{
+					out[i] = normalized(in[i]);
+				}
+			}
+
+#if defined(M3D_SSE2)
+			// Scales the vectors in the lanes of x, y and z to unit length.
+			inline void normalizeLanes(__m128& x, __m128& y, __m128& z)
+			{
+				const __m128 sqr = simd::madd(z, z, simd::madd(y, y, _mm_mul_ps(x, x)));
+				const __m128 estimate = _mm_rsqrt_ps(sqr);
+
+				// One Newton-Raphson step, as in rsqrt().
+				const __m128 halfSqr = _mm_mul_ps(_mm_set1_ps(0.5f), sqr);
+				const __m128 scale = _mm_mul_ps(estimate,
+					_mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(halfSqr, estimate), estimate)));
+
+				x = _mm_mul_ps(x, scale);
+				y = _mm_mul_ps(y, scale);
+				z = _mm_mul_ps(z, scale);
+			}
+
+#if defined(M3D_AVX)
+			// Eight lane version of the above.
+			inline void normalizeLanes(__m256& x, __m256& y, __m256& z)
+			{
+				const __m256 sqr = simd::madd(z, z, simd::madd(y, y, _mm256_mul_ps(x, x)));
+				const __m256 estimate = _mm256_rsqrt_ps(sqr);
+
+				const __m256 halfSqr = _mm256_mul_ps(_mm256_set1_ps(0.5f), sqr);
+				const __m256 scale = _mm256_mul_ps(estimate,
+					_mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_mul_ps(halfSqr, estimate), estimate)));
+
+				x = _mm256_mul_ps(x, scale);
+				y = _mm256_mul_ps(y, scale);
+				z = _mm256_mul_ps(z, scale);
+			}
+#endif
+
+			void normalizeArray(const TVector3<float>* in, TVector3<float>* out, std::size_t first, std::size_t count)
+			{
+				static_assert(sizeof(TVector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+				std::size_t i = first;
+
+#if defined(M3D_AVX)
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256 x, y, z;
+					simd::loadPacked3(&in[i].x, x, y, z);
+					normalizeLanes(x, y, z);
+					simd::storePacked3(&out[i].x, x, y, z);
+				}
+#endif
+
+				for (; i + 4 <= count; i += 4)
+				{
+					__m128 x, y, z;
+					simd::loadPacked3(&in[i].x, x, y, z);
+					normalizeLanes(x, y, z);
+					simd::storePacked3(&out[i].x, x, y, z);
+				}
+
+				// Remaining vectors.
+				normalizeArray<float>(in, out, i, count);
+			}
+#endif
+		}
+
+		template <typename T>
+		void normalize(const TVector3<T>* in, TVector3<T>* out, std::size_t count)
+		{
+			normalizeArray(in, out, 0, count);
+		}
+
+		// Explicit instantiations for the supported scalar types.
+		template void normalize(const TVector3<float>* in, TVector3<float>* out, std::size_t count);
+		template void normalize(const TVector3<double>* in, TVector3<double>* out, std::size_t count);
+	}
+}
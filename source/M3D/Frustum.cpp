@@ -0,0 +1,306 @@
+#include <M3D/Frustum.hpp>
+
+#include "SIMD.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace M3D
+{
+	namespace
+	{
+		// Returns `plane` scaled so that its normal has unit length. The far
+		// plane of an infinite projection has a zero normal and a positive
+		// constant, as every point is in front of it, so it is replaced by a
+		// plane that every point passes.
+		template <typename T>
+		TVector4<T> normalizePlane(const TVector4<T>& plane)
+		{
+			const T length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			if (length == T(0))
+			{
+				return TVector4<T>(T(0), T(0), T(0), T(1));
+			}
+
+			return plane / length;
+		}
+
+		// Culls the spheres in `xs`, `ys`, `zs` and `radii`, starting from the
+		// sphere at index `first`, against `frustum`, setting the bits of the
+		// visible spheres in the cleared `visibility` words.
+		template <typename T>
+		void cullSphereArrays(const TFrustum<T>& frustum, const T* xs, const T* ys, const T* zs, const T* radii,
+			std::uint32_t* visibility, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				if (frustum.intersects(TVector3<T>(xs[i], ys[i], zs[i]), radii[i]))
+				{
+					visibility[i / 32] |= std::uint32_t(1) << (i % 32);
+				}
+			}
+		}
+
+		// Culls the boxes in `minXs`, ..., `maxZs`, starting from the box at
+		// index `first`, against `frustum`, setting the bits of the visible
+		// boxes in the cleared `visibility` words.
+		template <typename T>
+		void cullBoxArrays(const TFrustum<T>& frustum, const T* minXs, const T* minYs, const T* minZs,
+			const T* maxXs, const T* maxYs, const T* maxZs,
+			std::uint32_t* visibility, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const TAABB<T> box(TVector3<T>(minXs[i], minYs[i], minZs[i]), TVector3<T>(maxXs[i], maxYs[i], maxZs[i]));
+				if (frustum.intersects(box))
+				{
+					visibility[i / 32] |= std::uint32_t(1) << (i % 32);
+				}
+			}
+		}
+
+		// The vectorised kernels below test a whole register of objects
+		// against each plane and combine the per-plane results into a lane
+		// mask, whose sign bits are then packed into the visibility words.
+		// The objects are processed from index zero in steps of four or
+		// eight, so the bits of one step never straddle two words. An object
+		// is culled when it is strictly behind a plane, which is tested as
+		// "not less than" so that NaNs are kept, as in the scalar tests.
+
+#if defined(M3D_SSE2)
+		void cullSphereArrays(const TFrustum<float>& frustum, const float* xs, const float* ys, const float* zs, const float* radii,
+			std::uint32_t* visibility, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+#if defined(M3D_AVX)
+			const __m256 signMask8 = _mm256_set1_ps(-0.0f);
+			__m256 planes8[6][4];
+			for (std::size_t p = 0; p < 6; ++p)
+			{
+				const TVector4<float>& plane = frustum.plane(p);
+				planes8[p][0] = _mm256_set1_ps(plane.x);
+				planes8[p][1] = _mm256_set1_ps(plane.y);
+				planes8[p][2] = _mm256_set1_ps(plane.z);
+				planes8[p][3] = _mm256_set1_ps(plane.w);
+			}
+
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 x = _mm256_loadu_ps(xs + i);
+				const __m256 y = _mm256_loadu_ps(ys + i);
+				const __m256 z = _mm256_loadu_ps(zs + i);
+				const __m256 negR = _mm256_xor_ps(_mm256_loadu_ps(radii + i), signMask8);
+
+				__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (std::size_t p = 0; p < 6; ++p)
+				{
+					__m256 d = simd::madd(planes8[p][0], x, planes8[p][3]);
+					d = simd::madd(planes8[p][1], y, d);
+					d = simd::madd(planes8[p][2], z, d);
+					visible = _mm256_and_ps(visible, _mm256_cmp_ps(d, negR, _CMP_NLT_UQ));
+				}
+
+				visibility[i / 32] |= std::uint32_t(_mm256_movemask_ps(visible)) << (i % 32);
+			}
+#endif
+
+			__m128 planes4[6][4];
+			for (std::size_t p = 0; p < 6; ++p)
+			{
+				const TVector4<float>& plane = frustum.plane(p);
+				planes4[p][0] = _mm_set1_ps(plane.x);
+				planes4[p][1] = _mm_set1_ps(plane.y);
+				planes4[p][2] = _mm_set1_ps(plane.z);
+				planes4[p][3] = _mm_set1_ps(plane.w);
+			}
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 x = _mm_loadu_ps(xs + i);
+				const __m128 y = _mm_loadu_ps(ys + i);
+				const __m128 z = _mm_loadu_ps(zs + i);
+				const __m128 negR = _mm_xor_ps(_mm_loadu_ps(radii + i), signMask);
+
+				__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (std::size_t p = 0; p < 6; ++p)
+				{
+					__m128 d = simd::madd(planes4[p][0], x, planes4[p][3]);
+					d = simd::madd(planes4[p][1], y, d);
+					d = simd::madd(planes4[p][2], z, d);
+					visible = _mm_and_ps(visible, _mm_cmpnlt_ps(d, negR));
+				}
+
+				visibility[i / 32] |= std::uint32_t(_mm_movemask_ps(visible)) << (i % 32);
+			}
+
+			// Remaining spheres.
+			cullSphereArrays<float>(frustum, xs, ys, zs, radii, visibility, i, count);
+		}
+
+		void cullBoxArrays(const TFrustum<float>& frustum, const float* minXs, const float* minYs, const float* minZs,
+			const float* maxXs, const float* maxYs, const float* maxZs,
+			std::uint32_t* visibility, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+			// The projection of the extents onto each normal is accumulated
+			// negated, using the negated absolute values of the normal, so
+			// that it can be compared with the distance directly.
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 half = _mm_set1_ps(0.5f);
+
+#if defined(M3D_AVX)
+			const __m256 signMask8 = _mm256_set1_ps(-0.0f);
+			__m256 planes8[6][4], negAbs8[6][3];
+			for (std::size_t p = 0; p < 6; ++p)
+			{
+				const TVector4<float>& plane = frustum.plane(p);
+				planes8[p][0] = _mm256_set1_ps(plane.x);
+				planes8[p][1] = _mm256_set1_ps(plane.y);
+				planes8[p][2] = _mm256_set1_ps(plane.z);
+				planes8[p][3] = _mm256_set1_ps(plane.w);
+				negAbs8[p][0] = _mm256_or_ps(planes8[p][0], signMask8);
+				negAbs8[p][1] = _mm256_or_ps(planes8[p][1], signMask8);
+				negAbs8[p][2] = _mm256_or_ps(planes8[p][2], signMask8);
+			}
+
+			const __m256 half8 = _mm256_set1_ps(0.5f);
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 minX = _mm256_loadu_ps(minXs + i), maxX = _mm256_loadu_ps(maxXs + i);
+				const __m256 minY = _mm256_loadu_ps(minYs + i), maxY = _mm256_loadu_ps(maxYs + i);
+				const __m256 minZ = _mm256_loadu_ps(minZs + i), maxZ = _mm256_loadu_ps(maxZs + i);
+				const __m256 cx = _mm256_mul_ps(half8, _mm256_add_ps(minX, maxX));
+				const __m256 cy = _mm256_mul_ps(half8, _mm256_add_ps(minY, maxY));
+				const __m256 cz = _mm256_mul_ps(half8, _mm256_add_ps(minZ, maxZ));
+				const __m256 ex = _mm256_mul_ps(half8, _mm256_sub_ps(maxX, minX));
+				const __m256 ey = _mm256_mul_ps(half8, _mm256_sub_ps(maxY, minY));
+				const __m256 ez = _mm256_mul_ps(half8, _mm256_sub_ps(maxZ, minZ));
+
+				__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (std::size_t p = 0; p < 6; ++p)
+				{
+					__m256 d = simd::madd(planes8[p][0], cx, planes8[p][3]);
+					d = simd::madd(planes8[p][1], cy, d);
+					d = simd::madd(planes8[p][2], cz, d);
+
+					__m256 negR = _mm256_mul_ps(negAbs8[p][0], ex);
+					negR = simd::madd(negAbs8[p][1], ey, negR);
+					negR = simd::madd(negAbs8[p][2], ez, negR);
+
+					visible = _mm256_and_ps(visible, _mm256_cmp_ps(d, negR, _CMP_NLT_UQ));
+				}
+
+				visibility[i / 32] |= std::uint32_t(_mm256_movemask_ps(visible)) << (i % 32);
+			}
+#endif
+
+			__m128 planes4[6][4], negAbs4[6][3];
+			for (std::size_t p = 0; p < 6; ++p)
+			{
+				const TVector4<float>& plane = frustum.plane(p);
+				planes4[p][0] = _mm_set1_ps(plane.x);
+				planes4[p][1] = _mm_set1_ps(plane.y);
+				planes4[p][2] = _mm_set1_ps(plane.z);
+				planes4[p][3] = _mm_set1_ps(plane.w);
+				negAbs4[p][0] = _mm_or_ps(planes4[p][0], signMask);
+				negAbs4[p][1] = _mm_or_ps(planes4[p][1], signMask);
+				negAbs4[p][2] = _mm_or_ps(planes4[p][2], signMask);
+			}
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 minX = _mm_loadu_ps(minXs + i), maxX = _mm_loadu_ps(maxXs + i);
+				const __m128 minY = _mm_loadu_ps(minYs + i), maxY = _mm_loadu_ps(maxYs + i);
+				const __m128 minZ = _mm_loadu_ps(minZs + i), maxZ = _mm_loadu_ps(maxZs + i);
+				const __m128 cx = _mm_mul_ps(half, _mm_add_ps(minX, maxX));
+				const __m128 cy = _mm_mul_ps(half, _mm_add_ps(minY, maxY));
+				const __m128 cz = _mm_mul_ps(half, _mm_add_ps(minZ, maxZ));
+				const __m128 ex = _mm_mul_ps(half, _mm_sub_ps(maxX, minX));
+				const __m128 ey = _mm_mul_ps(half, _mm_sub_ps(maxY, minY));
+				const __m128 ez = _mm_mul_ps(half, _mm_sub_ps(maxZ, minZ));
+
+				__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (std::size_t p = 0; p < 6; ++p)
+				{
+					__m128 d = simd::madd(planes4[p][0], cx, planes4[p][3]);
+					d = simd::madd(planes4[p][1], cy, d);
+					d = simd::madd(planes4[p][2], cz, d);
+
+					__m128 negR = _mm_mul_ps(negAbs4[p][0], ex);
+					negR = simd::madd(negAbs4[p][1], ey, negR);
+					negR = simd::madd(negAbs4[p][2], ez, negR);
+
+					visible = _mm_and_ps(visible, _mm_cmpnlt_ps(d, negR));
+				}
+
+				visibility[i / 32] |= std::uint32_t(_mm_movemask_ps(visible)) << (i % 32);
+			}
+
+			// Remaining boxes.
+			cullBoxArrays<float>(frustum, minXs, minYs, minZs, maxXs, maxYs, maxZs, visibility, i, count);
+		}
+#endif
+	}
+
+	template <typename T>
+	TFrustum<T>::TFrustum(const TMatrix4<T>& A, ClipDepth depth)
+	{
+		TVector4<T> rows[4];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			rows[i] = TVector4<T>(A[4 * i], A[4 * i + 1], A[4 * i + 2], A[4 * i + 3]);
+		}
+
+		// A point is inside when -w <= x <= w, -w <= y <= w and either
+		// -w <= z <= w or 0 <= z <= w, where (x, y, z, w) is the point in
+		// clip space. Each inequality is linear in the point, with
+		// coefficients given by a sum or difference of the rows of `A`.
+		planes[0] = normalizePlane(rows[3] + rows[0]);
+		planes[1] = normalizePlane(rows[3] - rows[0]);
+		planes[2] = normalizePlane(rows[3] + rows[1]);
+		planes[3] = normalizePlane(rows[3] - rows[1]);
+		planes[4] = normalizePlane(depth == CLIP_DEPTH_ZERO_TO_ONE ? rows[2] : rows[3] + rows[2]);
+		planes[5] = normalizePlane(rows[3] - rows[2]);
+	}
+
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TFrustum<T>& frustum)
+	{
+		out << "[";
+		for (std::size_t i = 0; i < 6; ++i)
+		{
+			out << (i == 0 ? "" : ", ") << frustum.planes[i];
+		}
+
+		out << "]";
+		return out;
+	}
+
+	template <typename T>
+	void TFrustum<T>::cullSpheres(const T* xs, const T* ys, const T* zs, const T* radii,
+		std::uint32_t* visibility, std::size_t count) const
+	{
+		std::fill(visibility, visibility + (count + 31) / 32, std::uint32_t(0));
+		cullSphereArrays(*this, xs, ys, zs, radii, visibility, 0, count);
+	}
+
+	template <typename T>
+	void TFrustum<T>::cullBoxes(const T* minXs, const T* minYs, const T* minZs,
+		const T* maxXs, const T* maxYs, const T* maxZs,
+		std::uint32_t* visibility, std::size_t count) const
+	{
+		std::fill(visibility, visibility + (count + 31) / 32, std::uint32_t(0));
+		cullBoxArrays(*this, minXs, minYs, minZs, maxXs, maxYs, maxZs, visibility, 0, count);
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TFrustum<float>;
+	template class TFrustum<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TFrustum<float>& frustum);
+
+	template std::ostream& operator <<(std::ostream& out, const TFrustum<double>& frustum);
+}
@@ -6,127 +6,30 @@
 
 namespace M3D
 {
-	const Matrix3 Matrix3::IDENTITY = Matrix3();
-	const Matrix3 Matrix3::ZERO = Matrix3({0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-
-	Matrix3::Matrix3()
-	: m{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f}
+	namespace
 	{
-		// Nothing to do.
-	}
-
-	Matrix3::Matrix3(const float arr[9])
-	{
-		std::memcpy(m, arr, 9 * sizeof(float));
-	}
-
-	Matrix3::Matrix3(float entry00, float entry01, float entry02,
-		float entry10, float entry11, float entry12,
-		float entry20, float entry21, float entry22)
-	: m{entry00, entry01, entry02, entry10, entry11, entry12, entry20, entry21, entry22}
-	{
-		// Nothing to do.
-	}
-
-	float Matrix3::operator[](std::size_t index) const
-	{
-		assert(index < 9);
-		return m[index];
-	}
-
-	bool operator==(const Matrix3& A, const Matrix3& B)
-	{
-		const float epsilon = 1e-6;
-		for (std::size_t i = 0; i < 9; ++i)
+		// Stores the adjugate of the matrix `m` in `adj` and returns the
+		// determinant, which is expanded along the first row using the
+		// cofactors already in the adjugate.
+		template <typename T>
+		T adjugate(const T* m, T* adj)
 		{
-			if (std::abs(A[i] - B[i]) > epsilon) return false;
+			adj[0] = m[4] * m[8] - m[5] * m[7];
+			adj[1] = m[7] * m[2] - m[8] * m[1];
+			adj[2] = m[1] * m[5] - m[2] * m[4];
+			adj[3] = m[6] * m[5] - m[3] * m[8];
+			adj[4] = m[0] * m[8] - m[6] * m[2];
+			adj[5] = m[3] * m[2] - m[0] * m[5];
+			adj[6] = m[3] * m[7] - m[6] * m[4];
+			adj[7] = m[6] * m[1] - m[0] * m[7];
+			adj[8] = m[0] * m[4] - m[3] * m[1];
+
+			return m[0] * adj[0] + m[1] * adj[3] + m[2] * adj[6];
 		}
-
-		return true;
-	}
-
-	bool operator!=(const Matrix3& A, const Matrix3& B)
-	{
-		return !(A == B);
-	}
-
-	Matrix3 operator+(const Matrix3& A, const Matrix3& B)
-	{
-		return Matrix3(
-			A[0] + B[0], A[1] + B[1], A[2] + B[2],
-			A[3] + B[3], A[4] + B[4], A[5] + B[5],
-			A[6] + B[6], A[7] + B[7], A[8] + B[8]
-		);
-	}
-
-	Matrix3 operator-(const Matrix3& lhs, const Matrix3& rhs)
-	{
-		return Matrix3(
-			lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2],
-			lhs[3] - rhs[3], lhs[4] - rhs[4], lhs[5] - rhs[5],
-			lhs[6] - rhs[6], lhs[7] - rhs[7], lhs[8] - rhs[8]
-		);
-	}
-
-	Matrix3 operator-(const Matrix3& A)
-	{
-		return Matrix3(
-			-A[0], -A[1], -A[2],
-			-A[3], -A[4], -A[5],
-			-A[6], -A[7], -A[8]
-		);
-	}
-
-	Matrix3 operator*(const Matrix3& A, const float s)
-	{
-		return Matrix3(
-			A[0] * s, A[1] * s, A[2] * s,
-			A[3] * s, A[4] * s, A[5] * s,
-			A[6] * s, A[7] * s, A[8] * s
-		);
 	}
 
-	Matrix3 operator*(const float s, const Matrix3& A)
-	{
-		return A * s;
-	}
-
-	Vector3 operator*(const Matrix3& lhs, const Vector3& rhs)
-	{
-		return Vector3(
-			lhs[0] * rhs.x + lhs[1] * rhs.y + lhs[2] * rhs.z,
-			lhs[3] * rhs.x + lhs[4] * rhs.y + lhs[5] * rhs.z,
-			lhs[6] * rhs.x + lhs[7] * rhs.y + lhs[8] * rhs.z
-		);
-	}
-
-	Vector3 operator*(const Vector3& lhs, const Matrix3& rhs)
-	{
-		return Vector3(
-			lhs.x * rhs[0] + lhs.y * rhs[3] + lhs.z * rhs[6],
-			lhs.x * rhs[1] + lhs.y * rhs[4] + lhs.z * rhs[7],
-			lhs.x * rhs[2] + lhs.y * rhs[5] + lhs.z * rhs[8]
-		);
-	}
-
-	Matrix3 operator*(const Matrix3& lhs, const Matrix3& rhs)
-	{
-		return Matrix3(
-			lhs[0] * rhs[0] + lhs[1] * rhs[3] + lhs[2] * rhs[6],
-			lhs[0] * rhs[1] + lhs[1] * rhs[4] + lhs[2] * rhs[7],
-			lhs[0] * rhs[2] + lhs[1] * rhs[5] + lhs[2] * rhs[8],
-
-			lhs[3] * rhs[0] + lhs[4] * rhs[3] + lhs[5] * rhs[6],
-			lhs[3] * rhs[1] + lhs[4] * rhs[4] + lhs[5] * rhs[7],
-			lhs[3] * rhs[2] + lhs[4] * rhs[5] + lhs[5] * rhs[8],
-
-			lhs[6] * rhs[0] + lhs[7] * rhs[3] + lhs[8] * rhs[6],
-			lhs[6] * rhs[1] + lhs[7] * rhs[4] + lhs[8] * rhs[7],
-			lhs[6] * rhs[2] + lhs[7] * rhs[5] + lhs[8] * rhs[8]
-		);
-	}
-
-	std::ostream& operator <<(std::ostream& out, const Matrix3& A)
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TMatrix3<T>& A)
 	{
 		std::string stringMatrix[9];
 		std::size_t columnLengths[3] = {0, 0, 0};
@@ -178,65 +81,66 @@ namespace M3D
 		return out;
 	}
 
-	Matrix3 Matrix3::transposed() const
+	template <typename T>
+	TMatrix3<T> TMatrix3<T>::inverse() const
 	{
-		return Matrix3(
-			m[0], m[3], m[6],
-			m[1], m[4], m[7],
-			m[2], m[5], m[8]
-		);
-	}
+		T adj[9];
+		const T det = adjugate(m, adj);
 
-	void Matrix3::transpose()
-	{
-		std::swap(m[1], m[3]);
-		std::swap(m[2], m[6]);
-		std::swap(m[5], m[7]);
+		// Ensure that the matrix is not singular.
+		assert(det != T(0));
+
+		// Return a copy of the inverse of this matrix.
+		const T invDet = T(1) / det;
+		for (std::size_t i = 0; i < 9; ++i) adj[i] *= invDet;
+		return TMatrix3<T>(adj);
 	}
 
-	float Matrix3::determinant() const
+	template <typename T>
+	bool TMatrix3<T>::tryInverse(TMatrix3<T>& out, const T epsilon) const
 	{
-		return m[0] * m[4] * m[8] + m[1] * m[5] * m[6] + m[2] * m[3] * m[7]
-			- m[6] * m[4] * m[2] - m[7] * m[5] * m[0] - m[8] * m[3] * m[1];
+		T adj[9];
+		const T det = adjugate(m, adj);
+		if (!(std::abs(det) > epsilon)) return false;
+
+		const T invDet = T(1) / det;
+		for (std::size_t i = 0; i < 9; ++i) adj[i] *= invDet;
+		out = TMatrix3<T>(adj);
+
+		return true;
 	}
 
-	Matrix3 Matrix3::inverse() const
+	template <typename T>
+	std::size_t tryInverse(const TMatrix3<T>* matrices, TMatrix3<T>* out, bool* valid, std::size_t count,
+		const typename TMatrix3<T>::Scalar epsilon)
 	{
-		// Ensure that the matrix is not singular.
-		const float det = determinant();
-		assert(det != 0.0f);
+		std::size_t inverted = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			valid[i] = matrices[i].tryInverse(out[i], epsilon);
+			if (valid[i]) ++inverted;
+		}
 
-		// Return a copy of the inverse of this matrix.
-		const float invDet = 1.0f / det;
-		return Matrix3(
-			(m[4] * m[8] - m[5] * m[7]) * invDet,
-			(m[7] * m[2] - m[8] * m[1]) * invDet,
-			(m[1] * m[5] - m[2] * m[4]) * invDet,
-			(m[6] * m[5] - m[3] * m[8]) * invDet,
-			(m[0] * m[8] - m[6] * m[2]) * invDet,
-			(m[3] * m[2] - m[0] * m[5]) * invDet,
-			(m[3] * m[7] - m[6] * m[4]) * invDet,
-			(m[6] * m[1] - m[0] * m[7]) * invDet,
-			(m[0] * m[4] - m[3] * m[1]) * invDet
-		);
+		return inverted;
 	}
 
-	Matrix3 Matrix3::angleAxis(const float angle, const Vector3& axis)
+	template <typename T>
+	TMatrix3<T> TMatrix3<T>::angleAxis(const T angle, const TVector3<T>& axis)
 	{
-		const float c = std::cos(angle);
-		const float s = std::sin(angle);
+		const T c = std::cos(angle);
+		const T s = std::sin(angle);
 
-		const float nc = 1.0f - c;
+		const T nc = 1.0f - c;
 
-		const float nc_xy = nc * axis.x * axis.y;
-		const float nc_yz = nc * axis.y * axis.z;
-		const float nc_xz = nc * axis.x * axis.z;
+		const T nc_xy = nc * axis.x * axis.y;
+		const T nc_yz = nc * axis.y * axis.z;
+		const T nc_xz = nc * axis.x * axis.z;
 
-		const float sx = s * axis.x;
-		const float sy = s * axis.y;
-		const float sz = s * axis.z;
+		const T sx = s * axis.x;
+		const T sy = s * axis.y;
+		const T sz = s * axis.z;
 
-		return Matrix3(
+		return TMatrix3<T>(
 			nc * axis.x * axis.x + c,
 			nc_xy - sz,
 			nc_xz + sy,
@@ -249,17 +153,18 @@ namespace M3D
 		);
 	}
 
-	Matrix3 Matrix3::euler(const Vector3& eulerAngles)
+	template <typename T>
+	TMatrix3<T> TMatrix3<T>::euler(const TVector3<T>& eulerAngles)
 	{
-		const float s1 = std::sin(eulerAngles.x);
-		const float s2 = std::sin(eulerAngles.y);
-		const float s3 = std::sin(eulerAngles.z);
+		const T s1 = std::sin(eulerAngles.x);
+		const T s2 = std::sin(eulerAngles.y);
+		const T s3 = std::sin(eulerAngles.z);
 
-		const float c1 = std::cos(eulerAngles.x);
-		const float c2 = std::cos(eulerAngles.y);
-		const float c3 = std::cos(eulerAngles.z);
+		const T c1 = std::cos(eulerAngles.x);
+		const T c2 = std::cos(eulerAngles.y);
+		const T c3 = std::cos(eulerAngles.z);
 
-		return Matrix3(
+		return TMatrix3<T>(
 			c2 * c3,
 			-c2 * s3,
 			s2,
@@ -272,26 +177,27 @@ namespace M3D
 		);
 	}
 
-	Matrix3 Matrix3::fromToRotation(const Vector3& fromDirection, const Vector3& toDirection)
+	template <typename T>
+	TMatrix3<T> TMatrix3<T>::fromToRotation(const TVector3<T>& fromDirection, const TVector3<T>& toDirection)
 	{
 		assert(fromDirection.sqrMagnitude() > 0.0f && toDirection.sqrMagnitude() > 0.0f);
-		const Vector3 unitFrom = fromDirection.normalized();
-		const Vector3 unitTo = toDirection.normalized();
-		const float d = dot(unitFrom, unitTo);
+		const TVector3<T> unitFrom = fromDirection.normalized();
+		const TVector3<T> unitTo = toDirection.normalized();
+		const T d = dot(unitFrom, unitTo);
 
 		if (d >= 1.0f)
 		{
 			// In the case where the two vectors are pointing in the same
 			// direction, we simply return the identity matrix - corresponding
 			// to no rotation.
-			return Matrix3::IDENTITY;
+			return TMatrix3<T>::IDENTITY;
 		}
 		else if (d <= -1.0f)
 		{
 			// If the two vectors are pointing in opposite directions then we
 			// need to supply a rotation matrix corresponding to a rotation of
 			// PI-radians about an axis orthogonal to the fromDirection.
-			Vector3 axis = cross(unitFrom, Vector3::RIGHT);
+			TVector3<T> axis = cross(unitFrom, TVector3<T>::RIGHT);
 			if (axis.sqrMagnitude() < 1e-6)
 			{
 				// Bad luck. The x-axis and fromDirection are linearly
@@ -299,7 +205,7 @@ namespace M3D
 				// orthogonal to both the y-axis and fromDirection instead.
 				// The y-axis and fromDirection will clearly not be linearly
 				// dependent.
-				axis = cross(unitFrom, Vector3::UP);
+				axis = cross(unitFrom, TVector3<T>::UP);
 			}
 
 			// Note that we need to normalize the axis as the cross product of
@@ -309,18 +215,19 @@ namespace M3D
 		else
 		{
 			// Determine the axis of rotation.
-			Vector3 unitAxis = cross(fromDirection, toDirection);
+			TVector3<T> unitAxis = cross(fromDirection, toDirection);
 			unitAxis.normalize();
 
 			// Find the angle between the two vectors.
-			const float theta = angle(fromDirection, toDirection);
+			const T theta = angle(fromDirection, toDirection);
 
 			// Construct the rotation matrix.
 			return angleAxis(theta, unitAxis);
 		}
 	}
 
-	Matrix3 Matrix3::lookRotation(const Vector3& forward, const Vector3& upwards)
+	template <typename T>
+	TMatrix3<T> TMatrix3<T>::lookRotation(const TVector3<T>& forward, const TVector3<T>& upwards)
 	{
 		// The forward and upwards vectors should not be linearly dependent
 		// (colinear).
@@ -328,24 +235,36 @@ namespace M3D
 
 		// We rotate so that the z-axis points in the specified forward
 		// direction.
-		const Vector3 zAxis = forward.normalized();
+		const TVector3<T> zAxis = forward.normalized();
 
 		// The x-axis is now orthogonal to both the z-axis and the specified
 		// up direction. Note that the z-axis is pointing out of the screen
 		// in the right-handed coordinate system.
-		const Vector3 xAxis = cross(upwards, zAxis).normalized();
+		const TVector3<T> xAxis = cross(upwards, zAxis).normalized();
 
 		// Now the real y-axis is determined to be the vector orthogonal to both
 		// the zAxis and xAxis. This is necessary because we don't know whether
 		// the specified upwards direction is orthogonal to the specified
 		// forward direction.
-		const Vector3 yAxis = cross(zAxis, xAxis).normalized();
+		const TVector3<T> yAxis = cross(zAxis, xAxis).normalized();
 
 		// Finally return the rotation matrix.
-		return Matrix3(
+		return TMatrix3<T>(
 			xAxis.x, yAxis.x, zAxis.x,
 			xAxis.y, yAxis.y, zAxis.y,
 			xAxis.z, yAxis.z, zAxis.z
 		);
 	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TMatrix3<float>;
+	template class TMatrix3<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TMatrix3<float>& A);
+	template std::size_t tryInverse(const TMatrix3<float>* matrices, TMatrix3<float>* out, bool* valid, std::size_t count,
+		const float epsilon);
+
+	template std::ostream& operator <<(std::ostream& out, const TMatrix3<double>& A);
+	template std::size_t tryInverse(const TMatrix3<double>* matrices, TMatrix3<double>* out, bool* valid, std::size_t count,
+		const double epsilon);
 }
@@ -1,187 +1,1188 @@
 #include <M3D/Matrix4.hpp>
+#include <M3D/DualQuaternion.hpp>
 #include <M3D/Quaternion.hpp>
 #include <M3D/Vector3.hpp>
 #include <M3D/Vector4.hpp>
 
+#include "SIMD.hpp"
+
 #include <cmath>
 #include <cassert>
 #include <cstring>
 
 namespace M3D
 {
-	const Matrix4 Matrix4::IDENTITY = Matrix4();
-	const Matrix4 Matrix4::ZERO = Matrix4({
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f
-	});
-
-	Matrix4::Matrix4()
-	: m{1.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 1.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 1.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f}
+	namespace
 	{
-		// Nothing to do.
-	}
+		// The kernels below operate on the row-major entries of the matrices.
+		// The templates are the scalar implementations used for every scalar
+		// type. The single precision overloads that follow them are chosen by
+		// overload resolution and contain the vectorised implementations.
+
+		// Returns the product of the matrix `m` and the column vector `v`.
+		template <typename T>
+		TVector4<T> mulMatVec(const T* m, const TVector4<T>& v)
+		{
+			return TVector4<T>(
+				m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * v.w,
+				m[4] * v.x + m[5] * v.y + m[6] * v.z + m[7] * v.w,
+				m[8] * v.x + m[9] * v.y + m[10] * v.z + m[11] * v.w,
+				m[12] * v.x + m[13] * v.y + m[14] * v.z + m[15] * v.w
+			);
+		}
 
-	Matrix4::Matrix4(const float arr[16])
-	{
-		std::memcpy(m, arr, 16 * sizeof(float));
-	}
+		// Returns the product of the row vector `v` and the matrix `m`.
+		template <typename T>
+		TVector4<T> mulVecMat(const TVector4<T>& v, const T* m)
+		{
+			return TVector4<T>(
+				v.x * m[0] + v.y * m[4] + v.z * m[8] + v.w * m[12],
+				v.x * m[1] + v.y * m[5] + v.z * m[9] + v.w * m[13],
+				v.x * m[2] + v.y * m[6] + v.z * m[10] + v.w * m[14],
+				v.x * m[3] + v.y * m[7] + v.z * m[11] + v.w * m[15]
+			);
+		}
 
-	Matrix4::Matrix4(float entry00, float entry01, float entry02, float entry03,
-		float entry10, float entry11, float entry12, float entry13,
-		float entry20, float entry21, float entry22, float entry23,
-		float entry30, float entry31, float entry32, float entry33)
-	: m{entry00, entry01, entry02, entry03,
-		entry10, entry11, entry12, entry13,
-		entry20, entry21, entry22, entry23,
-		entry30, entry31, entry32, entry33}
-	{
-		// Nothing to do.
-	}
+		// Stores the product of the matrices `a` and `b` in `c`.
+		template <typename T>
+		void mulMatMat(const T* a, const T* b, T* c)
+		{
+			for (std::size_t i = 0; i < 16; i += 4)
+			{
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					c[i + j] = a[i] * b[j] + a[i + 1] * b[4 + j]
+						+ a[i + 2] * b[8 + j] + a[i + 3] * b[12 + j];
+				}
+			}
+		}
 
-	Matrix4::Matrix4(const Matrix3& A)
-	: m{A[0], A[1], A[2], 0.0f,
-		A[3], A[4], A[5], 0.0f,
-		A[6], A[7], A[8], 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f}
-	{
-		// Nothing to do.
-	}
+		// Transposes the matrix `m` in place.
+		template <typename T>
+		void transposeInPlace(T* m)
+		{
+			std::swap(m[1], m[4]);
+			std::swap(m[2], m[8]);
+			std::swap(m[3], m[12]);
+			std::swap(m[6], m[9]);
+			std::swap(m[7], m[13]);
+			std::swap(m[11], m[14]);
+		}
 
-	Matrix4::Matrix4(const Quaternion& q)
-	: m{1.0f - 2.0f * q.y * q.y - 2.0f * q.z * q.z,
-		2.0f * q.x * q.y - 2.0f * q.w * q.z,
-		2.0f * q.x * q.z + 2.0f * q.w * q.y,
-		0.0f,
-		2.0f * q.x * q.y + 2.0f * q.w * q.z,
-		1.0f - 2.0f * q.x * q.x - 2.0f * q.z * q.z,
-		2.0f * q.y * q.z - 2.0f * q.w * q.x,
-		0.0f,
-		2.0f * q.x * q.z - 2.0f * q.w * q.y,
-		2.0f * q.y * q.z + 2.0f * q.w * q.x,
-		1.0f - 2.0f * q.x * q.x - 2.0f * q.y * q.y,
-		1.0f}
-	{
-		// Nothing to do.
-	}
+		// Stores the adjugate of the matrix `m` in `inv` and returns the
+		// determinant, which is expanded along the first row using the
+		// cofactors already in the adjugate.
+		template <typename T>
+		T adjugate(const T* m, T* inv)
+		{
+			// Taken from the MESA implementation of the GLU library.
+			inv[0] =	m[5]  * m[10] * m[15] -
+						m[5]  * m[11] * m[14] -
+						m[9]  * m[6]  * m[15] +
+						m[9]  * m[7]  * m[14] +
+						m[13] * m[6]  * m[11] -
+						m[13] * m[7]  * m[10];
+
+			inv[4] =   -m[4]  * m[10] * m[15] +
+						m[4]  * m[11] * m[14] +
+						m[8]  * m[6]  * m[15] -
+						m[8]  * m[7]  * m[14] -
+						m[12] * m[6]  * m[11] +
+						m[12] * m[7]  * m[10];
+
+			inv[8] =	m[4]  * m[9]  * m[15] -
+						m[4]  * m[11] * m[13] -
+						m[8]  * m[5]  * m[15] +
+						m[8]  * m[7]  * m[13] +
+						m[12] * m[5]  * m[11] -
+						m[12] * m[7]  * m[9];
+
+			inv[12] =  -m[4]  * m[9]  * m[14] +
+						m[4]  * m[10] * m[13] +
+						m[8]  * m[5]  * m[14] -
+						m[8]  * m[6]  * m[13] -
+						m[12] * m[5]  * m[10] +
+						m[12] * m[6]  * m[9];
+
+			inv[1] =   -m[1]  * m[10] * m[15] +
+						m[1]  * m[11] * m[14] +
+						m[9]  * m[2]  * m[15] -
+						m[9]  * m[3]  * m[14] -
+						m[13] * m[2]  * m[11] +
+						m[13] * m[3]  * m[10];
+
+			inv[5] =	m[0]  * m[10] * m[15] -
+						m[0]  * m[11] * m[14] -
+						m[8]  * m[2]  * m[15] +
+						m[8]  * m[3]  * m[14] +
+						m[12] * m[2]  * m[11] -
+						m[12] * m[3]  * m[10];
+
+			inv[9] =   -m[0]  * m[9]  * m[15] +
+						m[0]  * m[11] * m[13] +
+						m[8]  * m[1]  * m[15] -
+						m[8]  * m[3]  * m[13] -
+						m[12] * m[1]  * m[11] +
+						m[12] * m[3]  * m[9];
+
+			inv[13] =	m[0]  * m[9]  * m[14] -
+						m[0]  * m[10] * m[13] -
+						m[8]  * m[1]  * m[14] +
+						m[8]  * m[2]  * m[13] +
+						m[12] * m[1]  * m[10] -
+						m[12] * m[2]  * m[9];
+
+			inv[2] =	m[1]  * m[6]  * m[15] -
+						m[1]  * m[7]  * m[14] -
+						m[5]  * m[2]  * m[15] +
+						m[5]  * m[3]  * m[14] +
+						m[13] * m[2]  * m[7]  -
+						m[13] * m[3]  * m[6];
+
+			inv[6] =   -m[0]  * m[6]  * m[15] +
+						m[0]  * m[7]  * m[14] +
+						m[4]  * m[2]  * m[15] -
+						m[4]  * m[3]  * m[14] -
+						m[12] * m[2]  * m[7]  +
+						m[12] * m[3]  * m[6];
+
+			inv[10] =   m[0]  * m[5]  * m[15] -
+						m[0]  * m[7]  * m[13] -
+						m[4]  * m[1]  * m[15] +
+						m[4]  * m[3]  * m[13] +
+						m[12] * m[1]  * m[7]  -
+						m[12] * m[3]  * m[5];
+
+			inv[14] =  -m[0]  * m[5]  * m[14] +
+						m[0]  * m[6]  * m[13] +
+						m[4]  * m[1]  * m[14] -
+						m[4]  * m[2]  * m[13] -
+						m[12] * m[1]  * m[6]  +
+						m[12] * m[2]  * m[5];
+
+			inv[3] =   -m[1]  * m[6]  * m[11] +
+						m[1]  * m[7]  * m[10] +
+						m[5]  * m[2]  * m[11] -
+						m[5]  * m[3]  * m[10] -
+						m[9]  * m[2]  * m[7]  +
+						m[9]  * m[3]  * m[6];
+
+			inv[7] =	m[0]  * m[6]  * m[11] -
+						m[0]  * m[7]  * m[10] -
+						m[4]  * m[2]  * m[11] +
+						m[4]  * m[3]  * m[10] +
+						m[8]  * m[2]  * m[7]  -
+						m[8]  * m[3]  * m[6];
+
+			inv[11] =  -m[0]  * m[5]  * m[11] +
+						m[0]  * m[7]  * m[9]  +
+						m[4]  * m[1]  * m[11] -
+						m[4]  * m[3]  * m[9]  -
+						m[8]  * m[1]  * m[7]  +
+						m[8]  * m[3]  * m[5];
+
+			inv[15] =	m[0]  * m[5]  * m[10] -
+						m[0]  * m[6]  * m[9]  -
+						m[4]  * m[1]  * m[10] +
+						m[4]  * m[2]  * m[9]  +
+						m[8]  * m[1]  * m[6]  -
+						m[8]  * m[2]  * m[5];
+
+			// Determinant.
+			return m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+		}
 
-	float Matrix4::operator[](std::size_t index) const
-	{
-		assert(index < 16);
-		return m[index];
-	}
+		// Stores the inverse of the non-singular matrix `m` in `inv`.
+		template <typename T>
+		void invert(const T* m, T* inv)
+		{
+			const T det = adjugate(m, inv);
 
-	bool operator==(const Matrix4& A, const Matrix4& B)
-	{
-		const float epsilon = 1e-6;
-		for (std::size_t i = 0; i < 16; ++i)
+			// Ensure that the matrix is not singular.
+			assert(det != T(0));
+
+			const T invDet = T(1) / det;
+			for (std::size_t i = 0; i < 16; ++i) inv[i] *= invDet;
+		}
+
+		// Stores the inverse of the matrix `m` in `inv` and returns true if the
+		// magnitude of the determinant exceeds `epsilon`. Otherwise returns
+		// false and leaves `inv` unchanged.
+		template <typename T>
+		bool tryInvert(const T* m, T* inv, const T epsilon)
 		{
-			if (std::abs(A[i] - B[i]) > epsilon) return false;
+			T adj[16];
+			const T det = adjugate(m, adj);
+			if (!(std::abs(det) > epsilon)) return false;
+
+			const T invDet = T(1) / det;
+			for (std::size_t i = 0; i < 16; ++i) inv[i] = adj[i] * invDet;
+			return true;
 		}
 
-		return true;
-	}
+		// Stores the transpose of the inverse of the non-singular matrix `m`
+		// in `inv`.
+		template <typename T>
+		void invertTransposed(const T* m, T* inv)
+		{
+			invert(m, inv);
+			transposeInPlace(inv);
+		}
 
-	bool operator!=(const Matrix4& A, const Matrix4& B)
-	{
-		return !(A == B);
-	}
+		// Returns the transpose of the inverse of the upper left 3x3 block of
+		// the matrix `m`. This is the cofactor matrix of the block divided by
+		// its determinant, and the rows of the cofactor matrix are the cross
+		// products of pairs of rows of the block.
+		template <typename T>
+		TMatrix3<T> normalBlock(const T* m)
+		{
+			const TVector3<T> r0(m[0], m[1], m[2]);
+			const TVector3<T> r1(m[4], m[5], m[6]);
+			const TVector3<T> r2(m[8], m[9], m[10]);
+
+			const TVector3<T> n0 = cross(r1, r2);
+			const TVector3<T> n1 = cross(r2, r0);
+			const TVector3<T> n2 = cross(r0, r1);
+
+			const T det = dot(r0, n0);
+			assert(det != T(0));
+			const T invDet = T(1) / det;
+
+			return TMatrix3<T>(
+				n0.x * invDet, n0.y * invDet, n0.z * invDet,
+				n1.x * invDet, n1.y * invDet, n1.z * invDet,
+				n2.x * invDet, n2.y * invDet, n2.z * invDet
+			);
+		}
 
-	Matrix4 operator+(const Matrix4& A, const Matrix4& B)
-	{
-		return Matrix4(
-			A[0] + B[0], A[1] + B[1], A[2] + B[2], A[3] + B[3],
-			A[4] + B[4], A[5] + B[5], A[6] + B[6], A[7] + B[7],
-			A[8] + B[8], A[9] + B[9], A[10] + B[10], A[11] + B[11],
-			A[12] + B[12], A[13] + B[13], A[14] + B[14], A[15] + B[15]
-		);
-	}
+		// Transforms the column vectors (x, y, z, w) given in structure of
+		// arrays form by the affine part of the matrix `A`, starting from the
+		// element at index `first`.
+		template <typename T>
+		void transformArrays(const TMatrix4<T>& A, const T w,
+			const T* xs, const T* ys, const T* zs,
+			T* outXs, T* outYs, T* outZs, std::size_t first, std::size_t count)
+		{
+			const T m00 = A[0], m01 = A[1], m02 = A[2], m03 = A[3] * w;
+			const T m10 = A[4], m11 = A[5], m12 = A[6], m13 = A[7] * w;
+			const T m20 = A[8], m21 = A[9], m22 = A[10], m23 = A[11] * w;
 
-	Matrix4 operator-(const Matrix4& lhs, const Matrix4& rhs)
-	{
-		return Matrix4(
-			lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2], lhs[3] - rhs[3],
-			lhs[4] - rhs[4], lhs[5] - rhs[5], lhs[6] - rhs[6], lhs[7] - rhs[7],
-			lhs[8] - rhs[8], lhs[9] - rhs[9], lhs[10] - rhs[10], lhs[11] - rhs[11],
-			lhs[12] - rhs[12], lhs[13] - rhs[13], lhs[14] - rhs[14], lhs[15] - rhs[15]
-		);
-	}
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const T x = xs[i];
+				const T y = ys[i];
+				const T z = zs[i];
 
-	Matrix4 operator-(const Matrix4& A)
-	{
-		return Matrix4(
-			-A[0], -A[1], -A[2], -A[3],
-			-A[4], -A[5], -A[6], -A[7],
-			-A[8], -A[9], -A[10], -A[11],
-			-A[12], -A[13], -A[14], -A[15]
-		);
-	}
+				outXs[i] = m00 * x + m01 * y + m02 * z + m03;
+				outYs[i] = m10 * x + m11 * y + m12 * z + m13;
+				outZs[i] = m20 * x + m21 * y + m22 * z + m23;
+			}
+		}
 
-	Matrix4 operator*(const Matrix4& A, const float s)
-	{
-		return Matrix4(
-			A[0] * s, A[1] * s, A[2] * s, A[3] * s,
-			A[4] * s, A[5] * s, A[6] * s, A[7] * s,
-			A[8] * s, A[9] * s, A[10] * s, A[11] * s,
-			A[12] * s, A[13] * s, A[14] * s, A[15] * s
-		);
+		// Transforms the column vectors (x, y, z, w) for each of the packed
+		// 3D vectors by the affine part of the matrix `A`, starting from the
+		// vector at index `first`.
+		template <typename T>
+		void transformPacked(const TMatrix4<T>& A, const T w, const TVector3<T>* in, TVector3<T>* out,
+			std::size_t first, std::size_t count)
+		{
+			const T m00 = A[0], m01 = A[1], m02 = A[2], m03 = A[3] * w;
+			const T m10 = A[4], m11 = A[5], m12 = A[6], m13 = A[7] * w;
+			const T m20 = A[8], m21 = A[9], m22 = A[10], m23 = A[11] * w;
+
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const TVector3<T> v = in[i];
+
+				out[i] = TVector3<T>(
+					m00 * v.x + m01 * v.y + m02 * v.z + m03,
+					m10 * v.x + m11 * v.y + m12 * v.z + m13,
+					m20 * v.x + m21 * v.y + m22 * v.z + m23
+				);
+			}
+		}
+
+		// Multiplies each of the column vectors in `in` by the matrix `A`.
+		template <typename T>
+		void transformVectors(const TMatrix4<T>& A, const TVector4<T>* in, TVector4<T>* out, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				out[i] = A * in[i];
+			}
+		}
+
+		// Returns the row-major entries of the matrices in the array `A`,
+		// which follow one another with no padding.
+		template <typename T>
+		const T* entries(const TMatrix4<T>* A)
+		{
+			static_assert(sizeof(TMatrix4<T>) == 16 * sizeof(T), "Matrix4 must be tightly packed");
+			return reinterpret_cast<const T*>(A);
+		}
+
+		template <typename T>
+		T* entries(TMatrix4<T>* A)
+		{
+			static_assert(sizeof(TMatrix4<T>) == 16 * sizeof(T), "Matrix4 must be tightly packed");
+			return reinterpret_cast<T*>(A);
+		}
+
+		// Stores the products of the corresponding matrices in the arrays `a`
+		// and `b` in `c`. The products are formed in a temporary, so `c` may
+		// be the same as either input.
+		template <typename T>
+		void mulMatMatPairs(const T* a, const T* b, T* c, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				T product[16];
+				mulMatMat(a + 16 * i, b + 16 * i, product);
+				std::memcpy(c + 16 * i, product, sizeof(product));
+			}
+		}
+
+		// Stores the products of the matrix `a` and each matrix in the array
+		// `b` in `c`. The shared matrix is copied first, so it may itself be
+		// one of the outputs.
+		template <typename T>
+		void mulMatMatLeft(const T* a, const T* b, T* c, std::size_t count)
+		{
+			T shared[16];
+			std::memcpy(shared, a, sizeof(shared));
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				T product[16];
+				mulMatMat(shared, b + 16 * i, product);
+				std::memcpy(c + 16 * i, product, sizeof(product));
+			}
+		}
+
+		// Stores the products of each matrix in the array `a` and the matrix
+		// `b` in `c`.
+		template <typename T>
+		void mulMatMatRight(const T* a, const T* b, T* c, std::size_t count)
+		{
+			T shared[16];
+			std::memcpy(shared, b, sizeof(shared));
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				T product[16];
+				mulMatMat(a + 16 * i, shared, product);
+				std::memcpy(c + 16 * i, product, sizeof(product));
+			}
+		}
+
+		// Stores the inverses, or the transposes of the inverses, of the
+		// non-singular matrices in the array `m` in `inv`. Each result is
+		// formed in a temporary, so `inv` may be the same as `m`.
+		template <typename T>
+		void invertArray(const T* m, T* inv, std::size_t count, bool transposed)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				T result[16];
+				if (transposed) invertTransposed(m + 16 * i, result);
+				else invert(m + 16 * i, result);
+				std::memcpy(inv + 16 * i, result, sizeof(result));
+			}
+		}
+
+		// Stores the inverses of the matrices in the array `m` whose
+		// determinants exceed `epsilon` in magnitude in `inv`, leaving the
+		// others unchanged, and flags which were inverted in `valid`. Returns
+		// the number of matrices inverted.
+		template <typename T>
+		std::size_t tryInvertArray(const T* m, T* inv, bool* valid, std::size_t count, const T epsilon)
+		{
+			std::size_t inverted = 0;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				valid[i] = tryInvert(m + 16 * i, inv + 16 * i, epsilon);
+				if (valid[i]) ++inverted;
+			}
+
+			return inverted;
+		}
+
+#if defined(M3D_SSE2)
+		// Helpers for the 2x2 block inverse. Each 2x2 matrix is stored
+		// row-major in a single register as (a00, a01, a10, a11).
+
+		// Returns the product A * B.
+		inline __m128 mat2Mul(__m128 A, __m128 B)
+		{
+			return _mm_add_ps(
+				_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 3, 0))),
+				_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2)))
+			);
+		}
+
+		// Returns the product adj(A) * B.
+		inline __m128 mat2AdjMul(__m128 A, __m128 B)
+		{
+			return _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 3, 3)), B),
+				_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2)))
+			);
+		}
+
+		// Returns the product A * adj(B).
+		inline __m128 mat2MulAdj(__m128 A, __m128 B)
+		{
+			return _mm_sub_ps(
+				_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 3, 0, 3))),
+				_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2)))
+			);
+		}
+
+		TVector4<float> mulMatVec(const float* m, const TVector4<float>& v)
+		{
+			// Transpose the rows so that the product is a linear combination of
+			// the columns, avoiding horizontal additions.
+			__m128 c0 = _mm_loadu_ps(&m[0]);
+			__m128 c1 = _mm_loadu_ps(&m[4]);
+			__m128 c2 = _mm_loadu_ps(&m[8]);
+			__m128 c3 = _mm_loadu_ps(&m[12]);
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			__m128 r = _mm_mul_ps(c0, _mm_set1_ps(v.x));
+			r = simd::madd(c1, _mm_set1_ps(v.y), r);
+			r = simd::madd(c2, _mm_set1_ps(v.z), r);
+			r = simd::madd(c3, _mm_set1_ps(v.w), r);
+
+			float result[4];
+			_mm_storeu_ps(result, r);
+			return TVector4<float>(result[0], result[1], result[2], result[3]);
+		}
+
+		TVector4<float> mulVecMat(const TVector4<float>& v, const float* m)
+		{
+			__m128 r = _mm_mul_ps(_mm_set1_ps(v.x), _mm_loadu_ps(&m[0]));
+			r = simd::madd(_mm_set1_ps(v.y), _mm_loadu_ps(&m[4]), r);
+			r = simd::madd(_mm_set1_ps(v.z), _mm_loadu_ps(&m[8]), r);
+			r = simd::madd(_mm_set1_ps(v.w), _mm_loadu_ps(&m[12]), r);
+
+			float result[4];
+			_mm_storeu_ps(result, r);
+			return TVector4<float>(result[0], result[1], result[2], result[3]);
+		}
+
+		void mulMatMat(const float* a, const float* b, float* c)
+		{
+#if defined(M3D_AVX)
+			// Each row of the product is a linear combination of the rows of
+			// `b`. The rows of `b` are broadcast to both 128-bit halves so that
+			// two rows of the product are computed per iteration.
+			const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[0]));
+			const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[4]));
+			const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[8]));
+			const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[12]));
+
+			for (std::size_t i = 0; i < 16; i += 8)
+			{
+				const __m256 r0 = _mm256_loadu_ps(&a[i]);
+				__m256 r = _mm256_mul_ps(simd::splat<0>(r0), b0);
+				r = simd::madd(simd::splat<1>(r0), b1, r);
+				r = simd::madd(simd::splat<2>(r0), b2, r);
+				r = simd::madd(simd::splat<3>(r0), b3, r);
+				_mm256_storeu_ps(&c[i], r);
+			}
+#else
+			// Each row of the product is a linear combination of the rows of
+			// `b`, weighted by the entries in the corresponding row of `a`.
+			const __m128 b0 = _mm_loadu_ps(&b[0]);
+			const __m128 b1 = _mm_loadu_ps(&b[4]);
+			const __m128 b2 = _mm_loadu_ps(&b[8]);
+			const __m128 b3 = _mm_loadu_ps(&b[12]);
+
+			for (std::size_t i = 0; i < 16; i += 4)
+			{
+				const __m128 r0 = _mm_loadu_ps(&a[i]);
+				__m128 r = _mm_mul_ps(simd::splat<0>(r0), b0);
+				r = simd::madd(simd::splat<1>(r0), b1, r);
+				r = simd::madd(simd::splat<2>(r0), b2, r);
+				r = simd::madd(simd::splat<3>(r0), b3, r);
+				_mm_storeu_ps(&c[i], r);
+			}
+#endif
+		}
+
+		void transposeInPlace(float* m)
+		{
+			__m128 r0 = _mm_loadu_ps(&m[0]);
+			__m128 r1 = _mm_loadu_ps(&m[4]);
+			__m128 r2 = _mm_loadu_ps(&m[8]);
+			__m128 r3 = _mm_loadu_ps(&m[12]);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(&m[0], r0);
+			_mm_storeu_ps(&m[4], r1);
+			_mm_storeu_ps(&m[8], r2);
+			_mm_storeu_ps(&m[12], r3);
+		}
+
+		// Computes the rows of the inverse of the matrix `m` and returns its
+		// determinant. The rows are not finite if the matrix is singular.
+		inline float invertRows(const float* m, __m128& i0, __m128& i1, __m128& i2, __m128& i3)
+		{
+			// Vectorised form of the cofactor expansion below. The matrix is
+			// partitioned into the 2x2 blocks
+			//
+			//     | A B |
+			//     | C D |
+			//
+			// each of which is held row-major in a single register. The adjugate
+			// is then assembled from products of the 2x2 blocks and their
+			// adjugates, sharing the 2x2 minors that the scalar expansion
+			// recomputes for every cofactor.
+			const __m128 r0 = _mm_loadu_ps(&m[0]);
+			const __m128 r1 = _mm_loadu_ps(&m[4]);
+			const __m128 r2 = _mm_loadu_ps(&m[8]);
+			const __m128 r3 = _mm_loadu_ps(&m[12]);
+
+			const __m128 A = _mm_movelh_ps(r0, r1);
+			const __m128 B = _mm_movehl_ps(r1, r0);
+			const __m128 C = _mm_movelh_ps(r2, r3);
+			const __m128 D = _mm_movehl_ps(r3, r2);
+
+			// Determinants of the blocks as (|A|, |B|, |C|, |D|).
+			const __m128 detSub = _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+				_mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0)))
+			);
+			const __m128 detA = simd::splat<0>(detSub);
+			const __m128 detB = simd::splat<1>(detSub);
+			const __m128 detC = simd::splat<2>(detSub);
+			const __m128 detD = simd::splat<3>(detSub);
+
+			// adj(D) * C and adj(A) * B.
+			const __m128 DC = mat2AdjMul(D, C);
+			const __m128 AB = mat2AdjMul(A, B);
+
+			// The blocks of the adjugate of the matrix.
+			__m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Mul(B, DC));
+			__m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Mul(C, AB));
+			__m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MulAdj(D, AB));
+			__m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MulAdj(A, DC));
+
+			// Determinant.
+			const __m128 tr = simd::horizontalSum(_mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0))));
+			const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+			// Scale by the reciprocal of the determinant, folding in the signs of
+			// the adjugate of each block.
+			const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+			X = _mm_mul_ps(X, invDet);
+			Y = _mm_mul_ps(Y, invDet);
+			Z = _mm_mul_ps(Z, invDet);
+			W = _mm_mul_ps(W, invDet);
+
+			// Apply the block adjugate permutation while reassembling the rows.
+			i0 = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3));
+			i1 = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2));
+			i2 = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3));
+			i3 = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2));
+
+			return _mm_cvtss_f32(det);
+		}
+
+		void invert(const float* m, float* inv)
+		{
+			__m128 i0, i1, i2, i3;
+			const float det = invertRows(m, i0, i1, i2, i3);
+
+			// Ensure that the matrix is not singular.
+			assert(det != 0.0f);
+			(void) det;
+
+			_mm_storeu_ps(&inv[0], i0);
+			_mm_storeu_ps(&inv[4], i1);
+			_mm_storeu_ps(&inv[8], i2);
+			_mm_storeu_ps(&inv[12], i3);
+		}
+
+		void invertTransposed(const float* m, float* inv)
+		{
+			// The inverse is transposed in registers, saving the round trip
+			// through memory of a separate transpose.
+			__m128 i0, i1, i2, i3;
+			const float det = invertRows(m, i0, i1, i2, i3);
+			assert(det != 0.0f);
+			(void) det;
+
+			_MM_TRANSPOSE4_PS(i0, i1, i2, i3);
+			_mm_storeu_ps(&inv[0], i0);
+			_mm_storeu_ps(&inv[4], i1);
+			_mm_storeu_ps(&inv[8], i2);
+			_mm_storeu_ps(&inv[12], i3);
+		}
+
+		bool tryInvert(const float* m, float* inv, const float epsilon)
+		{
+			// The inverse is computed before the determinant is checked, and
+			// discarded if the matrix is singular.
+			__m128 i0, i1, i2, i3;
+			const float det = invertRows(m, i0, i1, i2, i3);
+			if (!(std::abs(det) > epsilon)) return false;
+
+			_mm_storeu_ps(&inv[0], i0);
+			_mm_storeu_ps(&inv[4], i1);
+			_mm_storeu_ps(&inv[8], i2);
+			_mm_storeu_ps(&inv[12], i3);
+			return true;
+		}
+
+		// Returns the cross product of the 3D vectors in the first three
+		// lanes of `a` and `b`. The last lane is left unspecified.
+		inline __m128 cross3(__m128 a, __m128 b)
+		{
+			const __m128 ayzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 byzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 c = _mm_sub_ps(_mm_mul_ps(a, byzx), _mm_mul_ps(ayzx, b));
+			return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+		}
+
+		TMatrix3<float> normalBlock(const float* m)
+		{
+			const __m128 r0 = _mm_loadu_ps(&m[0]);
+			const __m128 r1 = _mm_loadu_ps(&m[4]);
+			const __m128 r2 = _mm_loadu_ps(&m[8]);
+
+			const __m128 n0 = cross3(r1, r2);
+			const __m128 n1 = cross3(r2, r0);
+			const __m128 n2 = cross3(r0, r1);
+
+			// The last lane of the first row, the translation, is cleared so
+			// that the sum of the lanes of the product is the determinant.
+			const __m128 xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			const __m128 det = simd::horizontalSum(_mm_mul_ps(_mm_and_ps(r0, xyz), n0));
+			assert(_mm_cvtss_f32(det) != 0.0f);
+			const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+			float result[12];
+			_mm_storeu_ps(&result[0], _mm_mul_ps(n0, invDet));
+			_mm_storeu_ps(&result[4], _mm_mul_ps(n1, invDet));
+			_mm_storeu_ps(&result[8], _mm_mul_ps(n2, invDet));
+			return TMatrix3<float>(
+				result[0], result[1], result[2],
+				result[4], result[5], result[6],
+				result[8], result[9], result[10]
+			);
+		}
+
+		void transformArrays(const TMatrix4<float>& A, const float w,
+			const float* xs, const float* ys, const float* zs,
+			float* outXs, float* outYs, float* outZs, std::size_t first, std::size_t count)
+		{
+			const float m00 = A[0], m01 = A[1], m02 = A[2], m03 = A[3] * w;
+			const float m10 = A[4], m11 = A[5], m12 = A[6], m13 = A[7] * w;
+			const float m20 = A[8], m21 = A[9], m22 = A[10], m23 = A[11] * w;
+
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			{
+				const __m256 a00 = _mm256_set1_ps(m00), a01 = _mm256_set1_ps(m01), a02 = _mm256_set1_ps(m02), a03 = _mm256_set1_ps(m03);
+				const __m256 a10 = _mm256_set1_ps(m10), a11 = _mm256_set1_ps(m11), a12 = _mm256_set1_ps(m12), a13 = _mm256_set1_ps(m13);
+				const __m256 a20 = _mm256_set1_ps(m20), a21 = _mm256_set1_ps(m21), a22 = _mm256_set1_ps(m22), a23 = _mm256_set1_ps(m23);
+
+				for (; i + 8 <= count; i += 8)
+				{
+					const __m256 x = _mm256_loadu_ps(xs + i);
+					const __m256 y = _mm256_loadu_ps(ys + i);
+					const __m256 z = _mm256_loadu_ps(zs + i);
+
+					_mm256_storeu_ps(outXs + i, simd::madd(a00, x, simd::madd(a01, y, simd::madd(a02, z, a03))));
+					_mm256_storeu_ps(outYs + i, simd::madd(a10, x, simd::madd(a11, y, simd::madd(a12, z, a13))));
+					_mm256_storeu_ps(outZs + i, simd::madd(a20, x, simd::madd(a21, y, simd::madd(a22, z, a23))));
+				}
+			}
+#endif
+
+			const __m128 a00 = _mm_set1_ps(m00), a01 = _mm_set1_ps(m01), a02 = _mm_set1_ps(m02), a03 = _mm_set1_ps(m03);
+			const __m128 a10 = _mm_set1_ps(m10), a11 = _mm_set1_ps(m11), a12 = _mm_set1_ps(m12), a13 = _mm_set1_ps(m13);
+			const __m128 a20 = _mm_set1_ps(m20), a21 = _mm_set1_ps(m21), a22 = _mm_set1_ps(m22), a23 = _mm_set1_ps(m23);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 x = _mm_loadu_ps(xs + i);
+				const __m128 y = _mm_loadu_ps(ys + i);
+				const __m128 z = _mm_loadu_ps(zs + i);
+
+				_mm_storeu_ps(outXs + i, simd::madd(a00, x, simd::madd(a01, y, simd::madd(a02, z, a03))));
+				_mm_storeu_ps(outYs + i, simd::madd(a10, x, simd::madd(a11, y, simd::madd(a12, z, a13))));
+				_mm_storeu_ps(outZs + i, simd::madd(a20, x, simd::madd(a21, y, simd::madd(a22, z, a23))));
+			}
+
+			// Remaining elements.
+			transformArrays<float>(A, w, xs, ys, zs, outXs, outYs, outZs, i, count);
+		}
+
+		void transformPacked(const TMatrix4<float>& A, const float w, const TVector3<float>* in, TVector3<float>* out,
+			std::size_t first, std::size_t count)
+		{
+			static_assert(sizeof(TVector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+			const __m128 a00 = _mm_set1_ps(A[0]), a01 = _mm_set1_ps(A[1]), a02 = _mm_set1_ps(A[2]), a03 = _mm_set1_ps(A[3] * w);
+			const __m128 a10 = _mm_set1_ps(A[4]), a11 = _mm_set1_ps(A[5]), a12 = _mm_set1_ps(A[6]), a13 = _mm_set1_ps(A[7] * w);
+			const __m128 a20 = _mm_set1_ps(A[8]), a21 = _mm_set1_ps(A[9]), a22 = _mm_set1_ps(A[10]), a23 = _mm_set1_ps(A[11] * w);
+
+			// Four vectors at a time, converted to and from structure of
+			// arrays form in registers.
+			std::size_t i = first;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 x, y, z;
+				simd::loadPacked3(&in[i].x, x, y, z);
+
+				simd::storePacked3(&out[i].x,
+					simd::madd(a00, x, simd::madd(a01, y, simd::madd(a02, z, a03))),
+					simd::madd(a10, x, simd::madd(a11, y, simd::madd(a12, z, a13))),
+					simd::madd(a20, x, simd::madd(a21, y, simd::madd(a22, z, a23))));
+			}
+
+			// Remaining vectors.
+			transformPacked<float>(A, w, in, out, i, count);
+		}
+
+		void transformVectors(const TMatrix4<float>& A, const TVector4<float>* in, TVector4<float>* out, std::size_t count)
+		{
+			static_assert(sizeof(TVector4<float>) == 4 * sizeof(float), "Vector4 must be tightly packed");
+
+			// The columns of the matrix are kept in registers for the whole array.
+			const __m128 c0 = _mm_setr_ps(A[0], A[4], A[8], A[12]);
+			const __m128 c1 = _mm_setr_ps(A[1], A[5], A[9], A[13]);
+			const __m128 c2 = _mm_setr_ps(A[2], A[6], A[10], A[14]);
+			const __m128 c3 = _mm_setr_ps(A[3], A[7], A[11], A[15]);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const __m128 v = _mm_loadu_ps(&in[i].x);
+
+				__m128 r = _mm_mul_ps(c0, simd::splat<0>(v));
+				r = simd::madd(c1, simd::splat<1>(v), r);
+				r = simd::madd(c2, simd::splat<2>(v), r);
+				r = simd::madd(c3, simd::splat<3>(v), r);
+				_mm_storeu_ps(&out[i].x, r);
+			}
+		}
+
+		void mulMatMatPairs(const float* a, const float* b, float* c, std::size_t count)
+		{
+			// The kernel reads all of each row of `a` and all of `b` before
+			// writing the corresponding row of the product, so `c` may be the
+			// same as either input.
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				mulMatMat(a + 16 * i, b + 16 * i, c + 16 * i);
+			}
+		}
+
+		void mulMatMatLeft(const float* a, const float* b, float* c, std::size_t count)
+		{
+			// Each row of a product is a linear combination of the rows of the
+			// matrix from `b`, weighted by a row of `a`. The weights are splat
+			// once for the whole array.
+#if defined(M3D_AVX)
+			// Two rows of the product are computed per register, so the weights
+			// for rows 0 and 1, and for rows 2 and 3, share registers.
+			__m256 w[8];
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				w[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a[k])), _mm_set1_ps(a[4 + k]), 1);
+				w[4 + k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a[8 + k])), _mm_set1_ps(a[12 + k]), 1);
+			}
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const float* m = b + 16 * i;
+				const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m[0]));
+				const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m[4]));
+				const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m[8]));
+				const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&m[12]));
+
+				__m256 r01 = _mm256_mul_ps(w[0], b0);
+				r01 = simd::madd(w[1], b1, r01);
+				r01 = simd::madd(w[2], b2, r01);
+				r01 = simd::madd(w[3], b3, r01);
+
+				__m256 r23 = _mm256_mul_ps(w[4], b0);
+				r23 = simd::madd(w[5], b1, r23);
+				r23 = simd::madd(w[6], b2, r23);
+				r23 = simd::madd(w[7], b3, r23);
+
+				_mm256_storeu_ps(c + 16 * i, r01);
+				_mm256_storeu_ps(c + 16 * i + 8, r23);
+			}
+#else
+			__m128 w[16];
+			for (std::size_t k = 0; k < 16; ++k)
+			{
+				w[k] = _mm_set1_ps(a[k]);
+			}
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const float* m = b + 16 * i;
+				const __m128 b0 = _mm_loadu_ps(&m[0]);
+				const __m128 b1 = _mm_loadu_ps(&m[4]);
+				const __m128 b2 = _mm_loadu_ps(&m[8]);
+				const __m128 b3 = _mm_loadu_ps(&m[12]);
+
+				for (std::size_t row = 0; row < 16; row += 4)
+				{
+					__m128 r = _mm_mul_ps(w[row], b0);
+					r = simd::madd(w[row + 1], b1, r);
+					r = simd::madd(w[row + 2], b2, r);
+					r = simd::madd(w[row + 3], b3, r);
+					_mm_storeu_ps(c + 16 * i + row, r);
+				}
+			}
+#endif
+		}
+
+		void mulMatMatRight(const float* a, const float* b, float* c, std::size_t count)
+		{
+			// As for a single product, each row of a product is a linear
+			// combination of the rows of `b`, which are loaded once for the
+			// whole array.
+#if defined(M3D_AVX)
+			const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[0]));
+			const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[4]));
+			const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[8]));
+			const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&b[12]));
+
+			for (std::size_t i = 0; i < 16 * count; i += 8)
+			{
+				const __m256 r0 = _mm256_loadu_ps(&a[i]);
+				__m256 r = _mm256_mul_ps(simd::splat<0>(r0), b0);
+				r = simd::madd(simd::splat<1>(r0), b1, r);
+				r = simd::madd(simd::splat<2>(r0), b2, r);
+				r = simd::madd(simd::splat<3>(r0), b3, r);
+				_mm256_storeu_ps(&c[i], r);
+			}
+#else
+			const __m128 b0 = _mm_loadu_ps(&b[0]);
+			const __m128 b1 = _mm_loadu_ps(&b[4]);
+			const __m128 b2 = _mm_loadu_ps(&b[8]);
+			const __m128 b3 = _mm_loadu_ps(&b[12]);
+
+			for (std::size_t i = 0; i < 16 * count; i += 4)
+			{
+				const __m128 r0 = _mm_loadu_ps(&a[i]);
+				__m128 r = _mm_mul_ps(simd::splat<0>(r0), b0);
+				r = simd::madd(simd::splat<1>(r0), b1, r);
+				r = simd::madd(simd::splat<2>(r0), b2, r);
+				r = simd::madd(simd::splat<3>(r0), b3, r);
+				_mm_storeu_ps(&c[i], r);
+			}
+#endif
+		}
+
+		// Lane-wise arithmetic on registers that each hold one entry of
+		// several matrices, so that the structure of arrays inverse below is
+		// written once for both register widths.
+		inline __m128 add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+		inline __m128 mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+		inline __m128 sub(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+		inline __m128 negate(__m128 a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+		inline __m128 reciprocal(__m128 a) { return _mm_div_ps(_mm_set1_ps(1.0f), a); }
+		inline bool anyZero(__m128 a) { return _mm_movemask_ps(_mm_cmpeq_ps(a, _mm_setzero_ps())) != 0; }
+		inline __m128 exceeds(__m128 a, __m128 epsilon) { return _mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), a), epsilon); }
+		inline __m128 select(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+		inline int movemask(__m128 mask) { return _mm_movemask_ps(mask); }
+
+#if defined(M3D_AVX)
+		inline __m256 add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+		inline __m256 mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+		inline __m256 sub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+		inline __m256 negate(__m256 a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+		inline __m256 reciprocal(__m256 a) { return _mm256_div_ps(_mm256_set1_ps(1.0f), a); }
+		inline bool anyZero(__m256 a) { return _mm256_movemask_ps(_mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ)) != 0; }
+		inline __m256 exceeds(__m256 a, __m256 epsilon) { return _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a), epsilon, _CMP_GT_OQ); }
+		inline __m256 select(__m256 mask, __m256 a, __m256 b) { return _mm256_blendv_ps(b, a, mask); }
+		inline int movemask(__m256 mask) { return _mm256_movemask_ps(mask); }
+#endif
+
+		// Returns `x` * `p` - `y` * `q` + `z` * `r`, the expansion of a 3x3
+		// minor along a row.
+		template <typename V>
+		inline V cofactor(V x, V p, V y, V q, V z, V r)
+		{
+			return simd::madd(z, r, sub(mul(x, p), mul(y, q)));
+		}
+
+		// Stores in `inv` the entries of the inverses of the matrices whose
+		// entries are in `a`, with entry (r, c) of every matrix held in
+		// `a[4 * r + c]`, and returns their determinants. Following the
+		// Laplace expansion theorem, the 2x2 minors of the top two rows and of
+		// the bottom two rows are shared by all of the cofactors. The inverses
+		// of singular matrices are not finite.
+		template <typename V>
+		V invertLanes(const V* a, V* inv)
+		{
+			const V s0 = sub(mul(a[0], a[5]), mul(a[4], a[1]));
+			const V s1 = sub(mul(a[0], a[6]), mul(a[4], a[2]));
+			const V s2 = sub(mul(a[0], a[7]), mul(a[4], a[3]));
+			const V s3 = sub(mul(a[1], a[6]), mul(a[5], a[2]));
+			const V s4 = sub(mul(a[1], a[7]), mul(a[5], a[3]));
+			const V s5 = sub(mul(a[2], a[7]), mul(a[6], a[3]));
+
+			const V c0 = sub(mul(a[8], a[13]), mul(a[12], a[9]));
+			const V c1 = sub(mul(a[8], a[14]), mul(a[12], a[10]));
+			const V c2 = sub(mul(a[8], a[15]), mul(a[12], a[11]));
+			const V c3 = sub(mul(a[9], a[14]), mul(a[13], a[10]));
+			const V c4 = sub(mul(a[9], a[15]), mul(a[13], a[11]));
+			const V c5 = sub(mul(a[10], a[15]), mul(a[14], a[11]));
+
+			const V det = add(cofactor(s0, c5, s1, c4, s2, c3), cofactor(s3, c2, s4, c1, s5, c0));
+
+			// The cofactors of the entries (r, c) with r + c odd are negated by
+			// scaling them by the negated reciprocal of the determinant.
+			const V p = reciprocal(det);
+			const V n = negate(p);
+
+			inv[0] = mul(cofactor(a[5], c5, a[6], c4, a[7], c3), p);
+			inv[1] = mul(cofactor(a[1], c5, a[2], c4, a[3], c3), n);
+			inv[2] = mul(cofactor(a[13], s5, a[14], s4, a[15], s3), p);
+			inv[3] = mul(cofactor(a[9], s5, a[10], s4, a[11], s3), n);
+
+			inv[4] = mul(cofactor(a[4], c5, a[6], c2, a[7], c1), n);
+			inv[5] = mul(cofactor(a[0], c5, a[2], c2, a[3], c1), p);
+			inv[6] = mul(cofactor(a[12], s5, a[14], s2, a[15], s1), n);
+			inv[7] = mul(cofactor(a[8], s5, a[10], s2, a[11], s1), p);
+
+			inv[8] = mul(cofactor(a[4], c4, a[5], c2, a[7], c0), p);
+			inv[9] = mul(cofactor(a[0], c4, a[1], c2, a[3], c0), n);
+			inv[10] = mul(cofactor(a[12], s4, a[13], s2, a[15], s0), p);
+			inv[11] = mul(cofactor(a[8], s4, a[9], s2, a[11], s0), n);
+
+			inv[12] = mul(cofactor(a[4], c3, a[5], c1, a[6], c0), n);
+			inv[13] = mul(cofactor(a[0], c3, a[1], c1, a[2], c0), p);
+			inv[14] = mul(cofactor(a[12], s3, a[13], s1, a[14], s0), n);
+			inv[15] = mul(cofactor(a[8], s3, a[9], s1, a[10], s0), p);
+
+			return det;
+		}
+
+		// Loads four consecutive matrices from `m` in structure of arrays
+		// form, with entry (r, c) of each in lane i of `a[4 * r + c]`.
+		inline void loadLanes(const float* m, __m128* a)
+		{
+			for (std::size_t r = 0; r < 4; ++r)
+			{
+				__m128 x0 = _mm_loadu_ps(m + 4 * r);
+				__m128 x1 = _mm_loadu_ps(m + 16 + 4 * r);
+				__m128 x2 = _mm_loadu_ps(m + 32 + 4 * r);
+				__m128 x3 = _mm_loadu_ps(m + 48 + 4 * r);
+				_MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+				a[4 * r] = x0;
+				a[4 * r + 1] = x1;
+				a[4 * r + 2] = x2;
+				a[4 * r + 3] = x3;
+			}
+		}
+
+		// Stores four matrices held in structure of arrays form as
+		// consecutive matrices at `m`, transposing each if `transposed`.
+		inline void storeLanes(float* m, const __m128* a, bool transposed)
+		{
+			const std::size_t across = transposed ? 4 : 1;
+			const std::size_t down = transposed ? 1 : 4;
+			for (std::size_t r = 0; r < 4; ++r)
+			{
+				__m128 x0 = a[down * r];
+				__m128 x1 = a[down * r + across];
+				__m128 x2 = a[down * r + 2 * across];
+				__m128 x3 = a[down * r + 3 * across];
+				_MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+				_mm_storeu_ps(m + 4 * r, x0);
+				_mm_storeu_ps(m + 16 + 4 * r, x1);
+				_mm_storeu_ps(m + 32 + 4 * r, x2);
+				_mm_storeu_ps(m + 48 + 4 * r, x3);
+			}
+		}
+
+#if defined(M3D_AVX)
+		// Loads eight consecutive matrices from `m` in structure of arrays
+		// form. The first four are held in the low halves of the registers.
+		inline void loadLanes(const float* m, __m256* a)
+		{
+			for (std::size_t r = 0; r < 4; ++r)
+			{
+				__m256 x[4];
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					x[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(m + 16 * k + 4 * r)),
+						_mm_loadu_ps(m + 16 * (k + 4) + 4 * r), 1);
+				}
+
+				simd::transpose4(x[0], x[1], x[2], x[3]);
+				for (std::size_t k = 0; k < 4; ++k) a[4 * r + k] = x[k];
+			}
+		}
+
+		// Stores eight matrices held in structure of arrays form as
+		// consecutive matrices at `m`, transposing each if `transposed`.
+		inline void storeLanes(float* m, const __m256* a, bool transposed)
+		{
+			const std::size_t across = transposed ? 4 : 1;
+			const std::size_t down = transposed ? 1 : 4;
+			for (std::size_t r = 0; r < 4; ++r)
+			{
+				__m256 x[4];
+				for (std::size_t k = 0; k < 4; ++k) x[k] = a[down * r + k * across];
+
+				simd::transpose4(x[0], x[1], x[2], x[3]);
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					_mm_storeu_ps(m + 16 * k + 4 * r, _mm256_castps256_ps128(x[k]));
+					_mm_storeu_ps(m + 16 * (k + 4) + 4 * r, _mm256_extractf128_ps(x[k], 1));
+				}
+			}
+		}
+#endif
+
+		void invertArray(const float* m, float* inv, std::size_t count, bool transposed)
+		{
+			// Groups of matrices are inverted together in structure of arrays
+			// form, one matrix per lane. Each group is loaded in full before
+			// any of it is stored, so `inv` may be the same as `m`.
+			std::size_t i = 0;
+
+#if defined(M3D_AVX)
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 a[16], b[16];
+				loadLanes(m + 16 * i, a);
+
+				// Ensure that none of the matrices is singular.
+				const __m256 det = invertLanes(a, b);
+				assert(!anyZero(det));
+				(void) det;
+
+				storeLanes(inv + 16 * i, b, transposed);
+			}
+#endif
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 a[16], b[16];
+				loadLanes(m + 16 * i, a);
+
+				// Ensure that none of the matrices is singular.
+				const __m128 det = invertLanes(a, b);
+				assert(!anyZero(det));
+				(void) det;
+
+				storeLanes(inv + 16 * i, b, transposed);
+			}
+
+			// Remaining matrices.
+			for (; i < count; ++i)
+			{
+				if (transposed) invertTransposed(m + 16 * i, inv + 16 * i);
+				else invert(m + 16 * i, inv + 16 * i);
+			}
+		}
+
+		// Inverts the group of matrices at `m`, one in each lane of `V`, into
+		// `inv`, except for those whose determinants do not exceed `epsilon`
+		// in magnitude, which are left unchanged. Returns a bit mask of the
+		// matrices inverted.
+		template <typename V>
+		int tryInvertGroup(const float* m, float* inv, V epsilon)
+		{
+			V a[16], b[16];
+			loadLanes(m, a);
+			const V valid = exceeds(invertLanes(a, b), epsilon);
+
+			const int bits = movemask(valid);
+			if (bits == 0) return 0;
+
+			if (bits != (1 << (sizeof(V) / sizeof(float))) - 1)
+			{
+				// Blend in the current outputs for the singular matrices, so
+				// that storing the whole group leaves them unchanged.
+				V previous[16];
+				loadLanes(inv, previous);
+				for (std::size_t k = 0; k < 16; ++k) b[k] = select(valid, b[k], previous[k]);
+			}
+
+			storeLanes(inv, b, false);
+			return bits;
+		}
+
+		std::size_t tryInvertArray(const float* m, float* inv, bool* valid, std::size_t count, const float epsilon)
+		{
+			std::size_t inverted = 0;
+			std::size_t i = 0;
+
+#if defined(M3D_AVX)
+			const __m256 epsilon8 = _mm256_set1_ps(epsilon);
+			for (; i + 8 <= count; i += 8)
+			{
+				const int bits = tryInvertGroup(m + 16 * i, inv + 16 * i, epsilon8);
+				for (std::size_t k = 0; k < 8; ++k)
+				{
+					valid[i + k] = ((bits >> k) & 1) != 0;
+					if (valid[i + k]) ++inverted;
+				}
+			}
+#endif
+
+			const __m128 epsilon4 = _mm_set1_ps(epsilon);
+			for (; i + 4 <= count; i += 4)
+			{
+				const int bits = tryInvertGroup(m + 16 * i, inv + 16 * i, epsilon4);
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					valid[i + k] = ((bits >> k) & 1) != 0;
+					if (valid[i + k]) ++inverted;
+				}
+			}
+
+			// Remaining matrices.
+			for (; i < count; ++i)
+			{
+				valid[i] = tryInvert(m + 16 * i, inv + 16 * i, epsilon);
+				if (valid[i]) ++inverted;
+			}
+
+			return inverted;
+		}
+#endif
 	}
 
-	Matrix4 operator*(const float s, const Matrix4& A)
+	template <typename T>
+	TMatrix4<T>::TMatrix4(const TDualQuaternion<T>& dq)
+	: TMatrix4<T>(TAffine3<T>(dq.real, dq.translationPart()))
 	{
-		return A * s;
+		// Nothing to do.
 	}
 
-	Vector4 operator*(const Matrix4& lhs, const Vector4& rhs)
+	template <typename T>
+	TVector4<T> TMatrix4<T>::multiply(const TMatrix4<T>& lhs, const TVector4<T>& rhs)
 	{
-		return Vector4(
-			lhs[0] * rhs.x + lhs[1] * rhs.y + lhs[2] * rhs.z + lhs[3] * rhs.w,
-			lhs[4] * rhs.x + lhs[5] * rhs.y + lhs[6] * rhs.z + lhs[7] * rhs.w,
-			lhs[8] * rhs.x + lhs[9] * rhs.y + lhs[10] * rhs.z + lhs[11] * rhs.w,
-			lhs[12] * rhs.x + lhs[13] * rhs.y + lhs[14] * rhs.z + lhs[15] * rhs.w
-		);
+		return mulMatVec(lhs.m, rhs);
 	}
 
-	Vector4 operator*(const Vector4& lhs, const Matrix4& rhs)
+	template <typename T>
+	TVector4<T> TMatrix4<T>::multiply(const TVector4<T>& lhs, const TMatrix4<T>& rhs)
 	{
-		return Vector4(
-			lhs.x * rhs[0] + lhs.y * rhs[4] + lhs.z * rhs[8] + lhs.w * rhs[12],
-			lhs.x * rhs[1] + lhs.y * rhs[5] + lhs.z * rhs[9] + lhs.w * rhs[13],
-			lhs.x * rhs[2] + lhs.y * rhs[6] + lhs.z * rhs[10] + lhs.w * rhs[14],
-			lhs.x * rhs[3] + lhs.y * rhs[7] + lhs.z * rhs[11] + lhs.w * rhs[15]
-		);
+		return mulVecMat(lhs, rhs.m);
 	}
 
-	Matrix4 operator*(const Matrix4& lhs, const Matrix4& rhs)
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::multiply(const TMatrix4<T>& lhs, const TMatrix4<T>& rhs)
 	{
-		return Matrix4(
-			lhs[0] * rhs[0] + lhs[1] * rhs[4] + lhs[2] * rhs[8] + lhs[3] * rhs[12],
-			lhs[0] * rhs[1] + lhs[1] * rhs[5] + lhs[2] * rhs[9] + lhs[3] * rhs[13],
-			lhs[0] * rhs[2] + lhs[1] * rhs[6] + lhs[2] * rhs[10] + lhs[3] * rhs[14],
-			lhs[0] * rhs[3] + lhs[1] * rhs[7] + lhs[2] * rhs[11] + lhs[3] * rhs[15],
-
-			lhs[4] * rhs[0] + lhs[5] * rhs[4] + lhs[6] * rhs[8] + lhs[7] * rhs[12],
-			lhs[4] * rhs[1] + lhs[5] * rhs[5] + lhs[6] * rhs[9] + lhs[7] * rhs[13],
-			lhs[4] * rhs[2] + lhs[5] * rhs[6] + lhs[6] * rhs[10] + lhs[7] * rhs[14],
-			lhs[4] * rhs[3] + lhs[5] * rhs[7] + lhs[6] * rhs[11] + lhs[7] * rhs[15],
-
-			lhs[8] * rhs[0] + lhs[9] * rhs[4] + lhs[10] * rhs[8] + lhs[11] * rhs[12],
-			lhs[8] * rhs[1] + lhs[9] * rhs[5] + lhs[10] * rhs[9] + lhs[11] * rhs[13],
-			lhs[8] * rhs[2] + lhs[9] * rhs[6] + lhs[10] * rhs[10] + lhs[11] * rhs[14],
-			lhs[8] * rhs[3] + lhs[9] * rhs[7] + lhs[10] * rhs[11] + lhs[11] * rhs[15],
-
-			lhs[12] * rhs[0] + lhs[13] * rhs[4] + lhs[14] * rhs[8] + lhs[15] * rhs[12],
-			lhs[12] * rhs[1] + lhs[13] * rhs[5] + lhs[14] * rhs[9] + lhs[15] * rhs[13],
-			lhs[12] * rhs[2] + lhs[13] * rhs[6] + lhs[14] * rhs[10] + lhs[15] * rhs[14],
-			lhs[12] * rhs[3] + lhs[13] * rhs[7] + lhs[14] * rhs[11] + lhs[15] * rhs[15]
-		);
+		TMatrix4<T> C;
+		mulMatMat(lhs.m, rhs.m, C.m);
+		return C;
 	}
 
-	std::ostream& operator <<(std::ostream& out, const Matrix4& A)
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TMatrix4<T>& A)
 	{
 		std::string stringMatrix[16];
 		std::size_t columnLengths[4] = {0, 0, 0, 0};
@@ -233,211 +1234,110 @@ namespace M3D
 		return out;
 	}
 
-	Matrix4 Matrix4::transposed() const
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::transposed() const
 	{
-		return Matrix4(
-			m[0], m[4], m[8], m[12],
-			m[1], m[5], m[9], m[13],
-			m[2], m[6], m[10], m[14],
-			m[3], m[7], m[11], m[15]
-		);
+		TMatrix4<T> A(*this);
+		A.transpose();
+		return A;
 	}
 
-	void Matrix4::transpose()
+	template <typename T>
+	void TMatrix4<T>::transpose()
 	{
-		std::swap(m[1], m[4]);
-		std::swap(m[2], m[8]);
-		std::swap(m[3], m[12]);
-		std::swap(m[6], m[9]);
-		std::swap(m[7], m[13]);
-		std::swap(m[11], m[14]);
+		transposeInPlace(m);
 	}
 
-	float Matrix4::determinant() const
+	template <typename T>
+	T TMatrix4<T>::determinant() const
 	{
-		const float det1 = m[10] * (m[15] * m[5] - m[7] * m[13]) + m[11] * (m[13] * m[6] - m[5] * m[14]) + m[9] * (m[14] * m[7] - m[6] * m[15]);
-		const float det2 = m[1] * (m[10] * m[15] - m[11] * m[14]) + m[2] * (m[11] * m[13] - m[9] * m[15]) + m[3] * (m[9] * m[14] - m[10] * m[13]);
-		const float det3 = m[1] * (m[6] * m[15] - m[7] * m[14]) + m[2] * (m[7] * m[13] - m[5] * m[15]) + m[3] * (m[5] * m[14] - m[6] * m[13]);
-		const float det4 = m[1] * (m[6] * m[11] - m[7] * m[10]) + m[2] * (m[7] * m[9] - m[5] * m[11]) + m[3] * (m[5] * m[10] - m[6] * m[9]);
+		const T det1 = m[10] * (m[15] * m[5] - m[7] * m[13]) + m[11] * (m[13] * m[6] - m[5] * m[14]) + m[9] * (m[14] * m[7] - m[6] * m[15]);
+		const T det2 = m[1] * (m[10] * m[15] - m[11] * m[14]) + m[2] * (m[11] * m[13] - m[9] * m[15]) + m[3] * (m[9] * m[14] - m[10] * m[13]);
+		const T det3 = m[1] * (m[6] * m[15] - m[7] * m[14]) + m[2] * (m[7] * m[13] - m[5] * m[15]) + m[3] * (m[5] * m[14] - m[6] * m[13]);
+		const T det4 = m[1] * (m[6] * m[11] - m[7] * m[10]) + m[2] * (m[7] * m[9] - m[5] * m[11]) + m[3] * (m[5] * m[10] - m[6] * m[9]);
 
 		return (m[0] * det1 - m[4] * det2 + m[8] * det3 - m[12] * det4);
 	}
 
-	// Taken from the MESA implementation of the GLU library.
-	Matrix4 Matrix4::inverse() const
-	{
-		float inv[16];
-
-		inv[0] =	m[5]  * m[10] * m[15] -
-					m[5]  * m[11] * m[14] -
-					m[9]  * m[6]  * m[15] +
-					m[9]  * m[7]  * m[14] +
-					m[13] * m[6]  * m[11] -
-					m[13] * m[7]  * m[10];
-
-		inv[4] =   -m[4]  * m[10] * m[15] +
-					m[4]  * m[11] * m[14] +
-					m[8]  * m[6]  * m[15] -
-					m[8]  * m[7]  * m[14] -
-					m[12] * m[6]  * m[11] +
-					m[12] * m[7]  * m[10];
-
-		inv[8] =	m[4]  * m[9]  * m[15] -
-					m[4]  * m[11] * m[13] -
-					m[8]  * m[5]  * m[15] +
-					m[8]  * m[7]  * m[13] +
-					m[12] * m[5]  * m[11] -
-					m[12] * m[7]  * m[9];
-
-		inv[12] =  -m[4]  * m[9]  * m[14] +
-					m[4]  * m[10] * m[13] +
-					m[8]  * m[5]  * m[14] -
-					m[8]  * m[6]  * m[13] -
-					m[12] * m[5]  * m[10] +
-					m[12] * m[6]  * m[9];
-
-		inv[1] =   -m[1]  * m[10] * m[15] +
-					m[1]  * m[11] * m[14] +
-					m[9]  * m[2]  * m[15] -
-					m[9]  * m[3]  * m[14] -
-					m[13] * m[2]  * m[11] +
-					m[13] * m[3]  * m[10];
-
-		inv[5] =	m[0]  * m[10] * m[15] -
-					m[0]  * m[11] * m[14] -
-					m[8]  * m[2]  * m[15] +
-					m[8]  * m[3]  * m[14] +
-					m[12] * m[2]  * m[11] -
-					m[12] * m[3]  * m[10];
-
-		inv[9] =   -m[0]  * m[9]  * m[15] +
-					m[0]  * m[11] * m[13] +
-					m[8]  * m[1]  * m[15] -
-					m[8]  * m[3]  * m[13] -
-					m[12] * m[1]  * m[11] +
-					m[12] * m[3]  * m[9];
-
-		inv[13] =	m[0]  * m[9]  * m[14] -
-					m[0]  * m[10] * m[13] -
-					m[8]  * m[1]  * m[14] +
-					m[8]  * m[2]  * m[13] +
-					m[12] * m[1]  * m[10] -
-					m[12] * m[2]  * m[9];
-
-		inv[2] =	m[1]  * m[6]  * m[15] -
-					m[1]  * m[7]  * m[14] -
-					m[5]  * m[2]  * m[15] +
-					m[5]  * m[3]  * m[14] +
-					m[13] * m[2]  * m[7]  -
-					m[13] * m[3]  * m[6];
-
-		inv[6] =   -m[0]  * m[6]  * m[15] +
-					m[0]  * m[7]  * m[14] +
-					m[4]  * m[2]  * m[15] -
-					m[4]  * m[3]  * m[14] -
-					m[12] * m[2]  * m[7]  +
-					m[12] * m[3]  * m[6];
-
-		inv[10] =   m[0]  * m[5]  * m[15] -
-					m[0]  * m[7]  * m[13] -
-					m[4]  * m[1]  * m[15] +
-					m[4]  * m[3]  * m[13] +
-					m[12] * m[1]  * m[7]  -
-					m[12] * m[3]  * m[5];
-
-		inv[14] =  -m[0]  * m[5]  * m[14] +
-					m[0]  * m[6]  * m[13] +
-					m[4]  * m[1]  * m[14] -
-					m[4]  * m[2]  * m[13] -
-					m[12] * m[1]  * m[6]  +
-					m[12] * m[2]  * m[5];
-
-		inv[3] =   -m[1]  * m[6]  * m[11] +
-					m[1]  * m[7]  * m[10] +
-					m[5]  * m[2]  * m[11] -
-					m[5]  * m[3]  * m[10] -
-					m[9]  * m[2]  * m[7]  +
-					m[9]  * m[3]  * m[6];
-
-		inv[7] =	m[0]  * m[6]  * m[11] -
-					m[0]  * m[7]  * m[10] -
-					m[4]  * m[2]  * m[11] +
-					m[4]  * m[3]  * m[10] +
-					m[8]  * m[2]  * m[7]  -
-					m[8]  * m[3]  * m[6];
-
-		inv[11] =  -m[0]  * m[5]  * m[11] +
-					m[0]  * m[7]  * m[9]  +
-					m[4]  * m[1]  * m[11] -
-					m[4]  * m[3]  * m[9]  -
-					m[8]  * m[1]  * m[7]  +
-					m[8]  * m[3]  * m[5];
-
-		inv[15] =	m[0]  * m[5]  * m[10] -
-					m[0]  * m[6]  * m[9]  -
-					m[4]  * m[1]  * m[10] +
-					m[4]  * m[2]  * m[9]  +
-					m[8]  * m[1]  * m[6]  -
-					m[8]  * m[2]  * m[5];
-
-		// Determinant.
-		const float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
-
-		// Ensure that the matrix is not singular.
-		assert(det != 0.0f);
-
-		// Return a copy of the inverse of this matrix.
-		const float invDet = 1.0f / det;
-		for (std::size_t i = 0; i < 16; ++i) inv[i] *= invDet;
-		return Matrix4(inv);
-	}
-
-	Matrix4 Matrix4::scaling(const Vector3& scaleFactors)
-	{
-		return Matrix4(
-			scaleFactors.x, 0.0f, 0.0f, 0.0f,
-			0.0f, scaleFactors.y, 0.0f, 0.0f,
-			0.0f, 0.0f, scaleFactors.z, 0.0f,
-			0.0f, 0.0f, 0.0f, 1.0f
-		);
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::inverse() const
+	{
+		TMatrix4<T> inv;
+		invert(m, inv.m);
+		return inv;
 	}
 
-	Matrix4 Matrix4::scaling(const float factor)
+	template <typename T>
+	bool TMatrix4<T>::tryInverse(TMatrix4<T>& out, const T epsilon) const
 	{
-		return Matrix4(
-			factor, 0.0f, 0.0f, 0.0f,
-			0.0f, factor, 0.0f, 0.0f,
-			0.0f, 0.0f, factor, 0.0f,
-			0.0f, 0.0f, 0.0f, 1.0f
+		return tryInvert(m, out.m, epsilon);
+	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::inverseTranspose() const
+	{
+		TMatrix4<T> inv;
+		invertTransposed(m, inv.m);
+		return inv;
+	}
+
+	template <typename T>
+	TMatrix3<T> TMatrix4<T>::normalMatrix() const
+	{
+		return normalBlock(m);
+	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::projectionInverse() const
+	{
+		// The matrix has the block form [A B; 0 D] with A diagonal, so its
+		// inverse is [A^-1 -A^-1 B D^-1; 0 D^-1].
+		const T invA0 = T(1) / m[0];
+		const T invA1 = T(1) / m[5];
+
+		const T invDet = T(1) / (m[10] * m[15] - m[11] * m[14]);
+		const T d00 = m[15] * invDet;
+		const T d01 = -m[11] * invDet;
+		const T d10 = -m[14] * invDet;
+		const T d11 = m[10] * invDet;
+
+		return TMatrix4<T>(
+			invA0, T(0), -invA0 * (m[2] * d00 + m[3] * d10), -invA0 * (m[2] * d01 + m[3] * d11),
+			T(0), invA1, -invA1 * (m[6] * d00 + m[7] * d10), -invA1 * (m[6] * d01 + m[7] * d11),
+			T(0), T(0), d00, d01,
+			T(0), T(0), d10, d11
 		);
 	}
 
-	Matrix4 Matrix4::translation(const Vector3& translation)
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::rigidInverse() const
 	{
-		return Matrix4(
-			1.0f, 0.0f, 0.0f, translation.x,
-			0.0f, 1.0f, 0.0f, translation.y,
-			0.0f, 0.0f, 1.0f, translation.z,
+		// The inverse of [R t; 0 1] is [R^T -R^T t; 0 1].
+		return TMatrix4<T>(
+			m[0], m[4], m[8], -(m[0] * m[3] + m[4] * m[7] + m[8] * m[11]),
+			m[1], m[5], m[9], -(m[1] * m[3] + m[5] * m[7] + m[9] * m[11]),
+			m[2], m[6], m[10], -(m[2] * m[3] + m[6] * m[7] + m[10] * m[11]),
 			0.0f, 0.0f, 0.0f, 1.0f
 		);
 	}
 
-	Matrix4 Matrix4::angleAxis(const float angle, const Vector3& axis)
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::angleAxis(const T angle, const TVector3<T>& axis)
 	{
-		const float c = std::cos(angle);
-		const float s = std::sin(angle);
+		const T c = std::cos(angle);
+		const T s = std::sin(angle);
 
-		const float nc = 1.0f - c;
+		const T nc = 1.0f - c;
 
-		const float nc_xy = nc * axis.x * axis.y;
-		const float nc_yz = nc * axis.y * axis.z;
-		const float nc_xz = nc * axis.x * axis.z;
+		const T nc_xy = nc * axis.x * axis.y;
+		const T nc_yz = nc * axis.y * axis.z;
+		const T nc_xz = nc * axis.x * axis.z;
 
-		const float sx = s * axis.x;
-		const float sy = s * axis.y;
-		const float sz = s * axis.z;
+		const T sx = s * axis.x;
+		const T sy = s * axis.y;
+		const T sz = s * axis.z;
 
-		return Matrix4(
+		return TMatrix4<T>(
 			nc * axis.x * axis.x + c, nc_xy - sz, nc_xz + sy, 0.0f,
 			nc_xy + sz, nc * axis.y * axis.y + c, nc_yz - sx, 0.0f,
 			nc_xz - sy, nc_yz + sx, nc * axis.z * axis.z + c, 0.0f,
@@ -445,17 +1345,18 @@ namespace M3D
 		);
 	}
 
-	Matrix4 Matrix4::euler(const Vector3& eulerAngles)
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::euler(const TVector3<T>& eulerAngles)
 	{
-		const float s1 = std::sin(eulerAngles.x);
-		const float s2 = std::sin(eulerAngles.y);
-		const float s3 = std::sin(eulerAngles.z);
+		const T s1 = std::sin(eulerAngles.x);
+		const T s2 = std::sin(eulerAngles.y);
+		const T s3 = std::sin(eulerAngles.z);
 
-		const float c1 = std::cos(eulerAngles.x);
-		const float c2 = std::cos(eulerAngles.y);
-		const float c3 = std::cos(eulerAngles.z);
+		const T c1 = std::cos(eulerAngles.x);
+		const T c2 = std::cos(eulerAngles.y);
+		const T c3 = std::cos(eulerAngles.z);
 
-		return Matrix4(
+		return TMatrix4<T>(
 			c2 * c3, -c2 * s3, s2, 0.0f,
 			c1 * s3 + c3 * s1 * s2, c1 * c3 - s1 * s2 * s3, -c2 * s1, 0.0f,
 			s1 * s3 - c1 * c3 * s2, c3 * s1 + c1 * s2 * s3, c1 * c2, 0.0f,
@@ -463,26 +1364,27 @@ namespace M3D
 		);
 	}
 
-	Matrix4 Matrix4::fromToRotation(const Vector3& fromDirection, const Vector3& toDirection)
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::fromToRotation(const TVector3<T>& fromDirection, const TVector3<T>& toDirection)
 	{
 		assert(fromDirection.sqrMagnitude() > 0.0f && toDirection.sqrMagnitude() > 0.0f);
-		const Vector3 unitFrom = fromDirection.normalized();
-		const Vector3 unitTo = toDirection.normalized();
-		const float d = dot(unitFrom, unitTo);
+		const TVector3<T> unitFrom = fromDirection.normalized();
+		const TVector3<T> unitTo = toDirection.normalized();
+		const T d = dot(unitFrom, unitTo);
 
 		if (d >= 1.0f)
 		{
 			// In the case where the two vectors are pointing in the same
 			// direction, we simply return the identity matrix - corresponding
 			// to no rotation.
-			return Matrix4::IDENTITY;
+			return TMatrix4<T>::IDENTITY;
 		}
 		else if (d <= -1.0f)
 		{
 			// If the two vectors are pointing in opposite directions then we
 			// need to supply a rotation matrix corresponding to a rotation of
 			// PI-radians about an axis orthogonal to the fromDirection.
-			Vector3 axis = cross(unitFrom, Vector3::RIGHT);
+			TVector3<T> axis = cross(unitFrom, TVector3<T>::RIGHT);
 			if (axis.sqrMagnitude() < 1e-6)
 			{
 				// Bad luck. The x-axis and fromDirection are linearly
@@ -490,7 +1392,7 @@ namespace M3D
 				// orthogonal to both the y-axis and fromDirection instead.
 				// The y-axis and fromDirection will clearly not be linearly
 				// dependent.
-				axis = cross(unitFrom, Vector3::UP);
+				axis = cross(unitFrom, TVector3<T>::UP);
 			}
 
 			// Note that we need to normalize the axis as the cross product of
@@ -500,18 +1402,19 @@ namespace M3D
 		else
 		{
 			// Determine the axis of rotation.
-			Vector3 unitAxis = cross(fromDirection, toDirection);
+			TVector3<T> unitAxis = cross(fromDirection, toDirection);
 			unitAxis.normalize();
 
 			// Find the angle between the two vectors.
-			const float theta = angle(fromDirection, toDirection);
+			const T theta = angle(fromDirection, toDirection);
 
 			// Construct the rotation matrix.
 			return angleAxis(theta, unitAxis);
 		}
 	}
 
-	Matrix4 Matrix4::lookRotation(const Vector3& forward, const Vector3& upwards)
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::lookRotation(const TVector3<T>& forward, const TVector3<T>& upwards)
 	{
 		// The forward and upwards vectors should not be linearly dependent
 		// (colinear).
@@ -519,21 +1422,21 @@ namespace M3D
 
 		// We rotate so that the z-axis points in the specified forward
 		// direction.
-		const Vector3 zAxis = forward.normalized();
+		const TVector3<T> zAxis = forward.normalized();
 
 		// The x-axis is now orthogonal to both the z-axis and the specified
 		// up direction. Note that the z-axis is pointing out of the screen
 		// in the right-handed coordinate system.
-		const Vector3 xAxis = cross(upwards, zAxis).normalized();
+		const TVector3<T> xAxis = cross(upwards, zAxis).normalized();
 
 		// Now the real y-axis is determined to be the vector orthogonal to both
 		// the zAxis and xAxis. This is necessary because we don't know whether
 		// the specified upwards direction is orthogonal to the specified
 		// forward direction.
-		const Vector3 yAxis = cross(zAxis, xAxis).normalized();
+		const TVector3<T> yAxis = cross(zAxis, xAxis).normalized();
 
 		// Finally return the rotation matrix.
-		return Matrix4(
+		return TMatrix4<T>(
 			xAxis.x, yAxis.x, zAxis.x, 0.0f,
 			xAxis.y, yAxis.y, zAxis.y, 0.0f,
 			xAxis.z, yAxis.z, zAxis.z, 0.0f,
@@ -541,9 +1444,10 @@ namespace M3D
 		);
 	}
 
-	Matrix4 Matrix4::lookRotation(const Vector3& target, const Vector3& eye, const Vector3& upwards)
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::lookRotation(const TVector3<T>& target, const TVector3<T>& eye, const TVector3<T>& upwards)
 	{
-		const Vector3 forward = target - eye;
+		const TVector3<T> forward = target - eye;
 
 		// The forward and upwards vectors should not be linearly dependent
 		// (colinear).
@@ -551,25 +1455,238 @@ namespace M3D
 
 		// We rotate so that the z-axis points in the specified forward
 		// direction.
-		const Vector3 zAxis = forward.normalized();
+		const TVector3<T> zAxis = forward.normalized();
 
 		// The x-axis is now orthogonal to both the z-axis and the specified
 		// up direction. Note that the z-axis is pointing out of the screen
 		// in the right-handed coordinate system.
-		const Vector3 xAxis = cross(upwards, zAxis).normalized();
+		const TVector3<T> xAxis = cross(upwards, zAxis).normalized();
 
 		// Now the real y-axis is determined to be the vector orthogonal to both
 		// the zAxis and xAxis. This is necessary because we don't know whether
 		// the specified upwards direction is orthogonal to the specified
 		// forward direction.
-		const Vector3 yAxis = cross(zAxis, xAxis).normalized();
+		const TVector3<T> yAxis = cross(zAxis, xAxis).normalized();
 
 		// Finally return the rotation matrix.
-		return Matrix4(
+		return TMatrix4<T>(
 			xAxis.x, yAxis.x, zAxis.x, 0.0f,
 			xAxis.y, yAxis.y, zAxis.y, 0.0f,
 			xAxis.z, yAxis.z, zAxis.z, 0.0f,
 			-dot(xAxis, eye), -dot(yAxis, eye), -dot(zAxis, eye), 1.0f
 		);
 	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::lookAt(const TVector3<T>& eye, const TVector3<T>& target, const TVector3<T>& upwards)
+	{
+		// The camera looks down its negative z-axis, so the z-axis points
+		// from the target back towards the eye.
+		const TVector3<T> zAxis = (eye - target).normalized();
+
+		// The forward and upwards vectors should not be linearly dependent
+		// (colinear).
+		assert(cross(upwards, zAxis).sqrMagnitude() != 0.0f);
+
+		const TVector3<T> xAxis = cross(upwards, zAxis).normalized();
+		const TVector3<T> yAxis = cross(zAxis, xAxis);
+
+		// The rows are the camera axes, so that the matrix is the transpose
+		// of the camera rotation followed by the inverse of its translation.
+		return TMatrix4<T>(
+			xAxis.x, xAxis.y, xAxis.z, -dot(xAxis, eye),
+			yAxis.x, yAxis.y, yAxis.z, -dot(yAxis, eye),
+			zAxis.x, zAxis.y, zAxis.z, -dot(zAxis, eye),
+			0.0f, 0.0f, 0.0f, 1.0f
+		);
+	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::perspective(const T fieldOfView, const T aspect, const T zNear, const T zFar, ClipDepth depth)
+	{
+		assert(zNear > 0.0f && zFar > zNear);
+		const T f = 1.0f / std::tan(0.5f * fieldOfView);
+		const T invRange = 1.0f / (zNear - zFar);
+
+		// The view space depth z is mapped to (a * z + b) / -z.
+		const T a = (depth == CLIP_DEPTH_ZERO_TO_ONE) ? zFar * invRange : (zFar + zNear) * invRange;
+		const T b = (depth == CLIP_DEPTH_ZERO_TO_ONE) ? zFar * zNear * invRange : 2.0f * zFar * zNear * invRange;
+
+		return TMatrix4<T>(
+			f / aspect, 0.0f, 0.0f, 0.0f,
+			0.0f, f, 0.0f, 0.0f,
+			0.0f, 0.0f, a, b,
+			0.0f, 0.0f, -1.0f, 0.0f
+		);
+	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::infinitePerspective(const T fieldOfView, const T aspect, const T zNear, ClipDepth depth)
+	{
+		assert(zNear > 0.0f);
+		const T f = 1.0f / std::tan(0.5f * fieldOfView);
+		const T b = (depth == CLIP_DEPTH_ZERO_TO_ONE) ? -zNear : -2.0f * zNear;
+
+		return TMatrix4<T>(
+			f / aspect, 0.0f, 0.0f, 0.0f,
+			0.0f, f, 0.0f, 0.0f,
+			0.0f, 0.0f, -1.0f, b,
+			0.0f, 0.0f, -1.0f, 0.0f
+		);
+	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::reversedPerspective(const T fieldOfView, const T aspect, const T zNear, const T zFar)
+	{
+		assert(zNear > 0.0f && zFar > zNear);
+		const T f = 1.0f / std::tan(0.5f * fieldOfView);
+		const T invRange = 1.0f / (zFar - zNear);
+
+		return TMatrix4<T>(
+			f / aspect, 0.0f, 0.0f, 0.0f,
+			0.0f, f, 0.0f, 0.0f,
+			0.0f, 0.0f, zNear * invRange, zFar * zNear * invRange,
+			0.0f, 0.0f, -1.0f, 0.0f
+		);
+	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::reversedInfinitePerspective(const T fieldOfView, const T aspect, const T zNear)
+	{
+		assert(zNear > 0.0f);
+		const T f = 1.0f / std::tan(0.5f * fieldOfView);
+
+		return TMatrix4<T>(
+			f / aspect, 0.0f, 0.0f, 0.0f,
+			0.0f, f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, zNear,
+			0.0f, 0.0f, -1.0f, 0.0f
+		);
+	}
+
+	template <typename T>
+	TMatrix4<T> TMatrix4<T>::orthographic(const T left, const T right, const T bottom, const T top,
+		const T zNear, const T zFar, ClipDepth depth)
+	{
+		assert(right != left && top != bottom && zFar != zNear);
+		const T invWidth = 1.0f / (right - left);
+		const T invHeight = 1.0f / (top - bottom);
+		const T invDepth = 1.0f / (zFar - zNear);
+
+		// The view space depth z is mapped to a * z + b.
+		const T a = (depth == CLIP_DEPTH_ZERO_TO_ONE) ? -invDepth : -2.0f * invDepth;
+		const T b = (depth == CLIP_DEPTH_ZERO_TO_ONE) ? -zNear * invDepth : -(zFar + zNear) * invDepth;
+
+		return TMatrix4<T>(
+			2.0f * invWidth, 0.0f, 0.0f, -(right + left) * invWidth,
+			0.0f, 2.0f * invHeight, 0.0f, -(top + bottom) * invHeight,
+			0.0f, 0.0f, a, b,
+			0.0f, 0.0f, 0.0f, 1.0f
+		);
+	}
+
+	template <typename T>
+	void transformPoints(const TMatrix4<T>& A, const T* xs, const T* ys, const T* zs,
+		T* outXs, T* outYs, T* outZs, std::size_t count)
+	{
+		transformArrays(A, T(1), xs, ys, zs, outXs, outYs, outZs, 0, count);
+	}
+
+	template <typename T>
+	void transformPoints(const TMatrix4<T>& A, const TVector3<T>* points, TVector3<T>* out, std::size_t count)
+	{
+		transformPacked(A, T(1), points, out, 0, count);
+	}
+
+	template <typename T>
+	void transformDirections(const TMatrix4<T>& A, const T* xs, const T* ys, const T* zs,
+		T* outXs, T* outYs, T* outZs, std::size_t count)
+	{
+		transformArrays(A, T(0), xs, ys, zs, outXs, outYs, outZs, 0, count);
+	}
+
+	template <typename T>
+	void transformDirections(const TMatrix4<T>& A, const TVector3<T>* directions, TVector3<T>* out, std::size_t count)
+	{
+		transformPacked(A, T(0), directions, out, 0, count);
+	}
+
+	template <typename T>
+	void transform(const TMatrix4<T>& A, const TVector4<T>* vectors, TVector4<T>* out, std::size_t count)
+	{
+		transformVectors(A, vectors, out, count);
+	}
+
+	template <typename T>
+	void multiply(const TMatrix4<T>* A, const TMatrix4<T>* B, TMatrix4<T>* out, std::size_t count)
+	{
+		mulMatMatPairs(entries(A), entries(B), entries(out), count);
+	}
+
+	template <typename T>
+	void multiply(const TMatrix4<T>& A, const TMatrix4<T>* B, TMatrix4<T>* out, std::size_t count)
+	{
+		mulMatMatLeft(entries(&A), entries(B), entries(out), count);
+	}
+
+	template <typename T>
+	void multiply(const TMatrix4<T>* A, const TMatrix4<T>& B, TMatrix4<T>* out, std::size_t count)
+	{
+		mulMatMatRight(entries(A), entries(&B), entries(out), count);
+	}
+
+	template <typename T>
+	void inverse(const TMatrix4<T>* matrices, TMatrix4<T>* out, std::size_t count)
+	{
+		invertArray(entries(matrices), entries(out), count, false);
+	}
+
+	template <typename T>
+	void inverseTranspose(const TMatrix4<T>* matrices, TMatrix4<T>* out, std::size_t count)
+	{
+		invertArray(entries(matrices), entries(out), count, true);
+	}
+
+	template <typename T>
+	std::size_t tryInverse(const TMatrix4<T>* matrices, TMatrix4<T>* out, bool* valid, std::size_t count,
+		const typename TMatrix4<T>::Scalar epsilon)
+	{
+		return tryInvertArray(entries(matrices), entries(out), valid, count, epsilon);
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TMatrix4<float>;
+	template class TMatrix4<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TMatrix4<float>& A);
+	template void transformPoints(const TMatrix4<float>& A, const float* xs, const float* ys, const float* zs,
+		float* outXs, float* outYs, float* outZs, std::size_t count);
+	template void transformPoints(const TMatrix4<float>& A, const TVector3<float>* points, TVector3<float>* out, std::size_t count);
+	template void transformDirections(const TMatrix4<float>& A, const float* xs, const float* ys, const float* zs,
+		float* outXs, float* outYs, float* outZs, std::size_t count);
+	template void transformDirections(const TMatrix4<float>& A, const TVector3<float>* directions, TVector3<float>* out, std::size_t count);
+	template void transform(const TMatrix4<float>& A, const TVector4<float>* vectors, TVector4<float>* out, std::size_t count);
+	template void multiply(const TMatrix4<float>* A, const TMatrix4<float>* B, TMatrix4<float>* out, std::size_t count);
+	template void multiply(const TMatrix4<float>& A, const TMatrix4<float>* B, TMatrix4<float>* out, std::size_t count);
+	template void multiply(const TMatrix4<float>* A, const TMatrix4<float>& B, TMatrix4<float>* out, std::size_t count);
+	template void inverse(const TMatrix4<float>* matrices, TMatrix4<float>* out, std::size_t count);
+	template void inverseTranspose(const TMatrix4<float>* matrices, TMatrix4<float>* out, std::size_t count);
+	template std::size_t tryInverse(const TMatrix4<float>* matrices, TMatrix4<float>* out, bool* valid, std::size_t count,
+		const float epsilon);
+
+	template std::ostream& operator <<(std::ostream& out, const TMatrix4<double>& A);
+	template void transformPoints(const TMatrix4<double>& A, const double* xs, const double* ys, const double* zs,
+		double* outXs, double* outYs, double* outZs, std::size_t count);
+	template void transformPoints(const TMatrix4<double>& A, const TVector3<double>* points, TVector3<double>* out, std::size_t count);
+	template void transformDirections(const TMatrix4<double>& A, const double* xs, const double* ys, const double* zs,
+		double* outXs, double* outYs, double* outZs, std::size_t count);
+	template void transformDirections(const TMatrix4<double>& A, const TVector3<double>* directions, TVector3<double>* out, std::size_t count);
+	template void transform(const TMatrix4<double>& A, const TVector4<double>* vectors, TVector4<double>* out, std::size_t count);
+	template void multiply(const TMatrix4<double>* A, const TMatrix4<double>* B, TMatrix4<double>* out, std::size_t count);
+	template void multiply(const TMatrix4<double>& A, const TMatrix4<double>* B, TMatrix4<double>* out, std::size_t count);
+	template void multiply(const TMatrix4<double>* A, const TMatrix4<double>& B, TMatrix4<double>* out, std::size_t count);
+	template void inverse(const TMatrix4<double>* matrices, TMatrix4<double>* out, std::size_t count);
+	template void inverseTranspose(const TMatrix4<double>* matrices, TMatrix4<double>* out, std::size_t count);
+	template std::size_t tryInverse(const TMatrix4<double>* matrices, TMatrix4<double>* out, bool* valid, std::size_t count,
+		const double epsilon);
 }
@@ -0,0 +1,525 @@
+#include <M3D/Packed.hpp>
+
+#include "SIMD.hpp"
+
+#include <cassert>
+
+namespace M3D
+{
+	namespace
+	{
+		const float SQRT2 = 1.41421356f;
+		const float SQRT1_2 = 0.707106781f;
+
+		// Number of bits of each of the three smallest components of the
+		// packed quaternions.
+		const unsigned BITS_32 = 10;
+		const unsigned BITS_48 = 15;
+
+		// Returns the quantized value that represents zero, and the number of
+		// values either side of it, for components of the specified number of
+		// bits.
+		inline int halfRangeOf(unsigned bits)
+		{
+			return (1 << (bits - 1)) - 1;
+		}
+
+		// Returns the index of the component of greatest magnitude of `q`
+		// in the high bits, followed by the remaining components, negated if
+		// the greatest is negative and quantized to `Bits` bits each.
+		template <unsigned Bits>
+		std::uint64_t packSmallestThree(const Quaternion& q)
+		{
+			const float components[4] = { q.w, q.x, q.y, q.z };
+			unsigned largest = 0;
+			for (unsigned i = 1; i < 4; ++i)
+			{
+				if (std::abs(components[i]) > std::abs(components[largest]))
+				{
+					largest = i;
+				}
+			}
+
+			const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+			const float halfRange = static_cast<float>(halfRangeOf(Bits));
+
+			std::uint64_t packed = largest;
+			for (unsigned i = 0; i < 4; ++i)
+			{
+				if (i != largest)
+				{
+					// Map [-1/sqrt(2), 1/sqrt(2)] to [0, 2^Bits - 2], with zero
+					// to the middle value so that it is represented exactly.
+					const float t = std::min(std::max(sign * components[i] * SQRT2, -1.0f), 1.0f);
+					packed = (packed << Bits) | static_cast<std::uint64_t>(t * halfRange + (halfRange + 0.5f));
+				}
+			}
+
+			return packed;
+		}
+
+		// Inverse of packSmallestThree().
+		template <unsigned Bits>
+		Quaternion unpackSmallestThree(std::uint64_t packed)
+		{
+			const std::uint64_t mask = (1u << Bits) - 1;
+			const unsigned largest = static_cast<unsigned>(packed >> (3 * Bits));
+			const int halfRange = halfRangeOf(Bits);
+			const float scale = SQRT1_2 / static_cast<float>(halfRange);
+
+			float components[4];
+			float sqrSum = 0.0f;
+			unsigned shift = 0;
+			for (unsigned i = 4; i-- > 0;)
+			{
+				if (i != largest)
+				{
+					components[i] = static_cast<float>(static_cast<int>((packed >> shift) & mask) - halfRange) * scale;
+					sqrSum += components[i] * components[i];
+					shift += Bits;
+				}
+			}
+
+			components[largest] = std::sqrt(std::max(1.0f - sqrSum, 0.0f));
+			return Quaternion(components[0], components[1], components[2], components[3]);
+		}
+
+#if defined(M3D_SSE2)
+		// Returns the lanes of `a` where `mask` is set and of `b` elsewhere.
+		inline __m128i select(__m128i mask, __m128i a, __m128i b)
+		{
+			return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+		}
+
+		inline __m128 select(__m128 mask, __m128 a, __m128 b)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+
+		// Four lane version of floatToHalf(), returning each half in the low
+		// bits of a 32-bit lane.
+		inline __m128i floatToHalfLanes(__m128 v)
+		{
+			const __m128i bits = _mm_castps_si128(v);
+			const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+			const __m128i f = _mm_xor_si128(bits, sign);
+
+			const __m128i isNaN = _mm_cmpgt_epi32(f, _mm_set1_epi32(0x7f800000));
+			const __m128i infinity = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(isNaN, _mm_set1_epi32(0x0200)));
+
+			const __m128i denormal = _mm_sub_epi32(
+				_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f), _mm_set1_ps(0.5f))),
+				_mm_set1_epi32(0x3f000000));
+
+			const __m128i odd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+			const __m128i normal = _mm_srli_epi32(
+				_mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(static_cast<int>(0xc8000fffu))), odd), 13);
+
+			const __m128i isInfinity = _mm_cmpgt_epi32(f, _mm_set1_epi32(0x477fffff));
+			const __m128i isDenormal = _mm_cmplt_epi32(f, _mm_set1_epi32(0x38800000));
+			const __m128i h = select(isInfinity, infinity, select(isDenormal, denormal, normal));
+
+			return _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+		}
+
+		// Four lane version of halfToFloat(), taking each half from the low
+		// bits of a 32-bit lane.
+		inline __m128 halfToFloatLanes(__m128i h)
+		{
+			const __m128i shiftedExponent = _mm_set1_epi32(0x7c00 << 13);
+			__m128i f = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+			const __m128i exponent = _mm_and_si128(f, shiftedExponent);
+			f = _mm_add_epi32(f, _mm_set1_epi32(0x38000000));
+
+			const __m128i isInfinity = _mm_cmpeq_epi32(exponent, shiftedExponent);
+			const __m128i isDenormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+			f = _mm_add_epi32(f, _mm_and_si128(isInfinity, _mm_set1_epi32(0x38000000)));
+
+			const __m128i denormal = _mm_castps_si128(_mm_sub_ps(
+				_mm_castsi128_ps(_mm_add_epi32(f, _mm_set1_epi32(0x00800000))),
+				_mm_set1_ps(6.103515625e-05f)));
+			f = select(isDenormal, denormal, f);
+
+			return _mm_castsi128_ps(_mm_or_si128(f, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)));
+		}
+
+		// Packs the low 16 bits of each 32-bit lane of `lo` and `hi` into
+		// eight 16-bit lanes. The lanes are sign extended first so that the
+		// saturating pack leaves them unchanged.
+		inline __m128i pack16(__m128i lo, __m128i hi)
+		{
+			return _mm_packs_epi32(
+				_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+				_mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+		}
+
+		// Finds the component of greatest magnitude of each of the four
+		// quaternions starting at `q`, and quantizes the remaining
+		// components as packSmallestThree() does.
+		inline void packSmallestThreeLanes(const Quaternion* q, float halfRange,
+			__m128i& largest, __m128i& a, __m128i& b, __m128i& c)
+		{
+			__m128 w = _mm_loadu_ps(&q[0].w);
+			__m128 x = _mm_loadu_ps(&q[1].w);
+			__m128 y = _mm_loadu_ps(&q[2].w);
+			__m128 z = _mm_loadu_ps(&q[3].w);
+			_MM_TRANSPOSE4_PS(w, x, y, z);
+
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 absW = _mm_andnot_ps(signMask, w);
+			const __m128 absX = _mm_andnot_ps(signMask, x);
+			const __m128 absY = _mm_andnot_ps(signMask, y);
+			const __m128 absZ = _mm_andnot_ps(signMask, z);
+			const __m128 greatest = _mm_max_ps(_mm_max_ps(absW, absX), _mm_max_ps(absY, absZ));
+
+			// As in the scalar version, ties go to the first component.
+			const __m128 isW = _mm_cmpeq_ps(absW, greatest);
+			const __m128 isX = _mm_andnot_ps(isW, _mm_cmpeq_ps(absX, greatest));
+			const __m128 isWX = _mm_or_ps(isW, isX);
+			const __m128 isY = _mm_andnot_ps(isWX, _mm_cmpeq_ps(absY, greatest));
+			const __m128 isZ = _mm_andnot_ps(_mm_or_ps(isWX, isY), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+			largest = _mm_or_si128(
+				_mm_and_si128(_mm_castps_si128(isX), _mm_set1_epi32(1)),
+				_mm_or_si128(
+					_mm_and_si128(_mm_castps_si128(isY), _mm_set1_epi32(2)),
+					_mm_and_si128(_mm_castps_si128(isZ), _mm_set1_epi32(3))));
+
+			// Negate the quaternions whose greatest component is negative,
+			// and scale the remaining components by sqrt(2).
+			const __m128 value = _mm_or_ps(
+				_mm_or_ps(_mm_and_ps(isW, w), _mm_and_ps(isX, x)),
+				_mm_or_ps(_mm_and_ps(isY, y), _mm_and_ps(isZ, z)));
+			const __m128 scale = _mm_xor_ps(_mm_set1_ps(SQRT2), _mm_and_ps(value, signMask));
+
+			const __m128 first = _mm_mul_ps(select(isW, x, w), scale);
+			const __m128 second = _mm_mul_ps(select(isWX, y, x), scale);
+			const __m128 third = _mm_mul_ps(select(isZ, y, z), scale);
+
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 minusOne = _mm_set1_ps(-1.0f);
+			const __m128 range = _mm_set1_ps(halfRange);
+			const __m128 offset = _mm_set1_ps(halfRange + 0.5f);
+			a = _mm_cvttps_epi32(simd::madd(_mm_min_ps(_mm_max_ps(first, minusOne), one), range, offset));
+			b = _mm_cvttps_epi32(simd::madd(_mm_min_ps(_mm_max_ps(second, minusOne), one), range, offset));
+			c = _mm_cvttps_epi32(simd::madd(_mm_min_ps(_mm_max_ps(third, minusOne), one), range, offset));
+		}
+
+		// Reconstructs four quaternions from the index of the greatest
+		// component and the three quantized remaining components, as
+		// unpackSmallestThree() does, and stores them starting at `q`.
+		inline void unpackSmallestThreeLanes(__m128i largest, __m128i a, __m128i b, __m128i c, int halfRange,
+			Quaternion* q)
+		{
+			const __m128i offset = _mm_set1_epi32(halfRange);
+			const __m128 scale = _mm_set1_ps(SQRT1_2 / static_cast<float>(halfRange));
+			const __m128 first = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(a, offset)), scale);
+			const __m128 second = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(b, offset)), scale);
+			const __m128 third = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(c, offset)), scale);
+
+			const __m128 sqrSum = simd::madd(first, first, simd::madd(second, second, _mm_mul_ps(third, third)));
+			const __m128 greatest = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), sqrSum), _mm_setzero_ps()));
+
+			const __m128 isW = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_setzero_si128()));
+			const __m128 isX = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1)));
+			const __m128 isY = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(2)));
+			const __m128 isZ = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(3)));
+
+			__m128 w = select(isW, greatest, first);
+			__m128 x = select(isW, first, select(isX, greatest, second));
+			__m128 y = select(_mm_or_ps(isW, isX), second, select(isY, greatest, third));
+			__m128 z = select(isZ, greatest, third);
+			_MM_TRANSPOSE4_PS(w, x, y, z);
+
+			_mm_storeu_ps(&q[0].w, w);
+			_mm_storeu_ps(&q[1].w, x);
+			_mm_storeu_ps(&q[2].w, y);
+			_mm_storeu_ps(&q[3].w, z);
+		}
+#endif
+
+		void floatToHalfArray(const float* in, std::uint16_t* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+#if defined(M3D_F16C)
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+					_mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+			}
+#endif
+
+#if defined(M3D_SSE2)
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i lo = floatToHalfLanes(_mm_loadu_ps(in + i));
+				const __m128i hi = floatToHalfLanes(_mm_loadu_ps(in + i + 4));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), pack16(lo, hi));
+			}
+#endif
+
+			// Remaining values.
+			for (; i < count; ++i)
+			{
+				out[i] = floatToHalf(in[i]);
+			}
+		}
+
+		void halfToFloatArray(const std::uint16_t* in, float* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+#if defined(M3D_F16C)
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+			}
+#endif
+
+#if defined(M3D_SSE2)
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+				_mm_storeu_ps(out + i, halfToFloatLanes(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+				_mm_storeu_ps(out + i + 4, halfToFloatLanes(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+			}
+#endif
+
+			// Remaining values.
+			for (; i < count; ++i)
+			{
+				out[i] = halfToFloat(in[i]);
+			}
+		}
+
+		void floatToSnormArray(const float* in, std::int16_t* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+#if defined(M3D_SSE2)
+			// The conversions round to nearest even, as std::lrint does in
+			// the default rounding mode.
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 minusOne = _mm_set1_ps(-1.0f);
+			const __m128 scale = _mm_set1_ps(32767.0f);
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128 lo = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i), minusOne), one);
+				const __m128 hi = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i + 4), minusOne), one);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(
+					_mm_cvtps_epi32(_mm_mul_ps(lo, scale)),
+					_mm_cvtps_epi32(_mm_mul_ps(hi, scale))));
+			}
+#endif
+
+			// Remaining values.
+			for (; i < count; ++i)
+			{
+				out[i] = static_cast<std::int16_t>(std::lrint(std::min(std::max(in[i], -1.0f), 1.0f) * 32767.0f));
+			}
+		}
+
+		void snormToFloatArray(const std::int16_t* in, float* out, std::size_t count)
+		{
+			const float scale = 1.0f / 32767.0f;
+			std::size_t i = 0;
+
+#if defined(M3D_SSE2)
+			const __m128 minusOne = _mm_set1_ps(-1.0f);
+			const __m128 s = _mm_set1_ps(scale);
+			for (; i + 8 <= count; i += 8)
+			{
+				// Interleaving each value with itself and shifting right
+				// sign extends it to 32 bits.
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+				const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+				const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+				_mm_storeu_ps(out + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), s), minusOne));
+				_mm_storeu_ps(out + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), s), minusOne));
+			}
+#endif
+
+			// Remaining values.
+			for (; i < count; ++i)
+			{
+				out[i] = std::max(static_cast<float>(in[i]) * scale, -1.0f);
+			}
+		}
+	}
+
+	PackedQuaternion32::PackedQuaternion32(const Quaternion& q)
+	: bits(static_cast<std::uint32_t>(packSmallestThree<BITS_32>(q)))
+	{
+		// Nothing to do.
+	}
+
+	Quaternion PackedQuaternion32::unpack() const
+	{
+		return unpackSmallestThree<BITS_32>(bits);
+	}
+
+	PackedQuaternion48::PackedQuaternion48(const Quaternion& q)
+	{
+		const std::uint64_t packed = packSmallestThree<BITS_48>(q);
+		bits[0] = static_cast<std::uint16_t>(packed >> 32);
+		bits[1] = static_cast<std::uint16_t>(packed >> 16);
+		bits[2] = static_cast<std::uint16_t>(packed);
+	}
+
+	Quaternion PackedQuaternion48::unpack() const
+	{
+		const std::uint64_t packed = (static_cast<std::uint64_t>(bits[0]) << 32)
+			| (static_cast<std::uint64_t>(bits[1]) << 16)
+			| bits[2];
+		return unpackSmallestThree<BITS_48>(packed);
+	}
+
+	void pack(const Vector3* in, Vector3h* out, std::size_t count)
+	{
+		static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be tightly packed");
+		static_assert(sizeof(Vector3h) == 3 * sizeof(std::uint16_t), "Vector3h must be tightly packed");
+
+		floatToHalfArray(&in->x, &out->x, 3 * count);
+	}
+
+	void unpack(const Vector3h* in, Vector3* out, std::size_t count)
+	{
+		halfToFloatArray(&in->x, &out->x, 3 * count);
+	}
+
+	void pack(const Vector3* in, Vector3s* out, std::size_t count)
+	{
+		static_assert(sizeof(Vector3s) == 3 * sizeof(std::int16_t), "Vector3s must be tightly packed");
+
+		floatToSnormArray(&in->x, &out->x, 3 * count);
+	}
+
+	void unpack(const Vector3s* in, Vector3* out, std::size_t count)
+	{
+		snormToFloatArray(&in->x, &out->x, 3 * count);
+	}
+
+	void pack(const Quaternion* in, PackedQuaternion32* out, std::size_t count)
+	{
+		static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be tightly packed");
+		static_assert(sizeof(PackedQuaternion32) == sizeof(std::uint32_t), "PackedQuaternion32 must be tightly packed");
+
+		std::size_t i = 0;
+
+#if defined(M3D_SSE2)
+		const float halfRange = static_cast<float>(halfRangeOf(BITS_32));
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i largest, a, b, c;
+			packSmallestThreeLanes(in + i, halfRange, largest, a, b, c);
+
+			const __m128i packed = _mm_or_si128(
+				_mm_or_si128(_mm_slli_epi32(largest, 3 * BITS_32), _mm_slli_epi32(a, 2 * BITS_32)),
+				_mm_or_si128(_mm_slli_epi32(b, BITS_32), c));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i].bits), packed);
+		}
+#endif
+
+		// Remaining quaternions.
+		for (; i < count; ++i)
+		{
+			out[i] = PackedQuaternion32(in[i]);
+		}
+	}
+
+	void unpack(const PackedQuaternion32* in, Quaternion* out, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if defined(M3D_SSE2)
+		const __m128i mask = _mm_set1_epi32((1 << BITS_32) - 1);
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i].bits));
+			unpackSmallestThreeLanes(
+				_mm_srli_epi32(packed, 3 * BITS_32),
+				_mm_and_si128(_mm_srli_epi32(packed, 2 * BITS_32), mask),
+				_mm_and_si128(_mm_srli_epi32(packed, BITS_32), mask),
+				_mm_and_si128(packed, mask),
+				halfRangeOf(BITS_32), out + i);
+		}
+#endif
+
+		// Remaining quaternions.
+		for (; i < count; ++i)
+		{
+			out[i] = in[i].unpack();
+		}
+	}
+
+	void pack(const Quaternion* in, PackedQuaternion48* out, std::size_t count)
+	{
+		static_assert(sizeof(PackedQuaternion48) == 3 * sizeof(std::uint16_t), "PackedQuaternion48 must be tightly packed");
+
+		std::size_t i = 0;
+
+#if defined(M3D_SSE2)
+		// The 48-bit records do not fit the lanes, so the quantized
+		// components are assembled into records one at a time.
+		const float halfRange = static_cast<float>(halfRangeOf(BITS_48));
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i largest, a, b, c;
+			packSmallestThreeLanes(in + i, halfRange, largest, a, b, c);
+
+			// The high word holds the index and the first component, and
+			// the low 32 bits the second and third.
+			std::uint32_t high[4], low[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(high), _mm_or_si128(_mm_slli_epi32(largest, BITS_48), a));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(low), _mm_or_si128(_mm_slli_epi32(b, BITS_48), c));
+
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				out[i + j].bits[0] = static_cast<std::uint16_t>(high[j] >> 2);
+				out[i + j].bits[1] = static_cast<std::uint16_t>((high[j] << 14) | (low[j] >> 16));
+				out[i + j].bits[2] = static_cast<std::uint16_t>(low[j]);
+			}
+		}
+#endif
+
+		// Remaining quaternions.
+		for (; i < count; ++i)
+		{
+			out[i] = PackedQuaternion48(in[i]);
+		}
+	}
+
+	void unpack(const PackedQuaternion48* in, Quaternion* out, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if defined(M3D_SSE2)
+		for (; i + 4 <= count; i += 4)
+		{
+			std::int32_t largest[4], a[4], b[4], c[4];
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				const std::uint16_t* bits = in[i + j].bits;
+				largest[j] = bits[0] >> 13;
+				a[j] = ((bits[0] << 2) | (bits[1] >> 14)) & 0x7fff;
+				b[j] = ((bits[1] << 1) | (bits[2] >> 15)) & 0x7fff;
+				c[j] = bits[2] & 0x7fff;
+			}
+
+			unpackSmallestThreeLanes(
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(largest)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(a)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(b)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(c)),
+				halfRangeOf(BITS_48), out + i);
+		}
+#endif
+
+		// Remaining quaternions.
+		for (; i < count; ++i)
+		{
+			out[i] = in[i].unpack();
+		}
+	}
+}
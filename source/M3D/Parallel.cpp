@@ -0,0 +1,272 @@
+#include <M3D/Parallel.hpp>
+
+#include <algorithm>
+
+namespace M3D
+{
+	namespace parallel
+	{
+		namespace
+		{
+			// Size in bytes of the input and output of each chunk of the batch
+			// operations, small enough to stay in the L2 cache and large
+			// enough to amortise taking a task from a queue.
+			const std::size_t CHUNK_BYTES = 64 * 1024;
+
+			// Chunks start at multiples of this many elements, the width of
+			// the widest SIMD kernels, so that the serial kernels process the
+			// elements of each chunk in the same groups as they would the
+			// whole array.
+			const std::size_t CHUNK_ALIGNMENT = 8;
+
+			// Returns the number of elements in each chunk of an operation
+			// that reads and writes `elementBytes` bytes per element.
+			inline std::size_t chunkSize(std::size_t elementBytes)
+			{
+				return std::max(CHUNK_BYTES / elementBytes / CHUNK_ALIGNMENT, std::size_t(1)) * CHUNK_ALIGNMENT;
+			}
+		}
+
+		ThreadPool::ThreadPool(std::size_t threadCount)
+		: queues()
+		, workers()
+		, function(nullptr)
+		, task(nullptr)
+		, remaining(0)
+		, runMutex()
+		, mutex()
+		, wake()
+		, done()
+		, generation(0)
+		, stopping(false)
+		{
+			if (threadCount == 0)
+			{
+				threadCount = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), std::size_t(1));
+			}
+
+			for (std::size_t i = 0; i < threadCount; ++i)
+			{
+				queues.push_back(std::unique_ptr<Queue>(new Queue()));
+			}
+
+			for (std::size_t i = 1; i < threadCount; ++i)
+			{
+				workers.push_back(std::thread(&ThreadPool::work, this, i));
+			}
+		}
+
+		ThreadPool::~ThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stopping = true;
+			}
+
+			wake.notify_all();
+			for (std::size_t i = 0; i < workers.size(); ++i)
+			{
+				workers[i].join();
+			}
+		}
+
+		void ThreadPool::run(std::size_t taskCount, Function function_, const void* task_)
+		{
+			if (taskCount == 0)
+			{
+				return;
+			}
+
+			std::lock_guard<std::mutex> runLock(runMutex);
+			if (workers.empty())
+			{
+				for (std::size_t i = 0; i < taskCount; ++i)
+				{
+					function_(task_, i);
+				}
+
+				return;
+			}
+
+			// The function is published before the tasks, under the queue
+			// locks, so that a worker still looking for work from the
+			// previous call sees it before taking any of the new tasks.
+			function = function_;
+			task = task_;
+			remaining.store(taskCount);
+
+			const std::size_t queueCount = queues.size();
+			for (std::size_t q = 0; q < queueCount; ++q)
+			{
+				std::lock_guard<std::mutex> lock(queues[q]->mutex);
+				for (std::size_t i = taskCount * q / queueCount; i < taskCount * (q + 1) / queueCount; ++i)
+				{
+					queues[q]->tasks.push_back(i);
+				}
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				++generation;
+			}
+
+			wake.notify_all();
+			drain(0);
+
+			std::unique_lock<std::mutex> lock(mutex);
+			done.wait(lock, [this]() { return remaining.load() == 0; });
+		}
+
+		void ThreadPool::work(std::size_t self)
+		{
+			std::size_t seen = 0;
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					wake.wait(lock, [&]() { return stopping || generation != seen; });
+					if (stopping)
+					{
+						return;
+					}
+
+					seen = generation;
+				}
+
+				drain(self);
+			}
+		}
+
+		void ThreadPool::drain(std::size_t self)
+		{
+			std::size_t index;
+			while (take(self, index))
+			{
+				function(task, index);
+				if (remaining.fetch_sub(1) == 1)
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					done.notify_all();
+				}
+			}
+		}
+
+		bool ThreadPool::take(std::size_t self, std::size_t& index)
+		{
+			{
+				Queue& own = *queues[self];
+				std::lock_guard<std::mutex> lock(own.mutex);
+				if (!own.tasks.empty())
+				{
+					index = own.tasks.front();
+					own.tasks.pop_front();
+					return true;
+				}
+			}
+
+			// Steal from the back of the other queues, which holds the tasks
+			// that their owners would reach last.
+			for (std::size_t k = 1; k < queues.size(); ++k)
+			{
+				Queue& other = *queues[(self + k) % queues.size()];
+				std::lock_guard<std::mutex> lock(other.mutex);
+				if (!other.tasks.empty())
+				{
+					index = other.tasks.back();
+					other.tasks.pop_back();
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		template <typename T>
+		void transform(ThreadPool& pool, const TMatrix4<T>& A, const TVector4<T>* vectors, TVector4<T>* out,
+			std::size_t count)
+		{
+			forEach(pool, count, chunkSize(2 * sizeof(TVector4<T>)), [&](std::size_t first, std::size_t n)
+			{
+				M3D::transform(A, vectors + first, out + first, n);
+			});
+		}
+
+		template <typename T>
+		void rotate(ThreadPool& pool, const TQuaternion<T>& q, const TVector3<T>* in, TVector3<T>* out,
+			std::size_t count)
+		{
+			forEach(pool, count, chunkSize(2 * sizeof(TVector3<T>)), [&](std::size_t first, std::size_t n)
+			{
+				M3D::rotate(q, in + first, out + first, n);
+			});
+		}
+
+		template <typename T>
+		void rotate(ThreadPool& pool, const TQuaternion<T>* q, const TVector3<T>* in, TVector3<T>* out,
+			std::size_t count)
+		{
+			forEach(pool, count, chunkSize(sizeof(TQuaternion<T>) + 2 * sizeof(TVector3<T>)),
+				[&](std::size_t first, std::size_t n)
+				{
+					M3D::rotate(q + first, in + first, out + first, n);
+				});
+		}
+
+		template <typename T>
+		void multiply(ThreadPool& pool, const TMatrix4<T>* A, const TMatrix4<T>* B, TMatrix4<T>* out,
+			std::size_t count)
+		{
+			forEach(pool, count, chunkSize(3 * sizeof(TMatrix4<T>)), [&](std::size_t first, std::size_t n)
+			{
+				M3D::multiply(A + first, B + first, out + first, n);
+			});
+		}
+
+		template <typename T>
+		void normalize(ThreadPool& pool, const TVector3<T>* in, TVector3<T>* out, std::size_t count)
+		{
+			forEach(pool, count, chunkSize(2 * sizeof(TVector3<T>)), [&](std::size_t first, std::size_t n)
+			{
+				for (std::size_t i = first; i < first + n; ++i)
+				{
+					out[i] = in[i].normalized();
+				}
+			});
+		}
+
+		template <typename T>
+		void normalize(ThreadPool& pool, const TVector4<T>* in, TVector4<T>* out, std::size_t count)
+		{
+			forEach(pool, count, chunkSize(2 * sizeof(TVector4<T>)), [&](std::size_t first, std::size_t n)
+			{
+				for (std::size_t i = first; i < first + n; ++i)
+				{
+					out[i] = in[i].normalized();
+				}
+			});
+		}
+
+		// Explicit instantiations for the supported scalar types.
+		template void transform(ThreadPool& pool, const TMatrix4<float>& A, const TVector4<float>* vectors, TVector4<float>* out,
+			std::size_t count);
+		template void rotate(ThreadPool& pool, const TQuaternion<float>& q, const TVector3<float>* in, TVector3<float>* out,
+			std::size_t count);
+		template void rotate(ThreadPool& pool, const TQuaternion<float>* q, const TVector3<float>* in, TVector3<float>* out,
+			std::size_t count);
+		template void multiply(ThreadPool& pool, const TMatrix4<float>* A, const TMatrix4<float>* B, TMatrix4<float>* out,
+			std::size_t count);
+		template void normalize(ThreadPool& pool, const TVector3<float>* in, TVector3<float>* out, std::size_t count);
+		template void normalize(ThreadPool& pool, const TVector4<float>* in, TVector4<float>* out, std::size_t count);
+
+		template void transform(ThreadPool& pool, const TMatrix4<double>& A, const TVector4<double>* vectors, TVector4<double>* out,
+			std::size_t count);
+		template void rotate(ThreadPool& pool, const TQuaternion<double>& q, const TVector3<double>* in, TVector3<double>* out,
+			std::size_t count);
+		template void rotate(ThreadPool& pool, const TQuaternion<double>* q, const TVector3<double>* in, TVector3<double>* out,
+			std::size_t count);
+		template void multiply(ThreadPool& pool, const TMatrix4<double>* A, const TMatrix4<double>* B, TMatrix4<double>* out,
+			std::size_t count);
+		template void normalize(ThreadPool& pool, const TVector3<double>* in, TVector3<double>* out, std::size_t count);
+		template void normalize(ThreadPool& pool, const TVector4<double>* in, TVector4<double>* out, std::size_t count);
+	}
+}
@@ -0,0 +1,19 @@
+#include <M3D/Plane.hpp>
+
+namespace M3D
+{
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TPlane<T>& plane)
+	{
+		out << "[" << plane.normal << ", " << plane.distance << "]";
+		return out;
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TPlane<float>;
+	template class TPlane<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TPlane<float>& plane);
+
+	template std::ostream& operator <<(std::ostream& out, const TPlane<double>& plane);
+}
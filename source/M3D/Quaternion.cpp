@@ -1,108 +1,465 @@
 #include <M3D/Quaternion.hpp>
 #include <M3D/Vector3.hpp>
 
+#include "SIMD.hpp"
+
 #include <cmath>
 #include <cassert>
 
 namespace M3D
 {
-	const Quaternion Quaternion::IDENTITY = Quaternion(1.0f, 0.0f, 0.0f, 0.0f);
-
-	Quaternion::Quaternion()
-	: w(1.0f)
-	, x(0.0f)
-	, y(0.0f)
-	, z(0.0f)
+	namespace
 	{
-		// Nothing to do.
-	}
+		// Rotates the vectors in `in`, starting from the vector at index
+		// `first`, by the quaternion `q`.
+		template <typename T>
+		void rotateArray(const TQuaternion<T>& q, const TVector3<T>* in, TVector3<T>* out,
+			std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				out[i] = q * in[i];
+			}
+		}
 
-	Quaternion::Quaternion(float w_, float x_, float y_, float z_)
-	: w(w_)
-	, x(x_)
-	, y(y_)
-	, z(z_)
-	{
-		// Nothing to do.
-	}
+		// Rotates the vectors in `in`, starting from the vector at index
+		// `first`, by the corresponding quaternions in `q`.
+		template <typename T>
+		void rotateArrays(const TQuaternion<T>* q, const TVector3<T>* in, TVector3<T>* out,
+			std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				out[i] = q[i] * in[i];
+			}
+		}
 
-	Quaternion::Quaternion(const float s, const Vector3& v)
-	: w(s)
-	, x(v.x)
-	, y(v.y)
-	, z(v.z)
-	{
-		// Nothing to do.
-	}
+		// Coefficients of the polynomial approximation of the slerp weights
+		// described by Eberly in "A Fast and Accurate Algorithm for Computing
+		// SLERP". The last coefficients are scaled by 1 + mu to balance the
+		// truncation error over the range of angles.
+		const double onePlusMu = 1.90110745351730037;
+		const double slerpU[8] = {
+			1.0 / (1 * 3), 1.0 / (2 * 5), 1.0 / (3 * 7), 1.0 / (4 * 9),
+			1.0 / (5 * 11), 1.0 / (6 * 13), 1.0 / (7 * 15), onePlusMu / (8 * 17)
+		};
+		const double slerpV[8] = {
+			1.0 / 3, 2.0 / 5, 3.0 / 7, 4.0 / 9,
+			5.0 / 11, 6.0 / 13, 7.0 / 15, onePlusMu * 8 / 17
+		};
+
+		// Returns an approximation of sin(t * theta) / sin(theta), given
+		// `cosm1` = cos(theta) - 1 for an angle theta in the range [0, PI/2].
+		template <typename T>
+		T slerpWeight(const T t, const T cosm1)
+		{
+			const T tt = t * t;
 
-	float operator==(const Quaternion& q1, const Quaternion& q2)
-	{
-		const float epsilon = 1e-6;
-		return std::abs(q1.w - q2.w) < epsilon && std::abs(q1.x - q2.x) < epsilon
-			&& std::abs(q1.y - q2.y) < epsilon && std::abs(q1.z - q2.z) < epsilon;
-	}
+			T weight = 1.0f;
+			for (int i = 7; i >= 0; --i)
+			{
+				weight = 1.0f + (static_cast<T>(slerpU[i]) * tt - static_cast<T>(slerpV[i])) * cosm1 * weight;
+			}
 
-	float operator!=(const Quaternion& q1, const Quaternion& q2)
-	{
-		return !(q1 == q2);
-	}
+			return t * weight;
+		}
 
-	Quaternion operator*(const Quaternion& lhs, const Quaternion& rhs)
-	{
-		return Quaternion(
-			lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
-			lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
-			lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
-			lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w
-		);
-	}
+		// Interpolates the quaternion pairs, starting from the pair at index
+		// `first`, using the polynomial approximation of the slerp weights.
+		template <typename T>
+		void slerpArrays(const TQuaternion<T>* from, const TQuaternion<T>* to, const T* factors,
+			TQuaternion<T>* out, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const TQuaternion<T> a = from[i];
+				const TQuaternion<T> b = to[i];
+				const T t = factors[i];
+
+				// Interpolate towards whichever of b and -b is closer.
+				const T d = dot(a, b);
+				const T sign = d < 0.0f ? -1.0f : 1.0f;
+				const T cosm1 = d * sign - 1.0f;
+
+				const T wa = slerpWeight(1.0f - t, cosm1);
+				const T wb = slerpWeight(t, cosm1) * sign;
+
+				out[i] = TQuaternion<T>(
+					wa * a.w + wb * b.w,
+					wa * a.x + wb * b.x,
+					wa * a.y + wb * b.y,
+					wa * a.z + wb * b.z
+				);
+			}
+		}
 
-	Vector3 operator*(const Quaternion& q, const Vector3& v)
-	{
-		// Quaternion r = q * Quaternion(0.0f, v.x, v.y, v.z) * q.conjugate();
-		// return Vector3(r.x, r.y, r.z);
-
-		// This faster method is described:
-		// http://molecularmusings.wordpress.com/2013/05/24/a-faster-quaternion-vector-multiplication/
-		const Vector3 qv = Vector3(q.x, q.y, q.z);
-		const Vector3 t = 2.0f * cross(qv, v);
-		return v + q.w * t + cross(qv, t);
-	}
+		// Returns the weights `wa` and `wb` such that `wa` * `from` + `wb` *
+		// `to` is the spherical linear interpolation by `factor`. The shortest
+		// path is taken if `shortestPath` is true.
+		template <typename T>
+		void exactSlerpWeights(const TQuaternion<T>& from, const TQuaternion<T>& to, const T factor,
+			const bool shortestPath, T& wa, T& wb)
+		{
+			T cosTheta = dot(from, to);
+			T sign = 1.0f;
+			if (shortestPath && cosTheta < 0.0f)
+			{
+				cosTheta = -cosTheta;
+				sign = -1.0f;
+			}
 
-	std::ostream& operator <<(std::ostream& out, const Quaternion& q)
-	{
-		out << q.w << " + " << q.x << "i + " << q.y << "j + " << q.z << "k";
-		return out;
-	}
+			if (cosTheta > 1.0f - 1e-6)
+			{
+				// The quaternions are nearly identical so sin(theta) is close
+				// to zero. Linear interpolation is accurate here.
+				wa = 1.0f - factor;
+				wb = factor * sign;
+			}
+			else
+			{
+				const T theta = std::acos(cosTheta);
+				const T invSinTheta = 1.0f / std::sin(theta);
+				wa = std::sin((1.0f - factor) * theta) * invSinTheta;
+				wb = std::sin(factor * theta) * invSinTheta * sign;
+			}
+		}
 
-	float Quaternion::sqrMagnitude() const
-	{
-		return w * w + x * x + y * y + z * z;
-	}
+		// Returns the spherical linear interpolation between `from` and `to`.
+		template <typename T>
+		TQuaternion<T> exactSlerp(const TQuaternion<T>& from, const TQuaternion<T>& to, const T factor,
+			const bool shortestPath)
+		{
+			T wa, wb;
+			exactSlerpWeights(from, to, factor, shortestPath, wa, wb);
+
+			return TQuaternion<T>(
+				wa * from.w + wb * to.w,
+				wa * from.x + wb * to.x,
+				wa * from.y + wb * to.y,
+				wa * from.z + wb * to.z
+			).normalized();
+		}
 
-	float Quaternion::magnitude() const
-	{
-		return sqrt(sqrMagnitude());
+		// Returns the logarithm of the unit quaternion `q`. The logarithm is
+		// a pure quaternion, so only its vector part is returned.
+		template <typename T>
+		TVector3<T> logUnit(const TQuaternion<T>& q)
+		{
+			const TVector3<T> v(q.x, q.y, q.z);
+			const T sinHalfAngle = v.magnitude();
+			if (sinHalfAngle < 1e-6)
+			{
+				return v;
+			}
+
+			return v * (std::atan2(sinHalfAngle, q.w) / sinHalfAngle);
+		}
+
+		// Returns the exponential of the pure quaternion with vector part `v`.
+		template <typename T>
+		TQuaternion<T> expPure(const TVector3<T>& v)
+		{
+			const T halfAngle = v.magnitude();
+			if (halfAngle < 1e-6)
+			{
+				return TQuaternion<T>(1.0f, v).normalized();
+			}
+
+			return TQuaternion<T>(std::cos(halfAngle), v * (std::sin(halfAngle) / halfAngle));
+		}
+
+#if defined(M3D_SSE2)
+		// Rotates the vectors (vx, vy, vz) by the quaternions (qw, qx, qy, qz),
+		// one per lane, using the same cross product formulation as the scalar
+		// quaternion-vector product.
+		void rotateLanes(__m128 qw, __m128 qx, __m128 qy, __m128 qz,
+			__m128& vx, __m128& vy, __m128& vz)
+		{
+			const __m128 two = _mm_set1_ps(2.0f);
+
+			// t = 2 * cross(qv, v)
+			const __m128 tx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy)));
+			const __m128 ty = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz)));
+			const __m128 tz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx)));
+
+			// v + w * t + cross(qv, t)
+			vx = _mm_add_ps(simd::madd(qw, tx, vx), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)));
+			vy = _mm_add_ps(simd::madd(qw, ty, vy), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)));
+			vz = _mm_add_ps(simd::madd(qw, tz, vz), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)));
+		}
+#endif
+
+#if defined(M3D_AVX)
+		// Eight lane version of the above.
+		void rotateLanes(__m256 qw, __m256 qx, __m256 qy, __m256 qz,
+			__m256& vx, __m256& vy, __m256& vz)
+		{
+			const __m256 two = _mm256_set1_ps(2.0f);
+
+			const __m256 tx = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qy, vz), _mm256_mul_ps(qz, vy)));
+			const __m256 ty = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qz, vx), _mm256_mul_ps(qx, vz)));
+			const __m256 tz = _mm256_mul_ps(two, _mm256_sub_ps(_mm256_mul_ps(qx, vy), _mm256_mul_ps(qy, vx)));
+
+			vx = _mm256_add_ps(simd::madd(qw, tx, vx), _mm256_sub_ps(_mm256_mul_ps(qy, tz), _mm256_mul_ps(qz, ty)));
+			vy = _mm256_add_ps(simd::madd(qw, ty, vy), _mm256_sub_ps(_mm256_mul_ps(qz, tx), _mm256_mul_ps(qx, tz)));
+			vz = _mm256_add_ps(simd::madd(qw, tz, vz), _mm256_sub_ps(_mm256_mul_ps(qx, ty), _mm256_mul_ps(qy, tx)));
+		}
+#endif
+
+#if defined(M3D_SSE2)
+		// Loads the four quaternions starting at `q` in structure-of-arrays
+		// form.
+		void loadQuaternions(const TQuaternion<float>* q, __m128& w, __m128& x, __m128& y, __m128& z)
+		{
+			w = _mm_loadu_ps(&q[0].w);
+			x = _mm_loadu_ps(&q[1].w);
+			y = _mm_loadu_ps(&q[2].w);
+			z = _mm_loadu_ps(&q[3].w);
+			_MM_TRANSPOSE4_PS(w, x, y, z);
+		}
+
+		// Stores four quaternions given in structure-of-arrays form starting
+		// at `q`.
+		void storeQuaternions(TQuaternion<float>* q, __m128 w, __m128 x, __m128 y, __m128 z)
+		{
+			_MM_TRANSPOSE4_PS(w, x, y, z);
+			_mm_storeu_ps(&q[0].w, w);
+			_mm_storeu_ps(&q[1].w, x);
+			_mm_storeu_ps(&q[2].w, y);
+			_mm_storeu_ps(&q[3].w, z);
+		}
+
+		// Returns the slerp weights for the interpolation fractions `t`, one
+		// per lane. See slerpWeight().
+		__m128 slerpWeightLanes(__m128 t, __m128 cosm1)
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 tt = _mm_mul_ps(t, t);
+
+			__m128 weight = one;
+			for (int i = 7; i >= 0; --i)
+			{
+				const __m128 u = _mm_set1_ps(static_cast<float>(slerpU[i]));
+				const __m128 v = _mm_set1_ps(static_cast<float>(slerpV[i]));
+				weight = simd::madd(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u, tt), v), cosm1), weight, one);
+			}
+
+			return _mm_mul_ps(t, weight);
+		}
+#endif
+
+#if defined(M3D_AVX)
+		// Loads the eight quaternions starting at `q` in structure-of-arrays
+		// form. Quaternions 0..3 go to the low halves and 4..7 to the high
+		// halves, so that transposing each half leaves the lanes in the same
+		// order as the quaternions.
+		void loadQuaternions(const TQuaternion<float>* q, __m256& w, __m256& x, __m256& y, __m256& z)
+		{
+			w = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[0].w)), _mm_loadu_ps(&q[4].w), 1);
+			x = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[1].w)), _mm_loadu_ps(&q[5].w), 1);
+			y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[2].w)), _mm_loadu_ps(&q[6].w), 1);
+			z = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[3].w)), _mm_loadu_ps(&q[7].w), 1);
+			simd::transpose4(w, x, y, z);
+		}
+
+		// Stores eight quaternions given in structure-of-arrays form starting
+		// at `q`.
+		void storeQuaternions(TQuaternion<float>* q, __m256 w, __m256 x, __m256 y, __m256 z)
+		{
+			simd::transpose4(w, x, y, z);
+			_mm_storeu_ps(&q[0].w, _mm256_castps256_ps128(w));
+			_mm_storeu_ps(&q[1].w, _mm256_castps256_ps128(x));
+			_mm_storeu_ps(&q[2].w, _mm256_castps256_ps128(y));
+			_mm_storeu_ps(&q[3].w, _mm256_castps256_ps128(z));
+			_mm_storeu_ps(&q[4].w, _mm256_extractf128_ps(w, 1));
+			_mm_storeu_ps(&q[5].w, _mm256_extractf128_ps(x, 1));
+			_mm_storeu_ps(&q[6].w, _mm256_extractf128_ps(y, 1));
+			_mm_storeu_ps(&q[7].w, _mm256_extractf128_ps(z, 1));
+		}
+
+		// Eight lane version of the above.
+		__m256 slerpWeightLanes(__m256 t, __m256 cosm1)
+		{
+			const __m256 one = _mm256_set1_ps(1.0f);
+			const __m256 tt = _mm256_mul_ps(t, t);
+
+			__m256 weight = one;
+			for (int i = 7; i >= 0; --i)
+			{
+				const __m256 u = _mm256_set1_ps(static_cast<float>(slerpU[i]));
+				const __m256 v = _mm256_set1_ps(static_cast<float>(slerpV[i]));
+				weight = simd::madd(_mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(u, tt), v), cosm1), weight, one);
+			}
+
+			return _mm256_mul_ps(t, weight);
+		}
+#endif
+
+#if defined(M3D_SSE2)
+		void rotateArray(const TQuaternion<float>& q, const TVector3<float>* in, TVector3<float>* out,
+			std::size_t first, std::size_t count)
+		{
+			static_assert(sizeof(TVector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			{
+				const __m256 qw = _mm256_set1_ps(q.w), qx = _mm256_set1_ps(q.x);
+				const __m256 qy = _mm256_set1_ps(q.y), qz = _mm256_set1_ps(q.z);
+
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256 x, y, z;
+					simd::loadPacked3(&in[i].x, x, y, z);
+					rotateLanes(qw, qx, qy, qz, x, y, z);
+					simd::storePacked3(&out[i].x, x, y, z);
+				}
+			}
+#endif
+
+			const __m128 qw = _mm_set1_ps(q.w), qx = _mm_set1_ps(q.x);
+			const __m128 qy = _mm_set1_ps(q.y), qz = _mm_set1_ps(q.z);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 x, y, z;
+				simd::loadPacked3(&in[i].x, x, y, z);
+				rotateLanes(qw, qx, qy, qz, x, y, z);
+				simd::storePacked3(&out[i].x, x, y, z);
+			}
+
+			// Remaining vectors.
+			rotateArray<float>(q, in, out, i, count);
+		}
+
+		void rotateArrays(const TQuaternion<float>* q, const TVector3<float>* in, TVector3<float>* out,
+			std::size_t first, std::size_t count)
+		{
+			static_assert(sizeof(TQuaternion<float>) == 4 * sizeof(float), "Quaternion must be tightly packed");
+			static_assert(sizeof(TVector3<float>) == 3 * sizeof(float), "Vector3 must be tightly packed");
+
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 qw, qx, qy, qz;
+				loadQuaternions(&q[i], qw, qx, qy, qz);
+
+				__m256 x, y, z;
+				simd::loadPacked3(&in[i].x, x, y, z);
+				rotateLanes(qw, qx, qy, qz, x, y, z);
+				simd::storePacked3(&out[i].x, x, y, z);
+			}
+#endif
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 qw, qx, qy, qz;
+				loadQuaternions(&q[i], qw, qx, qy, qz);
+
+				__m128 x, y, z;
+				simd::loadPacked3(&in[i].x, x, y, z);
+				rotateLanes(qw, qx, qy, qz, x, y, z);
+				simd::storePacked3(&out[i].x, x, y, z);
+			}
+
+			// Remaining vectors.
+			rotateArrays<float>(q, in, out, i, count);
+		}
+
+		void slerpArrays(const TQuaternion<float>* from, const TQuaternion<float>* to, const float* factors,
+			TQuaternion<float>* out, std::size_t first, std::size_t count)
+		{
+			static_assert(sizeof(TQuaternion<float>) == 4 * sizeof(float), "Quaternion must be tightly packed");
+
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			{
+				const __m256 one = _mm256_set1_ps(1.0f);
+				const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256 aw, ax, ay, az, bw, bx, by, bz;
+					loadQuaternions(&from[i], aw, ax, ay, az);
+					loadQuaternions(&to[i], bw, bx, by, bz);
+					const __m256 t = _mm256_loadu_ps(&factors[i]);
+
+					// Interpolate towards whichever of b and -b is closer by
+					// flipping the sign of the weight for b.
+					__m256 d = _mm256_mul_ps(aw, bw);
+					d = simd::madd(ax, bx, d);
+					d = simd::madd(ay, by, d);
+					d = simd::madd(az, bz, d);
+					const __m256 sign = _mm256_and_ps(d, signMask);
+					const __m256 cosm1 = _mm256_sub_ps(_mm256_xor_ps(d, sign), one);
+
+					const __m256 wa = slerpWeightLanes(_mm256_sub_ps(one, t), cosm1);
+					const __m256 wb = _mm256_xor_ps(slerpWeightLanes(t, cosm1), sign);
+
+					storeQuaternions(&out[i],
+						simd::madd(wa, aw, _mm256_mul_ps(wb, bw)),
+						simd::madd(wa, ax, _mm256_mul_ps(wb, bx)),
+						simd::madd(wa, ay, _mm256_mul_ps(wb, by)),
+						simd::madd(wa, az, _mm256_mul_ps(wb, bz)));
+				}
+			}
+#endif
+
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 aw, ax, ay, az, bw, bx, by, bz;
+				loadQuaternions(&from[i], aw, ax, ay, az);
+				loadQuaternions(&to[i], bw, bx, by, bz);
+				const __m128 t = _mm_loadu_ps(&factors[i]);
+
+				__m128 d = _mm_mul_ps(aw, bw);
+				d = simd::madd(ax, bx, d);
+				d = simd::madd(ay, by, d);
+				d = simd::madd(az, bz, d);
+				const __m128 sign = _mm_and_ps(d, signMask);
+				const __m128 cosm1 = _mm_sub_ps(_mm_xor_ps(d, sign), one);
+
+				const __m128 wa = slerpWeightLanes(_mm_sub_ps(one, t), cosm1);
+				const __m128 wb = _mm_xor_ps(slerpWeightLanes(t, cosm1), sign);
+
+				storeQuaternions(&out[i],
+					simd::madd(wa, aw, _mm_mul_ps(wb, bw)),
+					simd::madd(wa, ax, _mm_mul_ps(wb, bx)),
+					simd::madd(wa, ay, _mm_mul_ps(wb, by)),
+					simd::madd(wa, az, _mm_mul_ps(wb, bz)));
+			}
+
+			// Remaining pairs.
+			slerpArrays<float>(from, to, factors, out, i, count);
+		}
+#endif
 	}
 
-	Quaternion Quaternion::normalized() const
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TQuaternion<T>& q)
 	{
-		assert(magnitude() > 0.0f);
-		const float invNorm = 1.0f / magnitude();
-
-		return Quaternion(w * invNorm, x * invNorm, y * invNorm, z * invNorm);
+		out << q.w << " + " << q.x << "i + " << q.y << "j + " << q.z << "k";
+		return out;
 	}
 
-	void Quaternion::rotateTowards(const Quaternion& target, float maxRadiansDelta)
+	template <typename T>
+	void TQuaternion<T>::rotateTowards(const TQuaternion<T>& target, T maxRadiansDelta)
 	{
 		// Relative unit quaternion rotation between this quaternion and the
 		// target quaternion.
-		const Quaternion relativeRotation = conjugate() * target;
+		const TQuaternion<T> relativeRotation = conjugate() * target;
 
 		// Calculate the angle and axis of the relative quaternion rotation.
 		assert(std::abs(relativeRotation.w) <= 1.0f);
-		const float angle = 2.0f * std::acos(relativeRotation.w);
-		const Vector3 axis(relativeRotation.x, relativeRotation.y, relativeRotation.z);
+		const T angle = 2.0f * std::acos(relativeRotation.w);
+		const TVector3<T> axis(relativeRotation.x, relativeRotation.y, relativeRotation.z);
 
 		// Apply a step of the relative rotation.
 		if (angle > maxRadiansDelta)
@@ -112,7 +469,7 @@ namespace M3D
 			// maxRadiansDelta. Note that we need to normalize the axis as the
 			// vector part of the relativeRotation quaternion is probably not
 			// a unit vector (unless the scalar part is zero).
-			const Quaternion delta = Quaternion::angleAxis(maxRadiansDelta, axis.normalized());
+			const TQuaternion<T> delta = TQuaternion<T>::angleAxis(maxRadiansDelta, axis.normalized());
 			(*this) = delta * (*this);
 		}
 		else
@@ -122,41 +479,32 @@ namespace M3D
 		}
 	}
 
-	void Quaternion::normalize()
-	{
-		assert(magnitude() > 0.0f);
-		const float invNorm = 1.0f / magnitude();
-
-		w *= invNorm;
-		x *= invNorm;
-		y *= invNorm;
-		z *= invNorm;
-	}
-
-	Quaternion Quaternion::angleAxis(const float angle, const Vector3& axis)
+	template <typename T>
+	TQuaternion<T> TQuaternion<T>::angleAxis(const T angle, const TVector3<T>& axis)
 	{
 		// The axis supplied should be a unit vector. We don't automatically
 		// normalize the axis for efficiency.
 		assert(std::abs(axis.magnitude() - 1.0f) < 1e-6);
 
-		const float halfAngle = 0.5f * angle;
-		return Quaternion(std::cos(halfAngle), axis * std::sin(halfAngle));
+		const T halfAngle = 0.5f * angle;
+		return TQuaternion<T>(std::cos(halfAngle), axis * std::sin(halfAngle));
 	}
 
-	Quaternion Quaternion::euler(const Vector3& eulerAngles)
+	template <typename T>
+	TQuaternion<T> TQuaternion<T>::euler(const TVector3<T>& eulerAngles)
 	{
-		const float halfPhi = 0.5f * eulerAngles.x; // Half the roll.
-		const float halfTheta = 0.5f * eulerAngles.y; // Half the pitch.
-		const float halfPsi = 0.5f * eulerAngles.z; // Half the yaw.
-
-		const float cosHalfPhi = std::cos(halfPhi);
-		const float sinHalfPhi = std::sin(halfPhi);
-		const float cosHalfTheta = std::cos(halfTheta);
-		const float sinHalfTheta = std::sin(halfTheta);
-		const float cosHalfPsi = std::cos(halfPsi);
-		const float sinHalfPsi = std::sin(halfPsi);
-
-		return Quaternion(
+		const T halfPhi = 0.5f * eulerAngles.x; // Half the roll.
+		const T halfTheta = 0.5f * eulerAngles.y; // Half the pitch.
+		const T halfPsi = 0.5f * eulerAngles.z; // Half the yaw.
+
+		const T cosHalfPhi = std::cos(halfPhi);
+		const T sinHalfPhi = std::sin(halfPhi);
+		const T cosHalfTheta = std::cos(halfTheta);
+		const T sinHalfTheta = std::sin(halfTheta);
+		const T cosHalfPsi = std::cos(halfPsi);
+		const T sinHalfPsi = std::sin(halfPsi);
+
+		return TQuaternion<T>(
 			cosHalfPhi * cosHalfTheta * cosHalfPsi - sinHalfPhi * sinHalfTheta * sinHalfPsi,
 			sinHalfPhi * cosHalfTheta * cosHalfPsi + cosHalfPhi * sinHalfTheta * sinHalfPsi,
 			cosHalfPhi * sinHalfTheta * cosHalfPsi - sinHalfPhi * cosHalfTheta * sinHalfPsi,
@@ -164,25 +512,26 @@ namespace M3D
 		);
 	}
 
-	Quaternion Quaternion::fromToRotation(const Vector3& fromDirection, const Vector3& toDirection)
+	template <typename T>
+	TQuaternion<T> TQuaternion<T>::fromToRotation(const TVector3<T>& fromDirection, const TVector3<T>& toDirection)
 	{
 		assert(fromDirection.sqrMagnitude() > 0.0f && toDirection.sqrMagnitude() > 0.0f);
-		const Vector3 unitFrom = fromDirection.normalized();
-		const Vector3 unitTo = toDirection.normalized();
-		const float d = dot(unitFrom, unitTo);
+		const TVector3<T> unitFrom = fromDirection.normalized();
+		const TVector3<T> unitTo = toDirection.normalized();
+		const T d = dot(unitFrom, unitTo);
 
 		if (d >= 1.0f)
 		{
 			// In the case where the two vectors are pointing in the same
 			// direction, we simply return the identity rotation.
-			return Quaternion::IDENTITY;
+			return TQuaternion<T>::IDENTITY;
 		}
 		else if (d <= -1.0f)
 		{
 			// If the two vectors are pointing in opposite directions then we
 			// need to supply a quaternion corresponding to a rotation of
 			// PI-radians about an axis orthogonal to the fromDirection.
-			Vector3 axis = cross(unitFrom, Vector3::RIGHT);
+			TVector3<T> axis = cross(unitFrom, TVector3<T>::RIGHT);
 			if (axis.sqrMagnitude() < 1e-6)
 			{
 				// Bad luck. The x-axis and fromDirection are linearly
@@ -190,7 +539,7 @@ namespace M3D
 				// orthogonal to both the y-axis and fromDirection instead.
 				// The y-axis and fromDirection will clearly not be linearly
 				// dependent.
-				axis = cross(unitFrom, Vector3::UP);
+				axis = cross(unitFrom, TVector3<T>::UP);
 			}
 
 			// Note that we need to normalize the axis as the cross product of
@@ -200,28 +549,30 @@ namespace M3D
 		else
 		{
 			// Scalar component.
-			const float s = sqrt(unitFrom.sqrMagnitude() * unitTo.sqrMagnitude())
+			const T s = sqrt(unitFrom.sqrMagnitude() * unitTo.sqrMagnitude())
 				+ dot(unitFrom, unitTo);
 
 			// Vector component.
-			const Vector3 v = cross(unitFrom, unitTo);
+			const TVector3<T> v = cross(unitFrom, unitTo);
 
 			// Return the normalized quaternion rotation.
-			return Quaternion(s, v).normalized();
+			return TQuaternion<T>(s, v).normalized();
 		}
 	}
 
-	Quaternion Quaternion::lookRotation(const Vector3& forward)
+	template <typename T>
+	TQuaternion<T> TQuaternion<T>::lookRotation(const TVector3<T>& forward)
 	{
 		assert(forward.sqrMagnitude() > 0.0f);
-		return Quaternion::fromToRotation(Vector3::FORWARD, forward);
+		return TQuaternion<T>::fromToRotation(TVector3<T>::FORWARD, forward);
 	}
 
-	Quaternion Quaternion::lookRotation(const Vector3& forward, const Vector3& upwards)
+	template <typename T>
+	TQuaternion<T> TQuaternion<T>::lookRotation(const TVector3<T>& forward, const TVector3<T>& upwards)
 	{
 		// Calculate the unit quaternion that rotates Vector3::FORWARD to face
 		// in the specified forward direction.
-		const Quaternion q1 = Quaternion::lookRotation(forward);
+		const TQuaternion<T> q1 = TQuaternion<T>::lookRotation(forward);
 
 		// We can't preserve the upwards direction if the forward and upwards
 		// vectors are linearly dependent (colinear).
@@ -231,11 +582,11 @@ namespace M3D
 		}
 
 		// Determine the upwards direction obtained after applying q1.
-		const Vector3 newUp = q1 * Vector3::UP;
+		const TVector3<T> newUp = q1 * TVector3<T>::UP;
 
 		// Calculate the unit quaternion rotation that rotates the newUp
 		// direction to look in the specified upward direction.
-		const Quaternion q2 = fromToRotation(newUp, upwards);
+		const TQuaternion<T> q2 = fromToRotation(newUp, upwards);
 
 		// Return the combined rotation so that we first rotate to look in the
 		// forward direction and then rotate to align Vector3::UPWARD with the
@@ -244,29 +595,99 @@ namespace M3D
 		return q2 * q1;
 	}
 
-	Quaternion Quaternion::conjugate() const
+	template <typename T>
+	T angle(const TQuaternion<T>& from, const TQuaternion<T>& to)
 	{
-		return Quaternion(w, -x, -y, -z);
+		const TQuaternion<T> relativeRotation = from.conjugate() * to;
+		assert(std::abs(relativeRotation.w) <= 1.0f);
+		return 2.0f * std::acos(relativeRotation.w);
 	}
 
-	Quaternion Quaternion::inverse() const
+	template <typename T>
+	TQuaternion<T> slerp(const TQuaternion<T>& from, const TQuaternion<T>& to, typename TQuaternion<T>::Scalar factor)
 	{
-		const float sqr = sqrMagnitude();
-		assert(sqr > 0.0f);
+		return exactSlerp(from, to, factor, true);
+	}
 
-		const float invSqr = 1.0f / sqr;
-		return Quaternion(w * invSqr, -x * invSqr, -y * invSqr, -z * invSqr);
+	template <typename T>
+	TQuaternion<T> squad(const TQuaternion<T>& from, const TQuaternion<T>& to,
+		const TQuaternion<T>& fromControl, const TQuaternion<T>& toControl,
+		typename TQuaternion<T>::Scalar factor)
+	{
+		// Move the destination key and its control point into the same
+		// hemisphere as the source key so that the shortest path is taken.
+		// The intermediate interpolations must not flip the hemisphere or
+		// the curve would be discontinuous.
+		const T sign = dot(from, to) < 0.0f ? -1.0f : 1.0f;
+		const TQuaternion<T> b(to.w * sign, to.x * sign, to.y * sign, to.z * sign);
+		const TQuaternion<T> bControl(toControl.w * sign, toControl.x * sign, toControl.y * sign, toControl.z * sign);
+
+		const TQuaternion<T> keys = exactSlerp(from, b, factor, false);
+		const TQuaternion<T> controls = exactSlerp(fromControl, bControl, factor, false);
+		return exactSlerp(keys, controls, 2.0f * factor * (1.0f - factor), false);
 	}
 
-	float dot(const Quaternion& lhs, const Quaternion& rhs)
+	template <typename T>
+	TQuaternion<T> squadControlPoint(const TQuaternion<T>& previous, const TQuaternion<T>& current,
+		const TQuaternion<T>& next)
 	{
-		return lhs.w * rhs.w + lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+		// Move the neighbouring keys into the same hemisphere as the current
+		// key.
+		const T previousSign = dot(current, previous) < 0.0f ? -1.0f : 1.0f;
+		const T nextSign = dot(current, next) < 0.0f ? -1.0f : 1.0f;
+		const TQuaternion<T> p(previous.w * previousSign, previous.x * previousSign, previous.y * previousSign, previous.z * previousSign);
+		const TQuaternion<T> n(next.w * nextSign, next.x * nextSign, next.y * nextSign, next.z * nextSign);
+
+		// s = q * exp(-(log(q^-1 * next) + log(q^-1 * previous)) / 4)
+		const TQuaternion<T> inv = current.conjugate();
+		const TVector3<T> l = logUnit(inv * n) + logUnit(inv * p);
+		return current * expPure(l * -0.25f);
 	}
 
-	float angle(const Quaternion& from, const Quaternion& to)
+	template <typename T>
+	void slerp(const TQuaternion<T>* from, const TQuaternion<T>* to, const T* factors,
+		TQuaternion<T>* out, std::size_t count)
 	{
-		const Quaternion relativeRotation = from.conjugate() * to;
-		assert(std::abs(relativeRotation.w) <= 1.0f);
-		return 2.0f * std::acos(relativeRotation.w);
+		slerpArrays(from, to, factors, out, 0, count);
+	}
+
+	template <typename T>
+	void rotate(const TQuaternion<T>& q, const TVector3<T>* in, TVector3<T>* out, std::size_t count)
+	{
+		rotateArray(q, in, out, 0, count);
 	}
+
+	template <typename T>
+	void rotate(const TQuaternion<T>* q, const TVector3<T>* in, TVector3<T>* out, std::size_t count)
+	{
+		rotateArrays(q, in, out, 0, count);
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TQuaternion<float>;
+	template class TQuaternion<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TQuaternion<float>& q);
+	template float angle(const TQuaternion<float>& from, const TQuaternion<float>& to);
+	template void rotate(const TQuaternion<float>& q, const TVector3<float>* in, TVector3<float>* out, std::size_t count);
+	template void rotate(const TQuaternion<float>* q, const TVector3<float>* in, TVector3<float>* out, std::size_t count);
+	template TQuaternion<float> slerp(const TQuaternion<float>& from, const TQuaternion<float>& to, float factor);
+	template TQuaternion<float> squad(const TQuaternion<float>& from, const TQuaternion<float>& to,
+		const TQuaternion<float>& fromControl, const TQuaternion<float>& toControl, float factor);
+	template TQuaternion<float> squadControlPoint(const TQuaternion<float>& previous, const TQuaternion<float>& current,
+		const TQuaternion<float>& next);
+	template void slerp(const TQuaternion<float>* from, const TQuaternion<float>* to, const float* factors,
+		TQuaternion<float>* out, std::size_t count);
+
+	template std::ostream& operator <<(std::ostream& out, const TQuaternion<double>& q);
+	template double angle(const TQuaternion<double>& from, const TQuaternion<double>& to);
+	template void rotate(const TQuaternion<double>& q, const TVector3<double>* in, TVector3<double>* out, std::size_t count);
+	template void rotate(const TQuaternion<double>* q, const TVector3<double>* in, TVector3<double>* out, std::size_t count);
+	template TQuaternion<double> slerp(const TQuaternion<double>& from, const TQuaternion<double>& to, double factor);
+	template TQuaternion<double> squad(const TQuaternion<double>& from, const TQuaternion<double>& to,
+		const TQuaternion<double>& fromControl, const TQuaternion<double>& toControl, double factor);
+	template TQuaternion<double> squadControlPoint(const TQuaternion<double>& previous, const TQuaternion<double>& current,
+		const TQuaternion<double>& next);
+	template void slerp(const TQuaternion<double>* from, const TQuaternion<double>* to, const double* factors,
+		TQuaternion<double>* out, std::size_t count);
 }
@@ -0,0 +1,556 @@
+#include <M3D/Ray.hpp>
+
+#include "SIMD.hpp"
+
+#include <limits>
+
+namespace M3D
+{
+	namespace
+	{
+		// Intersects `ray` with the triangles in `axs`, ..., `czs`, starting
+		// from the triangle at index `first`.
+		template <typename T>
+		void intersectTriangleArrays(const TRay<T>& ray,
+			const T* axs, const T* ays, const T* azs,
+			const T* bxs, const T* bys, const T* bzs,
+			const T* cxs, const T* cys, const T* czs,
+			T* distances, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const TTriangle<T> triangle(
+					TVector3<T>(axs[i], ays[i], azs[i]),
+					TVector3<T>(bxs[i], bys[i], bzs[i]),
+					TVector3<T>(cxs[i], cys[i], czs[i]));
+
+				T t;
+				distances[i] = ray.intersects(triangle, t) ? t : std::numeric_limits<T>::infinity();
+			}
+		}
+
+		// Intersects `ray` with the boxes in `minXs`, ..., `maxZs`, starting
+		// from the box at index `first`.
+		template <typename T>
+		void intersectBoxArrays(const TRay<T>& ray,
+			const T* minXs, const T* minYs, const T* minZs,
+			const T* maxXs, const T* maxYs, const T* maxZs,
+			T* distances, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const TAABB<T> box(TVector3<T>(minXs[i], minYs[i], minZs[i]), TVector3<T>(maxXs[i], maxYs[i], maxZs[i]));
+
+				T t;
+				distances[i] = ray.intersects(box, t) ? t : std::numeric_limits<T>::infinity();
+			}
+		}
+
+		// Intersects `ray` with the spheres in `xs`, `ys`, `zs` and `radii`,
+		// starting from the sphere at index `first`.
+		template <typename T>
+		void intersectSphereArrays(const TRay<T>& ray, const T* xs, const T* ys, const T* zs, const T* radii,
+			T* distances, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				T t;
+				distances[i] = ray.intersects(TSphere<T>(TVector3<T>(xs[i], ys[i], zs[i]), radii[i]), t)
+					? t : std::numeric_limits<T>::infinity();
+			}
+		}
+
+		// Intersects the rays in `oxs`, ..., `dzs`, starting from the ray at
+		// index `first`, with `primitive`.
+		template <typename T, typename Primitive>
+		void intersectRayArrays(const T* oxs, const T* oys, const T* ozs, const T* dxs, const T* dys, const T* dzs,
+			const Primitive& primitive, T* distances, std::size_t first, std::size_t count)
+		{
+			for (std::size_t i = first; i < count; ++i)
+			{
+				const TRay<T> ray(TVector3<T>(oxs[i], oys[i], ozs[i]), TVector3<T>(dxs[i], dys[i], dzs[i]));
+
+				T t;
+				distances[i] = ray.intersects(primitive, t) ? t : std::numeric_limits<T>::infinity();
+			}
+		}
+
+		// The lane functions below perform the scalar tests of TRay on four
+		// or eight ray and primitive pairs, with either side broadcast from
+		// a single ray or primitive. They return the parameter of the
+		// intersection in each lane, or positive infinity where there is no
+		// intersection.
+
+#if defined(M3D_SSE2)
+		// Returns `t` in the lanes selected by `hit` and infinity elsewhere.
+		inline __m128 selectHits(__m128 hit, __m128 t)
+		{
+			const __m128 infinity = _mm_set1_ps(std::numeric_limits<float>::infinity());
+			return _mm_or_ps(_mm_and_ps(hit, t), _mm_andnot_ps(hit, infinity));
+		}
+
+		inline __m128 triangleLanes(__m128 ox, __m128 oy, __m128 oz, __m128 dx, __m128 dy, __m128 dz,
+			__m128 ax, __m128 ay, __m128 az, __m128 e1x, __m128 e1y, __m128 e1z, __m128 e2x, __m128 e2y, __m128 e2z)
+		{
+			const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+			const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+			const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+			const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), simd::madd(e1z, pz, simd::madd(e1y, py, _mm_mul_ps(e1x, px))));
+
+			const __m128 sx = _mm_sub_ps(ox, ax);
+			const __m128 sy = _mm_sub_ps(oy, ay);
+			const __m128 sz = _mm_sub_ps(oz, az);
+			const __m128 u = _mm_mul_ps(simd::madd(sz, pz, simd::madd(sy, py, _mm_mul_ps(sx, px))), invDet);
+
+			const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+			const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+			const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+			const __m128 v = _mm_mul_ps(simd::madd(dz, qz, simd::madd(dy, qy, _mm_mul_ps(dx, qx))), invDet);
+			const __m128 t = _mm_mul_ps(simd::madd(e2z, qz, simd::madd(e2y, qy, _mm_mul_ps(e2x, qx))), invDet);
+
+			const __m128 zero = _mm_setzero_ps();
+			__m128 hit = _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero));
+			hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+			hit = _mm_and_ps(hit, _mm_cmpge_ps(t, zero));
+			return selectHits(hit, t);
+		}
+
+		// Clips the parameter ranges in `entry` and `exit` to a pair of slabs,
+		// leaving the lanes in which either parameter is NaN unclipped, as
+		// TRay::clipSlab does. The min and max intrinsics return their second
+		// operand when either is NaN, so the slab parameters of those lanes
+		// are set to NaN (all bits set) and passed first.
+		inline void clipSlabLanes(__m128 t0, __m128 t1, __m128& entry, __m128& exit)
+		{
+			const __m128 unordered = _mm_cmpunord_ps(t0, t1);
+			entry = _mm_max_ps(_mm_or_ps(_mm_min_ps(t0, t1), unordered), entry);
+			exit = _mm_min_ps(_mm_or_ps(_mm_max_ps(t0, t1), unordered), exit);
+		}
+
+		inline __m128 boxLanes(__m128 ox, __m128 oy, __m128 oz, __m128 invX, __m128 invY, __m128 invZ,
+			__m128 minX, __m128 minY, __m128 minZ, __m128 maxX, __m128 maxY, __m128 maxZ)
+		{
+			const __m128 x0 = _mm_mul_ps(_mm_sub_ps(minX, ox), invX), x1 = _mm_mul_ps(_mm_sub_ps(maxX, ox), invX);
+			const __m128 y0 = _mm_mul_ps(_mm_sub_ps(minY, oy), invY), y1 = _mm_mul_ps(_mm_sub_ps(maxY, oy), invY);
+			const __m128 z0 = _mm_mul_ps(_mm_sub_ps(minZ, oz), invZ), z1 = _mm_mul_ps(_mm_sub_ps(maxZ, oz), invZ);
+
+			__m128 tMin = _mm_setzero_ps();
+			__m128 tMax = _mm_set1_ps(std::numeric_limits<float>::infinity());
+			clipSlabLanes(x0, x1, tMin, tMax);
+			clipSlabLanes(y0, y1, tMin, tMax);
+			clipSlabLanes(z0, z1, tMin, tMax);
+			return selectHits(_mm_cmple_ps(tMin, tMax), tMin);
+		}
+
+		inline __m128 sphereLanes(__m128 ox, __m128 oy, __m128 oz, __m128 dx, __m128 dy, __m128 dz,
+			__m128 cx, __m128 cy, __m128 cz, __m128 r)
+		{
+			const __m128 mx = _mm_sub_ps(ox, cx);
+			const __m128 my = _mm_sub_ps(oy, cy);
+			const __m128 mz = _mm_sub_ps(oz, cz);
+			const __m128 b = simd::madd(mz, dz, simd::madd(my, dy, _mm_mul_ps(mx, dx)));
+			const __m128 c = _mm_sub_ps(simd::madd(mz, mz, simd::madd(my, my, _mm_mul_ps(mx, mx))), _mm_mul_ps(r, r));
+			const __m128 a = simd::madd(dz, dz, simd::madd(dy, dy, _mm_mul_ps(dx, dx)));
+			const __m128 discriminant = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(a, c));
+
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 away = _mm_and_ps(_mm_cmpgt_ps(c, zero), _mm_cmpgt_ps(b, zero));
+			const __m128 hit = _mm_andnot_ps(away, _mm_cmpge_ps(discriminant, zero));
+
+			const __m128 t = _mm_div_ps(_mm_sub_ps(_mm_xor_ps(b, _mm_set1_ps(-0.0f)), _mm_sqrt_ps(discriminant)), a);
+			return selectHits(hit, _mm_max_ps(zero, t));
+		}
+#endif
+
+#if defined(M3D_AVX)
+		// Eight lane versions of the above.
+		inline __m256 selectHits(__m256 hit, __m256 t)
+		{
+			return _mm256_blendv_ps(_mm256_set1_ps(std::numeric_limits<float>::infinity()), t, hit);
+		}
+
+		inline __m256 triangleLanes(__m256 ox, __m256 oy, __m256 oz, __m256 dx, __m256 dy, __m256 dz,
+			__m256 ax, __m256 ay, __m256 az, __m256 e1x, __m256 e1y, __m256 e1z, __m256 e2x, __m256 e2y, __m256 e2z)
+		{
+			const __m256 px = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+			const __m256 py = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+			const __m256 pz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+			const __m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), simd::madd(e1z, pz, simd::madd(e1y, py, _mm256_mul_ps(e1x, px))));
+
+			const __m256 sx = _mm256_sub_ps(ox, ax);
+			const __m256 sy = _mm256_sub_ps(oy, ay);
+			const __m256 sz = _mm256_sub_ps(oz, az);
+			const __m256 u = _mm256_mul_ps(simd::madd(sz, pz, simd::madd(sy, py, _mm256_mul_ps(sx, px))), invDet);
+
+			const __m256 qx = _mm256_sub_ps(_mm256_mul_ps(sy, e1z), _mm256_mul_ps(sz, e1y));
+			const __m256 qy = _mm256_sub_ps(_mm256_mul_ps(sz, e1x), _mm256_mul_ps(sx, e1z));
+			const __m256 qz = _mm256_sub_ps(_mm256_mul_ps(sx, e1y), _mm256_mul_ps(sy, e1x));
+			const __m256 v = _mm256_mul_ps(simd::madd(dz, qz, simd::madd(dy, qy, _mm256_mul_ps(dx, qx))), invDet);
+			const __m256 t = _mm256_mul_ps(simd::madd(e2z, qz, simd::madd(e2y, qy, _mm256_mul_ps(e2x, qx))), invDet);
+
+			const __m256 zero = _mm256_setzero_ps();
+			__m256 hit = _mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GE_OQ), _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+			hit = _mm256_and_ps(hit, _mm256_cmp_ps(_mm256_add_ps(u, v), _mm256_set1_ps(1.0f), _CMP_LE_OQ));
+			hit = _mm256_and_ps(hit, _mm256_cmp_ps(t, zero, _CMP_GE_OQ));
+			return selectHits(hit, t);
+		}
+
+		inline void clipSlabLanes(__m256 t0, __m256 t1, __m256& entry, __m256& exit)
+		{
+			const __m256 unordered = _mm256_cmp_ps(t0, t1, _CMP_UNORD_Q);
+			entry = _mm256_max_ps(_mm256_or_ps(_mm256_min_ps(t0, t1), unordered), entry);
+			exit = _mm256_min_ps(_mm256_or_ps(_mm256_max_ps(t0, t1), unordered), exit);
+		}
+
+		inline __m256 boxLanes(__m256 ox, __m256 oy, __m256 oz, __m256 invX, __m256 invY, __m256 invZ,
+			__m256 minX, __m256 minY, __m256 minZ, __m256 maxX, __m256 maxY, __m256 maxZ)
+		{
+			const __m256 x0 = _mm256_mul_ps(_mm256_sub_ps(minX, ox), invX), x1 = _mm256_mul_ps(_mm256_sub_ps(maxX, ox), invX);
+			const __m256 y0 = _mm256_mul_ps(_mm256_sub_ps(minY, oy), invY), y1 = _mm256_mul_ps(_mm256_sub_ps(maxY, oy), invY);
+			const __m256 z0 = _mm256_mul_ps(_mm256_sub_ps(minZ, oz), invZ), z1 = _mm256_mul_ps(_mm256_sub_ps(maxZ, oz), invZ);
+
+			__m256 tMin = _mm256_setzero_ps();
+			__m256 tMax = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+			clipSlabLanes(x0, x1, tMin, tMax);
+			clipSlabLanes(y0, y1, tMin, tMax);
+			clipSlabLanes(z0, z1, tMin, tMax);
+			return selectHits(_mm256_cmp_ps(tMin, tMax, _CMP_LE_OQ), tMin);
+		}
+
+		inline __m256 sphereLanes(__m256 ox, __m256 oy, __m256 oz, __m256 dx, __m256 dy, __m256 dz,
+			__m256 cx, __m256 cy, __m256 cz, __m256 r)
+		{
+			const __m256 mx = _mm256_sub_ps(ox, cx);
+			const __m256 my = _mm256_sub_ps(oy, cy);
+			const __m256 mz = _mm256_sub_ps(oz, cz);
+			const __m256 b = simd::madd(mz, dz, simd::madd(my, dy, _mm256_mul_ps(mx, dx)));
+			const __m256 c = _mm256_sub_ps(simd::madd(mz, mz, simd::madd(my, my, _mm256_mul_ps(mx, mx))), _mm256_mul_ps(r, r));
+			const __m256 a = simd::madd(dz, dz, simd::madd(dy, dy, _mm256_mul_ps(dx, dx)));
+			const __m256 discriminant = _mm256_sub_ps(_mm256_mul_ps(b, b), _mm256_mul_ps(a, c));
+
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 away = _mm256_and_ps(_mm256_cmp_ps(c, zero, _CMP_GT_OQ), _mm256_cmp_ps(b, zero, _CMP_GT_OQ));
+			const __m256 hit = _mm256_andnot_ps(away, _mm256_cmp_ps(discriminant, zero, _CMP_GE_OQ));
+
+			const __m256 t = _mm256_div_ps(_mm256_sub_ps(_mm256_xor_ps(b, _mm256_set1_ps(-0.0f)), _mm256_sqrt_ps(discriminant)), a);
+			return selectHits(hit, _mm256_max_ps(zero, t));
+		}
+#endif
+
+#if defined(M3D_SSE2)
+		void intersectTriangleArrays(const TRay<float>& ray,
+			const float* axs, const float* ays, const float* azs,
+			const float* bxs, const float* bys, const float* bzs,
+			const float* cxs, const float* cys, const float* czs,
+			float* distances, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			const __m256 ox8 = _mm256_set1_ps(ray.origin.x), oy8 = _mm256_set1_ps(ray.origin.y), oz8 = _mm256_set1_ps(ray.origin.z);
+			const __m256 dx8 = _mm256_set1_ps(ray.direction.x), dy8 = _mm256_set1_ps(ray.direction.y), dz8 = _mm256_set1_ps(ray.direction.z);
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 ax = _mm256_loadu_ps(axs + i), ay = _mm256_loadu_ps(ays + i), az = _mm256_loadu_ps(azs + i);
+				const __m256 e1x = _mm256_sub_ps(_mm256_loadu_ps(bxs + i), ax);
+				const __m256 e1y = _mm256_sub_ps(_mm256_loadu_ps(bys + i), ay);
+				const __m256 e1z = _mm256_sub_ps(_mm256_loadu_ps(bzs + i), az);
+				const __m256 e2x = _mm256_sub_ps(_mm256_loadu_ps(cxs + i), ax);
+				const __m256 e2y = _mm256_sub_ps(_mm256_loadu_ps(cys + i), ay);
+				const __m256 e2z = _mm256_sub_ps(_mm256_loadu_ps(czs + i), az);
+				_mm256_storeu_ps(distances + i, triangleLanes(ox8, oy8, oz8, dx8, dy8, dz8, ax, ay, az, e1x, e1y, e1z, e2x, e2y, e2z));
+			}
+#endif
+
+			const __m128 ox = _mm_set1_ps(ray.origin.x), oy = _mm_set1_ps(ray.origin.y), oz = _mm_set1_ps(ray.origin.z);
+			const __m128 dx = _mm_set1_ps(ray.direction.x), dy = _mm_set1_ps(ray.direction.y), dz = _mm_set1_ps(ray.direction.z);
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 ax = _mm_loadu_ps(axs + i), ay = _mm_loadu_ps(ays + i), az = _mm_loadu_ps(azs + i);
+				const __m128 e1x = _mm_sub_ps(_mm_loadu_ps(bxs + i), ax);
+				const __m128 e1y = _mm_sub_ps(_mm_loadu_ps(bys + i), ay);
+				const __m128 e1z = _mm_sub_ps(_mm_loadu_ps(bzs + i), az);
+				const __m128 e2x = _mm_sub_ps(_mm_loadu_ps(cxs + i), ax);
+				const __m128 e2y = _mm_sub_ps(_mm_loadu_ps(cys + i), ay);
+				const __m128 e2z = _mm_sub_ps(_mm_loadu_ps(czs + i), az);
+				_mm_storeu_ps(distances + i, triangleLanes(ox, oy, oz, dx, dy, dz, ax, ay, az, e1x, e1y, e1z, e2x, e2y, e2z));
+			}
+
+			// Remaining triangles.
+			intersectTriangleArrays<float>(ray, axs, ays, azs, bxs, bys, bzs, cxs, cys, czs, distances, i, count);
+		}
+
+		void intersectBoxArrays(const TRay<float>& ray,
+			const float* minXs, const float* minYs, const float* minZs,
+			const float* maxXs, const float* maxYs, const float* maxZs,
+			float* distances, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+			const float invX = 1.0f / ray.direction.x;
+			const float invY = 1.0f / ray.direction.y;
+			const float invZ = 1.0f / ray.direction.z;
+
+#if defined(M3D_AVX)
+			const __m256 ox8 = _mm256_set1_ps(ray.origin.x), oy8 = _mm256_set1_ps(ray.origin.y), oz8 = _mm256_set1_ps(ray.origin.z);
+			const __m256 ix8 = _mm256_set1_ps(invX), iy8 = _mm256_set1_ps(invY), iz8 = _mm256_set1_ps(invZ);
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(distances + i, boxLanes(ox8, oy8, oz8, ix8, iy8, iz8,
+					_mm256_loadu_ps(minXs + i), _mm256_loadu_ps(minYs + i), _mm256_loadu_ps(minZs + i),
+					_mm256_loadu_ps(maxXs + i), _mm256_loadu_ps(maxYs + i), _mm256_loadu_ps(maxZs + i)));
+			}
+#endif
+
+			const __m128 ox = _mm_set1_ps(ray.origin.x), oy = _mm_set1_ps(ray.origin.y), oz = _mm_set1_ps(ray.origin.z);
+			const __m128 ix = _mm_set1_ps(invX), iy = _mm_set1_ps(invY), iz = _mm_set1_ps(invZ);
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(distances + i, boxLanes(ox, oy, oz, ix, iy, iz,
+					_mm_loadu_ps(minXs + i), _mm_loadu_ps(minYs + i), _mm_loadu_ps(minZs + i),
+					_mm_loadu_ps(maxXs + i), _mm_loadu_ps(maxYs + i), _mm_loadu_ps(maxZs + i)));
+			}
+
+			// Remaining boxes.
+			intersectBoxArrays<float>(ray, minXs, minYs, minZs, maxXs, maxYs, maxZs, distances, i, count);
+		}
+
+		void intersectSphereArrays(const TRay<float>& ray, const float* xs, const float* ys, const float* zs, const float* radii,
+			float* distances, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			const __m256 ox8 = _mm256_set1_ps(ray.origin.x), oy8 = _mm256_set1_ps(ray.origin.y), oz8 = _mm256_set1_ps(ray.origin.z);
+			const __m256 dx8 = _mm256_set1_ps(ray.direction.x), dy8 = _mm256_set1_ps(ray.direction.y), dz8 = _mm256_set1_ps(ray.direction.z);
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(distances + i, sphereLanes(ox8, oy8, oz8, dx8, dy8, dz8,
+					_mm256_loadu_ps(xs + i), _mm256_loadu_ps(ys + i), _mm256_loadu_ps(zs + i), _mm256_loadu_ps(radii + i)));
+			}
+#endif
+
+			const __m128 ox = _mm_set1_ps(ray.origin.x), oy = _mm_set1_ps(ray.origin.y), oz = _mm_set1_ps(ray.origin.z);
+			const __m128 dx = _mm_set1_ps(ray.direction.x), dy = _mm_set1_ps(ray.direction.y), dz = _mm_set1_ps(ray.direction.z);
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(distances + i, sphereLanes(ox, oy, oz, dx, dy, dz,
+					_mm_loadu_ps(xs + i), _mm_loadu_ps(ys + i), _mm_loadu_ps(zs + i), _mm_loadu_ps(radii + i)));
+			}
+
+			// Remaining spheres.
+			intersectSphereArrays<float>(ray, xs, ys, zs, radii, distances, i, count);
+		}
+
+		void intersectRayArrays(const float* oxs, const float* oys, const float* ozs,
+			const float* dxs, const float* dys, const float* dzs,
+			const TTriangle<float>& triangle, float* distances, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+			const TVector3<float> e1 = triangle.b - triangle.a;
+			const TVector3<float> e2 = triangle.c - triangle.a;
+
+#if defined(M3D_AVX)
+			const __m256 ax8 = _mm256_set1_ps(triangle.a.x), ay8 = _mm256_set1_ps(triangle.a.y), az8 = _mm256_set1_ps(triangle.a.z);
+			const __m256 e1x8 = _mm256_set1_ps(e1.x), e1y8 = _mm256_set1_ps(e1.y), e1z8 = _mm256_set1_ps(e1.z);
+			const __m256 e2x8 = _mm256_set1_ps(e2.x), e2y8 = _mm256_set1_ps(e2.y), e2z8 = _mm256_set1_ps(e2.z);
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(distances + i, triangleLanes(
+					_mm256_loadu_ps(oxs + i), _mm256_loadu_ps(oys + i), _mm256_loadu_ps(ozs + i),
+					_mm256_loadu_ps(dxs + i), _mm256_loadu_ps(dys + i), _mm256_loadu_ps(dzs + i),
+					ax8, ay8, az8, e1x8, e1y8, e1z8, e2x8, e2y8, e2z8));
+			}
+#endif
+
+			const __m128 ax = _mm_set1_ps(triangle.a.x), ay = _mm_set1_ps(triangle.a.y), az = _mm_set1_ps(triangle.a.z);
+			const __m128 e1x = _mm_set1_ps(e1.x), e1y = _mm_set1_ps(e1.y), e1z = _mm_set1_ps(e1.z);
+			const __m128 e2x = _mm_set1_ps(e2.x), e2y = _mm_set1_ps(e2.y), e2z = _mm_set1_ps(e2.z);
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(distances + i, triangleLanes(
+					_mm_loadu_ps(oxs + i), _mm_loadu_ps(oys + i), _mm_loadu_ps(ozs + i),
+					_mm_loadu_ps(dxs + i), _mm_loadu_ps(dys + i), _mm_loadu_ps(dzs + i),
+					ax, ay, az, e1x, e1y, e1z, e2x, e2y, e2z));
+			}
+
+			// Remaining rays.
+			intersectRayArrays<float>(oxs, oys, ozs, dxs, dys, dzs, triangle, distances, i, count);
+		}
+
+		void intersectRayArrays(const float* oxs, const float* oys, const float* ozs,
+			const float* dxs, const float* dys, const float* dzs,
+			const TAABB<float>& box, float* distances, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			const __m256 one8 = _mm256_set1_ps(1.0f);
+			const __m256 minX8 = _mm256_set1_ps(box.min.x), minY8 = _mm256_set1_ps(box.min.y), minZ8 = _mm256_set1_ps(box.min.z);
+			const __m256 maxX8 = _mm256_set1_ps(box.max.x), maxY8 = _mm256_set1_ps(box.max.y), maxZ8 = _mm256_set1_ps(box.max.z);
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(distances + i, boxLanes(
+					_mm256_loadu_ps(oxs + i), _mm256_loadu_ps(oys + i), _mm256_loadu_ps(ozs + i),
+					_mm256_div_ps(one8, _mm256_loadu_ps(dxs + i)),
+					_mm256_div_ps(one8, _mm256_loadu_ps(dys + i)),
+					_mm256_div_ps(one8, _mm256_loadu_ps(dzs + i)),
+					minX8, minY8, minZ8, maxX8, maxY8, maxZ8));
+			}
+#endif
+
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 minX = _mm_set1_ps(box.min.x), minY = _mm_set1_ps(box.min.y), minZ = _mm_set1_ps(box.min.z);
+			const __m128 maxX = _mm_set1_ps(box.max.x), maxY = _mm_set1_ps(box.max.y), maxZ = _mm_set1_ps(box.max.z);
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(distances + i, boxLanes(
+					_mm_loadu_ps(oxs + i), _mm_loadu_ps(oys + i), _mm_loadu_ps(ozs + i),
+					_mm_div_ps(one, _mm_loadu_ps(dxs + i)),
+					_mm_div_ps(one, _mm_loadu_ps(dys + i)),
+					_mm_div_ps(one, _mm_loadu_ps(dzs + i)),
+					minX, minY, minZ, maxX, maxY, maxZ));
+			}
+
+			// Remaining rays.
+			intersectRayArrays<float>(oxs, oys, ozs, dxs, dys, dzs, box, distances, i, count);
+		}
+
+		void intersectRayArrays(const float* oxs, const float* oys, const float* ozs,
+			const float* dxs, const float* dys, const float* dzs,
+			const TSphere<float>& sphere, float* distances, std::size_t first, std::size_t count)
+		{
+			std::size_t i = first;
+
+#if defined(M3D_AVX)
+			const __m256 cx8 = _mm256_set1_ps(sphere.center.x), cy8 = _mm256_set1_ps(sphere.center.y), cz8 = _mm256_set1_ps(sphere.center.z);
+			const __m256 r8 = _mm256_set1_ps(sphere.radius);
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(distances + i, sphereLanes(
+					_mm256_loadu_ps(oxs + i), _mm256_loadu_ps(oys + i), _mm256_loadu_ps(ozs + i),
+					_mm256_loadu_ps(dxs + i), _mm256_loadu_ps(dys + i), _mm256_loadu_ps(dzs + i),
+					cx8, cy8, cz8, r8));
+			}
+#endif
+
+			const __m128 cx = _mm_set1_ps(sphere.center.x), cy = _mm_set1_ps(sphere.center.y), cz = _mm_set1_ps(sphere.center.z);
+			const __m128 r = _mm_set1_ps(sphere.radius);
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(distances + i, sphereLanes(
+					_mm_loadu_ps(oxs + i), _mm_loadu_ps(oys + i), _mm_loadu_ps(ozs + i),
+					_mm_loadu_ps(dxs + i), _mm_loadu_ps(dys + i), _mm_loadu_ps(dzs + i),
+					cx, cy, cz, r));
+			}
+
+			// Remaining rays.
+			intersectRayArrays<float>(oxs, oys, ozs, dxs, dys, dzs, sphere, distances, i, count);
+		}
+#endif
+	}
+
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TRay<T>& ray)
+	{
+		out << "[" << ray.origin << ", " << ray.direction << "]";
+		return out;
+	}
+
+	template <typename T>
+	void intersectTriangles(const TRay<T>& ray,
+		const T* axs, const T* ays, const T* azs,
+		const T* bxs, const T* bys, const T* bzs,
+		const T* cxs, const T* cys, const T* czs,
+		T* distances, std::size_t count)
+	{
+		intersectTriangleArrays(ray, axs, ays, azs, bxs, bys, bzs, cxs, cys, czs, distances, 0, count);
+	}
+
+	template <typename T>
+	void intersectBoxes(const TRay<T>& ray,
+		const T* minXs, const T* minYs, const T* minZs,
+		const T* maxXs, const T* maxYs, const T* maxZs,
+		T* distances, std::size_t count)
+	{
+		intersectBoxArrays(ray, minXs, minYs, minZs, maxXs, maxYs, maxZs, distances, 0, count);
+	}
+
+	template <typename T>
+	void intersectSpheres(const TRay<T>& ray, const T* xs, const T* ys, const T* zs, const T* radii,
+		T* distances, std::size_t count)
+	{
+		intersectSphereArrays(ray, xs, ys, zs, radii, distances, 0, count);
+	}
+
+	template <typename T>
+	void intersectRays(const T* originXs, const T* originYs, const T* originZs,
+		const T* directionXs, const T* directionYs, const T* directionZs,
+		const TTriangle<T>& triangle, T* distances, std::size_t count)
+	{
+		intersectRayArrays(originXs, originYs, originZs, directionXs, directionYs, directionZs, triangle, distances, 0, count);
+	}
+
+	template <typename T>
+	void intersectRays(const T* originXs, const T* originYs, const T* originZs,
+		const T* directionXs, const T* directionYs, const T* directionZs,
+		const TAABB<T>& box, T* distances, std::size_t count)
+	{
+		intersectRayArrays(originXs, originYs, originZs, directionXs, directionYs, directionZs, box, distances, 0, count);
+	}
+
+	template <typename T>
+	void intersectRays(const T* originXs, const T* originYs, const T* originZs,
+		const T* directionXs, const T* directionYs, const T* directionZs,
+		const TSphere<T>& sphere, T* distances, std::size_t count)
+	{
+		intersectRayArrays(originXs, originYs, originZs, directionXs, directionYs, directionZs, sphere, distances, 0, count);
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TRay<float>;
+	template class TRay<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TRay<float>& ray);
+	template void intersectTriangles(const TRay<float>& ray,
+		const float* axs, const float* ays, const float* azs,
+		const float* bxs, const float* bys, const float* bzs,
+		const float* cxs, const float* cys, const float* czs,
+		float* distances, std::size_t count);
+	template void intersectBoxes(const TRay<float>& ray,
+		const float* minXs, const float* minYs, const float* minZs,
+		const float* maxXs, const float* maxYs, const float* maxZs,
+		float* distances, std::size_t count);
+	template void intersectSpheres(const TRay<float>& ray, const float* xs, const float* ys, const float* zs, const float* radii,
+		float* distances, std::size_t count);
+	template void intersectRays(const float* originXs, const float* originYs, const float* originZs,
+		const float* directionXs, const float* directionYs, const float* directionZs,
+		const TTriangle<float>& triangle, float* distances, std::size_t count);
+	template void intersectRays(const float* originXs, const float* originYs, const float* originZs,
+		const float* directionXs, const float* directionYs, const float* directionZs,
+		const TAABB<float>& box, float* distances, std::size_t count);
+	template void intersectRays(const float* originXs, const float* originYs, const float* originZs,
+		const float* directionXs, const float* directionYs, const float* directionZs,
+		const TSphere<float>& sphere, float* distances, std::size_t count);
+
+	template std::ostream& operator <<(std::ostream& out, const TRay<double>& ray);
+	template void intersectTriangles(const TRay<double>& ray,
+		const double* axs, const double* ays, const double* azs,
+		const double* bxs, const double* bys, const double* bzs,
+		const double* cxs, const double* cys, const double* czs,
+		double* distances, std::size_t count);
+	template void intersectBoxes(const TRay<double>& ray,
+		const double* minXs, const double* minYs, const double* minZs,
+		const double* maxXs, const double* maxYs, const double* maxZs,
+		double* distances, std::size_t count);
+	template void intersectSpheres(const TRay<double>& ray, const double* xs, const double* ys, const double* zs, const double* radii,
+		double* distances, std::size_t count);
+	template void intersectRays(const double* originXs, const double* originYs, const double* originZs,
+		const double* directionXs, const double* directionYs, const double* directionZs,
+		const TTriangle<double>& triangle, double* distances, std::size_t count);
+	template void intersectRays(const double* originXs, const double* originYs, const double* originZs,
+		const double* directionXs, const double* directionYs, const double* directionZs,
+		const TAABB<double>& box, double* distances, std::size_t count);
+	template void intersectRays(const double* originXs, const double* originYs, const double* originZs,
+		const double* directionXs, const double* directionYs, const double* directionZs,
+		const TSphere<double>& sphere, double* distances, std::size_t count);
+}
@@ -0,0 +1,176 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+// Internal header shared by the library translation units that contain
+// vectorised kernels. The instruction set is selected at configure time with
+// the SIMD CMake option, which defines M3D_SIMD_SSE2 and/or M3D_SIMD_AVX. The
+// kernels are only enabled when the compiler is also targeting the requested
+// instruction set, so a mismatched configuration falls back to scalar code.
+
+#if defined(M3D_SIMD_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define M3D_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+#if defined(M3D_SSE2) && defined(M3D_SIMD_AVX) && defined(__AVX__)
+	#define M3D_AVX 1
+	#include <immintrin.h>
+#endif
+
+#if defined(M3D_AVX) && defined(__FMA__)
+	#define M3D_FMA 1
+#endif
+
+// The half precision conversion instructions are not implied by AVX, so are
+// only used when the compiler targets them (for example, with -mf16c).
+#if defined(M3D_AVX) && defined(__F16C__)
+	#define M3D_F16C 1
+#endif
+
+namespace M3D
+{
+	namespace simd
+	{
+#if defined(M3D_SSE2)
+		/**
+		 * Returns `a` * `b` + `c`, using a fused multiply-add where available.
+		 */
+		inline __m128 madd(__m128 a, __m128 b, __m128 c)
+		{
+#if defined(M3D_FMA)
+			return _mm_fmadd_ps(a, b, c);
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+		}
+
+		/**
+		 * Returns a vector with every lane equal to lane `i` of `v`.
+		 */
+		template <int i>
+		inline __m128 splat(__m128 v)
+		{
+			return _mm_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
+		}
+
+		/**
+		 * Returns the sum of the four lanes of `v` broadcast to every lane.
+		 */
+		inline __m128 horizontalSum(__m128 v)
+		{
+			const __m128 t = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_add_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
+		}
+
+		/**
+		 * Loads four consecutive packed 3D vectors (12 floats) starting at
+		 * `p` and returns their components in structure-of-arrays form.
+		 */
+		inline void loadPacked3(const float* p, __m128& x, __m128& y, __m128& z)
+		{
+			// p0 = (x0, y0, z0, x1), p1 = (y1, z1, x2, y2), p2 = (z2, x3, y3, z3)
+			const __m128 p0 = _mm_loadu_ps(p);
+			const __m128 p1 = _mm_loadu_ps(p + 4);
+			const __m128 p2 = _mm_loadu_ps(p + 8);
+
+			x = _mm_shuffle_ps(
+				_mm_shuffle_ps(p0, p0, _MM_SHUFFLE(3, 3, 0, 0)),
+				_mm_shuffle_ps(p1, p2, _MM_SHUFFLE(1, 1, 2, 2)),
+				_MM_SHUFFLE(2, 0, 2, 0));
+			y = _mm_shuffle_ps(
+				_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(0, 0, 1, 1)),
+				_mm_shuffle_ps(p1, p2, _MM_SHUFFLE(2, 2, 3, 3)),
+				_MM_SHUFFLE(2, 0, 2, 0));
+			z = _mm_shuffle_ps(
+				_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(1, 1, 2, 2)),
+				_mm_shuffle_ps(p2, p2, _MM_SHUFFLE(3, 3, 0, 0)),
+				_MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		/**
+		 * Stores four 3D vectors given in structure-of-arrays form as 12
+		 * consecutive packed floats starting at `p`.
+		 */
+		inline void storePacked3(float* p, __m128 x, __m128 y, __m128 z)
+		{
+			const __m128 xy01 = _mm_unpacklo_ps(x, y);
+			const __m128 xy23 = _mm_unpackhi_ps(x, y);
+
+			_mm_storeu_ps(p, _mm_shuffle_ps(xy01, _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xy23, _MM_SHUFFLE(1, 0, 2, 0)));
+			_mm_storeu_ps(p + 8, _mm_shuffle_ps(
+				_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+				_mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+				_MM_SHUFFLE(2, 0, 2, 0)));
+		}
+#endif
+
+#if defined(M3D_AVX)
+		/**
+		 * Returns `a` * `b` + `c`, using a fused multiply-add where available.
+		 */
+		inline __m256 madd(__m256 a, __m256 b, __m256 c)
+		{
+#if defined(M3D_FMA)
+			return _mm256_fmadd_ps(a, b, c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+		}
+
+		/**
+		 * Returns a vector with every lane of each 128-bit half equal to lane
+		 * `i` of that half of `v`.
+		 */
+		template <int i>
+		inline __m256 splat(__m256 v)
+		{
+			return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
+		}
+
+		/**
+		 * Transposes the 4x4 matrix held in each 128-bit half of the rows
+		 * `r0`, `r1`, `r2` and `r3` independently.
+		 */
+		inline void transpose4(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+		{
+			const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+			const __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+			const __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+			const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+			r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		/**
+		 * Loads eight consecutive packed 3D vectors (24 floats) starting at
+		 * `p` and returns their components in structure-of-arrays form.
+		 */
+		inline void loadPacked3(const float* p, __m256& x, __m256& y, __m256& z)
+		{
+			__m128 x0, y0, z0, x1, y1, z1;
+			loadPacked3(p, x0, y0, z0);
+			loadPacked3(p + 12, x1, y1, z1);
+
+			x = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+			y = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+			z = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+		}
+
+		/**
+		 * Stores eight 3D vectors given in structure-of-arrays form as 24
+		 * consecutive packed floats starting at `p`.
+		 */
+		inline void storePacked3(float* p, __m256 x, __m256 y, __m256 z)
+		{
+			storePacked3(p, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+			storePacked3(p + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+		}
+#endif
+	}
+}
+
+#endif
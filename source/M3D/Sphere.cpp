@@ -0,0 +1,19 @@
+#include <M3D/Sphere.hpp>
+
+namespace M3D
+{
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TSphere<T>& sphere)
+	{
+		out << "[" << sphere.center << ", " << sphere.radius << "]";
+		return out;
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TSphere<float>;
+	template class TSphere<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TSphere<float>& sphere);
+
+	template std::ostream& operator <<(std::ostream& out, const TSphere<double>& sphere);
+}
@@ -0,0 +1,78 @@
+#include <M3D/TransformHierarchy.hpp>
+
+#include <cassert>
+
+namespace M3D
+{
+	namespace
+	{
+		// Returns the transform that scales by `scale`, rotates by `rotation`
+		// and then translates by `position`. The columns of the rotation are
+		// scaled, which is cheaper than composing with a scaling.
+		inline Affine3 local(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+		{
+			const Affine3 R(rotation, position);
+			return Affine3(
+				R[0] * scale.x, R[1] * scale.y, R[2] * scale.z, R[3],
+				R[4] * scale.x, R[5] * scale.y, R[6] * scale.z, R[7],
+				R[8] * scale.x, R[9] * scale.y, R[10] * scale.z, R[11]);
+		}
+	}
+
+	const std::size_t TransformHierarchy::NO_PARENT;
+
+	void TransformHierarchy::reserve(std::size_t capacity)
+	{
+		parents.reserve(capacity);
+		positions.reserve(capacity);
+		rotations.reserve(capacity);
+		scales.reserve(capacity);
+		dirty.reserve(capacity);
+		worlds.reserve(capacity);
+	}
+
+	std::size_t TransformHierarchy::add(std::size_t parent, const Vector3& position, const Quaternion& rotation,
+		const Vector3& scale)
+	{
+		assert(parent == NO_PARENT || parent < size());
+
+		const std::size_t node = size();
+		parents.push_back(parent);
+		positions.push_back(position);
+		rotations.push_back(rotation);
+		scales.push_back(scale);
+		dirty.push_back(1);
+		worlds.push_back(Affine3());
+		firstDirty = std::min(firstDirty, node);
+		return node;
+	}
+
+	std::size_t TransformHierarchy::update()
+	{
+		// The nodes before the first dirty node have no dirty ancestors, as
+		// parents precede their children, so keep their world transforms.
+		// From there, a node is recomputed if it is dirty or its parent was
+		// recomputed earlier in the pass, which the dirty flag of the parent
+		// still records.
+		const std::size_t count = size();
+		std::size_t recomputed = 0;
+		for (std::size_t node = firstDirty; node < count; ++node)
+		{
+			const std::size_t p = parents[node];
+			if (p != NO_PARENT && dirty[p]) dirty[node] = 1;
+			if (!dirty[node]) continue;
+
+			const Affine3 L = local(positions[node], rotations[node], scales[node]);
+			worlds[node] = p == NO_PARENT ? L : worlds[p] * L;
+			++recomputed;
+		}
+
+		if (firstDirty < count)
+		{
+			std::fill(dirty.begin() + firstDirty, dirty.end(), 0);
+		}
+
+		firstDirty = count;
+		return recomputed;
+	}
+}
@@ -0,0 +1,19 @@
+#include <M3D/Triangle.hpp>
+
+namespace M3D
+{
+	template <typename T>
+	std::ostream& operator <<(std::ostream& out, const TTriangle<T>& triangle)
+	{
+		out << "[" << triangle.a << ", " << triangle.b << ", " << triangle.c << "]";
+		return out;
+	}
+
+	// Explicit instantiations for the supported scalar types.
+	template class TTriangle<float>;
+	template class TTriangle<double>;
+
+	template std::ostream& operator <<(std::ostream& out, const TTriangle<float>& triangle);
+
+	template std::ostream& operator <<(std::ostream& out, const TTriangle<double>& triangle);
+}
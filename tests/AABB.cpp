@@ -0,0 +1,202 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/AABB.hpp>
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	/**
+	 * Returns the bounding box of the eight corners of `box` transformed by
+	 * `A`.
+	 */
+	AABB transformCorners(const AABB& box, const Matrix4& A)
+	{
+		AABB result;
+		for (std::size_t i = 0; i < 8; ++i)
+		{
+			const Vector4 corner(
+				(i & 1) ? box.max.x : box.min.x,
+				(i & 2) ? box.max.y : box.min.y,
+				(i & 4) ? box.max.z : box.min.z,
+				1.0f);
+
+			const Vector4 p = A * corner;
+			result.merge(Vector3(p.x, p.y, p.z));
+		}
+
+		return result;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(AABB_Test_Suite)
+
+/**
+ * Test that the default constructor constructs an empty box, and that merging
+ * a point into it produces the box containing only that point.
+ */
+BOOST_AUTO_TEST_CASE(TestDefaultConstructor)
+{
+	AABB box;
+	BOOST_CHECK(box.isEmpty());
+
+	const Vector3 p(1.0f, -2.0f, 3.0f);
+	box.merge(p);
+
+	BOOST_CHECK(!box.isEmpty());
+	BOOST_CHECK_EQUAL(box.min, p);
+	BOOST_CHECK_EQUAL(box.max, p);
+}
+
+/**
+ * Test the center, extents, size, surface area and volume.
+ */
+BOOST_AUTO_TEST_CASE(TestMeasures)
+{
+	const AABB box(Vector3(-1.0f, 0.0f, 2.0f), Vector3(3.0f, 1.0f, 5.0f));
+
+	BOOST_CHECK_EQUAL(box.center(), Vector3(1.0f, 0.5f, 3.5f));
+	BOOST_CHECK_EQUAL(box.extents(), Vector3(2.0f, 0.5f, 1.5f));
+	BOOST_CHECK_EQUAL(box.size(), Vector3(4.0f, 1.0f, 3.0f));
+	BOOST_CHECK_CLOSE(box.surfaceArea(), 2.0f * (4.0f + 3.0f + 12.0f), 1e-5f);
+	BOOST_CHECK_CLOSE(box.volume(), 12.0f, 1e-5f);
+}
+
+/**
+ * Test containment of points and boxes, including on the boundary.
+ */
+BOOST_AUTO_TEST_CASE(TestContains)
+{
+	const AABB box(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 3.0f));
+
+	BOOST_CHECK(box.contains(Vector3(0.5f, 1.0f, 1.5f)));
+	BOOST_CHECK(box.contains(Vector3(1.0f, 2.0f, 3.0f)));
+	BOOST_CHECK(!box.contains(Vector3(1.5f, 1.0f, 1.5f)));
+	BOOST_CHECK(!box.contains(Vector3(0.5f, 1.0f, -0.1f)));
+
+	BOOST_CHECK(box.contains(AABB(Vector3(0.5f, 0.5f, 0.5f), Vector3(1.0f, 1.0f, 1.0f))));
+	BOOST_CHECK(!box.contains(AABB(Vector3(0.5f, 0.5f, 0.5f), Vector3(1.5f, 1.0f, 1.0f))));
+}
+
+/**
+ * Test the intersection tests and the intersection of boxes.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersection)
+{
+	const AABB a(Vector3(0.0f, 0.0f, 0.0f), Vector3(2.0f, 2.0f, 2.0f));
+	const AABB b(Vector3(1.0f, -1.0f, 1.5f), Vector3(3.0f, 1.0f, 4.0f));
+	const AABB touching(Vector3(2.0f, 0.0f, 0.0f), Vector3(3.0f, 1.0f, 1.0f));
+	const AABB disjoint(Vector3(0.0f, 2.5f, 0.0f), Vector3(1.0f, 3.0f, 1.0f));
+
+	BOOST_CHECK(a.intersects(b));
+	BOOST_CHECK(b.intersects(a));
+	BOOST_CHECK(a.intersects(touching));
+	BOOST_CHECK(!a.intersects(disjoint));
+	BOOST_CHECK(!disjoint.intersects(a));
+
+	BOOST_CHECK_EQUAL(intersection(a, b), AABB(Vector3(1.0f, 0.0f, 1.5f), Vector3(2.0f, 1.0f, 2.0f)));
+	BOOST_CHECK(intersection(a, disjoint).isEmpty());
+}
+
+/**
+ * Test that merging boxes produces the smallest box containing both.
+ */
+BOOST_AUTO_TEST_CASE(TestMerge)
+{
+	const AABB a(Vector3(0.0f, 0.0f, 0.0f), Vector3(2.0f, 2.0f, 2.0f));
+	const AABB b(Vector3(1.0f, -1.0f, 1.5f), Vector3(3.0f, 1.0f, 4.0f));
+	const AABB expected(Vector3(0.0f, -1.0f, 0.0f), Vector3(3.0f, 2.0f, 4.0f));
+
+	BOOST_CHECK_EQUAL(merge(a, b), expected);
+	BOOST_CHECK_EQUAL(merge(b, a), expected);
+	BOOST_CHECK_EQUAL(merge(a, AABB()), a);
+
+	AABB c;
+	c.merge(a);
+	c.merge(b);
+	BOOST_CHECK_EQUAL(c, expected);
+}
+
+/**
+ * Test that the transformed box matches the bounds of the transformed
+ * corners, which Arvo's method computes exactly.
+ */
+BOOST_AUTO_TEST_CASE(TestTransformed)
+{
+	const AABB box(Vector3(-1.0f, 0.5f, 2.0f), Vector3(3.0f, 1.0f, 5.0f));
+	const Quaternion q = Quaternion::euler(Vector3(0.3f, -1.2f, 2.1f));
+	const Affine3 A(q, Vector3(1.0f, 2.0f, -3.0f), 1.5f);
+	const Matrix4 M = Matrix4(A) * Matrix4::scaling(Vector3(1.0f, -2.0f, 0.5f));
+
+	checkClose(box.transformed(M), transformCorners(box, M), 1e-5f);
+	checkClose(box.transformed(A), transformCorners(box, Matrix4(A)), 1e-5f);
+	checkClose(box.transformed(Matrix4::IDENTITY), box, 0.0f);
+}
+
+/**
+ * Test that the batch construction from arrays of points matches merging the
+ * points one at a time, for counts that exercise the vectorised loops and
+ * the remainders.
+ */
+BOOST_AUTO_TEST_CASE(TestFromPoints)
+{
+	const std::size_t count = 37;
+
+	Vector3 points[count];
+	float xs[count], ys[count], zs[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float f = static_cast<float>(i);
+		points[i] = Vector3(std::sin(1.3f * f) * f, std::cos(0.7f * f) * f, 5.0f - 0.5f * f);
+		xs[i] = points[i].x;
+		ys[i] = points[i].y;
+		zs[i] = points[i].z;
+	}
+
+	for (std::size_t n = 0; n <= count; ++n)
+	{
+		AABB expected;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			expected.merge(points[i]);
+		}
+
+		const AABB fromPacked = AABB::fromPoints(points, n);
+		const AABB fromArrays = AABB::fromPoints(xs, ys, zs, n);
+
+		if (n == 0)
+		{
+			BOOST_CHECK(fromPacked.isEmpty());
+			BOOST_CHECK(fromArrays.isEmpty());
+		}
+		else
+		{
+			checkClose(fromPacked, expected, 0.0f);
+			checkClose(fromArrays, expected, 0.0f);
+		}
+	}
+}
+
+/**
+ * Test the double precision transformation.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	const AABBd box(Vector3d(-1.0, 0.5, 2.0), Vector3d(3.0, 1.0, 5.0));
+	const Matrix4d M(Affine3d(Affine3(Quaternion::euler(Vector3(0.3f, -1.2f, 2.1f)), Vector3(1.0f, 2.0f, -3.0f))));
+	const AABBd result = box.transformed(M);
+
+	checkClose(AABB(result), transformCorners(AABB(box), Matrix4(M)), 1e-5f);
+	BOOST_CHECK_EQUAL(box.transformed(Matrix4d::IDENTITY), box);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
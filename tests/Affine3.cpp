@@ -0,0 +1,246 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+using namespace M3D;
+using namespace M3D::test;
+
+BOOST_AUTO_TEST_SUITE(Affine3_Test_Suite)
+
+/**
+ * Test that the default constructor constructs the identity transformation.
+ */
+BOOST_AUTO_TEST_CASE(TestDefaultConstructor)
+{
+	const Affine3 A;
+
+	BOOST_CHECK_EQUAL(A.linearPart(), Matrix3::IDENTITY);
+	BOOST_CHECK_EQUAL(A.translationPart(), Vector3::ZERO);
+	BOOST_CHECK_EQUAL(A, Affine3::IDENTITY);
+}
+
+/**
+ * Test that the entry constructor sets all entries to those that were
+ * specified.
+ */
+BOOST_AUTO_TEST_CASE(TestEntryConstructor)
+{
+	const Affine3 A(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		5.0f, 6.0f, 7.0f, 8.0f,
+		9.0f, 10.0f, 11.0f, 12.0f
+	);
+
+	for (std::size_t i = 0; i < 12; ++i)
+	{
+		BOOST_CHECK_EQUAL(A[i], static_cast<float>(i + 1));
+	}
+}
+
+/**
+ * Test that the constructor taking the linear and translation parts places
+ * them in the correct entries.
+ */
+BOOST_AUTO_TEST_CASE(TestLinearTranslationConstructor)
+{
+	const Matrix3 L(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f);
+	const Vector3 t(-1.0f, -2.0f, -3.0f);
+	const Affine3 A(L, t);
+
+	BOOST_CHECK_EQUAL(A.linearPart(), L);
+	BOOST_CHECK_EQUAL(A.translationPart(), t);
+	BOOST_CHECK_EQUAL(A[3], -1.0f);
+	BOOST_CHECK_EQUAL(A[7], -2.0f);
+	BOOST_CHECK_EQUAL(A[11], -3.0f);
+}
+
+/**
+ * Test the conversions to and from Matrix4.
+ */
+BOOST_AUTO_TEST_CASE(TestMatrix4Conversion)
+{
+	const Affine3 A = randomAffine(7);
+	const Matrix4 M(A);
+
+	checkClose(A, M, 0.0f);
+	BOOST_CHECK_EQUAL(M[12], 0.0f);
+	BOOST_CHECK_EQUAL(M[13], 0.0f);
+	BOOST_CHECK_EQUAL(M[14], 0.0f);
+	BOOST_CHECK_EQUAL(M[15], 1.0f);
+	BOOST_CHECK_EQUAL(Affine3(M), A);
+}
+
+/**
+ * Test that the quaternion constructor rotates points in the same way as the
+ * quaternion before translating them.
+ */
+BOOST_AUTO_TEST_CASE(TestQuaternionConstructor)
+{
+	const Quaternion q = Quaternion::euler(Vector3(0.3f, -1.2f, 2.1f));
+	const Vector3 t(1.0f, 2.0f, -3.0f);
+	const Vector3 p(0.5f, -4.0f, 2.5f);
+
+	const Affine3 A(q, t);
+
+	checkClose(A.transformPoint(p), q * p + t, 1e-5f);
+	checkClose(A, Matrix4::translation(t) * Matrix4(q), 1e-6f);
+}
+
+/**
+ * Test that the scaled quaternion constructor scales points before rotating
+ * and translating them.
+ */
+BOOST_AUTO_TEST_CASE(TestScaledQuaternionConstructor)
+{
+	const Quaternion q = Quaternion::euler(Vector3(-0.7f, 0.4f, 1.9f));
+	const Vector3 t(-2.0f, 0.5f, 4.0f);
+	const Vector3 p(1.5f, 3.0f, -0.5f);
+
+	const Affine3 A(q, t, 2.5f);
+
+	checkClose(A.transformPoint(p), q * (2.5f * p) + t, 1e-5f);
+}
+
+/**
+ * Test that the rotation can be recovered from scaled rotations. The angles
+ * are chosen so that every branch of the extraction is exercised.
+ */
+BOOST_AUTO_TEST_CASE(TestRotationPart)
+{
+	const Vector3 angles[] = {
+		Vector3(0.1f, 0.2f, 0.3f),
+		Vector3(3.0f, 0.1f, 0.2f),
+		Vector3(0.1f, 3.0f, 0.2f),
+		Vector3(0.1f, 0.2f, 3.0f),
+		Vector3(-1.3f, 2.2f, -0.4f)
+	};
+
+	for (const Vector3& angle : angles)
+	{
+		const Quaternion q = Quaternion::euler(angle);
+		const Quaternion r = Affine3(q, Vector3(1.0f, 2.0f, 3.0f), 3.0f).rotationPart();
+
+		// The quaternions q and -q represent the same rotation.
+		const float sign = (q.w * r.w + q.x * r.x + q.y * r.y + q.z * r.z) < 0.0f ? -1.0f : 1.0f;
+		BOOST_CHECK_SMALL(sign * r.w - q.w, 1e-5f);
+		BOOST_CHECK_SMALL(sign * r.x - q.x, 1e-5f);
+		BOOST_CHECK_SMALL(sign * r.y - q.y, 1e-5f);
+		BOOST_CHECK_SMALL(sign * r.z - q.z, 1e-5f);
+	}
+}
+
+/**
+ * Test that composition matches the product of the equivalent 4x4 matrices.
+ */
+BOOST_AUTO_TEST_CASE(TestComposition)
+{
+	for (unsigned int seed = 1; seed <= 16; ++seed)
+	{
+		const Affine3 A = randomAffine(seed);
+		const Affine3 B = randomAffine(seed + 100);
+
+		checkClose(A * B, Matrix4(A) * Matrix4(B), 1e-4f);
+	}
+}
+
+/**
+ * Test that transforming points and vectors matches multiplication by the
+ * equivalent 4x4 matrix.
+ */
+BOOST_AUTO_TEST_CASE(TestTransform)
+{
+	const Affine3 A = randomAffine(3);
+	const Matrix4 M(A);
+	const Vector3 v(1.5f, -2.0f, 0.75f);
+
+	const Vector4 p = M * Vector4(v.x, v.y, v.z, 1.0f);
+	const Vector4 d = M * Vector4(v.x, v.y, v.z, 0.0f);
+
+	checkClose(A.transformPoint(v), Vector3(p.x, p.y, p.z), 1e-5f);
+	checkClose(A.transformVector(v), Vector3(d.x, d.y, d.z), 1e-5f);
+}
+
+/**
+ * Test that the determinant matches that of the equivalent 4x4 matrix.
+ */
+BOOST_AUTO_TEST_CASE(TestDeterminant)
+{
+	const Affine3 A = randomAffine(11);
+
+	BOOST_CHECK_CLOSE(A.determinant(), Matrix4(A).determinant(), 1e-4f);
+}
+
+/**
+ * Test that the product of a transformation and its inverse is the identity.
+ */
+BOOST_AUTO_TEST_CASE(TestInverse)
+{
+	for (unsigned int seed = 1; seed <= 16; ++seed)
+	{
+		const Affine3 A = randomAffine(seed);
+
+		checkClose(A * A.inverse(), Matrix4::IDENTITY, 1e-5f);
+		checkClose(A.inverse() * A, Matrix4::IDENTITY, 1e-5f);
+		checkClose(A.inverse(), Matrix4(A).inverse(), 1e-5f);
+	}
+}
+
+/**
+ * Test that the rigid inverse matches the general inverse for rigid
+ * transformations.
+ */
+BOOST_AUTO_TEST_CASE(TestRigidInverse)
+{
+	const Quaternion q = Quaternion::euler(Vector3(0.9f, -0.3f, 2.4f));
+	const Affine3 A(q, Vector3(4.0f, -1.0f, 2.5f));
+
+	checkClose(A.rigidInverse(), Matrix4(A.inverse()), 1e-5f);
+	checkClose(A * A.rigidInverse(), Matrix4::IDENTITY, 1e-5f);
+}
+
+/**
+ * Test that the uniform scale inverse matches the general inverse for
+ * uniformly scaled rigid transformations.
+ */
+BOOST_AUTO_TEST_CASE(TestUniformScaleInverse)
+{
+	const Quaternion q = Quaternion::euler(Vector3(-1.1f, 0.6f, 0.2f));
+	const Affine3 A(q, Vector3(-3.0f, 2.0f, 0.5f), 0.25f);
+
+	checkClose(A.uniformScaleInverse(), Matrix4(A.inverse()), 1e-4f);
+	checkClose(A * A.uniformScaleInverse(), Matrix4::IDENTITY, 1e-5f);
+}
+
+/**
+ * Test the scaling and translation factory functions.
+ */
+BOOST_AUTO_TEST_CASE(TestScalingTranslation)
+{
+	const Vector3 v(1.0f, -2.0f, 3.0f);
+
+	BOOST_CHECK_EQUAL(Matrix4(Affine3::scaling(v)), Matrix4::scaling(v));
+	BOOST_CHECK_EQUAL(Matrix4(Affine3::scaling(2.0f)), Matrix4::scaling(2.0f));
+	BOOST_CHECK_EQUAL(Matrix4(Affine3::translation(v)), Matrix4::translation(v));
+}
+
+/**
+ * Test that the double precision inverse is accurate.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	for (unsigned int seed = 1; seed <= 8; ++seed)
+	{
+		const Affine3d A(randomAffine(seed));
+
+		checkClose(A * A.inverse(), Matrix4d::IDENTITY, 1e-12);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
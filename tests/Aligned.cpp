@@ -0,0 +1,154 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/Aligned.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::test;
+
+BOOST_AUTO_TEST_SUITE(Aligned_Test_Suite)
+
+/**
+ * Test the alignment and size of the aligned types.
+ */
+BOOST_AUTO_TEST_CASE(TestLayout)
+{
+	BOOST_CHECK_EQUAL(alignof(Vector4A), 16u);
+	BOOST_CHECK_EQUAL(sizeof(Vector4A), sizeof(Vector4));
+	BOOST_CHECK_EQUAL(alignof(QuaternionA), 16u);
+	BOOST_CHECK_EQUAL(sizeof(QuaternionA), sizeof(Quaternion));
+	BOOST_CHECK_EQUAL(alignof(DualQuaternionA), 32u);
+	BOOST_CHECK_EQUAL(sizeof(DualQuaternionA), sizeof(DualQuaternion));
+	BOOST_CHECK_EQUAL(alignof(Matrix4A), 32u);
+	BOOST_CHECK_EQUAL(sizeof(Matrix4A), sizeof(Matrix4));
+	BOOST_CHECK_EQUAL(alignof(Matrix4dA), 32u);
+	BOOST_CHECK_EQUAL(sizeof(Vector4dA), sizeof(Vector4d));
+
+	// Types whose size is not a multiple of the alignment are padded.
+	BOOST_CHECK_EQUAL((sizeof(Aligned<Vector3, 16>)), 16u);
+}
+
+/**
+ * Test that the aligned types construct and operate as the types they
+ * derive from, and that the results of those operations can be assigned to
+ * them.
+ */
+BOOST_AUTO_TEST_CASE(TestOperations)
+{
+	const Matrix4A identity;
+	BOOST_CHECK(identity == Matrix4());
+
+	const Matrix4A A = Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f));
+	const Vector4A v(1.0f, 1.0f, 1.0f, 1.0f);
+	const Vector4A w = A * v;
+	BOOST_CHECK(w == Vector4(2.0f, 3.0f, 4.0f, 1.0f));
+
+	Matrix4A B = A * A;
+	B = B * A;
+	BOOST_CHECK(B == Matrix4::translation(Vector3(3.0f, 6.0f, 9.0f)));
+
+	const QuaternionA q(1.0f, 0.0f, 0.0f, 0.0f);
+	BOOST_CHECK(q * Vector3(1.0f, 2.0f, 3.0f) == Vector3(1.0f, 2.0f, 3.0f));
+}
+
+/**
+ * Test that aligned variants on the stack and in aligned arrays have the
+ * requested alignment.
+ */
+BOOST_AUTO_TEST_CASE(TestAlignment)
+{
+	const Matrix4A A;
+	const Vector4A v;
+	BOOST_CHECK(isAligned(&A, 32));
+	BOOST_CHECK(isAligned(&v, 16));
+
+	AlignedVector<Matrix4A> matrices(33);
+	for (std::size_t i = 0; i < matrices.size(); ++i)
+	{
+		BOOST_CHECK(isAligned(&matrices[i], 32));
+	}
+
+	Arena arena(64);
+	arena.allocate(1, 1);
+	AlignedVector<Vector4> vectors(10, Vector4(), AlignedAllocator<Vector4>(&arena));
+	BOOST_CHECK(isAligned(vectors.data(), SIMD_ALIGNMENT));
+}
+
+/**
+ * Test that the operations on aligned arrays resize the output and match
+ * the batch operations on plain arrays.
+ */
+BOOST_AUTO_TEST_CASE(TestArrayOperations)
+{
+	const Matrix4 A = Matrix4::translation(Vector3(1.0f, -2.0f, 3.0f)) * Matrix4::euler(Vector3(0.3f, 0.2f, 0.1f));
+	const Quaternion q = Quaternion::euler(Vector3(0.1f, -0.7f, 0.4f));
+
+	Arena arena;
+	const AlignedAllocator<Vector4> allocator4(&arena);
+	const AlignedAllocator<Vector3> allocator3(&arena);
+	AlignedVector<Vector4> vectors(allocator4);
+	AlignedVector<Vector3> points(allocator3);
+	AlignedVector<Quaternion> rotations;
+	for (std::size_t i = 0; i < 37; ++i)
+	{
+		const float f = static_cast<float>(i);
+		vectors.push_back(Vector4(f, -f, 0.5f * f, 1.0f));
+		points.push_back(Vector3(f, 2.0f * f, -f));
+		rotations.push_back(Quaternion::euler(Vector3(0.1f * f, 0.2f, -0.05f * f)));
+	}
+
+	AlignedVector<Vector4> transformed(allocator4);
+	transform(A, vectors, transformed);
+	BOOST_CHECK_EQUAL(transformed.size(), vectors.size());
+
+	AlignedVector<Vector3> moved(allocator3);
+	transformPoints(A, points, moved);
+	AlignedVector<Vector3> turned(allocator3);
+	transformDirections(A, points, turned);
+	AlignedVector<Vector3> rotated(allocator3);
+	rotate(q, points, rotated);
+
+	AlignedVector<Vector3> rotatedEach;
+	AlignedVector<Vector3> heapPoints(points.begin(), points.end());
+	rotate(rotations, heapPoints, rotatedEach);
+
+	std::vector<Vector4> expected4(vectors.size());
+	std::vector<Vector3> expected3(points.size());
+	transform(A, vectors.data(), expected4.data(), vectors.size());
+	for (std::size_t i = 0; i < vectors.size(); ++i)
+	{
+		BOOST_CHECK(transformed[i] == expected4[i]);
+	}
+
+	transformPoints(A, points.data(), expected3.data(), points.size());
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		BOOST_CHECK(moved[i] == expected3[i]);
+	}
+
+	transformDirections(A, points.data(), expected3.data(), points.size());
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		BOOST_CHECK(turned[i] == expected3[i]);
+	}
+
+	rotate(q, points.data(), expected3.data(), points.size());
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		BOOST_CHECK(rotated[i] == expected3[i]);
+	}
+
+	rotate(rotations.data(), points.data(), expected3.data(), points.size());
+	for (std::size_t i = 0; i < points.size(); ++i)
+	{
+		BOOST_CHECK(rotatedEach[i] == expected3[i]);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
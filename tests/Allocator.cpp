@@ -0,0 +1,181 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/Allocator.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <set>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::test;
+
+BOOST_AUTO_TEST_SUITE(Allocator_Test_Suite)
+
+/**
+ * Test that aligned heap allocations have the requested alignment and can
+ * be written in full.
+ */
+BOOST_AUTO_TEST_CASE(TestAlignedAllocate)
+{
+	for (std::size_t alignment = 1; alignment <= 4096; alignment *= 2)
+	{
+		void* memory = alignedAllocate(100, alignment);
+		BOOST_CHECK(isAligned(memory, alignment));
+		std::memset(memory, 0xAB, 100);
+		alignedFree(memory);
+	}
+
+	alignedFree(nullptr);
+}
+
+/**
+ * Test that the arena returns aligned, non-overlapping allocations and
+ * tracks the bytes in use.
+ */
+BOOST_AUTO_TEST_CASE(TestArenaAllocate)
+{
+	Arena arena(1024);
+	BOOST_CHECK_EQUAL(arena.capacity(), 1024u);
+	BOOST_CHECK_EQUAL(arena.size(), 0u);
+
+	char* a = static_cast<char*>(arena.allocate(10, 16));
+	char* b = static_cast<char*>(arena.allocate(40, 32));
+	float* c = arena.allocate<float>(5);
+	BOOST_CHECK(isAligned(a, 16));
+	BOOST_CHECK(isAligned(b, 32));
+	BOOST_CHECK(isAligned(c, SIMD_ALIGNMENT));
+	BOOST_CHECK(b >= a + 10);
+	BOOST_CHECK(reinterpret_cast<char*>(c) >= b + 40);
+	BOOST_CHECK(arena.size() >= 10u + 40u + 5u * sizeof(float));
+	BOOST_CHECK(arena.size() <= 1024u);
+}
+
+/**
+ * Test that the arena grows when a block is exhausted, and that a reset
+ * merges the blocks so that the same allocations then fit in one block and
+ * reuse its memory.
+ */
+BOOST_AUTO_TEST_CASE(TestArenaGrowAndReset)
+{
+	Arena arena(256);
+	std::vector<void*> first;
+	for (std::size_t i = 0; i < 20; ++i)
+	{
+		void* p = arena.allocate(100);
+		std::memset(p, static_cast<int>(i), 100);
+		first.push_back(p);
+	}
+
+	BOOST_CHECK(arena.capacity() >= 2000u);
+	BOOST_CHECK(arena.size() >= 2000u);
+	for (std::size_t i = 0; i < first.size(); ++i)
+	{
+		BOOST_CHECK_EQUAL(static_cast<unsigned char*>(first[i])[99], i);
+	}
+
+	arena.reset();
+	BOOST_CHECK_EQUAL(arena.size(), 0u);
+	const std::size_t capacity = arena.capacity();
+
+	char* start = static_cast<char*>(arena.allocate(100));
+	for (std::size_t i = 1; i < 20; ++i)
+	{
+		char* p = static_cast<char*>(arena.allocate(100));
+		BOOST_CHECK(p > start && p < start + capacity);
+	}
+
+	BOOST_CHECK_EQUAL(arena.capacity(), capacity);
+
+	// After the reset the allocations start again from the same block.
+	arena.reset();
+	BOOST_CHECK_EQUAL(arena.allocate(100), static_cast<void*>(start));
+}
+
+/**
+ * Test that an arena with no initial capacity allocates its first block on
+ * demand, including for allocations larger than the default block.
+ */
+BOOST_AUTO_TEST_CASE(TestArenaEmpty)
+{
+	Arena arena(0);
+	BOOST_CHECK_EQUAL(arena.capacity(), 0u);
+
+	double* values = arena.allocate<double>(1000);
+	BOOST_CHECK(isAligned(values, SIMD_ALIGNMENT));
+	for (std::size_t i = 0; i < 1000; ++i)
+	{
+		values[i] = static_cast<double>(i);
+	}
+
+	BOOST_CHECK_EQUAL(values[999], 999.0);
+	BOOST_CHECK(arena.capacity() >= 8000u);
+}
+
+/**
+ * Test that the pool returns distinct aligned blocks across several chunks,
+ * and reuses released blocks.
+ */
+BOOST_AUTO_TEST_CASE(TestAlignedPool)
+{
+	AlignedPool pool(64, 32, 4);
+	BOOST_CHECK_EQUAL(pool.blockSize(), 64u);
+
+	std::set<void*> blocks;
+	for (std::size_t i = 0; i < 10; ++i)
+	{
+		void* block = pool.allocate();
+		BOOST_CHECK(isAligned(block, 32));
+		std::memset(block, 0xCD, 64);
+		blocks.insert(block);
+	}
+
+	BOOST_CHECK_EQUAL(blocks.size(), 10u);
+
+	void* released = *blocks.begin();
+	pool.deallocate(released);
+	BOOST_CHECK_EQUAL(pool.allocate(), released);
+	pool.deallocate(nullptr);
+}
+
+/**
+ * Test that blocks smaller than a pointer are supported.
+ */
+BOOST_AUTO_TEST_CASE(TestAlignedPoolSmallBlocks)
+{
+	AlignedPool pool(1, 1);
+	void* a = pool.allocate();
+	void* b = pool.allocate();
+	BOOST_CHECK(a != b);
+	pool.deallocate(a);
+	pool.deallocate(b);
+	BOOST_CHECK_EQUAL(pool.allocate(), b);
+	BOOST_CHECK_EQUAL(pool.allocate(), a);
+}
+
+/**
+ * Test that the allocator aligns standard containers, from the heap and
+ * from an arena.
+ */
+BOOST_AUTO_TEST_CASE(TestAlignedAllocator)
+{
+	std::vector<float, AlignedAllocator<float, 64> > heap;
+	for (std::size_t i = 0; i < 1000; ++i)
+	{
+		heap.push_back(static_cast<float>(i));
+		BOOST_CHECK(isAligned(heap.data(), 64));
+	}
+
+	Arena arena;
+	AlignedAllocator<float> allocator(&arena);
+	std::vector<float, AlignedAllocator<float> > scratch(100, 1.0f, allocator);
+	BOOST_CHECK(isAligned(scratch.data(), SIMD_ALIGNMENT));
+	BOOST_CHECK(arena.size() >= 100u * sizeof(float));
+	BOOST_CHECK(scratch.get_allocator().arena() == &arena);
+
+	const AlignedAllocator<double> rebound(allocator);
+	BOOST_CHECK(rebound == allocator);
+	BOOST_CHECK(AlignedAllocator<float>() != allocator);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,213 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/AnimationClip.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	const std::size_t trackCount = 37;
+
+	// Not one more than a multiple of the segment length, so that the last
+	// segment is shorter than the others.
+	const std::size_t frameCount = 90;
+
+	const float frameRate = 30.0f;
+
+	/**
+	 * Uniformly sampled source tracks. Track 0 is constant and track 1 moves
+	 * linearly, while the others follow smooth curves.
+	 */
+	struct Source
+	{
+		Source()
+		: translations(trackCount * frameCount)
+		, rotations(trackCount * frameCount)
+		, scales(trackCount * frameCount)
+		{
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				for (std::size_t track = 0; track < trackCount; ++track)
+				{
+					const std::size_t i = frame * trackCount + track;
+					const float t = static_cast<float>(frame) / frameRate;
+					const float k = static_cast<float>(track);
+
+					if (track == 0)
+					{
+						translations[i] = Vector3(1.0f, 2.0f, 3.0f);
+						rotations[i] = Quaternion::angleAxis(0.5f, Vector3(0.0f, 1.0f, 0.0f));
+						scales[i] = Vector3(1.0f, 1.0f, 1.0f);
+					}
+					else if (track == 1)
+					{
+						translations[i] = Vector3(t, -2.0f * t, 0.5f);
+						rotations[i] = Quaternion();
+						scales[i] = Vector3(1.0f + t, 1.0f, 1.0f);
+					}
+					else
+					{
+						translations[i] = Vector3(std::sin(t * 3.0f + k), std::cos(t * 2.0f + k) * 5.0f, t * k * 0.1f);
+						rotations[i] = Quaternion::euler(Vector3(std::sin(t + k), 2.0f * t + k, std::cos(1.5f * t)));
+						scales[i] = Vector3(1.0f + 0.1f * std::sin(t * 4.0f + k), 1.0f, 2.0f);
+					}
+				}
+			}
+		}
+
+		std::vector<Vector3> translations;
+		std::vector<Quaternion> rotations;
+		std::vector<Vector3> scales;
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(AnimationClip_Test_Suite)
+
+/**
+ * Test that a default constructed clip is empty.
+ */
+BOOST_AUTO_TEST_CASE(TestEmpty)
+{
+	const AnimationClip clip;
+	BOOST_CHECK_EQUAL(clip.trackCount(), 0u);
+	BOOST_CHECK_EQUAL(clip.frameCount(), 0u);
+	BOOST_CHECK_EQUAL(clip.duration(), 0.0f);
+
+	AnimationPose pose(3);
+	clip.sample(0.0f, pose);
+	BOOST_CHECK_EQUAL(pose.size(), 0u);
+}
+
+/**
+ * Test the properties of a clip.
+ */
+BOOST_AUTO_TEST_CASE(TestProperties)
+{
+	const Source source;
+	const AnimationClip clip(source.translations.data(), source.rotations.data(), source.scales.data(),
+		trackCount, frameCount, frameRate);
+
+	BOOST_CHECK_EQUAL(clip.trackCount(), trackCount);
+	BOOST_CHECK_EQUAL(clip.frameCount(), frameCount);
+	BOOST_CHECK_EQUAL(clip.frameRate(), frameRate);
+	BOOST_CHECK_CLOSE(clip.duration(), 89.0f / 30.0f, 1e-4f);
+
+	// Quantization alone stores 18 bytes a key in place of 40, and a looser
+	// tolerance lets the smooth tracks drop keys too.
+	const std::size_t sourceSize = trackCount * frameCount * (2 * sizeof(Vector3) + sizeof(Quaternion));
+	BOOST_CHECK_LT(clip.size(), sourceSize * 6 / 10);
+
+	const float tolerance = 1e-3f;
+	const AnimationClip loose(source.translations.data(), source.rotations.data(), source.scales.data(),
+		trackCount, frameCount, frameRate, tolerance, tolerance, tolerance);
+	BOOST_CHECK_LT(loose.size(), sourceSize * 4 / 10);
+}
+
+/**
+ * Test that sampling at the frames reproduces the source to within the
+ * documented error bounds.
+ */
+BOOST_AUTO_TEST_CASE(TestSampleFrames)
+{
+	const Source source;
+	const float tolerance = 1e-3f;
+	const AnimationClip clip(source.translations.data(), source.rotations.data(), source.scales.data(),
+		trackCount, frameCount, frameRate, tolerance, tolerance, tolerance);
+
+	AnimationPose pose;
+	for (std::size_t frame = 0; frame < frameCount; ++frame)
+	{
+		clip.sample(static_cast<float>(frame) / frameRate, pose);
+		BOOST_REQUIRE_EQUAL(pose.size(), trackCount);
+
+		for (std::size_t track = 0; track < trackCount; ++track)
+		{
+			const std::size_t i = frame * trackCount + track;
+
+			// The range of the translations is at most 10 and of the scales
+			// at most 3, over 65535 steps.
+			BOOST_CHECK_LE(difference(pose.translation(track), source.translations[i]), tolerance + 1e-4f);
+			BOOST_CHECK_LE(difference(pose.rotation(track), source.rotations[i]), tolerance + 6e-5f);
+			BOOST_CHECK_LE(difference(pose.scale(track), source.scales[i]), tolerance + 3e-5f);
+		}
+	}
+}
+
+/**
+ * Test that constant and linear tracks are reproduced between frames, and
+ * that times outside the clip are clamped.
+ */
+BOOST_AUTO_TEST_CASE(TestSampleBetweenFrames)
+{
+	const Source source;
+	const AnimationClip clip(source.translations.data(), source.rotations.data(), source.scales.data(),
+		trackCount, frameCount, frameRate);
+
+	AnimationPose pose;
+	clip.sample(1.2345f, pose);
+	BOOST_CHECK_SMALL(difference(pose.translation(0), Vector3(1.0f, 2.0f, 3.0f)), 1e-5f);
+	BOOST_CHECK_SMALL(difference(pose.rotation(0), Quaternion::angleAxis(0.5f, Vector3(0.0f, 1.0f, 0.0f))), 1e-4f);
+	BOOST_CHECK_SMALL(difference(pose.translation(1), Vector3(1.2345f, -2.469f, 0.5f)), 1e-4f);
+	BOOST_CHECK_SMALL(difference(pose.scale(1), Vector3(2.2345f, 1.0f, 1.0f)), 1e-4f);
+
+	clip.sample(-1.0f, pose);
+	BOOST_CHECK_SMALL(difference(pose.translation(1), Vector3(0.0f, 0.0f, 0.5f)), 1e-4f);
+
+	clip.sample(100.0f, pose);
+	const float end = clip.duration();
+	BOOST_CHECK_SMALL(difference(pose.translation(1), Vector3(end, -2.0f * end, 0.5f)), 1e-4f);
+}
+
+/**
+ * Test that sampling a time range gives the same poses as sampling each
+ * time separately.
+ */
+BOOST_AUTO_TEST_CASE(TestSampleRange)
+{
+	const Source source;
+	const AnimationClip clip(source.translations.data(), source.rotations.data(), source.scales.data(),
+		trackCount, frameCount, frameRate);
+
+	const std::size_t count = 7;
+	std::vector<AnimationPose> poses(count);
+	clip.sample(0.5f, 1.1f, poses.data(), count);
+
+	AnimationPose pose;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		clip.sample(0.5f + 0.1f * static_cast<float>(i), pose);
+		for (std::size_t track = 0; track < trackCount; ++track)
+		{
+			BOOST_CHECK_SMALL(difference(poses[i].translation(track), pose.translation(track)), 1e-5f);
+			BOOST_CHECK_SMALL(difference(poses[i].rotation(track), pose.rotation(track)), 1e-5f);
+			BOOST_CHECK_SMALL(difference(poses[i].scale(track), pose.scale(track)), 1e-5f);
+		}
+	}
+}
+
+/**
+ * Test a clip of a single frame.
+ */
+BOOST_AUTO_TEST_CASE(TestSingleFrame)
+{
+	const Vector3 translation(1.0f, -2.0f, 3.0f);
+	const Quaternion rotation = Quaternion::angleAxis(1.0f, Vector3(1.0f, 0.0f, 0.0f));
+	const Vector3 scale(2.0f, 2.0f, 2.0f);
+	const AnimationClip clip(&translation, &rotation, &scale, 1, 1, frameRate);
+
+	BOOST_CHECK_EQUAL(clip.duration(), 0.0f);
+
+	AnimationPose pose;
+	clip.sample(0.5f, pose);
+	BOOST_CHECK(pose.translation(0) == translation);
+	BOOST_CHECK_SMALL(difference(pose.rotation(0), rotation), 1e-4f);
+	BOOST_CHECK(pose.scale(0) == scale);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,334 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/BVH.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Ray.hpp>
+#include <M3D/Triangle.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	/**
+	 * Returns `count` small triangles scattered through the box [-10, 10]^3.
+	 */
+	std::vector<Triangle> triangles(std::size_t count)
+	{
+		std::vector<Triangle> result(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const Vector3 a = point(i, 0.0f, 10.0f);
+			result[i] = Triangle(a, a + point(i, 1.0f, 10.0f) * 0.1f, a + point(i, 2.0f, 10.0f) * 0.1f);
+		}
+
+		return result;
+	}
+
+	/**
+	 * Returns the bounds of each of `triangles`.
+	 */
+	std::vector<AABB> bounds(const std::vector<Triangle>& triangles)
+	{
+		std::vector<AABB> result(triangles.size());
+		for (std::size_t i = 0; i < triangles.size(); ++i)
+		{
+			result[i] = triangles[i].bounds();
+		}
+
+		return result;
+	}
+
+	/**
+	 * Checks that each primitive is referred to by exactly one leaf, that the
+	 * children of each node follow it, and that the bounds of each node
+	 * contain the bounds beneath it.
+	 */
+	void checkStructure(const BVH& bvh, const std::vector<AABB>& boxes)
+	{
+		const std::vector<BVH::Node>& nodes = bvh.nodes();
+		const std::vector<std::uint32_t>& indices = bvh.primitiveIndices();
+		BOOST_REQUIRE_EQUAL(indices.size(), boxes.size());
+
+		std::vector<std::size_t> references(boxes.size(), 0);
+		std::size_t leafPrimitives = 0;
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			const BVH::Node& node = nodes[i];
+			if (node.isLeaf())
+			{
+				for (std::uint32_t j = node.offset; j < node.offset + node.count; ++j)
+				{
+					++references[indices[j]];
+					BOOST_CHECK(node.bounds.contains(boxes[indices[j]]));
+				}
+
+				leafPrimitives += node.count;
+			}
+			else
+			{
+				BOOST_REQUIRE(node.offset > i && node.offset + 1 < nodes.size());
+				BOOST_CHECK(node.bounds.contains(nodes[node.offset].bounds));
+				BOOST_CHECK(node.bounds.contains(nodes[node.offset + 1].bounds));
+			}
+		}
+
+		BOOST_CHECK_EQUAL(leafPrimitives, boxes.size());
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			BOOST_CHECK_EQUAL(references[i], 1u);
+		}
+	}
+
+	/**
+	 * Checks that the closest intersections found through the hierarchy
+	 * match those found by testing every triangle.
+	 *
+	 * Half of the rays are aimed at the centroid of a triangle, so that they
+	 * hit, and the rest at arbitrary points. None are aimed at edges, where
+	 * the decision depends on rounding.
+	 */
+	void checkRays(const BVH& bvh, const std::vector<Triangle>& triangles)
+	{
+		std::size_t hits = 0;
+		for (std::size_t i = 0; i < 200; ++i)
+		{
+			const Triangle& target = triangles[(37 * i) % triangles.size()];
+			const Vector3 origin = point(i, 3.0f, 10.0f) * 1.5f;
+			const Vector3 end = i % 2 == 0 ? (target.a + target.b + target.c) / 3.0f : point(i, 4.5f, 10.0f);
+			const Ray ray(origin, end - origin);
+
+			float expected = std::numeric_limits<float>::infinity();
+			for (std::size_t j = 0; j < triangles.size(); ++j)
+			{
+				float t;
+				if (ray.intersects(triangles[j], t) && t < expected)
+				{
+					expected = t;
+				}
+			}
+
+			float distance = -1.0f;
+			std::size_t primitive = triangles.size();
+			const bool hit = bvh.intersectTriangles(ray, triangles.data(), distance, primitive);
+			BOOST_CHECK_EQUAL(hit, expected < std::numeric_limits<float>::infinity());
+			if (hit)
+			{
+				BOOST_CHECK_CLOSE(distance, expected, 1e-4f);
+				BOOST_REQUIRE(primitive < triangles.size());
+
+				float t;
+				BOOST_CHECK(ray.intersects(triangles[primitive], t));
+				BOOST_CHECK_CLOSE(t, expected, 1e-4f);
+				++hits;
+			}
+		}
+
+		BOOST_CHECK(hits > 0);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(BVH_Test_Suite)
+
+/**
+ * Test that the single precision nodes are 32 bytes in size.
+ */
+BOOST_AUTO_TEST_CASE(TestNodeSize)
+{
+	BOOST_CHECK_EQUAL(sizeof(BVH::Node), 32u);
+}
+
+/**
+ * Test the empty hierarchy.
+ */
+BOOST_AUTO_TEST_CASE(TestEmpty)
+{
+	const BVH bvh;
+	BOOST_CHECK(bvh.nodes().empty());
+	BOOST_CHECK(bvh.bounds().isEmpty());
+
+	std::size_t visited = 0;
+	bvh.query(AABB(Vector3(-1.0f, -1.0f, -1.0f), Vector3(1.0f, 1.0f, 1.0f)), [&](std::size_t) { ++visited; });
+	BOOST_CHECK_EQUAL(visited, 0u);
+
+	float distance;
+	std::size_t primitive;
+	BOOST_CHECK(!bvh.intersectTriangles(Ray(), static_cast<const Triangle*>(0), distance, primitive));
+
+	const BVH single(std::vector<AABB>(1, AABB(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f))).data(), 1);
+	BOOST_CHECK_EQUAL(single.nodes().size(), 1u);
+	BOOST_CHECK(single.nodes()[0].isLeaf());
+}
+
+/**
+ * Test the structure of the hierarchy and ray intersections against testing
+ * every triangle.
+ */
+BOOST_AUTO_TEST_CASE(TestBuild)
+{
+	const std::vector<Triangle> soup = triangles(3000);
+	const std::vector<AABB> boxes = bounds(soup);
+	const BVH bvh(boxes.data(), boxes.size());
+
+	checkStructure(bvh, boxes);
+	checkRays(bvh, soup);
+
+	// The SAH should produce a tree with small leaves.
+	BOOST_CHECK(bvh.nodes().size() > boxes.size() / 4);
+}
+
+/**
+ * Test that primitives whose centroids coincide are split into leaves.
+ */
+BOOST_AUTO_TEST_CASE(TestCoincidentCentroids)
+{
+	std::vector<AABB> boxes;
+	for (std::size_t i = 0; i < 40; ++i)
+	{
+		const float s = 1.0f + static_cast<float>(i);
+		boxes.push_back(AABB(Vector3(-s, -s, -s), Vector3(s, s, s)));
+	}
+
+	const BVH bvh(boxes.data(), boxes.size());
+	checkStructure(bvh, boxes);
+	for (std::size_t i = 0; i < bvh.nodes().size(); ++i)
+	{
+		BOOST_CHECK(bvh.nodes()[i].count <= 8u);
+	}
+}
+
+/**
+ * Test that the box query visits every primitive whose bounds intersect the
+ * box.
+ */
+BOOST_AUTO_TEST_CASE(TestQuery)
+{
+	const std::vector<AABB> boxes = bounds(triangles(3000));
+	const BVH bvh(boxes.data(), boxes.size());
+
+	for (std::size_t i = 0; i < 20; ++i)
+	{
+		const AABB box(point(i, 5.0f, 10.0f), point(i, 5.0f, 10.0f) + Vector3(2.0f, 3.0f, 4.0f));
+
+		std::vector<std::size_t> visits(boxes.size(), 0);
+		bvh.query(box, [&](std::size_t index) { ++visits[index]; });
+
+		std::size_t candidates = 0;
+		for (std::size_t j = 0; j < boxes.size(); ++j)
+		{
+			BOOST_CHECK(visits[j] <= 1u);
+			BOOST_CHECK(!boxes[j].intersects(box) || visits[j] == 1u);
+			candidates += visits[j];
+		}
+
+		BOOST_CHECK(candidates < boxes.size() / 4);
+	}
+}
+
+/**
+ * Test that refitting after moving the triangles keeps the bounds and the
+ * intersections correct.
+ */
+BOOST_AUTO_TEST_CASE(TestRefit)
+{
+	std::vector<Triangle> soup = triangles(2000);
+	BVH bvh(bounds(soup).data(), soup.size());
+
+	for (std::size_t i = 0; i < soup.size(); ++i)
+	{
+		const Vector3 offset = point(i, 9.0f, 10.0f) * 0.2f;
+		soup[i] = Triangle(soup[i].a * 0.8f + offset, soup[i].b * 0.8f + offset, soup[i].c * 0.8f + offset);
+	}
+
+	const std::vector<AABB> boxes = bounds(soup);
+	const std::vector<BVH::Node> before = bvh.nodes();
+	bvh.refit(boxes.data());
+
+	BOOST_REQUIRE_EQUAL(bvh.nodes().size(), before.size());
+	checkStructure(bvh, boxes);
+	checkRays(bvh, soup);
+}
+
+/**
+ * Test that building with several threads gives the same hierarchy as
+ * building with one.
+ */
+BOOST_AUTO_TEST_CASE(TestMultithreadedBuild)
+{
+	const std::vector<AABB> boxes = bounds(triangles(30000));
+	const BVH serial(boxes.data(), boxes.size(), 1);
+	const BVH parallel(boxes.data(), boxes.size(), 4);
+
+	BOOST_REQUIRE_EQUAL(parallel.nodes().size(), serial.nodes().size());
+	for (std::size_t i = 0; i < serial.nodes().size(); ++i)
+	{
+		const BVH::Node& a = serial.nodes()[i];
+		const BVH::Node& b = parallel.nodes()[i];
+		BOOST_CHECK(a.offset == b.offset && a.count == b.count && a.bounds == b.bounds);
+	}
+
+	BOOST_CHECK(serial.primitiveIndices() == parallel.primitiveIndices());
+	checkStructure(parallel, boxes);
+}
+
+/**
+ * Test that rays parallel to an axis that lie on a face of the bounds of a
+ * node, for which the slab test computes zero times infinity, are not
+ * rejected by the traversal.
+ */
+BOOST_AUTO_TEST_CASE(TestRaysOnBounds)
+{
+	const std::vector<Triangle> soup(1, Triangle(Vector3(0.0f, 0.0f, 5.0f), Vector3(1.0f, 0.0f, 5.0f), Vector3(1.0f, 1.0f, 5.0f)));
+	const std::vector<AABB> boxes = bounds(soup);
+	const BVH bvh(boxes.data(), boxes.size());
+
+	const Ray rays[] = {
+		Ray(Vector3(1.0f, 0.5f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)),
+		Ray(Vector3(1.0f, 0.5f, 0.0f), Vector3(-0.0f, 0.0f, 1.0f)),
+		Ray(Vector3(0.5f, 0.0f, 10.0f), Vector3(0.0f, 0.0f, -1.0f))
+	};
+
+	for (const Ray& ray : rays)
+	{
+		float expected;
+		BOOST_REQUIRE(ray.intersects(soup[0], expected));
+
+		float distance;
+		std::size_t primitive;
+		BOOST_CHECK(bvh.intersectTriangles(ray, soup.data(), distance, primitive));
+		BOOST_CHECK_EQUAL(distance, expected);
+		BOOST_CHECK_EQUAL(primitive, 0u);
+	}
+}
+
+/**
+ * Test the double precision hierarchy.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	const std::vector<Triangle> soup = triangles(500);
+	std::vector<Triangled> soupd(soup.size());
+	std::vector<AABBd> boxes(soup.size());
+	for (std::size_t i = 0; i < soup.size(); ++i)
+	{
+		soupd[i] = Triangled(soup[i]);
+		boxes[i] = soupd[i].bounds();
+	}
+
+	const BVHd bvh(boxes.data(), boxes.size(), 2);
+	const Rayd ray(Vector3d(soupd[7].a) * 2.0, soupd[7].a - Vector3d(soupd[7].a) * 2.0 + (soupd[7].b - soupd[7].a) * 0.25
+		+ (soupd[7].c - soupd[7].a) * 0.25);
+
+	double distance;
+	std::size_t primitive;
+	BOOST_REQUIRE(bvh.intersectTriangles(ray, soupd.data(), distance, primitive));
+	BOOST_CHECK(distance <= 1.0 + 1e-9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
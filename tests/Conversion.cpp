@@ -0,0 +1,125 @@
+#include <M3D/Conversion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Matrix4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+using namespace M3D;
+
+BOOST_AUTO_TEST_SUITE(Conversion_Test_Suite)
+
+/**
+ * Test the conversion of a scalar array from double to single precision,
+ * using a length that exercises both the vectorised and scalar paths.
+ */
+BOOST_AUTO_TEST_CASE(TestConvertDoubleToFloat)
+{
+	const std::size_t count = 19;
+
+	double in[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in[i] = 0.1 * i - 1.0 / 3.0;
+	}
+
+	float out[count];
+	convert(in, out, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_EQUAL(out[i], static_cast<float>(in[i]));
+	}
+}
+
+/**
+ * Test the conversion of a scalar array from single to double precision.
+ */
+BOOST_AUTO_TEST_CASE(TestConvertFloatToDouble)
+{
+	const std::size_t count = 19;
+
+	float in[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in[i] = 0.1f * i - 1.0f / 3.0f;
+	}
+
+	double out[count];
+	convert(in, out, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_EQUAL(out[i], static_cast<double>(in[i]));
+	}
+}
+
+/**
+ * Test that converting an array of vectors matches the converting
+ * constructor.
+ */
+BOOST_AUTO_TEST_CASE(TestConvertVectors)
+{
+	const std::size_t count = 7;
+
+	Vector3d in[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in[i] = Vector3d(1e8 + 0.25 * i, -1.0 / (i + 1), 0.5 * i);
+	}
+
+	Vector3 out[count];
+	convert(in, out, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Vector3 expected(in[i]);
+		BOOST_CHECK_EQUAL(out[i].x, expected.x);
+		BOOST_CHECK_EQUAL(out[i].y, expected.y);
+		BOOST_CHECK_EQUAL(out[i].z, expected.z);
+	}
+}
+
+/**
+ * Test that converting arrays of quaternions and matrices to double
+ * precision and back is lossless.
+ */
+BOOST_AUTO_TEST_CASE(TestConvertRoundTrip)
+{
+	const Quaternion q[3] = {
+		Quaternion::IDENTITY,
+		Quaternion::euler(Vector3(0.1f, 0.2f, 0.3f)),
+		Quaternion::angleAxis(1.0f, Vector3::UP)
+	};
+	const Matrix4 A[2] = {Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f)), Matrix4::euler(Vector3(0.5f, 0.0f, -0.5f))};
+
+	Quaterniond qd[3];
+	Quaternion qf[3];
+	convert(q, qd, 3);
+	convert(qd, qf, 3);
+
+	Matrix4d Ad[2];
+	Matrix4 Af[2];
+	convert(A, Ad, 2);
+	convert(Ad, Af, 2);
+
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		BOOST_CHECK_EQUAL(qd[i].w, static_cast<double>(q[i].w));
+		BOOST_CHECK_EQUAL(qf[i].x, q[i].x);
+		BOOST_CHECK_EQUAL(qf[i].y, q[i].y);
+		BOOST_CHECK_EQUAL(qf[i].z, q[i].z);
+	}
+
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		for (std::size_t j = 0; j < 16; ++j)
+		{
+			BOOST_CHECK_EQUAL(Ad[i][j], static_cast<double>(A[i][j]));
+			BOOST_CHECK_EQUAL(Af[i][j], A[i][j]);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
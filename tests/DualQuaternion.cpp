@@ -0,0 +1,242 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/DualQuaternion.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+
+using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	/**
+	 * Returns a pseudo-random unit dual quaternion. The same `seed` always
+	 * produces the same transformation.
+	 */
+	DualQuaternion randomRigid(unsigned int seed)
+	{
+		float values[6];
+		for (std::size_t i = 0; i < 6; ++i) values[i] = randomValue(seed);
+
+		const Quaternion q = Quaternion::euler(3.0f * Vector3(values[0], values[1], values[2]));
+		return DualQuaternion(q, 5.0f * Vector3(values[3], values[4], values[5]));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(DualQuaternion_Test_Suite)
+
+/**
+ * Test that the default constructor constructs the identity transformation.
+ */
+BOOST_AUTO_TEST_CASE(TestDefaultConstructor)
+{
+	const DualQuaternion dq;
+
+	BOOST_CHECK_EQUAL(dq.real, Quaternion::IDENTITY);
+	BOOST_CHECK_EQUAL(dq.dual, Quaternion(0.0f, 0.0f, 0.0f, 0.0f));
+	BOOST_CHECK_EQUAL(dq, DualQuaternion::IDENTITY);
+}
+
+/**
+ * Test that the rotation and translation can be recovered from the dual
+ * quaternion constructed from them.
+ */
+BOOST_AUTO_TEST_CASE(TestRotationTranslationConstructor)
+{
+	const Quaternion q = Quaternion::euler(Vector3(0.3f, -1.2f, 2.1f));
+	const Vector3 t(1.0f, 2.0f, -3.0f);
+	const DualQuaternion dq(q, t);
+
+	BOOST_CHECK_EQUAL(dq.rotationPart(), q);
+	checkClose(dq.translationPart(), t, 1e-5f);
+}
+
+/**
+ * Test that points and vectors are transformed by the rotation followed by
+ * the translation.
+ */
+BOOST_AUTO_TEST_CASE(TestTransform)
+{
+	const Quaternion q = Quaternion::euler(Vector3(-0.7f, 0.4f, 1.9f));
+	const Vector3 t(-2.0f, 0.5f, 4.0f);
+	const Vector3 p(1.5f, 3.0f, -0.5f);
+	const DualQuaternion dq(q, t);
+
+	checkClose(dq.transformPoint(p), q * p + t, 1e-5f);
+	checkClose(dq.transformVector(p), q * p, 1e-5f);
+}
+
+/**
+ * Test that composition matches the product of the equivalent 4x4 matrices.
+ */
+BOOST_AUTO_TEST_CASE(TestComposition)
+{
+	for (unsigned int seed = 1; seed <= 16; ++seed)
+	{
+		const DualQuaternion a = randomRigid(seed);
+		const DualQuaternion b = randomRigid(seed + 100);
+		const Matrix4 expected = Matrix4(a) * Matrix4(b);
+		const Matrix4 actual(a * b);
+
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			BOOST_CHECK_SMALL(actual[i] - expected[i], 1e-4f);
+		}
+	}
+}
+
+/**
+ * Test the conversions to and from Matrix4.
+ */
+BOOST_AUTO_TEST_CASE(TestMatrix4Conversion)
+{
+	const Quaternion q = Quaternion::euler(Vector3(0.9f, -0.3f, 2.4f));
+	const Vector3 t(4.0f, -1.0f, 2.5f);
+	const DualQuaternion dq(q, t);
+
+	const Matrix4 M(dq);
+	const Matrix4 expected = Matrix4::translation(t) * Matrix4(q);
+	for (std::size_t i = 0; i < 16; ++i)
+	{
+		BOOST_CHECK_SMALL(M[i] - expected[i], 1e-5f);
+	}
+
+	// The quaternions q and -q represent the same rotation.
+	const DualQuaternion converted(M);
+	const float sign = dot(converted.real, q) < 0.0f ? -1.0f : 1.0f;
+	BOOST_CHECK_EQUAL(sign * converted, dq);
+}
+
+/**
+ * Test that normalization produces a unit dual quaternion representing the
+ * same transformation.
+ */
+BOOST_AUTO_TEST_CASE(TestNormalize)
+{
+	const DualQuaternion dq = randomRigid(5);
+	const Vector3 p(0.5f, -4.0f, 2.5f);
+
+	// A component of the dual part along the real part does not change the
+	// transformation, but is removed by normalization.
+	DualQuaternion scaled = 3.0f * dq;
+	const Quaternion& r = dq.real;
+	const Quaternion& d = scaled.dual;
+	scaled.dual = Quaternion(d.w + 0.25f * r.w, d.x + 0.25f * r.x, d.y + 0.25f * r.y, d.z + 0.25f * r.z);
+	scaled.normalize();
+
+	BOOST_CHECK_SMALL(scaled.real.magnitude() - 1.0f, 1e-6f);
+	BOOST_CHECK_SMALL(dot(scaled.real, scaled.dual), 1e-6f);
+	checkClose(scaled.transformPoint(p), dq.transformPoint(p), 1e-5f);
+	BOOST_CHECK_EQUAL((2.0f * dq).normalized(), dq);
+}
+
+/**
+ * Test that the conjugate and the inverse undo the transformation of a unit
+ * dual quaternion.
+ */
+BOOST_AUTO_TEST_CASE(TestInverse)
+{
+	for (unsigned int seed = 1; seed <= 8; ++seed)
+	{
+		const DualQuaternion dq = randomRigid(seed);
+
+		BOOST_CHECK_EQUAL(dq * dq.conjugate(), DualQuaternion::IDENTITY);
+		BOOST_CHECK_EQUAL(dq.inverse(), dq.conjugate());
+		BOOST_CHECK_EQUAL((2.0f * dq) * (2.0f * dq).inverse(), DualQuaternion::IDENTITY);
+	}
+}
+
+/**
+ * Test that blending is independent of the sign of the dual quaternions and
+ * interpolates between rigid transformations.
+ */
+BOOST_AUTO_TEST_CASE(TestBlend)
+{
+	const Vector3 axis(0.0f, 0.0f, 1.0f);
+	const DualQuaternion dqs[2] = {
+		DualQuaternion(Quaternion::angleAxis(0.0f, axis), Vector3(0.0f, 0.0f, 0.0f)),
+		-1.0f * DualQuaternion(Quaternion::angleAxis(1.0f, axis), Vector3(2.0f, 0.0f, 0.0f))
+	};
+	const float weights[2] = {0.5f, 0.5f};
+
+	// Blending a single dual quaternion returns it unchanged.
+	BOOST_CHECK_EQUAL(blend(dqs, weights, 1), dqs[0]);
+
+	// An equal blend of rotations about the same axis rotates by half the
+	// angle about the axis.
+	const DualQuaternion b = blend(dqs, weights, 2);
+	BOOST_CHECK_SMALL(std::abs(dot(b.real, Quaternion::angleAxis(0.5f, axis))) - 1.0f, 1e-6f);
+	BOOST_CHECK_SMALL(b.real.magnitude() - 1.0f, 1e-6f);
+	BOOST_CHECK_SMALL(b.translationPart().z, 1e-6f);
+}
+
+/**
+ * Test that the batch skinning matches blending the influences of each point
+ * individually.
+ */
+BOOST_AUTO_TEST_CASE(TestSkinPoints)
+{
+	const std::size_t count = 37;
+	const std::size_t influences = 3;
+	const std::size_t boneCount = 5;
+
+	DualQuaternion bones[boneCount];
+	for (std::size_t j = 0; j < boneCount; ++j)
+	{
+		bones[j] = randomRigid(static_cast<unsigned int>(j + 1));
+	}
+
+	// Include a bone in the opposite hemisphere.
+	bones[3] = -1.0f * bones[3];
+
+	unsigned int indices[influences * count];
+	float weights[influences * count];
+	float xs[count], ys[count], zs[count];
+	Vector3 expected[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		DualQuaternion dqs[influences];
+		float w[influences] = {0.6f, 0.3f, 0.1f};
+		if (i % 5 == 0) w[0] = 1.0f, w[1] = 0.0f, w[2] = 0.0f;
+
+		for (std::size_t k = 0; k < influences; ++k)
+		{
+			indices[k * count + i] = static_cast<unsigned int>((i + 2 * k) % boneCount);
+			weights[k * count + i] = w[k];
+			dqs[k] = bones[indices[k * count + i]];
+		}
+
+		xs[i] = 0.5f * i;
+		ys[i] = 1.0f - 0.25f * i;
+		zs[i] = 2.0f + 0.1f * i;
+		expected[i] = blend(dqs, w, influences).transformPoint(Vector3(xs[i], ys[i], zs[i]));
+	}
+
+	skinPoints(bones, indices, weights, influences, xs, ys, zs, xs, ys, zs, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		checkClose(Vector3(xs[i], ys[i], zs[i]), expected[i], 1e-4f);
+	}
+}
+
+/**
+ * Test that the double precision composition and inverse are accurate.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	for (unsigned int seed = 1; seed <= 8; ++seed)
+	{
+		const DualQuaterniond dq = DualQuaterniond(randomRigid(seed)).normalized();
+		const Vector3d p(1.5, -2.0, 0.75);
+
+		checkClose((dq * dq.conjugate()).transformPoint(p), p, 1e-12);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
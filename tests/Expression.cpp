@@ -0,0 +1,103 @@
+#include <M3D/Expression.hpp>
+#include <M3D/Matrix2.hpp>
+#include <M3D/Matrix3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Vector2.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <type_traits>
+
+using namespace M3D;
+using namespace M3D::expr;
+
+BOOST_AUTO_TEST_SUITE(Expression_Test_Suite)
+
+/**
+ * Test that a blend of matrices built as an expression equals that computed
+ * eagerly.
+ */
+BOOST_AUTO_TEST_CASE(TestMatrixBlend)
+{
+	const Matrix4 A(
+		4.0f, 2.0f, -3.0f, 1.0f,
+		1.0f, 5.0f, 0.5f, -2.0f,
+		-1.0f, 2.0f, 6.0f, 0.25f,
+		0.5f, -1.0f, 1.5f, 3.0f
+	);
+	const Matrix4 B(
+		0.5f, -1.5f, 2.5f, 1.0f,
+		1.0f, 3.0f, -2.0f, 0.5f,
+		0.25f, 1.0f, 2.0f, -1.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	);
+	const float t = 0.3f;
+
+	const Matrix4 eager = A * (1.0f - t) + B * t;
+	const Matrix4 fused = lazy(A) * (1.0f - t) + lazy(B) * t;
+	BOOST_CHECK(fused == eager);
+	BOOST_CHECK(Matrix4(lazy(A) * (1.0f - t) + B * t) == eager);
+	BOOST_CHECK(evaluate(lazy(A) - B) == A - B);
+
+	const Matrix3 C = Matrix3::IDENTITY;
+	const Matrix3 D(2.0f, 1.0f, 0.0f, 1.0f, 3.0f, 1.0f, 0.0f, 1.0f, 4.0f);
+	BOOST_CHECK(Matrix3(lazy(C) + D * 0.5f) == C + D * 0.5f);
+
+	const Matrix2 E(1.0f, 2.0f, 3.0f, 4.0f);
+	BOOST_CHECK(Matrix2(2.0f * lazy(E) - E) == E);
+}
+
+/**
+ * Test that chains of vector arithmetic built as expressions equal those
+ * computed eagerly, whichever operands are expressions.
+ */
+BOOST_AUTO_TEST_CASE(TestVectorChain)
+{
+	const Vector4 a(1.5f, -2.0f, 0.75f, 1.0f);
+	const Vector4 b(0.5f, 3.0f, -1.25f, 0.0f);
+	const Vector4 c(-1.0f, 0.25f, 2.0f, 1.0f);
+	const float s = 2.5f;
+
+	const Vector4 expected = a + b * s - c;
+	BOOST_CHECK(Vector4(lazy(a) + lazy(b) * s - lazy(c)) == expected);
+	BOOST_CHECK(Vector4(a + lazy(b) * s - c) == expected);
+	BOOST_CHECK(Vector4(lazy(a) + (b * s - lazy(c))) == a + (b * s - c));
+
+	const Vector3 u(1.0f, 2.0f, 3.0f);
+	const Vector3 v(-4.0f, 0.5f, 2.0f);
+	BOOST_CHECK(Vector3(-(lazy(u) + v)) == -(u + v));
+	BOOST_CHECK(Vector3((lazy(u) - v) / 2.0f) == (u - v) * 0.5f);
+
+	const Vector2 p(3.0f, -1.0f);
+	const Vector2 q(1.0f, 1.0f);
+	BOOST_CHECK(Vector2(lazy(p) * 2.0f - q) == p * 2.0f - q);
+}
+
+/**
+ * Test that the operators apply only where an operand is an expression of
+ * the same type.
+ */
+BOOST_AUTO_TEST_CASE(TestOperands)
+{
+	typedef decltype(lazy(Vector4()) + Vector4()) VectorSum;
+	BOOST_CHECK((std::is_same<VectorSum::Result, Vector4>::value));
+	BOOST_CHECK((std::is_same<decltype(Vector4() + Vector4()), Vector4>::value));
+	BOOST_CHECK((std::is_same<decltype(Matrix4() * 2.0f), Matrix4>::value));
+	BOOST_CHECK(!IsExpression<Vector4>::value);
+	BOOST_CHECK(IsExpression<VectorSum>::value);
+}
+
+/**
+ * Test that expressions can be evaluated at compile time.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	constexpr Vector3 u(1.0f, 2.0f, 3.0f);
+	constexpr Vector3 v(4.0f, 5.0f, 6.0f);
+	constexpr Vector3 w = lazy(u) * 2.0f - v;
+	static_assert(w.x == -2.0f && w.y == -1.0f && w.z == 0.0f, "Expression not evaluated at compile time");
+	BOOST_CHECK(w == Vector3(-2.0f, -1.0f, 0.0f));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
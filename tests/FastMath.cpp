@@ -0,0 +1,200 @@
+#include <M3D/FastMath.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace M3D;
+
+namespace
+{
+	const double pi = 3.14159265358979323846;
+}
+
+BOOST_AUTO_TEST_SUITE(FastMath_Test_Suite)
+
+/**
+ * Test the relative error bound of the reciprocal square root over many
+ * orders of magnitude.
+ */
+BOOST_AUTO_TEST_CASE(TestRsqrt)
+{
+	double maxError = 0.0;
+	for (float x = 1e-30f; x < 1e30f; x *= 1.001f)
+	{
+		const double exact = 1.0 / std::sqrt(static_cast<double>(x));
+		maxError = std::max(maxError, std::abs(fast::rsqrt(x) - exact) / exact);
+	}
+
+	BOOST_CHECK_LT(maxError, 3e-7);
+	BOOST_CHECK_EQUAL(fast::rsqrt(4.0), 0.5);
+}
+
+/**
+ * Test the absolute error bound of sincos, and its exact values at zero.
+ */
+BOOST_AUTO_TEST_CASE(TestSincos)
+{
+	double maxError = 0.0;
+	for (double angle = -1e4; angle <= 1e4; angle += 0.0123)
+	{
+		const float a = static_cast<float>(angle);
+		float s, c;
+		fast::sincos(a, s, c);
+		maxError = std::max(maxError, std::abs(s - std::sin(static_cast<double>(a))));
+		maxError = std::max(maxError, std::abs(c - std::cos(static_cast<double>(a))));
+	}
+
+	BOOST_CHECK_LT(maxError, 1.5e-7);
+
+	float s, c;
+	fast::sincos(0.0f, s, c);
+	BOOST_CHECK_EQUAL(s, 0.0f);
+	BOOST_CHECK_EQUAL(c, 1.0f);
+}
+
+/**
+ * Test the absolute error bound of the arc cosine, including at the ends of
+ * its domain.
+ */
+BOOST_AUTO_TEST_CASE(TestAcos)
+{
+	double maxError = 0.0;
+	for (double x = -1.0; x <= 1.0; x += 1e-5)
+	{
+		const float f = static_cast<float>(x);
+		maxError = std::max(maxError, std::abs(fast::acos(f) - std::acos(static_cast<double>(f))));
+	}
+
+	BOOST_CHECK_LT(maxError, 5e-7);
+	BOOST_CHECK_SMALL(fast::acos(1.0f), 1e-7f);
+	BOOST_CHECK_CLOSE(fast::acos(-1.0f), static_cast<float>(pi), 1e-4f);
+	BOOST_CHECK_CLOSE(fast::acos(0.0f), static_cast<float>(0.5 * pi), 1e-4f);
+}
+
+/**
+ * Test the absolute error bound of atan2 around circles of several radii,
+ * and its values on the axes and at the origin.
+ */
+BOOST_AUTO_TEST_CASE(TestAtan2)
+{
+	double maxError = 0.0;
+	for (double radius = 1e-3; radius <= 1e3; radius *= 10.0)
+	{
+		for (double angle = -pi; angle <= pi; angle += 1e-4)
+		{
+			const float y = static_cast<float>(radius * std::sin(angle));
+			const float x = static_cast<float>(radius * std::cos(angle));
+			const double exact = std::atan2(static_cast<double>(y), static_cast<double>(x));
+			maxError = std::max(maxError, std::abs(fast::atan2(y, x) - exact));
+		}
+	}
+
+	BOOST_CHECK_LT(maxError, 3e-7);
+	BOOST_CHECK_EQUAL(fast::atan2(0.0f, 1.0f), 0.0f);
+	BOOST_CHECK_CLOSE(fast::atan2(1.0f, 0.0f), static_cast<float>(0.5 * pi), 1e-4f);
+	BOOST_CHECK_CLOSE(fast::atan2(0.0f, -1.0f), static_cast<float>(pi), 1e-4f);
+	BOOST_CHECK_CLOSE(fast::atan2(-1.0f, 0.0f), static_cast<float>(-0.5 * pi), 1e-4f);
+	BOOST_CHECK_EQUAL(fast::atan2(0.0f, 0.0f), 0.0f);
+}
+
+/**
+ * Test that the double precision overloads are the precise functions.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	double s, c;
+	fast::sincos(0.7, s, c);
+	BOOST_CHECK_EQUAL(s, std::sin(0.7));
+	BOOST_CHECK_EQUAL(c, std::cos(0.7));
+	BOOST_CHECK_EQUAL(fast::acos(0.3), std::acos(0.3));
+	BOOST_CHECK_EQUAL(fast::atan2(0.3, -0.2), std::atan2(0.3, -0.2));
+
+	const Vector3d v(3.0, 4.0, 12.0);
+	BOOST_CHECK_EQUAL(fast::magnitude(v), 13.0);
+	BOOST_CHECK(fast::normalized(v) == v.normalized());
+}
+
+/**
+ * Test that the fast magnitude and normalizations agree with the precise
+ * versions to within the error of rsqrt.
+ */
+BOOST_AUTO_TEST_CASE(TestNormalized)
+{
+	const Vector3 v(1.0f, -2.0f, 3.5f);
+	const Vector4 w(1.0f, -2.0f, 3.5f, -0.5f);
+	const Quaternion q(0.5f, 1.0f, -2.0f, 3.0f);
+
+	BOOST_CHECK_CLOSE(fast::magnitude(v), v.magnitude(), 1e-4f);
+	BOOST_CHECK_EQUAL(fast::magnitude(Vector3()), 0.0f);
+
+	const Vector3 u = fast::normalized(v);
+	const Vector3 expected = v.normalized();
+	BOOST_CHECK_CLOSE(u.x, expected.x, 1e-4f);
+	BOOST_CHECK_CLOSE(u.y, expected.y, 1e-4f);
+	BOOST_CHECK_CLOSE(u.z, expected.z, 1e-4f);
+	BOOST_CHECK_CLOSE(fast::normalized(w).magnitude(), 1.0f, 1e-4f);
+	BOOST_CHECK_CLOSE(fast::normalized(q).magnitude(), 1.0f, 1e-4f);
+}
+
+/**
+ * Test that the fast rotations from angles agree with the precise versions.
+ */
+BOOST_AUTO_TEST_CASE(TestRotations)
+{
+	const Vector3 angles(0.3f, -1.2f, 2.9f);
+	const Quaternion a = fast::euler(angles);
+	const Quaternion b = Quaternion::euler(angles);
+	BOOST_CHECK_SMALL(a.w - b.w, 1e-6f);
+	BOOST_CHECK_SMALL(a.x - b.x, 1e-6f);
+	BOOST_CHECK_SMALL(a.y - b.y, 1e-6f);
+	BOOST_CHECK_SMALL(a.z - b.z, 1e-6f);
+
+	const Vector3 axis = Vector3(1.0f, 2.0f, -2.0f).normalized();
+	const Quaternion c = fast::angleAxis(1.7f, axis);
+	const Quaternion d = Quaternion::angleAxis(1.7f, axis);
+	BOOST_CHECK_SMALL(c.w - d.w, 1e-6f);
+	BOOST_CHECK_SMALL(c.x - d.x, 1e-6f);
+	BOOST_CHECK_SMALL(c.y - d.y, 1e-6f);
+	BOOST_CHECK_SMALL(c.z - d.z, 1e-6f);
+}
+
+/**
+ * Test that the batch normalization agrees with the fast normalization of
+ * each vector, for a count that exercises the vector and scalar paths, and
+ * in place.
+ */
+BOOST_AUTO_TEST_CASE(TestNormalizeBatch)
+{
+	const std::size_t count = 103;
+	std::vector<Vector3> in(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float f = static_cast<float>(i) + 1.0f;
+		in[i] = Vector3(std::sin(f) * f, std::cos(1.3f * f), 0.01f * f);
+	}
+
+	std::vector<Vector3> out(count);
+	fast::normalize(in.data(), out.data(), count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Vector3 expected = in[i].normalized();
+		BOOST_CHECK_SMALL(out[i].x - expected.x, 1e-6f);
+		BOOST_CHECK_SMALL(out[i].y - expected.y, 1e-6f);
+		BOOST_CHECK_SMALL(out[i].z - expected.z, 1e-6f);
+	}
+
+	std::vector<Vector3> inPlace(in);
+	fast::normalize(inPlace.data(), inPlace.data(), count);
+	BOOST_CHECK(inPlace == out);
+
+	std::vector<Vector3d> doubles(in.begin(), in.end());
+	fast::normalize(doubles.data(), doubles.data(), count);
+	BOOST_CHECK(doubles[5] == Vector3d(in[5]).normalized());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,286 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/Frustum.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	/**
+	 * Returns the OpenGL style perspective projection with a 90 degree
+	 * vertical field of view, unit aspect ratio and the specified near and
+	 * far distances.
+	 */
+	Matrix4 perspective(float zNear, float zFar, ClipDepth depth)
+	{
+		const float c = depth == CLIP_DEPTH_ZERO_TO_ONE ? zFar / (zNear - zFar) : (zFar + zNear) / (zNear - zFar);
+		const float d = depth == CLIP_DEPTH_ZERO_TO_ONE ? zFar * zNear / (zNear - zFar) : 2.0f * zFar * zNear / (zNear - zFar);
+		return Matrix4(
+			1.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, c, d,
+			0.0f, 0.0f, -1.0f, 0.0f);
+	}
+
+	/**
+	 * Returns a view-projection matrix for a camera at (1, 2, 3) rotated
+	 * about the y-axis.
+	 */
+	Matrix4 viewProjection()
+	{
+		const Matrix4 view = Matrix4::angleAxis(0.4f, Vector3(0.0f, 1.0f, 0.0f)) * Matrix4::translation(Vector3(-1.0f, -2.0f, -3.0f));
+		return perspective(0.5f, 20.0f, CLIP_DEPTH_NEGATIVE_ONE_TO_ONE) * view;
+	}
+
+	/**
+	 * Returns the value of bit `i` of the bitmask `visibility`.
+	 */
+	bool bit(const std::vector<std::uint32_t>& visibility, std::size_t i)
+	{
+		return ((visibility[i / 32] >> (i % 32)) & 1) != 0;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(Frustum_Test_Suite)
+
+/**
+ * Test that the default constructor constructs the cube [-1, 1]^3.
+ */
+BOOST_AUTO_TEST_CASE(TestDefaultConstructor)
+{
+	const Frustum frustum;
+
+	BOOST_CHECK(frustum.contains(Vector3(0.0f, 0.0f, 0.0f)));
+	BOOST_CHECK(frustum.contains(Vector3(1.0f, -1.0f, 1.0f)));
+	BOOST_CHECK(!frustum.contains(Vector3(1.5f, 0.0f, 0.0f)));
+	BOOST_CHECK(!frustum.contains(Vector3(0.0f, 0.0f, -1.5f)));
+
+	for (std::size_t i = 0; i < 6; ++i)
+	{
+		checkClose(frustum.plane(i), Frustum(Matrix4::IDENTITY).plane(i), 0.0f);
+	}
+}
+
+/**
+ * Test the planes extracted from perspective projections with both clip
+ * space depth ranges.
+ */
+BOOST_AUTO_TEST_CASE(TestPlanes)
+{
+	const float s = std::sqrt(0.5f);
+	const ClipDepth depths[] = { CLIP_DEPTH_NEGATIVE_ONE_TO_ONE, CLIP_DEPTH_ZERO_TO_ONE };
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		const Frustum frustum(perspective(1.0f, 10.0f, depths[i]), depths[i]);
+
+		checkClose(frustum.plane(0), Vector4(s, 0.0f, -s, 0.0f), 1e-6f);
+		checkClose(frustum.plane(1), Vector4(-s, 0.0f, -s, 0.0f), 1e-6f);
+		checkClose(frustum.plane(2), Vector4(0.0f, s, -s, 0.0f), 1e-6f);
+		checkClose(frustum.plane(3), Vector4(0.0f, -s, -s, 0.0f), 1e-6f);
+		checkClose(frustum.plane(4), Vector4(0.0f, 0.0f, -1.0f, -1.0f), 1e-5f);
+		checkClose(frustum.plane(5), Vector4(0.0f, 0.0f, 1.0f, 10.0f), 1e-5f);
+	}
+}
+
+/**
+ * Test that a point is contained exactly when its clip space coordinates
+ * lie within the clip volume.
+ */
+BOOST_AUTO_TEST_CASE(TestContains)
+{
+	const Matrix4 A = viewProjection();
+	const Frustum frustum(A);
+
+	std::size_t inside = 0;
+	for (std::size_t i = 0; i < 500; ++i)
+	{
+		const float f = static_cast<float>(i);
+		const Vector3 p(8.0f * std::sin(1.3f * f), 8.0f * std::cos(0.7f * f), 3.0f - 12.0f * std::sin(0.31f * f));
+		const Vector4 c = A * Vector4(p, 1.0f);
+
+		// Skip points too close to the boundary for the comparison to be
+		// meaningful.
+		const float margin = std::min(
+			std::min(c.w - std::abs(c.x), c.w - std::abs(c.y)),
+			c.w - std::abs(c.z));
+		if (std::abs(margin) < 1e-3f)
+		{
+			continue;
+		}
+
+		BOOST_CHECK_EQUAL(frustum.contains(p), margin > 0.0f);
+		inside += margin > 0.0f ? 1 : 0;
+	}
+
+	BOOST_CHECK(inside > 0);
+}
+
+/**
+ * Test the sphere and box intersection tests.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersects)
+{
+	const Frustum frustum(perspective(1.0f, 10.0f, CLIP_DEPTH_NEGATIVE_ONE_TO_ONE));
+
+	BOOST_CHECK(frustum.intersects(Vector3(0.0f, 0.0f, -5.0f), 1.0f));
+	BOOST_CHECK(frustum.intersects(Vector3(0.0f, 0.0f, 0.0f), 1.5f));
+	BOOST_CHECK(!frustum.intersects(Vector3(0.0f, 0.0f, 0.0f), 0.5f));
+	BOOST_CHECK(frustum.intersects(Vector3(6.0f, 0.0f, -5.0f), 1.0f));
+	BOOST_CHECK(!frustum.intersects(Vector3(7.0f, 0.0f, -5.0f), 1.0f));
+	BOOST_CHECK(!frustum.intersects(Vector3(0.0f, 0.0f, -12.0f), 1.0f));
+
+	BOOST_CHECK(frustum.intersects(AABB(Vector3(-1.0f, -1.0f, -6.0f), Vector3(1.0f, 1.0f, -4.0f))));
+	BOOST_CHECK(frustum.intersects(AABB(Vector3(4.5f, -1.0f, -6.0f), Vector3(6.0f, 1.0f, -4.0f))));
+	BOOST_CHECK(!frustum.intersects(AABB(Vector3(6.5f, -1.0f, -6.0f), Vector3(8.0f, 1.0f, -4.0f))));
+	BOOST_CHECK(!frustum.intersects(AABB(Vector3(-1.0f, -1.0f, -0.5f), Vector3(1.0f, 1.0f, 0.5f))));
+	BOOST_CHECK(frustum.intersects(AABB(Vector3(-1.0f, -1.0f, -1.5f), Vector3(1.0f, 1.0f, 0.5f))));
+}
+
+/**
+ * Test that frustums can be built from the infinite projections, whose far
+ * planes pass every point, and that they cull only against the other planes.
+ */
+BOOST_AUTO_TEST_CASE(TestInfiniteProjections)
+{
+	const float fieldOfView = 1.5707963f;
+	const Frustum frustums[] = {
+		Frustum(Matrix4::infinitePerspective(fieldOfView, 1.0f, 1.0f, CLIP_DEPTH_NEGATIVE_ONE_TO_ONE)),
+		Frustum(Matrix4::infinitePerspective(fieldOfView, 1.0f, 1.0f, CLIP_DEPTH_ZERO_TO_ONE), CLIP_DEPTH_ZERO_TO_ONE),
+		Frustum(Matrix4::reversedInfinitePerspective(fieldOfView, 1.0f, 1.0f), CLIP_DEPTH_ZERO_TO_ONE)
+	};
+
+	for (const Frustum& frustum : frustums)
+	{
+		BOOST_CHECK(frustum.contains(Vector3(0.0f, 0.0f, -5.0f)));
+		BOOST_CHECK(frustum.contains(Vector3(0.0f, 0.0f, -1e6f)));
+		BOOST_CHECK(!frustum.contains(Vector3(0.0f, 0.0f, -0.5f)));
+		BOOST_CHECK(!frustum.contains(Vector3(7.0f, 0.0f, -5.0f)));
+
+		BOOST_CHECK(frustum.intersects(Vector3(0.0f, 0.0f, -1e6f), 1.0f));
+		BOOST_CHECK(!frustum.intersects(Vector3(0.0f, 0.0f, 2.0f), 0.5f));
+		BOOST_CHECK(frustum.intersects(AABB(Vector3(-1.0f, -1.0f, -1e6f), Vector3(1.0f, 1.0f, -1e5f))));
+		BOOST_CHECK(!frustum.intersects(AABB(Vector3(6.5f, -1.0f, -6.0f), Vector3(8.0f, 1.0f, -4.0f))));
+
+		const float minXs[] = {-1.0f, 6.5f, -1.0f, -1.0f, 2.0f};
+		const float minYs[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+		const float minZs[] = {-6.0f, -6.0f, -1e6f, 1.0f, -100.0f};
+		const float maxXs[] = {1.0f, 8.0f, 1.0f, 1.0f, 3.0f};
+		const float maxYs[] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+		const float maxZs[] = {-4.0f, -4.0f, -1e5f, 2.0f, -99.0f};
+		std::vector<std::uint32_t> visibility(1);
+		frustum.cullBoxes(minXs, minYs, minZs, maxXs, maxYs, maxZs, visibility.data(), 5);
+		BOOST_CHECK_EQUAL(visibility[0], 0x15u);
+	}
+}
+
+/**
+ * Test that the batch sphere culling matches the scalar test, for counts that
+ * exercise the vectorised loops and the remainders, and that the unused bits
+ * of the last word are cleared.
+ */
+BOOST_AUTO_TEST_CASE(TestCullSpheres)
+{
+	const Frustum frustum(viewProjection());
+	const std::size_t count = 75;
+
+	std::vector<float> xs(count), ys(count), zs(count), radii(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float f = static_cast<float>(i);
+		xs[i] = 8.0f * std::sin(1.3f * f);
+		ys[i] = 8.0f * std::cos(0.7f * f);
+		zs[i] = 3.0f - 12.0f * std::sin(0.31f * f);
+		radii[i] = 0.5f + 0.5f * std::cos(2.1f * f);
+	}
+
+	for (std::size_t n = 0; n <= count; ++n)
+	{
+		std::vector<std::uint32_t> visibility((n + 31) / 32, 0xffffffff);
+		frustum.cullSpheres(xs.data(), ys.data(), zs.data(), radii.data(), visibility.data(), n);
+
+		for (std::size_t i = 0; i < 32 * visibility.size(); ++i)
+		{
+			const bool expected = i < n && frustum.intersects(Vector3(xs[i], ys[i], zs[i]), radii[i]);
+			BOOST_CHECK_EQUAL(bit(visibility, i), expected);
+		}
+	}
+}
+
+/**
+ * Test that the batch box culling matches the scalar test.
+ */
+BOOST_AUTO_TEST_CASE(TestCullBoxes)
+{
+	const Frustum frustum(viewProjection());
+	const std::size_t count = 75;
+
+	std::vector<float> minXs(count), minYs(count), minZs(count), maxXs(count), maxYs(count), maxZs(count);
+	std::size_t visible = 0;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float f = static_cast<float>(i);
+		minXs[i] = 8.0f * std::sin(1.3f * f);
+		minYs[i] = 8.0f * std::cos(0.7f * f);
+		minZs[i] = 3.0f - 12.0f * std::sin(0.31f * f);
+		maxXs[i] = minXs[i] + 1.0f + std::cos(2.1f * f);
+		maxYs[i] = minYs[i] + 1.0f + std::sin(1.7f * f);
+		maxZs[i] = minZs[i] + 0.5f;
+	}
+
+	for (std::size_t n = 0; n <= count; ++n)
+	{
+		std::vector<std::uint32_t> visibility((n + 31) / 32, 0xffffffff);
+		frustum.cullBoxes(minXs.data(), minYs.data(), minZs.data(), maxXs.data(), maxYs.data(), maxZs.data(),
+			visibility.data(), n);
+
+		visible = 0;
+		for (std::size_t i = 0; i < 32 * visibility.size(); ++i)
+		{
+			const bool expected = i < n && frustum.intersects(AABB(
+				Vector3(minXs[i], minYs[i], minZs[i]),
+				Vector3(maxXs[i], maxYs[i], maxZs[i])));
+			BOOST_CHECK_EQUAL(bit(visibility, i), expected);
+			visible += expected ? 1 : 0;
+		}
+	}
+
+	BOOST_CHECK(visible > 0 && visible < count);
+}
+
+/**
+ * Test the double precision extraction and culling.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	const Matrix4 A = viewProjection();
+	const Frustum frustum(A);
+	const Frustumd frustumd = Frustumd(Matrix4d(A));
+
+	for (std::size_t i = 0; i < 6; ++i)
+	{
+		checkClose(Vector4(frustumd.plane(i)), frustum.plane(i), 1e-5f);
+	}
+
+	const double xs[] = { 0.0, 1.0, 50.0 };
+	const double ys[] = { 2.0, 2.0, 0.0 };
+	const double zs[] = { -2.0, 10.0, 0.0 };
+	const double radii[] = { 0.5, 0.5, 1.0 };
+	std::uint32_t visibility = 0;
+	frustumd.cullSpheres(xs, ys, zs, radii, &visibility, 3);
+
+	BOOST_CHECK_EQUAL(visibility, 1u);
+	BOOST_CHECK(Frustum(frustumd).contains(Vector3(1.0f, 2.0f, -2.0f)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -423,6 +423,35 @@ BOOST_AUTO_TEST_CASE(TestInverse2)
 	BOOST_CHECK_EQUAL(A.inverse(), Matrix2(-2.0f, 1.0f, 1.5f, -0.5f));
 }
 
+/**
+ * Test that the checked inverse matches the inverse, and reports singular
+ * matrices without changing the output.
+ */
+BOOST_AUTO_TEST_CASE(TestTryInverse)
+{
+	const Matrix2 A(4.0f, 7.0f, 2.0f, 6.0f);
+	Matrix2 inv;
+	BOOST_CHECK(A.tryInverse(inv));
+	BOOST_CHECK_EQUAL(inv, A.inverse());
+
+	const Matrix2 singular(1.0f, 2.0f, 2.0f, 4.0f);
+	Matrix2 unchanged = A;
+	BOOST_CHECK(!singular.tryInverse(unchanged));
+	BOOST_CHECK_EQUAL(unchanged, A);
+
+	// A nearly singular matrix is rejected with a tolerance.
+	const Matrix2 nearlySingular(1.0f, 2.0f, 2.0f, 4.001f);
+	BOOST_CHECK(nearlySingular.tryInverse(inv));
+	BOOST_CHECK(!nearlySingular.tryInverse(inv, 1e-2f));
+
+	Matrix2 matrices[3] = {A, singular, nearlySingular};
+	Matrix2 out[3];
+	bool valid[3];
+	BOOST_CHECK_EQUAL(tryInverse(matrices, out, valid, 3, 1e-2f), 1u);
+	BOOST_CHECK(valid[0] && !valid[1] && !valid[2]);
+	BOOST_CHECK_EQUAL(out[0], A.inverse());
+}
+
 /**
  * First test for the scaling static factory function.
  */
@@ -533,4 +562,15 @@ BOOST_AUTO_TEST_CASE(TestFromToRotation4)
 	BOOST_CHECK_EQUAL(A * Vector2::RIGHT, Vector2::ONE.normalized());
 }
 
+/**
+ * Test that matrices can be constructed and combined in constant expressions.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	constexpr Matrix2 A = Matrix2(1.0f, 2.0f, 3.0f, 4.0f) * Matrix2::IDENTITY * 2.0f + Matrix2::ZERO;
+	static_assert(A[1] == 4.0f && A.determinant() == -8.0f, "Matrix2 arithmetic should be constexpr");
+	static_assert((A * Vector2::UP).y == 8.0f, "Matrix2 products should be constexpr");
+	BOOST_CHECK_EQUAL(A.transposed(), Matrix2(2.0f, 6.0f, 4.0f, 8.0f));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
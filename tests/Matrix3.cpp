@@ -431,6 +431,36 @@ BOOST_AUTO_TEST_CASE(TestInverse2)
 	BOOST_CHECK_EQUAL(A.inverse(), (1.0f / 12.0f) * Matrix3(-5.0f, 3.0f, 4.0f, 7.0f, 3.0f, -8.0f, 1.0f, -3.0f, 4.0f));
 }
 
+/**
+ * Test that the checked inverse matches the inverse, and reports singular
+ * matrices without changing the output.
+ */
+BOOST_AUTO_TEST_CASE(TestTryInverse)
+{
+	const Matrix3 A(1.0f, 2.0f, 3.0f, 3.0f, 2.0f, 1.0f, 2.0f, 1.0f, 3.0f);
+	Matrix3 inv;
+	BOOST_CHECK(A.tryInverse(inv));
+	BOOST_CHECK_EQUAL(inv, A.inverse());
+
+	const Matrix3 singular(1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 6.0f, 0.0f, 1.0f, 1.0f);
+	Matrix3 unchanged = A;
+	BOOST_CHECK(!singular.tryInverse(unchanged));
+	BOOST_CHECK_EQUAL(unchanged, A);
+
+	// The output may be the matrix itself.
+	Matrix3 inPlace = A;
+	BOOST_CHECK(inPlace.tryInverse(inPlace));
+	BOOST_CHECK_EQUAL(inPlace, A.inverse());
+
+	Matrix3 matrices[3] = {A, singular, Matrix3::IDENTITY};
+	Matrix3 out[3];
+	bool valid[3];
+	BOOST_CHECK_EQUAL(tryInverse(matrices, out, valid, 3), 2u);
+	BOOST_CHECK(valid[0] && !valid[1] && valid[2]);
+	BOOST_CHECK_EQUAL(out[0], A.inverse());
+	BOOST_CHECK_EQUAL(out[2], Matrix3::IDENTITY);
+}
+
 /**
  * First test for the angle axis static factory function.
  */
@@ -591,4 +621,16 @@ BOOST_AUTO_TEST_CASE(TestLookRotation4)
 	BOOST_CHECK_EQUAL(A * Vector3::UP, Vector3::FORWARD);
 }
 
+/**
+ * Test that matrices can be constructed and combined in constant expressions.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	constexpr Matrix3 A(0.0f, -1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+	constexpr Matrix3 B = A * A.transposed() - Matrix3::IDENTITY;
+	static_assert(B[0] == 0.0f && B[4] == 0.0f && A.determinant() == 1.0f, "Matrix3 arithmetic should be constexpr");
+	static_assert((A * Vector3::RIGHT).y == 1.0f, "Matrix3 products should be constexpr");
+	BOOST_CHECK_EQUAL(B, Matrix3::ZERO);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
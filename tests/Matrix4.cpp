@@ -1,12 +1,89 @@
+#include "TestUtilities.hpp"
+
 #include <M3D/Matrix4.hpp>
 #include <M3D/Vector3.hpp>
 #include <M3D/Vector4.hpp>
 #include <M3D/Quaternion.hpp>
 
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <cmath>
 
 using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	/**
+	 * Scalar reference implementation of the matrix product.
+	 */
+	Matrix4 referenceProduct(const Matrix4& A, const Matrix4& B)
+	{
+		float arr[16];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				arr[4 * i + j] = 0.0f;
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					arr[4 * i + j] += A[4 * i + k] * B[4 * k + j];
+				}
+			}
+		}
+
+		return Matrix4(arr);
+	}
+
+	/**
+	 * Scalar reference implementation of the inverse, computed by Gauss-Jordan
+	 * elimination in double precision.
+	 */
+	Matrix4 referenceInverse(const Matrix4& A)
+	{
+		double a[4][8];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				a[i][j] = A[4 * i + j];
+				a[i][j + 4] = (i == j) ? 1.0 : 0.0;
+			}
+		}
+
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			std::size_t pivot = i;
+			for (std::size_t k = i + 1; k < 4; ++k)
+			{
+				if (std::abs(a[k][i]) > std::abs(a[pivot][i])) pivot = k;
+			}
+
+			for (std::size_t j = 0; j < 8; ++j) std::swap(a[i][j], a[pivot][j]);
+
+			const double invPivot = 1.0 / a[i][i];
+			for (std::size_t j = 0; j < 8; ++j) a[i][j] *= invPivot;
+
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				if (k == i) continue;
+				const double factor = a[k][i];
+				for (std::size_t j = 0; j < 8; ++j) a[k][j] -= factor * a[i][j];
+			}
+		}
+
+		float arr[16];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				arr[4 * i + j] = static_cast<float>(a[i][j + 4]);
+			}
+		}
+
+		return Matrix4(arr);
+	}
+}
 
 BOOST_AUTO_TEST_SUITE(Matrix4_Test_Suite)
 
@@ -862,6 +939,129 @@ BOOST_AUTO_TEST_CASE(TestLookRotation4)
 	BOOST_CHECK_EQUAL(A, B);
 }
 
+/**
+ * Test that the lookAt view matrix moves the eye to the origin and the target
+ * onto the negative z-axis, and that its rigid inverse is exact.
+ */
+BOOST_AUTO_TEST_CASE(TestLookAt)
+{
+	const Vector3 eye(1.0f, 2.0f, 3.0f);
+	const Vector3 target(4.0f, 2.0f, -1.0f);
+	const Matrix4 V = Matrix4::lookAt(eye, target, Vector3::UP);
+
+	const Vector4 e = V * Vector4(eye, 1.0f);
+	const Vector4 t = V * Vector4(target, 1.0f);
+	const Vector4 u = V * Vector4(Vector3::UP, 0.0f);
+	BOOST_CHECK_SMALL(e.x, 1e-6f);
+	BOOST_CHECK_SMALL(e.y, 1e-6f);
+	BOOST_CHECK_SMALL(e.z, 1e-6f);
+	BOOST_CHECK_SMALL(t.x, 1e-6f);
+	BOOST_CHECK_SMALL(t.y, 1e-6f);
+	BOOST_CHECK_CLOSE(t.z, -5.0f, 1e-4f);
+	BOOST_CHECK_CLOSE(u.y, 1.0f, 1e-4f);
+
+	checkClose(V.rigidInverse(), referenceInverse(V), 1e-5f);
+	checkClose(V.rigidInverse() * V, Matrix4::IDENTITY, 1e-6f);
+}
+
+/**
+ * Test that the perspective projections map the near and far planes to the
+ * ends of the clip space depth range, and that the projection inverse matches
+ * the general inverse.
+ */
+BOOST_AUTO_TEST_CASE(TestPerspective)
+{
+	const float fov = 1.2f, aspect = 1.5f, zNear = 0.25f, zFar = 50.0f;
+	const Matrix4 P[] = {
+		Matrix4::perspective(fov, aspect, zNear, zFar),
+		Matrix4::perspective(fov, aspect, zNear, zFar, CLIP_DEPTH_ZERO_TO_ONE),
+		Matrix4::reversedPerspective(fov, aspect, zNear, zFar)
+	};
+	const float nearDepth[] = { -1.0f, 0.0f, 1.0f };
+	const float farDepth[] = { 1.0f, 1.0f, 0.0f };
+
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		const Vector4 n = P[i] * Vector4(0.0f, 0.0f, -zNear, 1.0f);
+		const Vector4 f = P[i] * Vector4(0.0f, 0.0f, -zFar, 1.0f);
+		BOOST_CHECK_SMALL(n.z / n.w - nearDepth[i], 1e-5f);
+		BOOST_CHECK_SMALL(f.z / f.w - farDepth[i], 1e-5f);
+
+		// The top edge of the field of view maps to y = 1.
+		const Vector4 top = P[i] * Vector4(0.0f, std::tan(0.5f * fov), -1.0f, 1.0f);
+		BOOST_CHECK_CLOSE(top.y / top.w, 1.0f, 1e-4f);
+
+		const Matrix4 expected = referenceInverse(P[i]);
+		const Matrix4 inverse = P[i].projectionInverse();
+		for (std::size_t j = 0; j < 16; ++j)
+		{
+			BOOST_CHECK_SMALL(inverse[j] - expected[j], 1e-5f * (1.0f + std::abs(expected[j])));
+		}
+	}
+}
+
+/**
+ * Test that the infinite perspective projections map the near plane to the
+ * near end of the depth range and distant points towards the far end.
+ */
+BOOST_AUTO_TEST_CASE(TestInfinitePerspective)
+{
+	const float fov = 1.2f, aspect = 1.5f, zNear = 0.25f;
+	const Matrix4 P[] = {
+		Matrix4::infinitePerspective(fov, aspect, zNear),
+		Matrix4::infinitePerspective(fov, aspect, zNear, CLIP_DEPTH_ZERO_TO_ONE),
+		Matrix4::reversedInfinitePerspective(fov, aspect, zNear)
+	};
+	const float nearDepth[] = { -1.0f, 0.0f, 1.0f };
+	const float farDepth[] = { 1.0f, 1.0f, 0.0f };
+
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		const Vector4 n = P[i] * Vector4(0.0f, 0.0f, -zNear, 1.0f);
+		const Vector4 f = P[i] * Vector4(0.0f, 0.0f, -1e6f, 1.0f);
+		BOOST_CHECK_SMALL(n.z / n.w - nearDepth[i], 1e-5f);
+		BOOST_CHECK_SMALL(f.z / f.w - farDepth[i], 1e-5f);
+
+		const Matrix4 expected = referenceInverse(P[i]);
+		const Matrix4 inverse = P[i].projectionInverse();
+		for (std::size_t j = 0; j < 16; ++j)
+		{
+			BOOST_CHECK_SMALL(inverse[j] - expected[j], 1e-5f * (1.0f + std::abs(expected[j])));
+		}
+	}
+
+	// The limit of the finite projection as the far plane recedes.
+	checkClose(Matrix4::perspective(fov, aspect, zNear, 1e7f), P[0], 1e-5f);
+	checkClose(Matrix4::reversedPerspective(fov, aspect, zNear, 1e7f), P[2], 1e-5f);
+}
+
+/**
+ * Test that the orthographic projection maps the corners of the view volume to
+ * the corners of the clip volume, and that the projection inverse matches the
+ * general inverse.
+ */
+BOOST_AUTO_TEST_CASE(TestOrthographic)
+{
+	const ClipDepth depths[] = { CLIP_DEPTH_NEGATIVE_ONE_TO_ONE, CLIP_DEPTH_ZERO_TO_ONE };
+	const float nearDepth[] = { -1.0f, 0.0f };
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		const Matrix4 P = Matrix4::orthographic(-2.0f, 6.0f, -1.0f, 3.0f, 0.5f, 10.0f, depths[i]);
+
+		const Vector4 lo = P * Vector4(-2.0f, -1.0f, -0.5f, 1.0f);
+		const Vector4 hi = P * Vector4(6.0f, 3.0f, -10.0f, 1.0f);
+		BOOST_CHECK_SMALL(lo.x + 1.0f, 1e-6f);
+		BOOST_CHECK_SMALL(lo.y + 1.0f, 1e-6f);
+		BOOST_CHECK_SMALL(lo.z - nearDepth[i], 1e-6f);
+		BOOST_CHECK_SMALL(hi.x - 1.0f, 1e-6f);
+		BOOST_CHECK_SMALL(hi.y - 1.0f, 1e-6f);
+		BOOST_CHECK_SMALL(hi.z - 1.0f, 1e-6f);
+		BOOST_CHECK_EQUAL(lo.w, 1.0f);
+
+		checkClose(P.projectionInverse(), referenceInverse(P), 1e-5f);
+	}
+}
+
 /**
  * First test for the constructor that constructs the matrix defined by the
  * passed quaternion.
@@ -896,5 +1096,466 @@ BOOST_AUTO_TEST_CASE(TestQuaternionConstructor3)
 	BOOST_CHECK_EQUAL(Matrix4(q) * Vector4::FORWARD, v);
 }
 
+/**
+ * Fourth test for the constructor that constructs the matrix defined by the
+ * passed quaternion. Points must be rotated without being translated.
+ */
+BOOST_AUTO_TEST_CASE(TestQuaternionConstructor4)
+{
+	const Quaternion q = Quaternion::lookRotation(Vector3::RIGHT);
+
+	BOOST_CHECK_EQUAL(Matrix4(q) * Vector4(0.0f, 0.0f, 1.0f, 1.0f), Vector4(1.0f, 0.0f, 0.0f, 1.0f));
+}
+
+/**
+ * Test the constructor that constructs the matrix defined by the passed
+ * affine transformation.
+ */
+BOOST_AUTO_TEST_CASE(TestAffine3Constructor)
+{
+	const Affine3 A(Matrix3::euler(Vector3(0.5f, 1.0f, -0.5f)), Vector3(1.0f, 2.0f, 3.0f));
+	const Matrix4 B = Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f)) * Matrix4(Matrix3::euler(Vector3(0.5f, 1.0f, -0.5f)));
+
+	BOOST_CHECK_EQUAL(Matrix4(A), B);
+}
+
+/**
+ * Test the matrix multiplication kernel against the scalar reference.
+ */
+BOOST_AUTO_TEST_CASE(TestMatrixMultiplicationKernel)
+{
+	for (unsigned int seed = 1; seed <= 32; ++seed)
+	{
+		const Matrix4 A = randomMatrix(seed);
+		const Matrix4 B = randomMatrix(seed + 100);
+		checkClose(A * B, referenceProduct(A, B), 1e-5f);
+	}
+}
+
+/**
+ * Test the matrix-vector multiplication kernels against the scalar reference.
+ */
+BOOST_AUTO_TEST_CASE(TestVectorMultiplicationKernels)
+{
+	for (unsigned int seed = 1; seed <= 32; ++seed)
+	{
+		const Matrix4 A = randomMatrix(seed);
+		const Matrix4 B = randomMatrix(seed + 100);
+		const Vector4 v(B[0], B[1], B[2], B[3]);
+
+		const Vector4 column = A * v;
+		const Vector4 row = v * A;
+		const Matrix4 P = referenceProduct(A, Matrix4(
+			v.x, 0.0f, 0.0f, 0.0f,
+			v.y, 0.0f, 0.0f, 0.0f,
+			v.z, 0.0f, 0.0f, 0.0f,
+			v.w, 0.0f, 0.0f, 0.0f
+		));
+		const Matrix4 Q = referenceProduct(Matrix4(
+			v.x, v.y, v.z, v.w,
+			0.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, 0.0f
+		), A);
+
+		BOOST_CHECK_SMALL(column.x - P[0], 1e-5f);
+		BOOST_CHECK_SMALL(column.y - P[4], 1e-5f);
+		BOOST_CHECK_SMALL(column.z - P[8], 1e-5f);
+		BOOST_CHECK_SMALL(column.w - P[12], 1e-5f);
+		BOOST_CHECK_SMALL(row.x - Q[0], 1e-5f);
+		BOOST_CHECK_SMALL(row.y - Q[1], 1e-5f);
+		BOOST_CHECK_SMALL(row.z - Q[2], 1e-5f);
+		BOOST_CHECK_SMALL(row.w - Q[3], 1e-5f);
+	}
+}
+
+/**
+ * Test the transpose kernel against the definition of the transpose.
+ */
+BOOST_AUTO_TEST_CASE(TestTransposeKernel)
+{
+	for (unsigned int seed = 1; seed <= 32; ++seed)
+	{
+		const Matrix4 A = randomMatrix(seed);
+		const Matrix4 B = A.transposed();
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				BOOST_CHECK_EQUAL(B[4 * i + j], A[4 * j + i]);
+			}
+		}
+	}
+}
+
+/**
+ * Test the inverse kernel against the scalar reference.
+ */
+BOOST_AUTO_TEST_CASE(TestInverseKernel)
+{
+	for (unsigned int seed = 1; seed <= 32; ++seed)
+	{
+		const Matrix4 A = randomMatrix(seed);
+		const Matrix4 B = A.inverse();
+		checkClose(B, referenceInverse(A), 1e-5f);
+		checkClose(A * B, Matrix4::IDENTITY, 1e-5f);
+	}
+}
+
+/**
+ * Test the double precision instantiation, which uses the scalar kernels.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	for (unsigned int seed = 1; seed <= 8; ++seed)
+	{
+		const Matrix4d A(randomMatrix(seed));
+		const Matrix4d B = A.inverse();
+		const Matrix4d C = A * B;
+
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			BOOST_CHECK_SMALL(C[i] - Matrix4d::IDENTITY[i], 1e-12);
+		}
+
+		const Vector4d v(1.0, -2.0, 0.5, 1.0);
+		const Vector4d u = B * (A * v);
+		BOOST_CHECK_SMALL(u.x - v.x, 1e-12);
+		BOOST_CHECK_SMALL(u.y - v.y, 1e-12);
+		BOOST_CHECK_SMALL(u.z - v.z, 1e-12);
+		BOOST_CHECK_SMALL(u.w - v.w, 1e-12);
+	}
+}
+
+/**
+ * Test that transforming arrays of points matches transforming each point
+ * individually.
+ */
+BOOST_AUTO_TEST_CASE(TestTransformPoints)
+{
+	const std::size_t count = 37;
+	const Matrix4 A = randomMatrix(7);
+
+	Vector3 points[count];
+	float xs[count], ys[count], zs[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		points[i] = Vector3(0.5f * i, 1.0f - i, 0.25f * i * i);
+		xs[i] = points[i].x;
+		ys[i] = points[i].y;
+		zs[i] = points[i].z;
+	}
+
+	Vector3 out[count];
+	float outXs[count], outYs[count], outZs[count];
+	transformPoints(A, points, out, count);
+	transformPoints(A, xs, ys, zs, outXs, outYs, outZs, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Vector3 expected = A * Vector4(points[i], 1.0f);
+		BOOST_CHECK_SMALL(out[i].x - expected.x, 1e-3f);
+		BOOST_CHECK_SMALL(out[i].y - expected.y, 1e-3f);
+		BOOST_CHECK_SMALL(out[i].z - expected.z, 1e-3f);
+		BOOST_CHECK_SMALL(outXs[i] - expected.x, 1e-3f);
+		BOOST_CHECK_SMALL(outYs[i] - expected.y, 1e-3f);
+		BOOST_CHECK_SMALL(outZs[i] - expected.z, 1e-3f);
+	}
+}
+
+/**
+ * Test that transforming arrays of directions matches transforming each
+ * direction individually, in place.
+ */
+BOOST_AUTO_TEST_CASE(TestTransformDirections)
+{
+	const std::size_t count = 21;
+	const Matrix4 A = randomMatrix(11);
+
+	Vector3 directions[count];
+	Vector3 expected[count];
+	float xs[count], ys[count], zs[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		directions[i] = Vector3(1.0f + i, -0.5f * i, 3.0f);
+		expected[i] = A * Vector4(directions[i], 0.0f);
+		xs[i] = directions[i].x;
+		ys[i] = directions[i].y;
+		zs[i] = directions[i].z;
+	}
+
+	transformDirections(A, directions, directions, count);
+	transformDirections(A, xs, ys, zs, xs, ys, zs, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_SMALL(directions[i].x - expected[i].x, 1e-3f);
+		BOOST_CHECK_SMALL(directions[i].y - expected[i].y, 1e-3f);
+		BOOST_CHECK_SMALL(directions[i].z - expected[i].z, 1e-3f);
+		BOOST_CHECK_SMALL(xs[i] - expected[i].x, 1e-3f);
+		BOOST_CHECK_SMALL(ys[i] - expected[i].y, 1e-3f);
+		BOOST_CHECK_SMALL(zs[i] - expected[i].z, 1e-3f);
+	}
+}
+
+/**
+ * Test that transforming an array of 4D vectors matches the column-vector
+ * multiplication operator.
+ */
+BOOST_AUTO_TEST_CASE(TestTransformVectors)
+{
+	const std::size_t count = 9;
+	const Matrix4 A = randomMatrix(13);
+
+	Vector4 vectors[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		vectors[i] = Vector4(1.0f * i, 2.0f, -1.0f * i, 0.5f * i);
+	}
+
+	Vector4 out[count];
+	transform(A, vectors, out, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_EQUAL(out[i], A * vectors[i]);
+	}
+}
+
+/**
+ * Test that multiplying arrays of matrices matches the multiplication
+ * operator, including when the output array is one of the inputs.
+ */
+BOOST_AUTO_TEST_CASE(TestMultiplyArrays)
+{
+	const std::size_t count = 7;
+	const Matrix4 S = randomMatrix(21);
+
+	Matrix4 A[count];
+	Matrix4 B[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		A[i] = randomMatrix(100 + i);
+		B[i] = randomMatrix(200 + i);
+	}
+
+	Matrix4 out[count];
+	multiply(A, B, out, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(out[i], A[i] * B[i]);
+
+	multiply(S, B, out, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(out[i], S * B[i]);
+
+	multiply(A, S, out, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(out[i], A[i] * S);
+
+	Matrix4 inPlace[count];
+	std::copy(B, B + count, inPlace);
+	multiply(A, inPlace, inPlace, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(inPlace[i], A[i] * B[i]);
+
+	std::copy(B, B + count, inPlace);
+	multiply(S, inPlace, inPlace, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(inPlace[i], S * B[i]);
+
+	std::copy(A, A + count, inPlace);
+	multiply(inPlace, S, inPlace, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(inPlace[i], A[i] * S);
+
+	// The shared matrix may be one of the outputs.
+	std::copy(B, B + count, inPlace);
+	multiply(inPlace[0], inPlace, inPlace, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(inPlace[i], B[0] * B[i]);
+
+	const Matrix4d D(S);
+	Matrix4d Bd[count];
+	Matrix4d outd[count];
+	for (std::size_t i = 0; i < count; ++i) Bd[i] = Matrix4d(B[i]);
+	multiply(D, Bd, outd, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(outd[i], D * Bd[i]);
+}
+
+/**
+ * Test that the fused inverse transpose matches transposing the inverse.
+ */
+BOOST_AUTO_TEST_CASE(TestInverseTranspose)
+{
+	for (unsigned int seed = 1; seed <= 16; ++seed)
+	{
+		const Matrix4 A = randomMatrix(seed);
+		BOOST_CHECK_EQUAL(A.inverseTranspose(), A.inverse().transposed());
+
+		const Matrix4d D(A);
+		BOOST_CHECK_EQUAL(D.inverseTranspose(), D.inverse().transposed());
+	}
+}
+
+/**
+ * Test that the normal matrix is the inverse transpose of the upper left 3x3
+ * block, and keeps normals perpendicular to transformed tangents under
+ * non-uniform scaling.
+ */
+BOOST_AUTO_TEST_CASE(TestNormalMatrix)
+{
+	const Matrix4 M = Matrix4::translation(Vector3(1.0f, -2.0f, 3.0f)) *
+		Matrix4(Quaternion::euler(Vector3(0.3f, -0.7f, 1.1f))) * Matrix4::scaling(Vector3(2.0f, 0.5f, 3.0f));
+	const Matrix3 N = M.normalMatrix();
+	const Matrix4 expected = M.inverseTranspose();
+	for (std::size_t r = 0; r < 3; ++r)
+	{
+		for (std::size_t c = 0; c < 3; ++c)
+		{
+			BOOST_CHECK_SMALL(N[3 * r + c] - expected[4 * r + c], 1e-5f);
+		}
+	}
+
+	const Vector3 tangent(1.0f, 1.0f, 0.0f);
+	const Vector3 normal(1.0f, -1.0f, 0.0f);
+	const Vector4 transformedTangent = M * Vector4(tangent, 0.0f);
+	const Vector3 transformedNormal = N * normal;
+	BOOST_CHECK_SMALL(dot(Vector3(transformedTangent), transformedNormal), 1e-5f);
+
+	BOOST_CHECK_EQUAL(Matrix4::IDENTITY.normalMatrix(), Matrix3::IDENTITY);
+}
+
+/**
+ * Test that inverting arrays of matrices matches inverting them one at a
+ * time, for counts that exercise both the grouped and the remaining
+ * matrices, and in place.
+ */
+BOOST_AUTO_TEST_CASE(TestInverseArrays)
+{
+	const std::size_t count = 15;
+
+	Matrix4 matrices[count];
+	for (std::size_t i = 0; i < count; ++i) matrices[i] = randomMatrix(300 + i);
+
+	Matrix4 out[count];
+	inverse(matrices, out, count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		checkClose(out[i], matrices[i].inverse(), 1e-5f);
+		checkClose(matrices[i] * out[i], Matrix4::IDENTITY, 1e-5f);
+	}
+
+	inverseTranspose(matrices, out, count);
+	for (std::size_t i = 0; i < count; ++i) checkClose(out[i], matrices[i].inverseTranspose(), 1e-5f);
+
+	Matrix4 inPlace[count];
+	std::copy(matrices, matrices + count, inPlace);
+	inverse(inPlace, inPlace, count);
+	for (std::size_t i = 0; i < count; ++i) checkClose(inPlace[i], matrices[i].inverse(), 1e-5f);
+
+	Matrix4d doubles[count];
+	Matrix4d outd[count];
+	for (std::size_t i = 0; i < count; ++i) doubles[i] = Matrix4d(matrices[i]);
+	inverseTranspose(doubles, outd, count);
+	for (std::size_t i = 0; i < count; ++i) BOOST_CHECK_EQUAL(outd[i], doubles[i].inverseTranspose());
+}
+
+/**
+ * Test that the checked inverse matches the inverse, and reports singular
+ * matrices without changing the output.
+ */
+BOOST_AUTO_TEST_CASE(TestTryInverse)
+{
+	for (unsigned int seed = 1; seed <= 8; ++seed)
+	{
+		const Matrix4 A = randomMatrix(seed);
+		Matrix4 inv;
+		BOOST_CHECK(A.tryInverse(inv));
+		BOOST_CHECK_EQUAL(inv, A.inverse());
+
+		Matrix4 inPlace = A;
+		BOOST_CHECK(inPlace.tryInverse(inPlace));
+		BOOST_CHECK_EQUAL(inPlace, A.inverse());
+	}
+
+	const Matrix4 A = randomMatrix(3);
+	const Matrix4 singular = Matrix4::scaling(Vector3(1.0f, 0.0f, 1.0f));
+	Matrix4 unchanged = A;
+	BOOST_CHECK(!singular.tryInverse(unchanged));
+	BOOST_CHECK_EQUAL(unchanged, A);
+
+	// A nearly singular matrix is rejected with a tolerance.
+	const Matrix4 nearlySingular = Matrix4::scaling(Vector3(1.0f, 1e-4f, 1.0f));
+	BOOST_CHECK(nearlySingular.tryInverse(unchanged));
+	unchanged = A;
+	BOOST_CHECK(!nearlySingular.tryInverse(unchanged, 1e-3f));
+	BOOST_CHECK_EQUAL(unchanged, A);
+
+	const Matrix4d D(A);
+	Matrix4d invd;
+	BOOST_CHECK(D.tryInverse(invd));
+	BOOST_CHECK_EQUAL(invd, D.inverse());
+	BOOST_CHECK(!Matrix4d(singular).tryInverse(invd));
+}
+
+/**
+ * Test that inverting arrays with singular matrices inverts the others and
+ * flags which were inverted, for counts that exercise both the grouped and
+ * the remaining matrices.
+ */
+BOOST_AUTO_TEST_CASE(TestTryInverseArrays)
+{
+	const std::size_t count = 15;
+	const Matrix4 singular = Matrix4::scaling(Vector3(1.0f, 1.0f, 0.0f));
+
+	Matrix4 matrices[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		matrices[i] = (i % 3 == 1) ? singular : randomMatrix(400 + i);
+	}
+
+	Matrix4 out[count];
+	for (std::size_t i = 0; i < count; ++i) out[i] = Matrix4::IDENTITY * 2.0f;
+
+	bool valid[count];
+	BOOST_CHECK_EQUAL(tryInverse(matrices, out, valid, count), count - count / 3);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_EQUAL(valid[i], i % 3 != 1);
+		if (valid[i]) checkClose(out[i], matrices[i].inverse(), 1e-5f);
+		else BOOST_CHECK_EQUAL(out[i], Matrix4::IDENTITY * 2.0f);
+	}
+
+	// In place, the singular matrices are left as they were.
+	Matrix4 inPlace[count];
+	std::copy(matrices, matrices + count, inPlace);
+	tryInverse(inPlace, inPlace, valid, count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		if (valid[i]) checkClose(inPlace[i], matrices[i].inverse(), 1e-5f);
+		else BOOST_CHECK_EQUAL(inPlace[i], singular);
+	}
+
+	// Every matrix of a group singular.
+	Matrix4 singulars[8];
+	std::fill(singulars, singulars + 8, singular);
+	BOOST_CHECK_EQUAL(tryInverse(singulars, singulars, valid, 8), 0u);
+
+	Matrix4d doubles[count];
+	Matrix4d outd[count];
+	for (std::size_t i = 0; i < count; ++i) doubles[i] = Matrix4d(matrices[i]);
+	BOOST_CHECK_EQUAL(tryInverse(doubles, outd, valid, count, 1e-6), count - count / 3);
+}
+
+/**
+ * Test that transformations can be composed in constant expressions, and
+ * that the products agree with those evaluated at run time.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	constexpr Matrix4 A = Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f)) *
+		Matrix4(Quaternion(0.0f, 0.0f, 0.0f, 1.0f)) * Matrix4::scaling(2.0f);
+	constexpr Vector4 p = A * Vector4(1.0f, 0.0f, 0.0f, 1.0f);
+	static_assert(p.x == -1.0f && p.y == 2.0f && p.z == 3.0f, "Matrix4 products should be constexpr");
+	static_assert((Vector4::UP * Matrix4::IDENTITY).y == 1.0f, "Matrix4 products should be constexpr");
+
+	const Matrix4 B = Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f)) *
+		Matrix4(Quaternion(0.0f, 0.0f, 0.0f, 1.0f)) * Matrix4::scaling(2.0f);
+	BOOST_CHECK_EQUAL(A, B);
+	BOOST_CHECK_EQUAL(p, B * Vector4(1.0f, 0.0f, 0.0f, 1.0f));
+}
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,252 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/Packed.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	// Not a multiple of the SIMD width, so that the batch operations have a
+	// scalar tail.
+	const std::size_t count = 1003;
+
+	/**
+	 * Returns a pseudo-random unit quaternion for the index `i`, with every
+	 * component sometimes the greatest and sometimes negative.
+	 */
+	Quaternion quaternion(std::size_t i)
+	{
+		const float f = static_cast<float>(i);
+		return Quaternion(std::sin(1.3f * f), std::cos(0.7f * f), std::sin(0.31f * f + 1.0f), std::cos(2.9f * f)).normalized();
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(Packed_Test_Suite)
+
+/**
+ * Test the sizes of the packed types.
+ */
+BOOST_AUTO_TEST_CASE(TestSizes)
+{
+	BOOST_CHECK_EQUAL(sizeof(Vector3h), 6u);
+	BOOST_CHECK_EQUAL(sizeof(Vector3s), 6u);
+	BOOST_CHECK_EQUAL(sizeof(PackedQuaternion32), 4u);
+	BOOST_CHECK_EQUAL(sizeof(PackedQuaternion48), 6u);
+}
+
+/**
+ * Test that every half precision value other than NaN survives conversion
+ * to single precision and back, and that NaNs remain NaNs.
+ */
+BOOST_AUTO_TEST_CASE(TestHalfRoundTrip)
+{
+	for (std::uint32_t h = 0; h <= 0xffffu; ++h)
+	{
+		const float f = halfToFloat(static_cast<std::uint16_t>(h));
+		if ((h & 0x7fffu) > 0x7c00u)
+		{
+			BOOST_CHECK(f != f);
+			BOOST_CHECK((floatToHalf(f) & 0x7fffu) > 0x7c00u);
+		}
+		else
+		{
+			BOOST_CHECK_EQUAL(floatToHalf(f), h);
+		}
+	}
+}
+
+/**
+ * Test the conversion of particular values to half precision, including
+ * rounding to nearest even, overflow and denormals.
+ */
+BOOST_AUTO_TEST_CASE(TestFloatToHalf)
+{
+	BOOST_CHECK_EQUAL(floatToHalf(0.0f), 0x0000u);
+	BOOST_CHECK_EQUAL(floatToHalf(-0.0f), 0x8000u);
+	BOOST_CHECK_EQUAL(floatToHalf(1.0f), 0x3c00u);
+	BOOST_CHECK_EQUAL(floatToHalf(-2.0f), 0xc000u);
+	BOOST_CHECK_EQUAL(floatToHalf(65504.0f), 0x7bffu);
+
+	// Halfway cases round to the even neighbour.
+	BOOST_CHECK_EQUAL(floatToHalf(1.0f + std::ldexp(1.0f, -11)), 0x3c00u);
+	BOOST_CHECK_EQUAL(floatToHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)), 0x3c02u);
+	BOOST_CHECK_EQUAL(floatToHalf(65519.0f), 0x7bffu);
+	BOOST_CHECK_EQUAL(floatToHalf(65520.0f), 0x7c00u);
+	BOOST_CHECK_EQUAL(floatToHalf(-1e10f), 0xfc00u);
+	BOOST_CHECK_EQUAL(floatToHalf(std::numeric_limits<float>::infinity()), 0x7c00u);
+
+	// Denormals.
+	BOOST_CHECK_EQUAL(floatToHalf(std::ldexp(1.0f, -24)), 0x0001u);
+	BOOST_CHECK_EQUAL(floatToHalf(std::ldexp(1.0f, -25)), 0x0000u);
+	BOOST_CHECK_EQUAL(floatToHalf(std::ldexp(3.0f, -25)), 0x0002u);
+	BOOST_CHECK_EQUAL(floatToHalf(std::ldexp(1.0f, -15)), 0x0200u);
+
+	const std::uint16_t nan = floatToHalf(std::numeric_limits<float>::quiet_NaN());
+	BOOST_CHECK((nan & 0x7fffu) > 0x7c00u);
+}
+
+/**
+ * Test that packing and unpacking arrays of half precision vectors matches
+ * the scalar conversions exactly.
+ */
+BOOST_AUTO_TEST_CASE(TestVector3hBatch)
+{
+	std::vector<Vector3> in(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float f = static_cast<float>(i);
+		in[i] = Vector3(1000.0f * std::sin(1.3f * f), std::ldexp(std::cos(0.7f * f), -20), std::sin(0.31f * f) * 1e5f);
+	}
+
+	std::vector<Vector3h> packed(count);
+	pack(in.data(), packed.data(), count);
+
+	std::vector<Vector3> unpacked(count);
+	unpack(packed.data(), unpacked.data(), count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Vector3h expected(in[i]);
+		BOOST_CHECK_EQUAL(packed[i].x, expected.x);
+		BOOST_CHECK_EQUAL(packed[i].y, expected.y);
+		BOOST_CHECK_EQUAL(packed[i].z, expected.z);
+		const Vector3 expectedUnpacked = expected.unpack();
+		BOOST_CHECK(std::memcmp(&unpacked[i], &expectedUnpacked, sizeof(Vector3)) == 0);
+	}
+
+	BOOST_CHECK_CLOSE(unpacked[1].x, in[1].x, 0.05f);
+}
+
+/**
+ * Test the quantization of normalized 16-bit vectors, including clamping.
+ */
+BOOST_AUTO_TEST_CASE(TestVector3s)
+{
+	const Vector3s v(Vector3(1.0f, -1.0f, 0.0f));
+	BOOST_CHECK_EQUAL(v.x, 32767);
+	BOOST_CHECK_EQUAL(v.y, -32767);
+	BOOST_CHECK_EQUAL(v.z, 0);
+	BOOST_CHECK(v.unpack() == Vector3(1.0f, -1.0f, 0.0f));
+
+	const Vector3s clamped(Vector3(2.0f, -3.0f, 0.5f));
+	BOOST_CHECK_EQUAL(clamped.x, 32767);
+	BOOST_CHECK_EQUAL(clamped.y, -32767);
+	BOOST_CHECK_EQUAL(Vector3s(0, -32768, 0).unpack().y, -1.0f);
+
+	float maxError = 0.0f;
+	for (float f = -1.0f; f <= 1.0f; f += 1e-4f)
+	{
+		maxError = std::max(maxError, std::abs(Vector3s(Vector3(f, 0.0f, 0.0f)).unpack().x - f));
+	}
+
+	BOOST_CHECK_LE(maxError, 1.0f / 65534.0f + 1e-7f);
+}
+
+/**
+ * Test that packing and unpacking arrays of normalized 16-bit vectors
+ * matches the scalar conversions exactly.
+ */
+BOOST_AUTO_TEST_CASE(TestVector3sBatch)
+{
+	std::vector<Vector3> in(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float f = static_cast<float>(i);
+		in[i] = Vector3(std::sin(1.3f * f), 1.2f * std::cos(0.7f * f), std::sin(0.31f * f));
+	}
+
+	std::vector<Vector3s> packed(count);
+	pack(in.data(), packed.data(), count);
+
+	std::vector<Vector3> unpacked(count);
+	unpack(packed.data(), unpacked.data(), count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Vector3s expected(in[i]);
+		BOOST_CHECK_EQUAL(packed[i].x, expected.x);
+		BOOST_CHECK_EQUAL(packed[i].y, expected.y);
+		BOOST_CHECK_EQUAL(packed[i].z, expected.z);
+		BOOST_CHECK(unpacked[i] == expected.unpack());
+	}
+}
+
+/**
+ * Test that the identity quaternion survives packing exactly.
+ */
+BOOST_AUTO_TEST_CASE(TestPackedQuaternionIdentity)
+{
+	BOOST_CHECK(PackedQuaternion32().unpack() == Quaternion());
+	BOOST_CHECK(PackedQuaternion48().unpack() == Quaternion());
+	BOOST_CHECK(PackedQuaternion32(Quaternion(-1.0f, 0.0f, 0.0f, 0.0f)).unpack() == Quaternion());
+	BOOST_CHECK(PackedQuaternion48(Quaternion(0.0f, 0.0f, -1.0f, 0.0f)).unpack() == Quaternion(0.0f, 0.0f, 1.0f, 0.0f));
+}
+
+/**
+ * Test the documented error bounds of the packed quaternions.
+ */
+BOOST_AUTO_TEST_CASE(TestPackedQuaternionError)
+{
+	float maxError32 = 0.0f;
+	float maxError48 = 0.0f;
+	for (std::size_t i = 0; i < 100000; ++i)
+	{
+		const Quaternion q = quaternion(i);
+
+		const Quaternion q32 = PackedQuaternion32(q).unpack();
+		maxError32 = std::max(maxError32, difference(q, q32));
+		BOOST_CHECK_CLOSE(q32.magnitude(), 1.0f, 1e-3f);
+
+		const Quaternion q48 = PackedQuaternion48(q).unpack();
+		maxError48 = std::max(maxError48, difference(q, q48));
+	}
+
+	BOOST_CHECK_LT(maxError32, 2e-3f);
+	BOOST_CHECK_LT(maxError48, 6e-5f);
+}
+
+/**
+ * Test that packing and unpacking arrays of quaternions agrees with the
+ * scalar operations.
+ */
+BOOST_AUTO_TEST_CASE(TestPackedQuaternionBatch)
+{
+	std::vector<Quaternion> in(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in[i] = quaternion(i);
+	}
+
+	std::vector<PackedQuaternion32> packed32(count);
+	std::vector<Quaternion> unpacked32(count);
+	pack(in.data(), packed32.data(), count);
+	unpack(packed32.data(), unpacked32.data(), count);
+
+	std::vector<PackedQuaternion48> packed48(count);
+	std::vector<Quaternion> unpacked48(count);
+	pack(in.data(), packed48.data(), count);
+	unpack(packed48.data(), unpacked48.data(), count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		// The index of the dropped component must agree, while a quantized
+		// component may differ by a rounding of the last bit.
+		BOOST_CHECK_EQUAL(packed32[i].bits >> 30, PackedQuaternion32(in[i]).bits >> 30);
+		BOOST_CHECK_EQUAL(packed48[i].bits[0] >> 13, PackedQuaternion48(in[i]).bits[0] >> 13);
+
+		BOOST_CHECK_SMALL(difference(unpacked32[i], PackedQuaternion32(in[i]).unpack()), 3e-3f);
+		BOOST_CHECK_SMALL(difference(unpacked32[i], packed32[i].unpack()), 1e-6f);
+		BOOST_CHECK_SMALL(difference(unpacked48[i], packed48[i].unpack()), 1e-6f);
+		BOOST_CHECK_SMALL(difference(unpacked48[i], in[i]), 6e-5f);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
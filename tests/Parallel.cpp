@@ -0,0 +1,267 @@
+#include <M3D/Parallel.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace M3D;
+
+namespace
+{
+	// Large enough to span many chunks, and not a multiple of the SIMD
+	// width, so that the last chunk has a scalar tail.
+	const std::size_t count = 20003;
+
+	// Thread counts to compare, including the single-threaded pool.
+	const std::size_t threadCounts[] = { 1, 2, 3, 8 };
+
+	/**
+	 * Returns a pseudo-random value in [-10, 10] for the index `i` and the
+	 * seed `k`.
+	 */
+	float value(std::size_t i, float k)
+	{
+		return 10.0f * std::sin(1.3f * static_cast<float>(i) + k);
+	}
+
+	/**
+	 * Returns whether two arrays are bitwise identical.
+	 */
+	template <typename Type>
+	bool identical(const std::vector<Type>& a, const std::vector<Type>& b)
+	{
+		return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(Type)) == 0;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(Parallel_Test_Suite)
+
+/**
+ * Test that the pool runs each task exactly once, for task counts both
+ * smaller and larger than the number of threads.
+ */
+BOOST_AUTO_TEST_CASE(TestRunEachTaskOnce)
+{
+	for (std::size_t threads : threadCounts)
+	{
+		parallel::ThreadPool pool(threads);
+		BOOST_CHECK_EQUAL(pool.threadCount(), threads);
+		for (std::size_t taskCount : { 0, 1, 5, 1000 })
+		{
+			std::vector< std::atomic<int> > calls(taskCount);
+			for (std::size_t i = 0; i < taskCount; ++i)
+			{
+				calls[i] = 0;
+			}
+
+			pool.run(taskCount, [&](std::size_t i) { ++calls[i]; });
+			for (std::size_t i = 0; i < taskCount; ++i)
+			{
+				BOOST_CHECK_EQUAL(calls[i].load(), 1);
+			}
+		}
+	}
+}
+
+/**
+ * Test that a pool can be reused for many short calls in succession.
+ */
+BOOST_AUTO_TEST_CASE(TestRepeatedRuns)
+{
+	parallel::ThreadPool pool(4);
+	std::atomic<std::size_t> total(0);
+	for (std::size_t k = 0; k < 2000; ++k)
+	{
+		pool.run(7, [&](std::size_t i) { total += i; });
+	}
+
+	BOOST_CHECK_EQUAL(total.load(), 2000u * 21u);
+}
+
+/**
+ * Test that a pool with a thread count of zero uses at least one thread.
+ */
+BOOST_AUTO_TEST_CASE(TestDefaultThreadCount)
+{
+	parallel::ThreadPool pool;
+	BOOST_CHECK(pool.threadCount() >= 1);
+}
+
+/**
+ * Test that forEach covers the range with chunks of the requested size.
+ */
+BOOST_AUTO_TEST_CASE(TestForEach)
+{
+	// The checks are made after the call, since the chunks run on the
+	// workers.
+	parallel::ThreadPool pool(3);
+	std::vector<int> covered(1000, 0);
+	std::atomic<bool> aligned(true);
+	parallel::forEach(pool, covered.size(), 64, [&](std::size_t first, std::size_t n)
+	{
+		if (first % 64 != 0 || (n != 64 && first + n != covered.size()))
+		{
+			aligned = false;
+		}
+
+		for (std::size_t i = first; i < first + n; ++i)
+		{
+			++covered[i];
+		}
+	});
+
+	BOOST_CHECK(aligned.load());
+	for (std::size_t i = 0; i < covered.size(); ++i)
+	{
+		BOOST_CHECK_EQUAL(covered[i], 1);
+	}
+}
+
+/**
+ * Test that the parallel transformation of vectors is bitwise identical to
+ * the serial transformation, whatever the number of threads, including in
+ * place.
+ */
+BOOST_AUTO_TEST_CASE(TestTransform)
+{
+	const Matrix4 A(1.0f, 2.0f, 3.0f, 4.0f,
+	                -5.0f, 6.0f, 7.0f, 8.0f,
+	                9.0f, 10.0f, -11.0f, 12.0f,
+	                0.1f, 0.2f, 0.3f, 1.0f);
+	std::vector<Vector4> in(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in[i] = Vector4(value(i, 0.0f), value(i, 1.0f), value(i, 2.0f), value(i, 3.0f));
+	}
+
+	std::vector<Vector4> expected(count);
+	transform(A, in.data(), expected.data(), count);
+	for (std::size_t threads : threadCounts)
+	{
+		parallel::ThreadPool pool(threads);
+		std::vector<Vector4> out(count);
+		parallel::transform(pool, A, in.data(), out.data(), count);
+		BOOST_CHECK(identical(out, expected));
+
+		out = in;
+		parallel::transform(pool, A, out.data(), out.data(), count);
+		BOOST_CHECK(identical(out, expected));
+	}
+}
+
+/**
+ * Test that the parallel rotations of vectors, by one quaternion and by one
+ * quaternion per vector, are bitwise identical to the serial rotations.
+ */
+BOOST_AUTO_TEST_CASE(TestRotate)
+{
+	const Quaternion q = Quaternion::euler(Vector3(0.3f, -0.2f, 1.1f));
+	std::vector<Quaternion> rotations(count);
+	std::vector<Vector3> in(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		rotations[i] = Quaternion::euler(Vector3(value(i, 4.0f), value(i, 5.0f), value(i, 6.0f)));
+		in[i] = Vector3(value(i, 0.0f), value(i, 1.0f), value(i, 2.0f));
+	}
+
+	std::vector<Vector3> expectedOne(count);
+	std::vector<Vector3> expectedEach(count);
+	rotate(q, in.data(), expectedOne.data(), count);
+	rotate(rotations.data(), in.data(), expectedEach.data(), count);
+	for (std::size_t threads : threadCounts)
+	{
+		parallel::ThreadPool pool(threads);
+		std::vector<Vector3> out(count);
+		parallel::rotate(pool, q, in.data(), out.data(), count);
+		BOOST_CHECK(identical(out, expectedOne));
+
+		parallel::rotate(pool, rotations.data(), in.data(), out.data(), count);
+		BOOST_CHECK(identical(out, expectedEach));
+	}
+}
+
+/**
+ * Test that the parallel product of matrix arrays matches the products of
+ * the individual matrices.
+ */
+BOOST_AUTO_TEST_CASE(TestMultiply)
+{
+	const std::size_t matrixCount = 5003;
+	std::vector<Matrix4> A(matrixCount);
+	std::vector<Matrix4> B(matrixCount);
+	std::vector<Matrix4> expected(matrixCount);
+	for (std::size_t i = 0; i < matrixCount; ++i)
+	{
+		A[i] = Matrix4::translation(Vector3(value(i, 0.0f), value(i, 1.0f), value(i, 2.0f)))
+			* Matrix4::euler(Vector3(value(i, 3.0f), value(i, 4.0f), value(i, 5.0f)));
+		B[i] = Matrix4::scaling(Vector3(value(i, 6.0f), value(i, 7.0f), value(i, 8.0f)));
+		expected[i] = A[i] * B[i];
+	}
+
+	for (std::size_t threads : threadCounts)
+	{
+		parallel::ThreadPool pool(threads);
+		std::vector<Matrix4> out(matrixCount);
+		parallel::multiply(pool, A.data(), B.data(), out.data(), matrixCount);
+		BOOST_CHECK(identical(out, expected));
+	}
+}
+
+/**
+ * Test that the parallel normalization of vectors matches the normalization
+ * of the individual vectors.
+ */
+BOOST_AUTO_TEST_CASE(TestNormalize)
+{
+	std::vector<Vector3> in3(count);
+	std::vector<Vector4> in4(count);
+	std::vector<Vector3> expected3(count);
+	std::vector<Vector4> expected4(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in3[i] = Vector3(value(i, 0.0f), value(i, 1.0f), value(i, 2.0f));
+		in4[i] = Vector4(value(i, 0.0f), value(i, 1.0f), value(i, 2.0f), value(i, 3.0f));
+		expected3[i] = in3[i].normalized();
+		expected4[i] = in4[i].normalized();
+	}
+
+	for (std::size_t threads : threadCounts)
+	{
+		parallel::ThreadPool pool(threads);
+		std::vector<Vector3> out3(count);
+		std::vector<Vector4> out4(count);
+		parallel::normalize(pool, in3.data(), out3.data(), count);
+		parallel::normalize(pool, in4.data(), out4.data(), count);
+		BOOST_CHECK(identical(out3, expected3));
+		BOOST_CHECK(identical(out4, expected4));
+	}
+}
+
+/**
+ * Test the double precision transformation.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	const Matrix4d A = Matrix4d::translation(Vector3d(1.0, -2.0, 3.0));
+	std::vector<Vector4d> in(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in[i] = Vector4d(value(i, 0.0f), value(i, 1.0f), value(i, 2.0f), 1.0);
+	}
+
+	std::vector<Vector4d> expected(count);
+	transform(A, in.data(), expected.data(), count);
+
+	parallel::ThreadPool pool(4);
+	std::vector<Vector4d> out(count);
+	parallel::transform(pool, A, in.data(), out.data(), count);
+	BOOST_CHECK(identical(out, expected));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
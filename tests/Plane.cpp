@@ -0,0 +1,53 @@
+#include <M3D/Plane.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace M3D;
+
+BOOST_AUTO_TEST_SUITE(Plane_Test_Suite)
+
+/**
+ * Test the constructors.
+ */
+BOOST_AUTO_TEST_CASE(TestConstructors)
+{
+	const Plane a;
+	BOOST_CHECK_EQUAL(a.normal, Vector3(0.0f, 1.0f, 0.0f));
+	BOOST_CHECK_EQUAL(a.distance, 0.0f);
+
+	// The plane z = 2 with normal +z, constructed in each of the ways.
+	const Plane b(Vector3(0.0f, 0.0f, 1.0f), -2.0f);
+	const Plane c(Vector3(0.0f, 0.0f, 1.0f), Vector3(5.0f, -3.0f, 2.0f));
+	const Plane d(Vector3(0.0f, 0.0f, 2.0f), Vector3(1.0f, 0.0f, 2.0f), Vector3(0.0f, 1.0f, 2.0f));
+	const Plane e(Vector4(0.0f, 0.0f, 3.0f, -6.0f));
+	BOOST_CHECK_EQUAL(c, b);
+	BOOST_CHECK_EQUAL(d, b);
+	BOOST_CHECK_EQUAL(e, b);
+
+	// Reversing the winding order of the points flips the normal.
+	const Plane f(Vector3(0.0f, 0.0f, 2.0f), Vector3(0.0f, 1.0f, 2.0f), Vector3(1.0f, 0.0f, 2.0f));
+	BOOST_CHECK_EQUAL(f, b.flipped());
+	BOOST_CHECK(f != b);
+
+	const Planed g(b);
+	BOOST_CHECK_EQUAL(Plane(g), b);
+}
+
+/**
+ * Test the signed distance and closest point of a point.
+ */
+BOOST_AUTO_TEST_CASE(TestSignedDistance)
+{
+	const Plane plane(Vector3(1.0f, 2.0f, 2.0f) / 3.0f, Vector3(1.0f, 1.0f, 1.0f));
+
+	BOOST_CHECK_CLOSE(plane.signedDistance(Vector3(2.0f, 3.0f, 3.0f)), 3.0f, 1e-4f);
+	BOOST_CHECK_CLOSE(plane.signedDistance(Vector3(0.0f, -1.0f, -1.0f)), -3.0f, 1e-4f);
+	BOOST_CHECK_SMALL(plane.signedDistance(Vector3(3.0f, 0.0f, 1.0f)), 1e-6f);
+	BOOST_CHECK_CLOSE(plane.flipped().signedDistance(Vector3(2.0f, 3.0f, 3.0f)), -3.0f, 1e-4f);
+
+	BOOST_CHECK_EQUAL(plane.closestPoint(Vector3(2.0f, 3.0f, 3.0f)), Vector3(1.0f, 1.0f, 1.0f));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
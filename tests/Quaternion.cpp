@@ -509,4 +509,197 @@ BOOST_AUTO_TEST_CASE(TestRotateTowards3)
 	BOOST_CHECK_EQUAL(from, Quaternion::lookRotation(Vector3::BACK, Vector3::UP));
 }
 
+/**
+ * Test that rotating an array of vectors by a single quaternion matches
+ * rotating each vector individually.
+ */
+BOOST_AUTO_TEST_CASE(TestRotateVectors)
+{
+	const std::size_t count = 27;
+	const Quaternion q = Quaternion::euler(Vector3(0.3f, -1.2f, 0.7f));
+
+	Vector3 in[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		in[i] = Vector3(0.5f * i, 1.0f - i, 0.25f * i - 2.0f);
+	}
+
+	Vector3 out[count];
+	rotate(q, in, out, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const Vector3 expected = q * in[i];
+		BOOST_CHECK_SMALL(out[i].x - expected.x, 1e-4f);
+		BOOST_CHECK_SMALL(out[i].y - expected.y, 1e-4f);
+		BOOST_CHECK_SMALL(out[i].z - expected.z, 1e-4f);
+	}
+}
+
+/**
+ * Test that rotating an array of vectors by an array of quaternions matches
+ * rotating each vector individually, in place.
+ */
+BOOST_AUTO_TEST_CASE(TestRotateVectorsByQuaternions)
+{
+	const std::size_t count = 19;
+
+	Quaternion q[count];
+	Vector3 v[count];
+	Vector3 expected[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		q[i] = Quaternion::euler(Vector3(0.1f * i, -0.2f * i, 0.3f + 0.05f * i));
+		v[i] = Vector3(1.0f - 0.5f * i, 0.25f * i, 2.0f);
+		expected[i] = q[i] * v[i];
+	}
+
+	rotate(q, v, v, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_SMALL(v[i].x - expected[i].x, 1e-4f);
+		BOOST_CHECK_SMALL(v[i].y - expected[i].y, 1e-4f);
+		BOOST_CHECK_SMALL(v[i].z - expected[i].z, 1e-4f);
+	}
+}
+
+/**
+ * Test that nlerp returns the end points and takes the shortest path.
+ */
+BOOST_AUTO_TEST_CASE(TestNlerp)
+{
+	const Quaternion q1 = Quaternion::angleAxis(0.2f, Vector3::UP);
+	const Quaternion q2 = Quaternion::angleAxis(1.4f, Vector3::UP);
+	const Quaternion q3(-q2.w, -q2.x, -q2.y, -q2.z);
+
+	BOOST_CHECK_EQUAL(nlerp(q1, q2, 0.0f), q1);
+	BOOST_CHECK_EQUAL(nlerp(q1, q2, 1.0f), q2);
+	BOOST_CHECK_EQUAL(nlerp(q1, q2, 0.5f), Quaternion::angleAxis(0.8f, Vector3::UP));
+	BOOST_CHECK_EQUAL(nlerp(q1, q3, 0.5f), Quaternion::angleAxis(0.8f, Vector3::UP));
+}
+
+/**
+ * Test that slerp returns the end points and interpolates with constant
+ * angular velocity.
+ */
+BOOST_AUTO_TEST_CASE(TestSlerp)
+{
+	const Vector3 axis = Vector3(1.0f, -2.0f, 0.5f).normalized();
+	const Quaternion q1 = Quaternion::angleAxis(-0.5f, axis);
+	const Quaternion q2 = Quaternion::angleAxis(2.5f, axis);
+
+	BOOST_CHECK_EQUAL(slerp(q1, q2, 0.0f), q1);
+	BOOST_CHECK_EQUAL(slerp(q1, q2, 1.0f), q2);
+
+	for (int i = 0; i <= 10; ++i)
+	{
+		const float t = 0.1f * i;
+		const Quaternion q = slerp(q1, q2, t);
+		const Quaternion expected = Quaternion::angleAxis(-0.5f + 3.0f * t, axis);
+
+		BOOST_CHECK_SMALL(q.w - expected.w, 1e-5f);
+		BOOST_CHECK_SMALL(q.x - expected.x, 1e-5f);
+		BOOST_CHECK_SMALL(q.y - expected.y, 1e-5f);
+		BOOST_CHECK_SMALL(q.z - expected.z, 1e-5f);
+	}
+}
+
+/**
+ * Test that slerp takes the shortest path and handles identical quaternions.
+ */
+BOOST_AUTO_TEST_CASE(TestSlerpShortestPath)
+{
+	const Quaternion q1 = Quaternion::angleAxis(0.3f, Vector3::RIGHT);
+	const Quaternion q2 = Quaternion::angleAxis(0.9f, Vector3::RIGHT);
+	const Quaternion q3(-q2.w, -q2.x, -q2.y, -q2.z);
+
+	BOOST_CHECK_EQUAL(slerp(q1, q3, 0.5f), Quaternion::angleAxis(0.6f, Vector3::RIGHT));
+	BOOST_CHECK_EQUAL(slerp(q1, q1, 0.5f), q1);
+}
+
+/**
+ * Test that squad returns the end points, and reduces to slerp when the
+ * control points are the keys themselves.
+ */
+BOOST_AUTO_TEST_CASE(TestSquad)
+{
+	const Quaternion q1 = Quaternion::euler(Vector3(0.1f, 0.5f, -0.3f));
+	const Quaternion q2 = Quaternion::euler(Vector3(0.8f, -0.2f, 0.4f));
+	const Quaternion s1 = Quaternion::euler(Vector3(0.3f, 0.6f, -0.1f));
+	const Quaternion s2 = Quaternion::euler(Vector3(0.6f, -0.1f, 0.2f));
+
+	BOOST_CHECK_EQUAL(squad(q1, q2, s1, s2, 0.0f), q1);
+	BOOST_CHECK_EQUAL(squad(q1, q2, s1, s2, 1.0f), q2);
+	BOOST_CHECK_EQUAL(squad(q1, q2, q1, q2, 0.3f), slerp(q1, q2, 0.3f));
+}
+
+/**
+ * Test that the squad control points of keys rotating at a constant rate
+ * about a single axis are the keys themselves, so that squad reproduces the
+ * constant rotation.
+ */
+BOOST_AUTO_TEST_CASE(TestSquadControlPoint)
+{
+	const Quaternion q0 = Quaternion::angleAxis(0.2f, Vector3::FORWARD);
+	const Quaternion q1 = Quaternion::angleAxis(0.7f, Vector3::FORWARD);
+	const Quaternion q2 = Quaternion::angleAxis(1.2f, Vector3::FORWARD);
+	const Quaternion q3 = Quaternion::angleAxis(1.7f, Vector3::FORWARD);
+
+	const Quaternion s1 = squadControlPoint(q0, q1, q2);
+	const Quaternion s2 = squadControlPoint(q1, q2, q3);
+
+	BOOST_CHECK_EQUAL(s1, q1);
+	BOOST_CHECK_EQUAL(s2, q2);
+	BOOST_CHECK_EQUAL(squad(q1, q2, s1, s2, 0.4f), Quaternion::angleAxis(0.9f, Vector3::FORWARD));
+}
+
+/**
+ * Test that the batch slerp approximation is close to the exact slerp, for
+ * pairs at a range of angles and in either hemisphere.
+ */
+BOOST_AUTO_TEST_CASE(TestSlerpBatch)
+{
+	const std::size_t count = 37;
+
+	Quaternion from[count];
+	Quaternion to[count];
+	float factors[count];
+	Quaternion expected[count];
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		from[i] = Quaternion::euler(Vector3(0.1f * i, -0.2f * i, 0.3f + 0.05f * i));
+		to[i] = Quaternion::euler(Vector3(0.3f - 0.15f * i, 0.1f * i, -0.02f * i));
+		if (i % 3 == 0) to[i] = Quaternion(-to[i].w, -to[i].x, -to[i].y, -to[i].z);
+		if (i % 7 == 0) to[i] = from[i];
+		factors[i] = static_cast<float>(i % 11) / 10.0f;
+		expected[i] = slerp(from[i], to[i], factors[i]);
+	}
+
+	slerp(from, to, factors, from, count);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_SMALL(from[i].w - expected[i].w, 5e-5f);
+		BOOST_CHECK_SMALL(from[i].x - expected[i].x, 5e-5f);
+		BOOST_CHECK_SMALL(from[i].y - expected[i].y, 5e-5f);
+		BOOST_CHECK_SMALL(from[i].z - expected[i].z, 5e-5f);
+	}
+}
+
+/**
+ * Test that quaternions can be constructed and multiplied in constant
+ * expressions.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	// A half turn about the z-axis, applied twice, is the negated identity.
+	constexpr Quaternion q(0.0f, 0.0f, 0.0f, 1.0f);
+	constexpr Quaternion qq = q * q;
+	static_assert(qq.w == -1.0f && qq.z == 0.0f, "Quaternion products should be constexpr");
+	static_assert((q * Vector3::RIGHT).x == -1.0f, "Rotation should be constexpr");
+	static_assert(dot(Quaternion::IDENTITY, q.conjugate()) == 0.0f, "dot() should be constexpr");
+	BOOST_CHECK_EQUAL(qq, Quaternion(-1.0f, 0.0f, 0.0f, 0.0f));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,387 @@
+#include "TestUtilities.hpp"
+
+#include <M3D/Ray.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Plane.hpp>
+#include <M3D/Sphere.hpp>
+#include <M3D/Triangle.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace M3D;
+using namespace M3D::test;
+
+namespace
+{
+	/**
+	 * Number of primitives or rays in the batch tests.
+	 */
+	const std::size_t COUNT = 43;
+
+	/**
+	 * Returns the ray from the origin towards point(i, 5, 4).
+	 */
+	Ray ray(std::size_t i)
+	{
+		return Ray(Vector3(0.1f, -0.2f, 0.3f), point(i, 5.0f, 4.0f) - Vector3(0.1f, -0.2f, 0.3f));
+	}
+
+	/**
+	 * Checks that the distance `actual` computed by a batch intersection
+	 * matches the result of the scalar intersection.
+	 *
+	 * Intersections within a small distance of an edge or a tangent may be
+	 * decided differently by the two, so these are skipped.
+	 */
+	template <typename Primitive>
+	void checkDistance(const Ray& r, const Primitive& primitive, float actual, std::size_t& hits)
+	{
+		float expected;
+		if (r.intersects(primitive, expected))
+		{
+			BOOST_CHECK_CLOSE(actual, expected, 1e-3f);
+			++hits;
+		}
+		else
+		{
+			BOOST_CHECK_EQUAL(actual, std::numeric_limits<float>::infinity());
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(Ray_Test_Suite)
+
+/**
+ * Test the default constructor and the point at a parameter.
+ */
+BOOST_AUTO_TEST_CASE(TestPointAt)
+{
+	const Ray a;
+	BOOST_CHECK_EQUAL(a.origin, Vector3(0.0f, 0.0f, 0.0f));
+	BOOST_CHECK_EQUAL(a.direction, Vector3(0.0f, 0.0f, 1.0f));
+
+	const Ray b(Vector3(1.0f, 2.0f, 3.0f), Vector3(0.0f, 2.0f, 0.0f));
+	BOOST_CHECK_EQUAL(b.pointAt(1.5f), Vector3(1.0f, 5.0f, 3.0f));
+	BOOST_CHECK_EQUAL(Ray(Rayd(b)), b);
+	BOOST_CHECK(a != b);
+}
+
+/**
+ * Test the ray/plane intersection.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectsPlane)
+{
+	const Plane plane(Vector3(0.0f, 1.0f, 0.0f), -2.0f);
+	float t = -1.0f;
+
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 4.0f, 0.0f)).intersects(plane, t));
+	BOOST_CHECK_CLOSE(t, 0.5f, 1e-4f);
+	BOOST_CHECK(Ray(Vector3(1.0f, 5.0f, 0.0f), Vector3(1.0f, -1.0f, 0.0f)).intersects(plane, t));
+	BOOST_CHECK_CLOSE(t, 3.0f, 1e-4f);
+
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f)).intersects(plane, t));
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f)).intersects(plane, t));
+}
+
+/**
+ * Test the ray/sphere intersection, from outside and inside the sphere.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectsSphere)
+{
+	const Sphere sphere(Vector3(0.0f, 0.0f, -5.0f), 1.0f);
+	float t = -1.0f;
+
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, -2.0f)).intersects(sphere, t));
+	BOOST_CHECK_CLOSE(t, 2.0f, 1e-4f);
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, -5.0f), Vector3(1.0f, 0.0f, 0.0f)).intersects(sphere, t));
+	BOOST_CHECK_EQUAL(t, 0.0f);
+
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)).intersects(sphere, t));
+	BOOST_CHECK(!Ray(Vector3(0.0f, 1.5f, 0.0f), Vector3(0.0f, 0.0f, -1.0f)).intersects(sphere, t));
+}
+
+/**
+ * Test the ray/box intersection, including rays parallel to the slabs.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectsBox)
+{
+	const AABB box(Vector3(-1.0f, -1.0f, -6.0f), Vector3(1.0f, 1.0f, -4.0f));
+	float t = -1.0f;
+
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f)).intersects(box, t));
+	BOOST_CHECK_CLOSE(t, 4.0f, 1e-4f);
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.1f, 0.1f, -1.0f)).intersects(box, t));
+	BOOST_CHECK_CLOSE(t, 4.0f, 1e-4f);
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, -5.0f), Vector3(0.0f, 1.0f, 0.0f)).intersects(box, t));
+	BOOST_CHECK_EQUAL(t, 0.0f);
+
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)).intersects(box, t));
+	BOOST_CHECK(!Ray(Vector3(0.0f, 2.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f)).intersects(box, t));
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, -1.0f)).intersects(box, t));
+}
+
+/**
+ * Test the ray/triangle intersection, from both sides of the triangle.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectsTriangle)
+{
+	const Triangle triangle(Vector3(-1.0f, -1.0f, -3.0f), Vector3(1.0f, -1.0f, -3.0f), Vector3(0.0f, 1.0f, -3.0f));
+	float t = -1.0f;
+
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f)).intersects(triangle, t));
+	BOOST_CHECK_CLOSE(t, 3.0f, 1e-4f);
+	BOOST_CHECK(Ray(Vector3(0.0f, 0.0f, -6.0f), Vector3(0.0f, 0.0f, 2.0f)).intersects(triangle, t));
+	BOOST_CHECK_CLOSE(t, 1.5f, 1e-4f);
+
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)).intersects(triangle, t));
+	BOOST_CHECK(!Ray(Vector3(0.9f, 0.9f, 0.0f), Vector3(0.0f, 0.0f, -1.0f)).intersects(triangle, t));
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f)).intersects(triangle, t));
+	BOOST_CHECK(!Ray(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f)).intersects(
+		Triangle(Vector3(0.0f, 0.0f, -3.0f), Vector3(1.0f, 1.0f, -3.0f), Vector3(2.0f, 2.0f, -3.0f)), t));
+}
+
+/**
+ * Test that the intersection of one ray with arrays of triangles matches the
+ * scalar test, for counts that exercise the vectorised loops and the
+ * remainders.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectTriangles)
+{
+	std::vector<float> axs(COUNT), ays(COUNT), azs(COUNT), bxs(COUNT), bys(COUNT), bzs(COUNT), cxs(COUNT), cys(COUNT), czs(COUNT);
+	std::vector<Triangle> triangles(COUNT);
+	for (std::size_t i = 0; i < COUNT; ++i)
+	{
+		// Large triangles about the line of the ray, so that some are hit.
+		const Vector3 a = point(i, 0.0f, 4.0f), b = -a + point(i, 1.0f, 4.0f) * 0.5f, c = -a + point(i, 2.0f, 4.0f) * 0.5f;
+		triangles[i] = Triangle(a, b + Vector3(0.0f, 0.0f, -3.0f), c);
+		axs[i] = triangles[i].a.x; ays[i] = triangles[i].a.y; azs[i] = triangles[i].a.z;
+		bxs[i] = triangles[i].b.x; bys[i] = triangles[i].b.y; bzs[i] = triangles[i].b.z;
+		cxs[i] = triangles[i].c.x; cys[i] = triangles[i].c.y; czs[i] = triangles[i].c.z;
+	}
+
+	const Ray r = ray(0);
+	std::size_t hits = 0;
+	for (std::size_t n = 0; n <= COUNT; ++n)
+	{
+		std::vector<float> distances(n + 1, -1.0f);
+		intersectTriangles(r, axs.data(), ays.data(), azs.data(), bxs.data(), bys.data(), bzs.data(),
+			cxs.data(), cys.data(), czs.data(), distances.data(), n);
+
+		hits = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			checkDistance(r, triangles[i], distances[i], hits);
+		}
+
+		BOOST_CHECK_EQUAL(distances[n], -1.0f);
+	}
+
+	BOOST_CHECK(hits > 0 && hits < COUNT);
+}
+
+/**
+ * Test that the intersection of one ray with arrays of boxes matches the
+ * scalar test.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectBoxes)
+{
+	std::vector<float> minXs(COUNT), minYs(COUNT), minZs(COUNT), maxXs(COUNT), maxYs(COUNT), maxZs(COUNT);
+	std::vector<AABB> boxes(COUNT);
+	for (std::size_t i = 0; i < COUNT; ++i)
+	{
+		const Vector3 halfExtents(1.5f, 1.5f, 1.5f);
+		boxes[i] = AABB(point(i, 0.0f, 4.0f) - halfExtents, point(i, 0.0f, 4.0f) + halfExtents + point(i, 1.0f, 4.0f) * 0.25f);
+		minXs[i] = boxes[i].min.x; minYs[i] = boxes[i].min.y; minZs[i] = boxes[i].min.z;
+		maxXs[i] = boxes[i].max.x; maxYs[i] = boxes[i].max.y; maxZs[i] = boxes[i].max.z;
+	}
+
+	// Include a ray parallel to a pair of slabs.
+	const Ray rays[] = { ray(0), ray(3), Ray(Vector3(0.5f, 0.5f, 0.5f), Vector3(0.0f, 1.0f, 0.0f)) };
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		std::size_t hits = 0;
+		for (std::size_t n = 0; n <= COUNT; ++n)
+		{
+			std::vector<float> distances(n);
+			intersectBoxes(rays[k], minXs.data(), minYs.data(), minZs.data(), maxXs.data(), maxYs.data(), maxZs.data(),
+				distances.data(), n);
+
+			hits = 0;
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				checkDistance(rays[k], boxes[i], distances[i], hits);
+			}
+		}
+
+		BOOST_CHECK(hits > 0 && hits < COUNT);
+	}
+}
+
+/**
+ * Test that the intersection of one ray with arrays of spheres matches the
+ * scalar test.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectSpheres)
+{
+	std::vector<float> xs(COUNT), ys(COUNT), zs(COUNT), radii(COUNT);
+	std::vector<Sphere> spheres(COUNT);
+	for (std::size_t i = 0; i < COUNT; ++i)
+	{
+		spheres[i] = Sphere(point(i, 0.0f, 4.0f), 1.0f + 0.5f * std::sin(2.1f * static_cast<float>(i)));
+		xs[i] = spheres[i].center.x; ys[i] = spheres[i].center.y; zs[i] = spheres[i].center.z;
+		radii[i] = spheres[i].radius;
+	}
+
+	const Ray r = ray(0);
+	std::size_t hits = 0;
+	for (std::size_t n = 0; n <= COUNT; ++n)
+	{
+		std::vector<float> distances(n);
+		intersectSpheres(r, xs.data(), ys.data(), zs.data(), radii.data(), distances.data(), n);
+
+		hits = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			checkDistance(r, spheres[i], distances[i], hits);
+		}
+	}
+
+	BOOST_CHECK(hits > 0 && hits < COUNT);
+}
+
+/**
+ * Test that the intersection of arrays of rays with a triangle, a box and a
+ * sphere matches the scalar tests.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectRays)
+{
+	std::vector<float> oxs(COUNT), oys(COUNT), ozs(COUNT), dxs(COUNT), dys(COUNT), dzs(COUNT);
+	std::vector<Ray> rays(COUNT);
+	for (std::size_t i = 0; i < COUNT; ++i)
+	{
+		rays[i] = Ray(point(i, 0.0f, 4.0f), point(i, 7.0f, 4.0f) * 0.25f - point(i, 0.0f, 4.0f));
+		oxs[i] = rays[i].origin.x; oys[i] = rays[i].origin.y; ozs[i] = rays[i].origin.z;
+		dxs[i] = rays[i].direction.x; dys[i] = rays[i].direction.y; dzs[i] = rays[i].direction.z;
+	}
+
+	const Triangle triangle(Vector3(-2.0f, -2.0f, 0.5f), Vector3(2.0f, -1.0f, 0.0f), Vector3(0.0f, 2.0f, -0.5f));
+	const AABB box(Vector3(-1.0f, -0.5f, -1.0f), Vector3(0.5f, 1.0f, 1.0f));
+	const Sphere sphere(Vector3(0.2f, 0.1f, -0.3f), 0.75f);
+
+	std::size_t triangleHits = 0, boxHits = 0, sphereHits = 0;
+	for (std::size_t n = 0; n <= COUNT; ++n)
+	{
+		std::vector<float> triangleDistances(n), boxDistances(n), sphereDistances(n);
+		intersectRays(oxs.data(), oys.data(), ozs.data(), dxs.data(), dys.data(), dzs.data(), triangle, triangleDistances.data(), n);
+		intersectRays(oxs.data(), oys.data(), ozs.data(), dxs.data(), dys.data(), dzs.data(), box, boxDistances.data(), n);
+		intersectRays(oxs.data(), oys.data(), ozs.data(), dxs.data(), dys.data(), dzs.data(), sphere, sphereDistances.data(), n);
+
+		triangleHits = boxHits = sphereHits = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			checkDistance(rays[i], triangle, triangleDistances[i], triangleHits);
+			checkDistance(rays[i], box, boxDistances[i], boxHits);
+			checkDistance(rays[i], sphere, sphereDistances[i], sphereHits);
+		}
+	}
+
+	BOOST_CHECK(triangleHits > 0 && triangleHits < COUNT);
+	BOOST_CHECK(boxHits > 0 && boxHits < COUNT);
+	BOOST_CHECK(sphereHits > 0 && sphereHits < COUNT);
+}
+
+/**
+ * Test that the batch box intersections match the scalar test for rays that
+ * are parallel to a face of the box and lie on it, for which the slab test
+ * computes zero times infinity. Such rays hit the closed box.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersectBoxFaces)
+{
+	const AABB box(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f));
+
+	// Rays on each face, in both directions parallel to it and with either
+	// sign of zero in the direction, half of which pass beside the box.
+	const std::size_t count = 48;
+	std::vector<float> oxs(count), oys(count), ozs(count), dxs(count), dys(count), dzs(count);
+	std::vector<Ray> rays(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const std::size_t axis = i % 3;
+		const std::size_t along = (axis + 1 + (i / 3) % 2) % 3;
+		const std::size_t across = 3 - axis - along;
+		float origin[3], direction[3];
+		origin[axis] = static_cast<float>((i / 6) % 2);
+		origin[along] = (i / 12) % 2 == 0 ? -1.0f : 2.0f;
+		origin[across] = i < count / 2 ? 0.5f : 1.5f;
+		direction[axis] = (i / 12) % 2 == 0 ? 0.0f : -0.0f;
+		direction[along] = (i / 12) % 2 == 0 ? 1.0f : -1.0f;
+		direction[across] = 0.0f;
+
+		rays[i] = Ray(Vector3(origin[0], origin[1], origin[2]), Vector3(direction[0], direction[1], direction[2]));
+		oxs[i] = origin[0]; oys[i] = origin[1]; ozs[i] = origin[2];
+		dxs[i] = direction[0]; dys[i] = direction[1]; dzs[i] = direction[2];
+
+		float t = -1.0f;
+		BOOST_CHECK_EQUAL(rays[i].intersects(box, t), i < count / 2);
+		BOOST_CHECK(i >= count / 2 || t == 1.0f);
+	}
+
+	std::vector<float> distances(count);
+	intersectRays(oxs.data(), oys.data(), ozs.data(), dxs.data(), dys.data(), dzs.data(), box, distances.data(), count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		BOOST_CHECK_EQUAL(distances[i], i < count / 2 ? 1.0f : std::numeric_limits<float>::infinity());
+	}
+
+	// One ray against boxes that it lies on a face of, passes through or
+	// misses.
+	const float offsets[] = { 0.0f, 1.0f, -1.0f, 0.5f, 2.0f, 0.0f, 1.0f, 0.25f, -0.5f };
+	const std::size_t boxCount = sizeof(offsets) / sizeof(offsets[0]);
+	std::vector<float> minXs(boxCount), minYs(boxCount, 0.0f), minZs(boxCount, 0.0f);
+	std::vector<float> maxXs(boxCount), maxYs(boxCount, 1.0f), maxZs(boxCount, 1.0f);
+	for (std::size_t i = 0; i < boxCount; ++i)
+	{
+		minXs[i] = offsets[i];
+		maxXs[i] = offsets[i] + 1.0f;
+	}
+
+	const Ray r(Vector3(1.0f, 0.5f, -1.0f), Vector3(0.0f, 0.0f, 1.0f));
+	std::vector<float> boxDistances(boxCount);
+	intersectBoxes(r, minXs.data(), minYs.data(), minZs.data(), maxXs.data(), maxYs.data(), maxZs.data(),
+		boxDistances.data(), boxCount);
+	for (std::size_t i = 0; i < boxCount; ++i)
+	{
+		float t;
+		const AABB b(Vector3(minXs[i], 0.0f, 0.0f), Vector3(maxXs[i], 1.0f, 1.0f));
+		const bool hit = r.intersects(b, t);
+		BOOST_CHECK_EQUAL(hit, offsets[i] >= 0.0f && offsets[i] <= 1.0f);
+		BOOST_CHECK_EQUAL(boxDistances[i], hit ? t : std::numeric_limits<float>::infinity());
+	}
+}
+
+/**
+ * Test the double precision batch intersections.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	const Rayd r(Vector3d(0.0, 0.0, 0.0), Vector3d(0.0, 0.0, -1.0));
+
+	const double axs[] = { -1.0, -1.0 }, ays[] = { -1.0, 5.0 }, azs[] = { -3.0, -3.0 };
+	const double bxs[] = { 1.0, 1.0 }, bys[] = { -1.0, 5.0 }, bzs[] = { -3.0, -3.0 };
+	const double cxs[] = { 0.0, 0.0 }, cys[] = { 1.0, 7.0 }, czs[] = { -3.0, -3.0 };
+	double distances[2];
+	intersectTriangles(r, axs, ays, azs, bxs, bys, bzs, cxs, cys, czs, distances, 2);
+	BOOST_CHECK_CLOSE(distances[0], 3.0, 1e-10);
+	BOOST_CHECK_EQUAL(distances[1], std::numeric_limits<double>::infinity());
+
+	const double xs[] = { 0.0, 3.0 }, ys[] = { 0.0, 0.0 }, zs[] = { -5.0, -5.0 }, radii[] = { 1.0, 1.0 };
+	intersectSpheres(r, xs, ys, zs, radii, distances, 2);
+	BOOST_CHECK_CLOSE(distances[0], 4.0, 1e-10);
+	BOOST_CHECK_EQUAL(distances[1], std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,46 @@
+#include <M3D/Sphere.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace M3D;
+
+BOOST_AUTO_TEST_SUITE(Sphere_Test_Suite)
+
+/**
+ * Test the point, sphere and box tests.
+ */
+BOOST_AUTO_TEST_CASE(TestIntersects)
+{
+	const Sphere sphere(Vector3(1.0f, 2.0f, 3.0f), 2.0f);
+
+	BOOST_CHECK(sphere.contains(Vector3(1.0f, 2.0f, 3.0f)));
+	BOOST_CHECK(sphere.contains(Vector3(2.0f, 3.0f, 4.0f)));
+	BOOST_CHECK(!sphere.contains(Vector3(3.0f, 3.0f, 3.0f)));
+
+	BOOST_CHECK(sphere.intersects(Sphere(Vector3(4.0f, 2.0f, 3.0f), 1.5f)));
+	BOOST_CHECK(!sphere.intersects(Sphere(Vector3(4.0f, 2.0f, 3.0f), 0.5f)));
+
+	// The nearest corner of the first box is sqrt(3) from the center, and
+	// that of the second is sqrt(6).
+	BOOST_CHECK(sphere.intersects(AABB(Vector3(2.0f, 3.0f, 4.0f), Vector3(5.0f, 5.0f, 5.0f))));
+	BOOST_CHECK(!sphere.intersects(AABB(Vector3(2.0f, 4.0f, 4.0f), Vector3(5.0f, 5.0f, 5.0f))));
+	BOOST_CHECK(sphere.intersects(AABB(Vector3(0.0f, 0.0f, 0.0f), Vector3(10.0f, 10.0f, 10.0f))));
+}
+
+/**
+ * Test the bounding box and the precision conversions.
+ */
+BOOST_AUTO_TEST_CASE(TestBounds)
+{
+	const Sphere sphere(Vector3(1.0f, 2.0f, 3.0f), 2.0f);
+	const AABB bounds = sphere.bounds();
+
+	BOOST_CHECK_EQUAL(bounds.min, Vector3(-1.0f, 0.0f, 1.0f));
+	BOOST_CHECK_EQUAL(bounds.max, Vector3(3.0f, 4.0f, 5.0f));
+	BOOST_CHECK_EQUAL(Sphere(Sphered(sphere)), sphere);
+	BOOST_CHECK(Sphere() != sphere);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
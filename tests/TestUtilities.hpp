@@ -0,0 +1,173 @@
+#ifndef TESTUTILITIES_HPP
+#define TESTUTILITIES_HPP
+
+#include <M3D/AABB.hpp>
+#include <M3D/Affine3.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+#include <M3D/Vector4.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace M3D
+{
+	/**
+	 * Helpers shared by the unit tests.
+	 */
+	namespace test
+	{
+		/**
+		 * Advances the linear congruential generator `seed` and returns a
+		 * pseudo-random value in [-1, 1]. The same sequence of seeds always
+		 * produces the same values, on every platform.
+		 */
+		inline float randomValue(unsigned int& seed)
+		{
+			seed = seed * 1103515245u + 12345u;
+			return static_cast<float>((seed >> 16) % 2001) / 1000.0f - 1.0f;
+		}
+
+		/**
+		 * Returns a well conditioned pseudo-random matrix. The same `seed`
+		 * always produces the same matrix.
+		 */
+		inline Matrix4 randomMatrix(unsigned int seed)
+		{
+			float arr[16];
+			for (std::size_t i = 0; i < 16; ++i) arr[i] = randomValue(seed);
+
+			// Make the matrix diagonally dominant so that it is invertible.
+			for (std::size_t i = 0; i < 16; i += 5) arr[i] += 4.0f;
+
+			return Matrix4(arr);
+		}
+
+		/**
+		 * Returns a well conditioned pseudo-random affine transformation.
+		 * The same `seed` always produces the same transformation.
+		 */
+		inline Affine3 randomAffine(unsigned int seed)
+		{
+			float arr[12];
+			for (std::size_t i = 0; i < 12; ++i) arr[i] = randomValue(seed);
+
+			// Make the linear part diagonally dominant so that it is
+			// invertible.
+			for (std::size_t i = 0; i < 12; i += 5) arr[i] += 4.0f;
+
+			return Affine3(arr);
+		}
+
+		/**
+		 * Returns whether a pointer is a multiple of the alignment.
+		 */
+		inline bool isAligned(const void* pointer, std::size_t alignment)
+		{
+			return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+		}
+
+		/**
+		 * Returns a pseudo-random point in the box [-`extent`, `extent`]^3 for
+		 * the index `i` and the seed `k`.
+		 */
+		inline Vector3 point(std::size_t i, float k, float extent)
+		{
+			const float f = static_cast<float>(i) + k;
+			return Vector3(extent * std::sin(1.3f * f), extent * std::cos(0.7f * f), extent * std::sin(0.31f * f + 1.0f));
+		}
+
+		/**
+		 * Returns the greatest difference between the components of `a` and
+		 * those of `b` or its negation, whichever is closer, as both
+		 * represent the same rotation.
+		 */
+		inline float difference(const Quaternion& a, const Quaternion& b)
+		{
+			const float positive = std::max(
+				std::max(std::abs(a.w - b.w), std::abs(a.x - b.x)),
+				std::max(std::abs(a.y - b.y), std::abs(a.z - b.z)));
+			const float negative = std::max(
+				std::max(std::abs(a.w + b.w), std::abs(a.x + b.x)),
+				std::max(std::abs(a.y + b.y), std::abs(a.z + b.z)));
+			return std::min(positive, negative);
+		}
+
+		/**
+		 * Returns the greatest difference between the components of `a` and
+		 * those of `b`.
+		 */
+		inline float difference(const Vector3& a, const Vector3& b)
+		{
+			return std::max(std::max(std::abs(a.x - b.x), std::abs(a.y - b.y)), std::abs(a.z - b.z));
+		}
+
+		/**
+		 * Checks that each of the components of `u` is within `tolerance` of
+		 * the corresponding component of `v`.
+		 */
+		template <typename T>
+		void checkClose(const TVector3<T>& u, const TVector3<T>& v, T tolerance)
+		{
+			BOOST_CHECK_SMALL(u.x - v.x, tolerance);
+			BOOST_CHECK_SMALL(u.y - v.y, tolerance);
+			BOOST_CHECK_SMALL(u.z - v.z, tolerance);
+		}
+
+		/**
+		 * Checks that each of the components of `u` is within `tolerance` of
+		 * the corresponding component of `v`.
+		 */
+		template <typename T>
+		void checkClose(const TVector4<T>& u, const TVector4<T>& v, T tolerance)
+		{
+			BOOST_CHECK_SMALL(u.x - v.x, tolerance);
+			BOOST_CHECK_SMALL(u.y - v.y, tolerance);
+			BOOST_CHECK_SMALL(u.z - v.z, tolerance);
+			BOOST_CHECK_SMALL(u.w - v.w, tolerance);
+		}
+
+		/**
+		 * Checks that each entry of `A` is within `tolerance` of the
+		 * corresponding entry of `B`.
+		 */
+		template <typename T>
+		void checkClose(const TMatrix4<T>& A, const TMatrix4<T>& B, T tolerance)
+		{
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				BOOST_CHECK_SMALL(A[i] - B[i], tolerance);
+			}
+		}
+
+		/**
+		 * Checks that each of the entries of `A` is within `tolerance` of the
+		 * corresponding entry of the first three rows of `B`.
+		 */
+		template <typename T>
+		void checkClose(const TAffine3<T>& A, const TMatrix4<T>& B, T tolerance)
+		{
+			for (std::size_t i = 0; i < 12; ++i)
+			{
+				BOOST_CHECK_SMALL(A[i] - B[i], tolerance);
+			}
+		}
+
+		/**
+		 * Checks that the corners of `a` are within `tolerance` of the
+		 * corresponding corners of `b`.
+		 */
+		template <typename T>
+		void checkClose(const TAABB<T>& a, const TAABB<T>& b, T tolerance)
+		{
+			checkClose(a.min, b.min, tolerance);
+			checkClose(a.max, b.max, tolerance);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,155 @@
+#include <M3D/TransformHierarchy.hpp>
+#include <M3D/Matrix4.hpp>
+#include <M3D/Quaternion.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace M3D;
+
+namespace
+{
+	/**
+	 * Returns the local transform of a node of `hierarchy` as a 4x4 matrix,
+	 * composed in the way of a pointer-linked scene graph.
+	 */
+	Matrix4 localMatrix(const TransformHierarchy& hierarchy, std::size_t node)
+	{
+		return Matrix4::translation(hierarchy.position(node)) * Matrix4(hierarchy.rotation(node)) *
+			Matrix4::scaling(hierarchy.scale(node));
+	}
+
+	/**
+	 * Returns the world transform of a node of `hierarchy` by composing the
+	 * local transforms of its ancestors.
+	 */
+	Matrix4 expectedWorld(const TransformHierarchy& hierarchy, std::size_t node)
+	{
+		Matrix4 M = localMatrix(hierarchy, node);
+		for (std::size_t p = hierarchy.parent(node); p != TransformHierarchy::NO_PARENT; p = hierarchy.parent(p))
+		{
+			M = localMatrix(hierarchy, p) * M;
+		}
+
+		return M;
+	}
+
+	/**
+	 * Checks that the world transform of every node is within `tolerance` of
+	 * that composed from the local transforms.
+	 */
+	void checkWorlds(const TransformHierarchy& hierarchy, float tolerance)
+	{
+		for (std::size_t node = 0; node < hierarchy.size(); ++node)
+		{
+			const Matrix4 expected = expectedWorld(hierarchy, node);
+			const Matrix4 actual = hierarchy.worldMatrix(node);
+			for (std::size_t i = 0; i < 16; ++i)
+			{
+				BOOST_CHECK_SMALL(actual[i] - expected[i], tolerance);
+			}
+		}
+	}
+
+	/**
+	 * Builds a hierarchy of a lone root and a deep tree under a second root,
+	 * with varied local transforms.
+	 */
+	TransformHierarchy buildHierarchy()
+	{
+		TransformHierarchy hierarchy;
+		for (std::size_t i = 0; i < 20; ++i)
+		{
+			const float k = static_cast<float>(i);
+			const std::size_t parent = i < 2 ? TransformHierarchy::NO_PARENT : (i % 3 == 0 ? i - 2 : i - 1);
+			hierarchy.add(parent,
+				Vector3(std::sin(k), 0.5f * k, std::cos(k)),
+				Quaternion::euler(Vector3(0.3f * k, std::sin(k), 0.1f)),
+				Vector3(1.0f + 0.05f * k, 1.0f, 0.9f));
+		}
+
+		return hierarchy;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(TransformHierarchy_Test_Suite)
+
+/**
+ * Test that nodes are added after their parents with the local transforms
+ * given.
+ */
+BOOST_AUTO_TEST_CASE(TestAdd)
+{
+	TransformHierarchy hierarchy;
+	BOOST_CHECK_EQUAL(hierarchy.size(), 0u);
+	BOOST_CHECK_EQUAL(hierarchy.update(), 0u);
+
+	const std::size_t root = hierarchy.add(TransformHierarchy::NO_PARENT);
+	const std::size_t child = hierarchy.add(root, Vector3(1.0f, 2.0f, 3.0f));
+	BOOST_CHECK_EQUAL(root, 0u);
+	BOOST_CHECK_EQUAL(child, 1u);
+	BOOST_CHECK_EQUAL(hierarchy.size(), 2u);
+	BOOST_CHECK_EQUAL(hierarchy.parent(root), TransformHierarchy::NO_PARENT);
+	BOOST_CHECK_EQUAL(hierarchy.parent(child), root);
+	BOOST_CHECK(hierarchy.position(child) == Vector3(1.0f, 2.0f, 3.0f));
+	BOOST_CHECK(hierarchy.rotation(child) == Quaternion());
+	BOOST_CHECK(hierarchy.scale(child) == Vector3(1.0f, 1.0f, 1.0f));
+	BOOST_CHECK(hierarchy.isDirty(root));
+	BOOST_CHECK(hierarchy.isDirty(child));
+}
+
+/**
+ * Test that the world transforms equal the products of the local transforms
+ * of the ancestors.
+ */
+BOOST_AUTO_TEST_CASE(TestUpdate)
+{
+	TransformHierarchy hierarchy = buildHierarchy();
+	BOOST_CHECK_EQUAL(hierarchy.update(), hierarchy.size());
+	for (std::size_t node = 0; node < hierarchy.size(); ++node)
+	{
+		BOOST_CHECK(!hierarchy.isDirty(node));
+	}
+
+	checkWorlds(hierarchy, 1e-4f);
+
+	const Affine3& world = hierarchy.world(1);
+	const Vector3 point = world.transformPoint(Vector3(0.0f, 0.0f, 0.0f));
+	BOOST_CHECK(point == hierarchy.position(1));
+}
+
+/**
+ * Test that an update recomputes only the changed nodes and their
+ * descendants.
+ */
+BOOST_AUTO_TEST_CASE(TestDirtyPropagation)
+{
+	TransformHierarchy hierarchy = buildHierarchy();
+	hierarchy.update();
+	BOOST_CHECK_EQUAL(hierarchy.update(), 0u);
+
+	// Node 19 is a leaf, so only it is recomputed.
+	hierarchy.setPosition(19, Vector3(5.0f, 0.0f, 0.0f));
+	BOOST_CHECK(hierarchy.isDirty(19));
+	BOOST_CHECK_EQUAL(hierarchy.update(), 1u);
+	checkWorlds(hierarchy, 1e-4f);
+
+	// Node 16 has the descendants 17, 18 and 19.
+	hierarchy.setRotation(16, Quaternion::angleAxis(1.0f, Vector3(0.0f, 0.0f, 1.0f)));
+	BOOST_CHECK_EQUAL(hierarchy.update(), 4u);
+	checkWorlds(hierarchy, 1e-4f);
+
+	// Every other node descends from node 1, so changing it recomputes all
+	// but the other root.
+	hierarchy.setScale(1, Vector3(2.0f, 2.0f, 2.0f));
+	BOOST_CHECK_EQUAL(hierarchy.update(), hierarchy.size() - 1);
+	checkWorlds(hierarchy, 1e-4f);
+
+	hierarchy.setLocal(0, Vector3(), Quaternion(), Vector3(3.0f, 3.0f, 3.0f));
+	BOOST_CHECK_EQUAL(hierarchy.update(), 1u);
+	checkWorlds(hierarchy, 1e-4f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,31 @@
+#include <M3D/Triangle.hpp>
+#include <M3D/AABB.hpp>
+#include <M3D/Plane.hpp>
+#include <M3D/Vector3.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace M3D;
+
+BOOST_AUTO_TEST_SUITE(Triangle_Test_Suite)
+
+/**
+ * Test the normal, area, plane and bounds of a triangle.
+ */
+BOOST_AUTO_TEST_CASE(TestProperties)
+{
+	const Triangle triangle(Vector3(1.0f, 0.0f, 1.0f), Vector3(3.0f, 0.0f, 1.0f), Vector3(1.0f, 4.0f, 1.0f));
+
+	BOOST_CHECK_EQUAL(triangle.normal(), Vector3(0.0f, 0.0f, 1.0f));
+	BOOST_CHECK_CLOSE(triangle.area(), 4.0f, 1e-4f);
+	BOOST_CHECK_EQUAL(triangle.plane(), Plane(Vector3(0.0f, 0.0f, 1.0f), -1.0f));
+
+	const AABB bounds = triangle.bounds();
+	BOOST_CHECK_EQUAL(bounds.min, Vector3(1.0f, 0.0f, 1.0f));
+	BOOST_CHECK_EQUAL(bounds.max, Vector3(3.0f, 4.0f, 1.0f));
+
+	BOOST_CHECK_EQUAL(Triangle(Triangled(triangle)), triangle);
+	BOOST_CHECK(Triangle(triangle.b, triangle.a, triangle.c) != triangle);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
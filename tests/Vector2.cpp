@@ -324,4 +324,16 @@ BOOST_AUTO_TEST_CASE(TestDistance3)
 	BOOST_CHECK_CLOSE(distance(v1, v2), std::sqrt(58.0f), 1e-3);
 }
 
+/**
+ * Test that vectors can be constructed and combined in constant expressions.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	constexpr Vector2 v = Vector2::UP * 2.0f + Vector2::RIGHT - Vector2(0.5f, 0.5f) / 2.0f;
+	static_assert(v.x == 0.75f && v.y == 1.75f, "Vector2 arithmetic should be constexpr");
+	static_assert(dot(Vector2::ONE, v) == 2.5f, "dot() should be constexpr");
+	static_assert(Vector2(3.0f, 4.0f).sqrMagnitude() == 25.0f, "sqrMagnitude() should be constexpr");
+	BOOST_CHECK_EQUAL(v, Vector2(0.75f, 1.75f));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -516,4 +516,37 @@ BOOST_AUTO_TEST_CASE(TestDistance3)
 	BOOST_CHECK_CLOSE(distance(v1, v2), 11.0f, 1e-3);
 }
 
+/**
+ * Test that double precision vectors keep small offsets far from the origin,
+ * where single precision cannot represent them.
+ */
+BOOST_AUTO_TEST_CASE(TestDoublePrecision)
+{
+	const Vector3d origin(1e8, -1e8, 1e8);
+	const Vector3d offset(0.25, 0.5, 0.125);
+
+	const Vector3d delta = (origin + offset) - origin;
+	BOOST_CHECK_EQUAL(delta.x, 0.25);
+	BOOST_CHECK_EQUAL(delta.y, 0.5);
+	BOOST_CHECK_EQUAL(delta.z, 0.125);
+	BOOST_CHECK_CLOSE(distance(origin + offset, origin), offset.magnitude(), 1e-9);
+
+	// The converting constructor rounds each component to single precision.
+	const Vector3 v(origin + offset);
+	BOOST_CHECK_EQUAL(v.x, static_cast<float>(1e8 + 0.25));
+}
+
+/**
+ * Test that vectors can be constructed and combined in constant expressions.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	constexpr Vector3 v = cross(Vector3::RIGHT, Vector3::UP) * 2.0f - Vector3::ONE;
+	static_assert(v.x == -1.0f && v.y == -1.0f && v.z == 1.0f, "Vector3 arithmetic should be constexpr");
+	static_assert(dot(v, Vector3::FORWARD) == 1.0f, "dot() should be constexpr");
+	static_assert(lerp(Vector3::ZERO, Vector3(2.0f, 4.0f, 6.0f), 0.5f).y == 2.0f, "lerp() should be constexpr");
+	static_assert(Vector3(Vector4(1.0f, 2.0f, 3.0f, 4.0f)).z == 3.0f, "Conversion should be constexpr");
+	BOOST_CHECK_EQUAL(v, Vector3(-1.0f, -1.0f, 1.0f));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -329,4 +329,15 @@ BOOST_AUTO_TEST_CASE(TestDistance3)
 	BOOST_CHECK_CLOSE(distance(v1, v2), 11.0f, 1e-3);
 }
 
+/**
+ * Test that vectors can be constructed and combined in constant expressions.
+ */
+BOOST_AUTO_TEST_CASE(TestConstexpr)
+{
+	constexpr Vector4 v = Vector4::FORWARD * 3.0f + -Vector4::ONE;
+	static_assert(v.z == 2.0f && v.w == -1.0f, "Vector4 arithmetic should be constexpr");
+	static_assert(dot(v, Vector4::ONE) == -1.0f, "dot() should be constexpr");
+	BOOST_CHECK_EQUAL(v, Vector4(-1.0f, -1.0f, 2.0f, -1.0f));
+}
+
 BOOST_AUTO_TEST_SUITE_END()